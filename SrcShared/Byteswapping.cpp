@@ -486,3 +486,83 @@ void Byteswap (SED1375RegsType& p)
 }
 
 #endif	// BYTESWAP
+
+
+#if WORDSWAP_MEMORY
+
+#if defined (__AVX2__)
+	#define WORDSWAP_AVX2	1
+	#include <immintrin.h>
+#else
+	#define WORDSWAP_AVX2	0
+#endif
+
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define WORDSWAP_SSE2	1
+	#include <emmintrin.h>
+#else
+	#define WORDSWAP_SSE2	0
+#endif
+
+
+// Swap each pair of bytes from src into dest.  src and dest may be the same
+// buffer (each block is loaded before it's stored), but may not otherwise
+// overlap.  A trailing odd byte is copied as-is.
+
+static void PrvSwapWords (uint8* dest, const uint8* src, unsigned long length)
+{
+	unsigned long	ii = 0;
+
+#if WORDSWAP_AVX2
+	for (; ii + 32 <= length; ii += 32)
+	{
+		__m256i	v = _mm256_loadu_si256 ((const __m256i*) (src + ii));
+		v = _mm256_or_si256 (_mm256_slli_epi16 (v, 8), _mm256_srli_epi16 (v, 8));
+		_mm256_storeu_si256 ((__m256i*) (dest + ii), v);
+	}
+#endif
+
+#if WORDSWAP_SSE2
+	for (; ii + 16 <= length; ii += 16)
+	{
+		__m128i	v = _mm_loadu_si128 ((const __m128i*) (src + ii));
+		v = _mm_or_si128 (_mm_slli_epi16 (v, 8), _mm_srli_epi16 (v, 8));
+		_mm_storeu_si128 ((__m128i*) (dest + ii), v);
+	}
+#endif
+
+	for (; ii + 2 <= length; ii += 2)
+	{
+		uint8	hi = src[ii];
+		uint8	lo = src[ii + 1];
+
+		dest[ii]		= lo;
+		dest[ii + 1]	= hi;
+	}
+
+	if (ii < length)
+	{
+		dest[ii] = src[ii];
+	}
+}
+
+
+void ByteswapWords (void* start, unsigned long length)
+{
+	::PrvSwapWords ((uint8*) start, (const uint8*) start, length);
+}
+
+
+void ByteswapWordsCopy (void* dest, const void* src, unsigned long length)
+{
+	::PrvSwapWords ((uint8*) dest, (const uint8*) src, length);
+}
+
+#else
+
+void ByteswapWordsCopy (void* dest, const void* src, unsigned long length)
+{
+	memcpy (dest, src, length);
+}
+
+#endif	// WORDSWAP_MEMORY
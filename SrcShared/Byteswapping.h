@@ -153,15 +153,7 @@ void Byteswap (SED1375RegsType& p);
 
 #if WORDSWAP_MEMORY
 
-	inline void ByteswapWords (void* start, unsigned long length)
-	{
-		for (unsigned long ii = 0; ii < length / 2; ++ii)
-		{
-			unsigned short*	p = ((unsigned short*) start) + ii;
-			unsigned char*	bp = (unsigned char*) p;
-			*p = (((unsigned short) *bp) << 8) | (unsigned short) (*(bp + 1));
-		}
-	}
+	void ByteswapWords (void* start, unsigned long length);
 
 #else
 
@@ -171,5 +163,11 @@ void Byteswap (SED1375RegsType& p);
 
 #endif	// WORDSWAP_MEMORY
 
+// Copy a buffer, converting between emulated and host memory layout along
+// the way (that is, swapping each pair of bytes if WORDSWAP_MEMORY).  Lets
+// callers save emulated memory without swapping it in place and back.
+
+void ByteswapWordsCopy (void* dest, const void* src, unsigned long length);
+
 #endif /* _BYTESWAPPING_H_ */
 
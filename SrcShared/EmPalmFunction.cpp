@@ -14,7 +14,7 @@
 #include "EmCommon.h"
 #include "EmPalmFunction.h"
 
-#include "EmBankROM.h"			// EmBankROM::GetMemoryStart
+#include "EmBankROM.h"			// EmBankROM::GetMemoryStart, GetImageSize
 #include "EmLowMem.h"			// LowMem_GetGlobal
 #include "EmMemory.h"			// CEnableFullAccess, EmMem_strcpy, EmMem_memcmp
 #include "EmPalmHeap.h"			// EmPalmHeap
@@ -23,7 +23,9 @@
 #include "Platform.h"			// Platform::GetString
 #include "Strings.r.h"			// kStr_INetLibTrapBase
 
+#include <algorithm>			// upper_bound
 #include <ctype.h>				// isalnum, toupper
+#include <map>					// map
 
 const UInt16	kMagicRefNum	= 0x666;	// See comments in HtalLibSendReply.
 
@@ -74,6 +76,19 @@ const uint8	kCerticomMemCpyPattern [] =
 };
 
 
+class EmFunctionRange;
+
+// Entry in the table of ROM functions we track, sorted by fBegin.
+
+struct EmFunctionIndexEntry
+{
+	emuptr				fBegin;
+	emuptr				fEnd;
+	EmFunctionRange*	fRange;
+};
+
+typedef vector<EmFunctionIndexEntry>	EmFunctionIndex;
+
 class EmFunctionRange
 {
 	public:
@@ -84,18 +99,39 @@ class EmFunctionRange
 
 		Bool					HasRange		(void) { return fBegin != EmMemNULL; }
 
+		static void				ResetIndex		(void);
+
 	private:
 		void					GetRange		(emuptr addr);
 
+		static Bool				IndexCovers		(emuptr addr);
+		static void				BuildIndex		(emuptr romStart, uint32 romSize);
+		static EmFunctionRange*	FindInIndex		(emuptr addr);
+
 		const char*				fName;
 		emuptr					fBegin;
 		emuptr					fEnd;
 
 		EmFunctionRange*		fNext;
 		static EmFunctionRange*	fgRoot;
+
+		static EmFunctionIndex	fgIndex;
+		static emuptr			fgIndexROMStart;
+		static uint32			fgIndexROMSize;
+		static emuptr			fgIndexEnd;
 };
 
 EmFunctionRange*	EmFunctionRange::fgRoot;
+EmFunctionIndex		EmFunctionRange::fgIndex;
+emuptr				EmFunctionRange::fgIndexROMStart;
+uint32				EmFunctionRange::fgIndexROMSize;
+emuptr				EmFunctionRange::fgIndexEnd;
+
+// Bytes at the end of the ROM image that aren't indexed, so that
+// reading a trailing Macsbug name can't run off the end of the image.
+// Addresses in this area are handled by scanning, as for RAM.
+
+const uint32	kFunctionIndexSlop	= 0x0200;
 
 // Define a bunch of EmFunctionRange objects to search for and
 // cache function ranges.
@@ -114,6 +150,7 @@ FOR_EACH_FUNCTION(DEFINE_FUNCTION)
 
 
 static string	PrvGetShortName (const char*, int len);
+static bool		PrvIndexEntryAfter (emuptr, const EmFunctionIndexEntry&);
 
 
 /***********************************************************************
@@ -135,6 +172,8 @@ void EmPalmFunctionInit (void)
 	g##fn_name.Reset ();
 
 FOR_EACH_FUNCTION(RESET_OBJECT)
+
+	EmFunctionRange::ResetIndex ();
 }
 
 
@@ -179,6 +218,14 @@ EmFunctionRange::EmFunctionRange (const char* functionName) :
 
 Bool EmFunctionRange::InRange (emuptr addr)
 {
+	// Functions in ROM are looked up in the index built from a single
+	// scan of the image, rather than by searching around the address.
+
+	if (EmFunctionRange::IndexCovers (addr))
+	{
+		return EmFunctionRange::FindInIndex (addr) == this;
+	}
+
 	// It's not in our range if it's in someone else's.
 	// This is an optimization.
 
@@ -313,6 +360,205 @@ void EmFunctionRange::GetRange (emuptr addr)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	EmFunctionRange::ResetIndex
+ *
+ * DESCRIPTION:	Forget the index of ROM functions.  It will be rebuilt
+ *				the next time an address in ROM is tested.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmFunctionRange::ResetIndex (void)
+{
+	fgIndex.clear ();
+
+	fgIndexROMStart	= EmMemNULL;
+	fgIndexROMSize	= 0;
+	fgIndexEnd		= EmMemNULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFunctionRange::IndexCovers
+ *
+ * DESCRIPTION:	Determine whether or not the given address can be
+ *				looked up in the index of ROM functions, building the
+ *				index if the ROM has been loaded or moved since it
+ *				was last built.
+ *
+ * PARAMETERS:	addr - address to test.
+ *
+ * RETURNED:	True if FindInIndex can be used for this address.
+ *
+ ***********************************************************************/
+
+Bool EmFunctionRange::IndexCovers (emuptr addr)
+{
+	emuptr	romStart	= EmBankROM::GetMemoryStart ();
+	uint32	romSize		= EmBankROM::GetImageSize ();
+
+	if (addr < romStart || addr - romStart >= romSize)
+		return false;
+
+	if (romStart != fgIndexROMStart || romSize != fgIndexROMSize)
+	{
+		EmFunctionRange::BuildIndex (romStart, romSize);
+	}
+
+	return addr < fgIndexEnd;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFunctionRange::BuildIndex
+ *
+ * DESCRIPTION:	Walk the ROM image once, finding the bounds and names
+ *				of all the functions in it the same way FindFunctionName
+ *				does, and remember the ones tracked by EmFunctionRange
+ *				objects.
+ *
+ * PARAMETERS:	romStart - address at which the ROM image is mapped.
+ *
+ *				romSize - size of the ROM image.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmFunctionRange::BuildIndex (emuptr romStart, uint32 romSize)
+{
+	EmFunctionRange::ResetIndex ();
+
+	fgIndexROMStart	= romStart;
+	fgIndexROMSize	= romSize;
+
+	if (romSize <= kFunctionIndexSlop)
+		return;
+
+	CEnableFullAccess	munge;	// Remove blocks on memory access.
+
+	if (!EmMemCheckAddress (romStart, romSize))
+		return;
+
+	// Map both the full names and the "fixed 8" Macsbug names to the
+	// objects that track them.  Full names take precedence.
+
+	typedef map<string, EmFunctionRange*>	NameMap;
+
+	NameMap				names;
+	EmFunctionRange*	certicom = NULL;
+	EmFunctionRange*	range;
+
+	for (range = fgRoot; range; range = range->fNext)
+	{
+		names.insert (NameMap::value_type (range->fName, range));
+
+		if (strcmp ("_CerticomMemCpy", range->fName) == 0)
+			certicom = range;
+	}
+
+	for (range = fgRoot; range; range = range->fNext)
+	{
+		names.insert (NameMap::value_type (::PrvGetShortName (range->fName, 8), range));
+	}
+
+	// A function extends from just past the Macsbug name (and constant
+	// data) following the previous end-of-function sequence up to and
+	// including its own end-of-function sequence.  Everything before the
+	// first end-of-function sequence is skipped, as FindFunctionStart
+	// would fail to find its start.
+
+	emuptr	indexEnd	= romStart + romSize - kFunctionIndexSlop;
+	emuptr	begin		= EmMemNULL;
+
+	for (emuptr addr = romStart + 6; addr < indexEnd; addr += 2)
+	{
+		if (!::EndOfFunctionSequence (addr))
+			continue;
+
+		emuptr	end = addr + 2;
+		emuptr	next;
+		char	name[80];
+
+		::GetMacsbugInfo (end, name, sizeof (name), &next);
+
+		if (begin != EmMemNULL && begin < end)
+		{
+			range = NULL;
+
+			NameMap::iterator	iter = names.find (name);
+			if (iter != names.end ())
+			{
+				range = iter->second;
+			}
+
+			// Check to see if it looks like this is the function the
+			// Certicom Encryption library uses to copy "random" data.
+
+			else if (certicom && end - begin == sizeof (kCerticomMemCpyPattern) &&
+				EmMem_memcmp (begin, (void*) kCerticomMemCpyPattern, end - begin) == 0)
+			{
+				range = certicom;
+			}
+
+			if (range)
+			{
+				EmFunctionIndexEntry	entry;
+
+				entry.fBegin	= begin;
+				entry.fEnd		= end;
+				entry.fRange	= range;
+
+				fgIndex.push_back (entry);
+			}
+		}
+
+		begin = next;
+	}
+
+	fgIndexEnd = indexEnd;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmFunctionRange::FindInIndex
+ *
+ * DESCRIPTION:	Find the tracked ROM function containing the given
+ *				address.  The caller must have made sure the index
+ *				covers the address.
+ *
+ * PARAMETERS:	addr - address to look up.
+ *
+ * RETURNED:	The object tracking the function, or NULL if the
+ *				address isn't in a tracked function.
+ *
+ ***********************************************************************/
+
+EmFunctionRange* EmFunctionRange::FindInIndex (emuptr addr)
+{
+	EmFunctionIndex::iterator	iter = upper_bound (fgIndex.begin (),
+		fgIndex.end (), addr, PrvIndexEntryAfter);
+
+	if (iter == fgIndex.begin ())
+		return NULL;
+
+	--iter;
+
+	if (addr >= iter->fEnd)
+		return NULL;
+
+	return iter->fRange;
+}
+
+
 
 
 /***********************************************************************
@@ -2044,3 +2290,24 @@ string PrvGetShortName (const char* srcName, int destLen)
 
 	return result;
 }
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvIndexEntryAfter
+ *
+ * DESCRIPTION:	Comparison function for upper_bound when searching the
+ *				index of ROM functions.
+ *
+ * PARAMETERS:	addr - address being looked up.
+ *
+ *				entry - index entry to compare against.
+ *
+ * RETURNED:	True if the entry starts after the address.
+ *
+ ***********************************************************************/
+
+bool PrvIndexEntryAfter (emuptr addr, const EmFunctionIndexEntry& entry)
+{
+	return addr < entry.fBegin;
+}
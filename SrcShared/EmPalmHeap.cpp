@@ -22,6 +22,7 @@
 #include "ROMStubs.h"			// MemNumHeaps, MemHeapID, MemHeapPtr
 #include "SessionFile.h"		// SessionFile
 
+#include <algorithm>			// upper_bound
 #include <stdio.h>				// sprintf
 
 
@@ -31,6 +32,11 @@
 
 EmPalmHeapList	EmPalmHeap::fgHeapList;
 
+static bool PrvStartsAfter (emuptr p, const EmPalmChunk& chunk)
+{
+	return p < chunk.Start ();
+}
+
 
 /***********************************************************************
  *
@@ -386,6 +392,13 @@ void EmPalmHeap::MemHeapInit (UInt16 heapID, Int16, Boolean)
  * DESCRIPTION:	All of these functions alter the heap in some way.
  *				Resync our notion of the state of the heap with reality.
  *
+ *				Those that allocate, free, or resize a single chunk
+ *				tell the heap object which chunk that was, so that
+ *				only that part of the heap needs to be re-walked.
+ *				Those that can rearrange the whole heap (compacting,
+ *				scrambling, freeing everything owned by a particular
+ *				owner) re-walk the whole thing.
+ *
  * PARAMETERS:	Parameters to the Memory Manager functions that altered
  *				the heap.
  *
@@ -420,65 +433,77 @@ void EmPalmHeap::MemHeapScramble (UInt16 heapID, EmPalmChunkList* delta)
 
 void EmPalmHeap::MemChunkNew (UInt16 heapID, MemPtr p, UInt16 attr, EmPalmChunkList* delta)
 {
-	UNUSED_PARAM (p);
-	UNUSED_PARAM (attr);
-
 	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByID (heapID));
 
 	if (heap)
-		heap->ResyncAll (delta);
+	{
+		// Unless the chunk is non-movable or pre-locked, we were
+		// handed back a handle rather than a pointer.
+
+		if (!(attr & (memNewChunkFlagNonMovable | memNewChunkFlagPreLock)))
+			p = DerefHandle ((MemHandle) p);
+
+		heap->ResyncChunks (EmMemNULL, (emuptr) p, delta);
+	}
 }
 
-void EmPalmHeap::MemChunkFree (EmPalmHeap* heap, EmPalmChunkList* delta)
+void EmPalmHeap::MemChunkFree (EmPalmHeap* heap, MemPtr p, EmPalmChunkList* delta)
 {
 //	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByPtr (p));
 
 	if (heap)
-		heap->ResyncAll (delta);
+		heap->ResyncChunks ((emuptr) p, EmMemNULL, delta);
 }
 
 void EmPalmHeap::MemPtrNew (MemPtr p, EmPalmChunkList* delta)
 {
-	UNUSED_PARAM (p);
 //	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByPtr (p));
 	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByID (0));
 
 	if (heap)
-		heap->ResyncAll (delta);
+		heap->ResyncChunks (EmMemNULL, (emuptr) p, delta);
 }
 
 void EmPalmHeap::MemPtrResize (MemPtr p, EmPalmChunkList* delta)
 {
 	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByPtr (p));
 
+	// Pointers don't move when resized, so there's only the one
+	// place in the heap to look at.
+
 	if (heap)
-		heap->ResyncAll (delta);
+		heap->ResyncChunks (EmMemNULL, (emuptr) p, delta);
 }
 
 void EmPalmHeap::MemHandleNew (MemHandle h, EmPalmChunkList* delta)
 {
-	UNUSED_PARAM (h);
 //	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByHdl (h));
 	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByID (0));
 
 	if (heap)
-		heap->ResyncAll (delta);
+		heap->ResyncChunks (EmMemNULL, (emuptr) DerefHandle (h), delta);
 }
 
 void EmPalmHeap::MemHandleResize (MemHandle h, EmPalmChunkList* delta)
 {
 	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByHdl (h));
 
+	// The handle may have been moved to make room for it to grow,
+	// so look at where it was as well as where it is now.
+
 	if (heap)
-		heap->ResyncAll (delta);
+		heap->ResyncChunks (heap->GetMasterPtr (h), (emuptr) DerefHandle (h), delta);
 }
 
-void EmPalmHeap::MemHandleFree (EmPalmHeap* heap, EmPalmChunkList* delta)
+void EmPalmHeap::MemHandleFree (EmPalmHeap* heap, MemHandle h, EmPalmChunkList* delta)
 {
 //	EmPalmHeap*	heap = const_cast <EmPalmHeap*> (GetHeapByHdl (h));
 
+	// The master pointer has been cleared by now, but we still
+	// know where it used to point.
+
 	if (heap)
-		heap->ResyncAll (delta);
+		heap->ResyncChunks (heap->GetMasterPtr (h), EmMemNULL, delta);
 }
 
 void EmPalmHeap::MemLocalIDToLockedPtr (MemPtr p, EmPalmChunkList* delta)
@@ -842,7 +867,8 @@ EmPalmHeap::EmPalmHeap (const EmPalmHeap& other) :
 	fFirstFree (other.fFirstFree),
 	fChunkHdrSize (other.fChunkHdrSize),
 	fChunkList (other.fChunkList),
-	fMPTList (other.fMPTList)
+	fMPTList (other.fMPTList),
+	fMasterPtrs (other.fMasterPtrs)
 {
 }
 
@@ -918,21 +944,9 @@ EmPalmChunkList::const_iterator EmPalmHeap::GetChunkListEnd (void) const
 
 const EmPalmChunk* EmPalmHeap::GetChunkReferencedBy (MemHandle h) const
 {
-	// !!! Could do a binary search here, if needed.
-
 	emuptr	p = (emuptr) EmPalmHeap::DerefHandle (h);
 
-	ITERATE_CHUNKS (*this, iter, end)
-	{
-		if (iter->Contains (p))
-		{
-			return &*iter;
-		}
-
-		++iter;
-	}
-
-	return NULL;
+	return this->GetChunkContaining (p);
 }
 
 
@@ -953,16 +967,11 @@ const EmPalmChunk* EmPalmHeap::GetChunkReferencedBy (MemHandle h) const
 
 const EmPalmChunk* EmPalmHeap::GetChunkContaining (emuptr p) const
 {
-	// !!! Could do a binary search here, if needed.
+	const EmPalmChunk*	chunk = this->FindChunk (p);
 
-	ITERATE_CHUNKS (*this, iter, end)
+	if (chunk && chunk->Contains (p))
 	{
-		if (iter->Contains (p))
-		{
-			return &*iter;
-		}
-
-		++iter;
+		return chunk;
 	}
 
 	return NULL;
@@ -986,22 +995,54 @@ const EmPalmChunk* EmPalmHeap::GetChunkContaining (emuptr p) const
 
 const EmPalmChunk* EmPalmHeap::GetChunkBodyContaining (emuptr p) const
 {
-	// !!! Could do a binary search here, if needed.
+	const EmPalmChunk*	chunk = this->FindChunk (p);
 
-	ITERATE_CHUNKS (*this, iter, end)
+	if (chunk && chunk->BodyContains (p))
 	{
-		if (iter->BodyContains (p))
-		{
-			return &*iter;
-		}
-
-		++iter;
+		return chunk;
 	}
 
 	return NULL;
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmHeap::FindChunk
+ *
+ * DESCRIPTION:	Binary search our list of chunks for the last one
+ *				starting at or before the given pointer.  Since the
+ *				chunks are contiguous, that's the only one that can
+ *				contain it.
+ *
+ *				This relies on fChunkList being sorted by address,
+ *				which it is, since ResyncChunkList builds it by walking
+ *				the heap from start to end.
+ *
+ * PARAMETERS:	p - probe address
+ *
+ * RETURNED:	Pointer to the candidate chunk object.  NULL if p is
+ *				before the first chunk.  The caller should check that
+ *				the chunk actually contains p.
+ *
+ ***********************************************************************/
+
+const EmPalmChunk* EmPalmHeap::FindChunk (emuptr p) const
+{
+	EmPalmChunkList::const_iterator	iter = upper_bound (fChunkList.begin (),
+		fChunkList.end (), p, PrvStartsAfter);
+
+	if (iter == fChunkList.begin ())
+	{
+		return NULL;
+	}
+
+	--iter;
+
+	return &*iter;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	EmPalmHeap::GetMPTListBegin
@@ -1316,9 +1357,12 @@ void EmPalmHeap::ResyncMPTList (void)
 	if (!this->Tracked ())
 		return;
 
+	CEnableFullAccess	munge;	// Remove blocks on memory access.
+
 	emuptr	p = this->MptStart ();
 
 	fMPTList.clear ();
+	fMasterPtrs.clear ();
 
 	while (1)
 	{
@@ -1330,6 +1374,14 @@ void EmPalmHeap::ResyncMPTList (void)
 
 		fMPTList.push_back (mpt);
 
+		// Remember where all the master pointers point.  ResyncMasterPtrs
+		// compares against this to see what chunks have moved.
+
+		for (emuptr mp = mpt.TableStart (); mp < mpt.TableEnd (); mp += sizeof (MemPtr))
+		{
+			fMasterPtrs.push_back (EmMemGet32 (mp));
+		}
+
 		if (mpt.NextTableOffset () == 0)
 			break;
 
@@ -1387,7 +1439,8 @@ void EmPalmHeap::ResyncChunkList (EmPalmChunkList* delta)
 
 		chunk.Validate (*this);
 
-		// Push this guy onto our list.
+		// Push this guy onto our list.  This keeps the list sorted by
+		// address, which FindChunk depends on.
 
 		fChunkList.push_back (chunk);
 
@@ -1401,6 +1454,324 @@ void EmPalmHeap::ResyncChunkList (EmPalmChunkList* delta)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmHeap::ResyncChunks
+ *
+ * DESCRIPTION:	Resynchronize our notion of what memory chunks exist
+ *				in this heap after a single chunk has been allocated,
+ *				freed, or resized.  Only the parts of the heap around
+ *				that chunk are re-walked.
+ *
+ *				If other chunks were moved in the process (the Memory
+ *				Manager will compact the heap if it needs to make
+ *				room), or if we can't otherwise tell what happened,
+ *				the whole heap is re-walked.
+ *
+ *				Does nothing if the heap is not "tracked".
+ *
+ * PARAMETERS:	oldP - pointer to the body of the chunk before the
+ *					change.  EmMemNULL if it was just allocated.
+ *
+ *				newP - pointer to the body of the chunk after the
+ *					change.  EmMemNULL if it was just freed.
+ *
+ *				delta - optional collection to receive the list of
+ *					chunks that are different between the current and
+ *					previous states of the heap.  This collection is
+ *					used when remarking what parts of the heap can be
+ *					accessed by different processes.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmPalmHeap::ResyncChunks (emuptr oldP, emuptr newP, EmPalmChunkList* delta)
+{
+	if (!this->Tracked ())
+		return;
+
+	// If we don't know what chunk changed (say, the allocation failed,
+	// possibly after compacting the heap), or if chunks other than
+	// that one moved, fall back to walking the whole heap.
+
+	if ((oldP == EmMemNULL && newP == EmMemNULL) ||
+		!this->ResyncMasterPtrs (oldP, newP))
+	{
+		this->ResyncAll (delta);
+		return;
+	}
+
+	if (delta)
+		delta->clear ();
+
+	if (oldP != EmMemNULL)
+		this->ResyncChunkRange (oldP, delta);
+
+	if (newP != EmMemNULL && newP != oldP)
+		this->ResyncChunkRange (newP, delta);
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmHeap::ResyncMasterPtrs
+ *
+ * DESCRIPTION:	Re-read the master pointer tables and see if any
+ *				chunks other than the given one have moved.  The
+ *				Memory Manager only moves movable chunks, and it
+ *				always updates their master pointers when it does,
+ *				so this is a cheap way to detect that the heap was
+ *				compacted without walking all of it.
+ *
+ *				Master pointers that change to or from pointing into
+ *				the master pointer tables themselves are links in the
+ *				list of free master pointers, and are not counted.
+ *
+ * PARAMETERS:	oldP, newP - the location of the chunk that is
+ *					expected to have changed, before and after the
+ *					change.  Either may be EmMemNULL.
+ *
+ * RETURNED:	True if nothing else moved and the master pointer
+ *				tables themselves were unchanged.
+ *
+ ***********************************************************************/
+
+Bool EmPalmHeap::ResyncMasterPtrs (emuptr oldP, emuptr newP)
+{
+	EmPalmMPTList	oldMPTList;
+	vector<emuptr>	oldMasterPtrs;
+
+	oldMPTList.swap (fMPTList);
+	oldMasterPtrs.swap (fMasterPtrs);
+
+	this->ResyncMPTList ();
+
+	// If we didn't have a previous copy of the master pointers (for
+	// instance, if we were just loaded from a session file), or if a
+	// table was added or removed, we can't tell what changed.
+
+	if (oldMasterPtrs.size () == 0 ||
+		oldMasterPtrs.size () != fMasterPtrs.size () ||
+		oldMPTList.size () != fMPTList.size ())
+	{
+		return false;
+	}
+
+	for (size_t ii = 0; ii < oldMPTList.size (); ++ii)
+	{
+		if (oldMPTList[ii].Start () != fMPTList[ii].Start () ||
+			oldMPTList[ii].Size () != fMPTList[ii].Size ())
+		{
+			return false;
+		}
+	}
+
+	for (size_t jj = 0; jj < fMasterPtrs.size (); ++jj)
+	{
+		emuptr	before = oldMasterPtrs[jj];
+		emuptr	after = fMasterPtrs[jj];
+
+		if (before == after)
+			continue;
+
+		if (after != EmMemNULL && after != oldP && after != newP &&
+			!this->MptTablesContain (after))
+		{
+			return false;
+		}
+
+		if (before != EmMemNULL && before != oldP && before != newP &&
+			!this->MptTablesContain (before))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmHeap::ResyncChunkRange
+ *
+ * DESCRIPTION:	Re-walk the part of the heap around the given chunk,
+ *				splicing what's found there into our chunk list.
+ *
+ *				The walk starts at the closest allocated chunk before
+ *				the given one; any free chunks in between may have
+ *				been merged with it.  It stops at the first chunk
+ *				after the given one that's the same as the chunk we
+ *				had at that location.  Assuming nothing else in the
+ *				heap moved (see ResyncMasterPtrs), the rest of the
+ *				heap is unchanged from that point on.
+ *
+ *				Note that free chunks that are merely relinked in the
+ *				free chunk list may not be picked up.  CompareForDelta
+ *				ignores such changes, too.
+ *
+ * PARAMETERS:	p - pointer to the body of the chunk that changed.
+ *
+ *				delta - optional collection to which chunks that are
+ *					different from the ones we had before are added.
+ *
+ * RETURNED:	Nothing
+ *
+ ***********************************************************************/
+
+void EmPalmHeap::ResyncChunkRange (emuptr p, EmPalmChunkList* delta)
+{
+	emuptr	target = p - fChunkHdrSize;
+
+	// Find where to start walking.
+
+	EmPalmChunkList::iterator	first = upper_bound (fChunkList.begin (),
+		fChunkList.end (), target, PrvStartsAfter);
+
+	while (first != fChunkList.begin ())
+	{
+		--first;
+
+		if (first->HeaderStart () < target && !first->Free ())
+			break;
+	}
+
+	emuptr	chunkHdr = first != fChunkList.end () ? first->HeaderStart () : this->DataStart ();
+
+	// Walk the heap from there, keeping "last" pointing to the first
+	// of our old chunks that doesn't start before the current one.
+
+	EmPalmChunkList				newChunks;
+	EmPalmChunkList::iterator	last = first;
+
+	while (1)
+	{
+		// Get information about the current chunk.
+
+		EmPalmChunk		chunk (*this, chunkHdr);
+
+		// If the size is zero, we've reached the sentinel at the end.
+
+		if (chunk.Size () == 0)
+		{
+			last = fChunkList.end ();
+			break;
+		}
+
+		while (last != fChunkList.end () && last->HeaderStart () < chunkHdr)
+		{
+			++last;
+		}
+
+		// If we're past the chunk that changed and back in step with
+		// the chunks we had before, we're done.
+
+		if (chunkHdr > target && last != fChunkList.end () &&
+			last->CompareForDelta (chunk))
+		{
+			break;
+		}
+
+		// See if this chunk looks valid.  An exception is thrown if not.
+
+		chunk.Validate (*this);
+
+		newChunks.push_back (chunk);
+
+		// Go on to next chunk.
+
+		chunkHdr += chunk.Size ();
+	}
+
+	// Report what changed, and replace the old chunks with the new ones.
+
+	if (delta)
+	{
+		EmPalmChunkList	oldChunks (first, last);
+		EmPalmChunkList	changed;
+
+		this->GenerateDeltas (oldChunks, newChunks, changed);
+
+		delta->insert (delta->end (), changed.begin (), changed.end ());
+	}
+
+	EmPalmChunkList::iterator	pos = fChunkList.erase (first, last);
+	fChunkList.insert (pos, newChunks.begin (), newChunks.end ());
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmHeap::GetMasterPtr
+ *
+ * DESCRIPTION:	Return the value the given handle's master pointer had
+ *				as of the last time we resynced.  This lets us find
+ *				where a chunk used to be after it's been freed or
+ *				moved.
+ *
+ * PARAMETERS:	h - the handle.
+ *
+ * RETURNED:	The old master pointer value, or EmMemNULL if the
+ *				handle doesn't refer to one of our master pointers.
+ *
+ ***********************************************************************/
+
+emuptr EmPalmHeap::GetMasterPtr (MemHandle h) const
+{
+	if (!h)
+		return EmMemNULL;
+
+	emuptr	mp = (emuptr) memHandleUnProtect (h);
+	size_t	index = 0;
+
+	ITERATE_MPTS (*this, iter, end)
+	{
+		if (iter->TableContains (mp))
+		{
+			index += (mp - iter->TableStart ()) / sizeof (MemPtr);
+
+			if (index < fMasterPtrs.size ())
+				return fMasterPtrs[index];
+
+			break;
+		}
+
+		index += iter->TableSize () / sizeof (MemPtr);
+		++iter;
+	}
+
+	return EmMemNULL;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmHeap::MptTablesContain
+ *
+ * DESCRIPTION:	Return whether or not the given address falls within
+ *				one of our master pointer tables.
+ *
+ * PARAMETERS:	p - probe address
+ *
+ * RETURNED:	True if so.
+ *
+ ***********************************************************************/
+
+Bool EmPalmHeap::MptTablesContain (emuptr p) const
+{
+	ITERATE_MPTS (*this, iter, end)
+	{
+		if (iter->Contains (p))
+			return true;
+
+		++iter;
+	}
+
+	return false;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	EmPalmHeap::ResyncPtr
@@ -1433,12 +1804,15 @@ void EmPalmHeap::ResyncPtr (MemPtr p, EmPalmChunkList* delta)
 	if (!this->Tracked ())
 		return;
 
-	EmPalmChunkList::iterator	iter = fChunkList.begin ();
-
 	emuptr	chunkStart = ((emuptr) p) - fChunkHdrSize;
-	
-	while (iter != fChunkList.end ())
+
+	EmPalmChunkList::iterator	iter = upper_bound (fChunkList.begin (),
+		fChunkList.end (), chunkStart, PrvStartsAfter);
+
+	if (iter != fChunkList.begin ())
 	{
+		--iter;
+
 		if (iter->HeaderStart () == chunkStart)
 		{
 			*iter = EmPalmChunk (*this, chunkStart);
@@ -1448,8 +1822,6 @@ void EmPalmHeap::ResyncPtr (MemPtr p, EmPalmChunkList* delta)
 
 			return;
 		}
-
-		++iter;
 	}
 
 	EmAssert (false);
@@ -1996,7 +2368,7 @@ Bool EmPalmChunk::CompareForDelta (const EmPalmChunk& lhs) const
 		fSize				== lhs.fSize			&&
 		(fLockCount > 0)	== (lhs.fLockCount > 0)	&&
 //		fOwner				== lhs.fOwner			&&
-		fHOffset			== lhs.fHOffset;
+		(fFree || fHOffset	== lhs.fHOffset);	// Free chunks use this to link the free list
 }
 
 
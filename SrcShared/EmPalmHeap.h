@@ -80,6 +80,7 @@ class EmPalmHeap
 														 UInt16 attributes,
 														 EmPalmChunkList* = NULL);
 		static void				MemChunkFree			(EmPalmHeap* heap,
+														 MemPtr,
 														 EmPalmChunkList* = NULL);
 
 		static void				MemPtrNew				(MemPtr,
@@ -92,6 +93,7 @@ class EmPalmHeap
 		static void				MemHandleResize			(MemHandle,
 														 EmPalmChunkList* = NULL);
 		static void				MemHandleFree			(EmPalmHeap* heap,
+														 MemHandle,
 														 EmPalmChunkList* = NULL);
 
 		static void				MemLocalIDToLockedPtr	(MemPtr,
@@ -194,6 +196,13 @@ class EmPalmHeap
 		void					ResyncAll				(EmPalmChunkList* delta);
 		void					ResyncMPTList			(void);
 		void					ResyncChunkList			(EmPalmChunkList* delta);
+		void					ResyncChunks			(emuptr oldP,
+														 emuptr newP,
+														 EmPalmChunkList* delta);
+		Bool					ResyncMasterPtrs		(emuptr oldP,
+														 emuptr newP);
+		void					ResyncChunkRange		(emuptr p,
+														 EmPalmChunkList* delta);
 		void					ResyncPtr				(MemPtr,
 														 EmPalmChunkList* delta);
 		void					ResyncHdl				(MemHandle,
@@ -203,6 +212,10 @@ class EmPalmHeap
 														 const EmPalmChunkList& newList,
 														 EmPalmChunkList& delta);
 
+		const EmPalmChunk*		FindChunk				(emuptr) const;
+		emuptr					GetMasterPtr			(MemHandle) const;
+		Bool					MptTablesContain		(emuptr) const;
+
 
 	private:
 		friend EmStream& operator << (EmStream&, const EmPalmHeap&);
@@ -222,6 +235,7 @@ class EmPalmHeap
 
 		EmPalmChunkList			fChunkList;
 		EmPalmMPTList			fMPTList;
+		vector<emuptr>			fMasterPtrs;		// Contents of the MPTs as of the last resync
 };
 
 
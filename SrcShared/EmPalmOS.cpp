@@ -38,6 +38,8 @@
 #include "ROMStubs.h"			// IntlSetStrictChecks
 #include "UAE.h"				// CHECK_STACK_POINTER_DECREMENT
 
+#include <algorithm>			// sort, upper_bound
+
 #include "EmEventPlayback.h"	// EmEventPlayback::Initialize ();
 #include "EmLowMem.h"			// EmLowMem::Initialize ();
 #include "EmPalmFunction.h"		// EmPalmFunctionInit ();
@@ -48,12 +50,13 @@
 
 #define LOG_FUNCTION_CALLS 0
 
-static StackList			gStackList;
+static StackList			gStackList;		// Sorted by fBottom; no two stacks overlap.
 static StackRange			gBootStack;
 static StackRange			gKernelStack;
 static StackRange			gInterruptStack;
 
 static emuptr				gBigROMEntry;
+static Bool					gCallHooksInstalled;
 
 static const uint32			CJ_TAGAMX	= 0x414D5800;
 static const uint32			CJ_TAGFENCE	= 0x55555555;
@@ -72,6 +75,16 @@ static const uint32			CJ_TAGFENCE	= 0x55555555;
 static const int	kInterruptOverhead = 34;
 static emuptr		gStackLowWaterMark = 0;
 
+// Bottom of the current stack; gStackHigh is its top.  Cached so that
+// CheckStackPointerAssignment can quickly see if the stack pointer is
+// still in the same stack.
+
+static Bool			gHaveCurrentStack = false;
+static emuptr		gStackBottom = 0;
+
+static StackList::iterator	PrvFindStack			(emuptr);
+static void					PrvForgetCurrentStack	(emuptr stackBottom);
+
 
 /***********************************************************************
  *
@@ -94,14 +107,17 @@ void EmPalmOS::Initialize (void)
 
 	gCPU68K->InstallHookException	(kException_SysCall,  HandleTrap15);
 
-	gCPU68K->InstallHookJSR			(HandleJSR);
 	gCPU68K->InstallHookJSR_Ind		(HandleJSR_Ind);
-	gCPU68K->InstallHookLINK		(HandleLINK);
-	gCPU68K->InstallHookRTE			(HandleRTE);
-	gCPU68K->InstallHookRTS			(HandleRTS);
 	gCPU68K->InstallHookNewPC		(HandleNewPC);
 	gCPU68K->InstallHookNewSP		(HandleNewSP);
 
+	// HandleJSR, HandleRTS, and HandleRTE only do anything when profiling
+	// or logging function calls, so they're installed only then.  That
+	// way, the CPU doesn't call out on every JSR, RTS, and RTE for nothing.
+
+	gCallHooksInstalled = false;
+	EmPalmOS::UpdateCallHooks ();
+
 	gBigROMEntry = EmMemNULL;
 
 	// Add a notification for IntlStrictChecks
@@ -140,6 +156,8 @@ void EmPalmOS::Reset (void)
 {
 	gStackList.clear ();
 
+	gHaveCurrentStack = false;
+
 	gBootStack		= StackRange ();
 	gKernelStack	= StackRange ();
 	gInterruptStack	= StackRange ();
@@ -267,6 +285,28 @@ void EmPalmOS::Load (SessionFile& f)
 		{
 			s >> gKernelStackOverflowed;
 		}
+
+		// Sessions saved by older builds didn't keep the list sorted.
+
+		sort (gStackList.begin (), gStackList.end ());
+
+		// Find the bounds of the current stack again.
+
+		gHaveCurrentStack = false;
+
+		StackList::iterator iter = gStackList.begin ();
+
+		while (iter != gStackList.end ())
+		{
+			if (iter->fTop == gStackHigh)
+			{
+				gHaveCurrentStack = true;
+				gStackBottom = iter->fBottom;
+				break;
+			}
+
+			++iter;
+		}
 	}
 	else
 	{
@@ -306,8 +346,11 @@ void EmPalmOS::Dispose (void)
  *
  * FUNCTION:	EmPalmOS::CheckStackPointerAssignment
  *
- * DESCRIPTION: !!! This operation slows down Gremlins by about 10%; it
- *				should be sped up or made an option.
+ * DESCRIPTION: Called whenever the stack pointer is assigned to (as
+ *				opposed to being pushed or popped).  Most of the time,
+ *				it's just being adjusted within the current stack, which
+ *				we check for first.  Otherwise, look up the stack it's
+ *				been set to, or start tracking a new one.
  *
  * PARAMETERS:	None.
  *
@@ -321,21 +364,24 @@ void EmPalmOS::CheckStackPointerAssignment (void)
 	// stack pointer to a new stack.  Scarf up information about that
 	// block of memory and treat that block as a stack.
 
-	// See if we already know about this stack.
-
 	emuptr				curA7 = gCPU->GetSP ();
-	StackList::iterator iter = gStackList.begin ();
 
-	while (iter != gStackList.end ())
+	// See if we're still in the current stack.
+
+	if (gHaveCurrentStack && curA7 >= gStackBottom && curA7 <= gStackHigh)
 	{
-		if ((curA7 >= (*iter).fBottom) && (curA7 <= (*iter).fTop))
-		{
-			// If so, switch to it.
-			SetCurrentStack (*iter);
-			return;
-		}
+		return;
+	}
 
-		++iter;
+	// See if we already know about this stack.
+
+	StackList::iterator iter = ::PrvFindStack (curA7);
+
+	if (iter != gStackList.end ())
+	{
+		// If so, switch to it.
+		SetCurrentStack (*iter);
+		return;
 	}
 
 	// If not, get some information about it and save it off.
@@ -628,9 +674,9 @@ void EmPalmOS::RememberStackRange (const StackRange& range)
 	}
 #endif
 
-	// Add the range to the list.
+	// Add the range to the list, keeping it sorted.
 
-	gStackList.push_back (range);
+	gStackList.insert (upper_bound (gStackList.begin (), gStackList.end (), range), range);
 }
 
 
@@ -650,11 +696,11 @@ void EmPalmOS::SetCurrentStack (const StackRange& range)
 {
 	// Record the low-water mark of the previous stack.
 
-	StackList::iterator iter = gStackList.begin ();
-
-	while (iter != gStackList.end ())
+	if (gHaveCurrentStack)
 	{
-		if (gStackHigh == iter->fTop)
+		StackList::iterator iter = ::PrvFindStack (gStackBottom);
+
+		if (iter != gStackList.end () && gStackHigh == iter->fTop)
 		{
 			iter->fLowWaterMark = gStackLowWaterMark;
 
@@ -666,11 +712,7 @@ void EmPalmOS::SetCurrentStack (const StackRange& range)
 
 			if (gStackHigh == gInterruptStack.fTop)
 				gInterruptStack.fLowWaterMark = gStackLowWaterMark;
-
-			break;
 		}
-
-		++iter;
 	}
 
 	// Determine the amount to test against when determining if we are
@@ -687,6 +729,9 @@ void EmPalmOS::SetCurrentStack (const StackRange& range)
 	if (range == gKernelStack)
 		stackSlush = kKernelStackSlush;
 
+	gHaveCurrentStack	= true;
+	gStackBottom		= range.fBottom;
+
 	gStackHigh			= range.fTop;
 	gStackLowWaterMark	= range.fLowWaterMark;
 	gStackLowWarn		= range.fBottom + kInterruptOverhead + stackSlush;
@@ -708,9 +753,9 @@ void EmPalmOS::SetCurrentStack (const StackRange& range)
 
 void EmPalmOS::ForgetStack (emuptr stackBottom)
 {
-	StackList::iterator iter = gStackList.begin ();
+	StackList::iterator iter = ::PrvFindStack (stackBottom);
 
-	while (iter != gStackList.end ())
+	if (iter != gStackList.end ())
 	{
 		// If the pointer is in the *middle* of a stack, that's not good.
 
@@ -724,6 +769,8 @@ void EmPalmOS::ForgetStack (emuptr stackBottom)
 		{
 			gStackList.erase (iter);
 
+			::PrvForgetCurrentStack (stackBottom);
+
 			if (stackBottom == gBootStack.fBottom)
 			{
 #define TRACK_BOOT_ALLOCATION 0
@@ -734,11 +781,7 @@ void EmPalmOS::ForgetStack (emuptr stackBottom)
 
 				gBootStack = StackRange ();
 			}
-
-			return;
 		}
-
-		++iter;
 	}
 }
 
@@ -757,13 +800,20 @@ void EmPalmOS::ForgetStack (emuptr stackBottom)
 
 void EmPalmOS::ForgetStacksIn (emuptr start, uint32 range)
 {
-	StackList::iterator iter = gStackList.begin ();
+	// Start at the first stack at or after "start".  Since the list
+	// is sorted, we can stop at the first one starting past the end
+	// of the range.
 
-	while (iter != gStackList.end ())
+	StackList::iterator iter = lower_bound (gStackList.begin (),
+		gStackList.end (), StackRange (start, start));
+
+	while (iter != gStackList.end () && iter->fBottom < start + range)
 	{
-		if ((iter->fBottom >= start) && (iter->fTop <= (start + range)))
+		if (iter->fTop <= (start + range))
 		{
-			gStackList.erase (iter);
+			::PrvForgetCurrentStack (iter->fBottom);
+
+			iter = gStackList.erase (iter);
 
 			if (start == gBootStack.fBottom)
 			{
@@ -776,9 +826,6 @@ void EmPalmOS::ForgetStacksIn (emuptr start, uint32 range)
 				gBootStack = StackRange ();
 			}
 
-			// We munged the collection; start over.
-
-			iter = gStackList.begin ();
 			continue;
 		}
 
@@ -841,6 +888,61 @@ Bool EmPalmOS::IsInStackBlock (emuptr addr)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	PrvFindStack
+ *
+ * DESCRIPTION: Binary search gStackList for the stack containing the
+ *				given address.  Stacks don't overlap, so the only one
+ *				that can is the last one starting at or below it.
+ *
+ * PARAMETERS:	addr - the address to look for.
+ *
+ * RETURNED:	An iterator referencing the stack, or gStackList.end ()
+ *				if the address isn't in any stack we know about.
+ *
+ ***********************************************************************/
+
+StackList::iterator PrvFindStack (emuptr addr)
+{
+	StackList::iterator iter = upper_bound (gStackList.begin (),
+		gStackList.end (), StackRange (addr, addr));
+
+	if (iter == gStackList.begin ())
+		return gStackList.end ();
+
+	--iter;
+
+	if (addr > iter->fTop)
+		return gStackList.end ();
+
+	return iter;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	PrvForgetCurrentStack
+ *
+ * DESCRIPTION: Called when a stack is removed from gStackList.  If
+ *				it's the current stack, forget its cached bounds so
+ *				that CheckStackPointerAssignment looks it up again.
+ *
+ * PARAMETERS:	stackBottom - the bottom of the stack being removed.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void PrvForgetCurrentStack (emuptr stackBottom)
+{
+	if (gHaveCurrentStack && stackBottom == gStackBottom)
+	{
+		gHaveCurrentStack = false;
+	}
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:    EmPalmOS::GenerateStackCrawl
@@ -1182,11 +1284,60 @@ Bool EmPalmOS::HandleJSR_Ind (emuptr oldpc, emuptr dest)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	EmPalmOS::UpdateCallHooks
+ *
+ * DESCRIPTION: Install HandleJSR, HandleRTS, and HandleRTE if they have
+ *				any work to do (that is, if profiling is enabled or
+ *				function calls are being logged), and remove them if
+ *				they don't.  Called from Initialize, and by the
+ *				profiler when it's initialized or cleaned up.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void EmPalmOS::UpdateCallHooks (void)
+{
+	Bool	needHooks = LOG_FUNCTION_CALLS;
+
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+	{
+		needHooks = true;
+	}
+#endif
+
+	if (!gCPU68K || needHooks == gCallHooksInstalled)
+	{
+		return;
+	}
+
+	if (needHooks)
+	{
+		gCPU68K->InstallHookJSR		(HandleJSR);
+		gCPU68K->InstallHookRTE		(HandleRTE);
+		gCPU68K->InstallHookRTS		(HandleRTS);
+	}
+	else
+	{
+		gCPU68K->RemoveHookJSR		(HandleJSR);
+		gCPU68K->RemoveHookRTE		(HandleRTE);
+		gCPU68K->RemoveHookRTS		(HandleRTS);
+	}
+
+	gCallHooksInstalled = needHooks;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	EmPalmOS::HandleLINK
  *
- * DESCRIPTION: .
+ * DESCRIPTION: Not currently installed, as it has nothing to do.
  *
  * PARAMETERS:	None.
  *
@@ -1404,8 +1555,8 @@ void EmPalmOS::HandleNewPC (emuptr dest)
  *
  * FUNCTION:	EmPalmOS::HandleNewSP
  *
- * DESCRIPTION: !!! This operation slows down Gremlins by about 10%; it
- *				should be sped up or made an option.
+ * DESCRIPTION: Dispatch a change to the stack pointer to the
+ *				appropriate check.
  *
  * PARAMETERS:	None.
  *
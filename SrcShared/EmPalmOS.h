@@ -91,6 +91,7 @@ class EmPalmOS
 		static Bool				IsInStackBlock				(emuptr);
 		static void				GenerateStackCrawl			(EmStackFrameList& frameList);
 		static void				PrefsChanged				(PrefKeyType, void*);
+		static void				UpdateCallHooks				(void);
 
 	protected:
 		static Bool				HandleTrap15				(ExceptionNumber);
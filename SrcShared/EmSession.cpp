@@ -634,13 +634,15 @@ void EmSession::Load (SessionFile& f)
 //		 EmSession::Save
 // ---------------------------------------------------------------------------
 
-void EmSession::Save (const EmFileRef& ref, Bool updateFileRef)
+void EmSession::Save (const EmFileRef& ref, Bool updateFileRef, Bool saveRAMDelta)
 {
 	EmStreamFile	stream (ref, kCreateOrEraseForUpdate,
 						kFileCreatorEmulator, kFileTypeSession);
 	ChunkFile		chunkFile (stream);
 	SessionFile		sessionFile (chunkFile);
 
+	sessionFile.SetSaveRAMDelta (saveRAMDelta);
+
 	this->Save (sessionFile);
 
 	if (updateFileRef)
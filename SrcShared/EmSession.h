@@ -345,9 +345,12 @@ class EmSession
 		// Utility methods that create a SessionFile for the given file, and then
 		// call the above Save and Load methods.  If updateFileRef is true, then
 		// the EmFileRef is remembered as part of the session's "identity".
+		// If saveRAMDelta is true, RAM may be saved as a delta against a base
+		// image (see SessionFile::SetSaveRAMDelta).
 
 		void 					Save				(const EmFileRef&,
-													 Bool updateFileRef);
+													 Bool updateFileRef,
+													 Bool saveRAMDelta = false);
 		void 					Load				(const EmFileRef&);
 
 		// Called by external thread to create and destroy the thread.  CreateThread
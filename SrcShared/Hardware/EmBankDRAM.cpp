@@ -21,7 +21,7 @@
 #include "DebugMgr.h"			// Debug::CheckStepSpy
 #include "EmBankSRAM.h"			// gRAMBank_Size, gRAM_Memory, gMemoryAccess
 #include "EmCPU.h"				// GetSP
-#include "EmCPU68K.h"			// gCPU68K
+#include "EmCPU68K.h"			// gCPU68K, EmCPU68K::NoteWrite
 #include "EmHAL.h"				// EmHAL
 #include "EmMemory.h"			// Memory::InitializeBanks, IsPCInRAM (implicitly, through META_CHECK)
 #include "EmPalmFunction.h"		// InSysLaunch
@@ -32,6 +32,7 @@
 #include "MetaMemory.h"			// MetaMemory
 #include "Profiling.h"			// WAITSTATES_DRAM
 #include "EmPalmStructs.h"
+#include "EmBlockCache.h"		// EmBlockCache::NoteWrite (last: pulls in <limits.h>)
 
 
 // ---------------------------------------------------------------------------
@@ -457,6 +458,9 @@ void EmBankDRAM::SetLong (emuptr address, uint32 value)
 #endif
 
 	EmMemDoPut32 (gRAM_Memory + address, value);
+	EmBlockCache::NoteWrite (gRAM_Memory + address);
+	EmCPU68K::NoteWrite (gRAM_Memory + address);
+	EmBankSRAM::NoteDirty (address, sizeof (uint32));
 
 #if FOR_LATER
 	// Mark that this memory location can now be read from.
@@ -511,6 +515,9 @@ void EmBankDRAM::SetWord (emuptr address, uint32 value)
 #endif
 
 	EmMemDoPut16 (gRAM_Memory + address, value);
+	EmBlockCache::NoteWrite (gRAM_Memory + address);
+	EmCPU68K::NoteWrite (gRAM_Memory + address);
+	EmBankSRAM::NoteDirty (address, sizeof (uint16));
 
 #if FOR_LATER
 	// Mark that this memory location can now be read from.
@@ -560,6 +567,9 @@ void EmBankDRAM::SetByte (emuptr address, uint32 value)
 #endif
 
 	EmMemDoPut8 (gRAM_Memory + address, value);
+	EmBlockCache::NoteWrite (gRAM_Memory + address);
+	EmCPU68K::NoteWrite (gRAM_Memory + address);
+	EmBankSRAM::NoteDirty (address, sizeof (uint8));
 
 #if FOR_LATER
 	// Mark that this memory location can now be read from.
@@ -14,18 +14,19 @@
 #include "EmCommon.h"
 #include "EmBankROM.h"
 
-#include "Byteswapping.h"		// ByteswapWords
-#include "EmCPU68K.h"			// gCPU68K
+#include "Byteswapping.h"		// ByteswapWords, ByteswapWordsCopy
+#include "EmCPU68K.h"			// gCPU68K, EmCPU68K::NoteWrite
 #include "EmErrCodes.h"			// kError_UnsupportedROM
 #include "EmHAL.h"				// EmHAL
 #include "EmMemory.h"			// Memory::InitializeBanks, EmMem_memset
 #include "EmPalmStructs.h"		// EmProxyCardHeaderType
 #include "EmSession.h"			// GetDevice, ScheduleDeferredError
 #include "ErrorHandling.h"		// Errors::Throw
-#include "Miscellaneous.h"		// StWordSwapper, NextPowerOf2
+#include "Miscellaneous.h"		// StMemory, NextPowerOf2
 #include "Profiling.h"			// WAITSTATES_ROM
 #include "SessionFile.h"		// WriteROMFileReference
 #include "Strings.r.h"			// kStr_BadChecksum
+#include "EmBlockCache.h"		// EmBlockCache::NoteROMWrite, SetROM (last: pulls in <limits.h>)
 
 
 // Private function declarations
@@ -145,8 +146,16 @@ void EmBankROM::Save (SessionFile& f)
 	Configuration	cfg = gSession->GetConfiguration ();
 	f.WriteROMFileReference (cfg.fROMFile);
 
-	StWordSwapper	swapper1 (gROM_MetaMemory, gROMImage_Size);
+#if WORDSWAP_MEMORY
+	// Swap into a copy, rather than swapping the meta-memory in place and
+	// then swapping it back.
+
+	StMemory	image (gROMImage_Size);
+	::ByteswapWordsCopy (image.Get (), gROM_MetaMemory, gROMImage_Size);
+	f.WriteMetaROMImage (image.Get (), gROMImage_Size);
+#else
 	f.WriteMetaROMImage (gROM_MetaMemory, gROMImage_Size);
+#endif
 }
 
 
@@ -198,11 +207,33 @@ void EmBankROM::Load (SessionFile& f)
 
 void EmBankROM::Dispose (void)
 {
+	EmBlockCache::SetROM (NULL, 0);
+
 	Platform::DisposeMemory (gROM_Memory);
 	Platform::DisposeMemory (gROM_MetaMemory);
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:    EmBankROM::GetImageSize
+ *
+ * DESCRIPTION: Return the size of the loaded ROM image.  The image
+ *				starts at GetMemoryStart; the bank itself may be
+ *				larger, in which case the image is mirrored.
+ *
+ * PARAMETERS:  None.
+ *
+ * RETURNED:    Size of the image in bytes; zero if none is loaded.
+ *
+ ***********************************************************************/
+
+uint32 EmBankROM::GetImageSize (void)
+{
+	return gROM_Memory ? gROMImage_Size : 0;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:    EmBankROM::SetBankHandlers
@@ -233,6 +264,16 @@ void EmBankROM::SetBankHandlers (void)
 
 	Memory::InitializeBanks (	gROMAddressBank, first_bank,
 								last_bank - first_bank + 1);
+
+#if !(VALIDATE_ROM_GET || PREVENT_USER_ROM_GET || PREVENT_SYSTEM_ROM_GET || PROFILE_MEMORY)
+	// Nothing's checked when reading ROM, so EmMemGet can read it directly.
+
+	if (gROM_Memory && gROMBank_Mask >= 0x0000FFFF)
+	{
+		Memory::InitializeFastRead (gROM_Memory, gROMBank_Mask, first_bank,
+									last_bank - first_bank + 1);
+	}
+#endif
 }
 
 
@@ -432,6 +473,8 @@ void EmBankROM::SetLong (emuptr address, uint32 value)
 	address &= gROMBank_Mask;
 
 	EmMemDoPut32 (gROM_Memory + address, value);
+	EmBlockCache::NoteROMWrite (gROM_Memory + address);
+	EmCPU68K::NoteWrite (gROM_Memory + address);
 }
 
 
@@ -481,6 +524,8 @@ void EmBankROM::SetWord (emuptr address, uint32 value)
 	address &= gROMBank_Mask;
 
 	EmMemDoPut16 (gROM_Memory + address, value);
+	EmBlockCache::NoteROMWrite (gROM_Memory + address);
+	EmCPU68K::NoteWrite (gROM_Memory + address);
 }
 
 
@@ -523,6 +568,8 @@ void EmBankROM::SetByte (emuptr address, uint32 value)
 	address &= gROMBank_Mask;
 
 	EmMemDoPut8 (gROM_Memory + address, value);
+	EmBlockCache::NoteROMWrite (gROM_Memory + address);
+	EmCPU68K::NoteWrite (gROM_Memory + address);
 }
 
 
@@ -791,6 +838,8 @@ void EmBankROM::LoadROM (EmStream& hROM)
 	gROM_MetaMemory = (uint8*) romMetaImage.Release ();
 	gROMBank_Mask	= gROMBank_Size - 1;
 
+	EmBlockCache::SetROM (gROM_Memory, gROMImage_Size);
+
 	// Guess the default ROM base address.
 	// This will be used until the chip selects are set up.
 	//
@@ -1370,6 +1419,8 @@ void EmBankFlash::SetWord (emuptr address, uint32 value)
 
 			address &= gROMBank_Mask;
 			EmMemDoPut16 (gROM_Memory + address, value);
+			EmBlockCache::NoteROMWrite (gROM_Memory + address);
+			EmCPU68K::NoteWrite (gROM_Memory + address);
 
 			gState = kAMDState_ProgramDone;
 			return;
@@ -80,11 +80,33 @@ static EmAddressBank	gAddressBank =
 EmRegsList		EmBankRegs::fgSubBanks;
 EmRegsList		EmBankRegs::fgDisabledSubBanks;
 
-static EmRegs*	gLastSubBank;
-static uint64	gLastStart;
-static uint32	gLastRange;
+// GetSubBank used to scan fgSubBanks for the sub-bank containing an
+// address, fronted by a one-entry cache.  That cache thrashes on devices
+// that go back and forth between, say, the Dragonball registers and the
+// LCD controller.  Instead, keep a table mapping each 256-byte page of
+// register space to the first sub-bank that overlaps it.  The table is
+// sparse: there's one array of pages for each 64K bank that has any
+// sub-banks in it.  It's rebuilt the next time it's needed after the
+// list of sub-banks changes.
+
+struct EmSubBankPage
+{
+	EmRegs*	fBank;
+	uint64	fStart;
+	uint32	fRange;
+};
+
+const int		kSubBankPageShift	= 8;
+const int		kSubBankPagesPerBank	= 0x00010000 >> kSubBankPageShift;
 
-static void PrvSwitchBanks (EmRegsList& fromList, EmRegsList& toList, emuptr address);
+static EmSubBankPage*	gSubBankPages[0x00010000];
+static Bool				gSubBankPagesValid;
+
+static void PrvInvalidateSubBankPages (void);
+static void PrvDisposeSubBankPages (void);
+static void PrvBuildSubBankPages (const EmRegsList&);
+
+static EmRegs* PrvSwitchBanks (EmRegsList& fromList, EmRegsList& toList, emuptr address);
 
 #pragma mark -
 
@@ -196,7 +218,7 @@ void EmBankRegs::Load (SessionFile& f)
 		++iter;
 	}
 
-	gLastSubBank = NULL;
+	::PrvInvalidateSubBankPages ();
 }
 
 
@@ -230,7 +252,7 @@ void EmBankRegs::Dispose (void)
 		delete bank;
 	}
 
-	gLastSubBank = NULL;
+	::PrvDisposeSubBankPages ();
 }
 
 
@@ -567,7 +589,7 @@ uint8* EmBankRegs::GetRealAddress (emuptr address)
 void EmBankRegs::AddSubBank (EmRegs* bank)
 {
 	fgSubBanks.push_back (bank);
-	gLastSubBank = NULL;
+	::PrvInvalidateSubBankPages ();
 }
 
 
@@ -577,7 +599,16 @@ void EmBankRegs::AddSubBank (EmRegs* bank)
 
 void EmBankRegs::EnableSubBank (emuptr address)
 {
-	PrvSwitchBanks (fgDisabledSubBanks, fgSubBanks, address);
+	EmRegs*	bank = PrvSwitchBanks (fgDisabledSubBanks, fgSubBanks, address);
+	::PrvInvalidateSubBankPages ();
+
+	// Re-install the handlers for the bank, in case its banks were handed
+	// back to us when it was disabled.
+
+	if (bank)
+	{
+		bank->SetBankHandlers (gAddressBank);
+	}
 }
 
 
@@ -587,7 +618,56 @@ void EmBankRegs::EnableSubBank (emuptr address)
 
 void EmBankRegs::DisableSubBank (emuptr address)
 {
-	PrvSwitchBanks (fgSubBanks, fgDisabledSubBanks, address);
+	EmRegs*	bank = PrvSwitchBanks (fgSubBanks, fgDisabledSubBanks, address);
+	::PrvInvalidateSubBankPages ();
+
+	// If the bank installed its own handlers (as EmRegsFrameBuffer does for
+	// VRAM), put ours back so that accesses to it are treated as invalid.
+
+	if (bank)
+	{
+		emuptr	start		= bank->GetAddressStart ();
+		uint32	range		= bank->GetAddressRange ();
+		uint32	numBanks	= EmMemBankIndex (start + range - 1) - EmMemBankIndex (start) + 1;
+
+		Memory::InitializeBanks (gAddressBank, EmMemBankIndex (start), numBanks);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBankRegs::IsSoleSubBank
+// ---------------------------------------------------------------------------
+// Returns whether the given sub-bank is the only enabled one overlapping
+// the given range of memory.  Sub-banks use this to see if they can
+// install their own handlers over that range.
+
+Bool EmBankRegs::IsSoleSubBank (EmRegs* bank, emuptr start, uint32 range)
+{
+	uint64	addrStart64	= start;
+	uint64	addrEnd64	= addrStart64 + range;
+	Bool	found		= false;
+
+	EmRegsList::iterator	iter = fgSubBanks.begin ();
+	while (iter != fgSubBanks.end ())
+	{
+		uint64	bankStart64	= (*iter)->GetAddressStart ();
+		uint64	bankEnd64	= bankStart64 + (*iter)->GetAddressRange ();
+
+		if ((bankStart64 < addrEnd64) && (bankEnd64 > addrStart64))
+		{
+			if (*iter != bank)
+			{
+				return false;
+			}
+
+			found = true;
+		}
+
+		++iter;
+	}
+
+	return found;
 }
 
 
@@ -602,19 +682,32 @@ EmRegs* EmBankRegs::GetSubBank (emuptr address, long size)
 	uint64	addrStart64	= address;
 	uint64	addrEnd64	= addrStart64 + size;
 
-	// This cache is a big win.  When emulating a Palm IIIc (which uses
-	// three EmRegs-based objects: EmRegsEZPalmIIIc, EmRegsSED1375, and
-	// EmRegsFrameBuffer) and doing a Gremlins run, the cache was hit
-	// 2,356,670 times and missed 19456 times.  When doing the same run
-	// on a Palm V, the cache was missed only the first time.
+	if (!gSubBankPagesValid)
+	{
+		::PrvBuildSubBankPages (fgSubBanks);
+	}
+
+	// Look up the first sub-bank overlapping the page.  If the access
+	// falls within it, we're done.
+
+	EmSubBankPage*	pages = gSubBankPages[EmMemBankIndex (address)];
 
-	if (gLastSubBank &&
-		(addrStart64 >= gLastStart) &&
-		(addrEnd64 <= gLastStart + gLastRange))
+	if (pages)
 	{
-		return gLastSubBank;
+		const EmSubBankPage&	page = pages[(address >> kSubBankPageShift) & (kSubBankPagesPerBank - 1)];
+
+		if (page.fBank &&
+			(addrStart64 >= page.fStart) &&
+			(addrEnd64 <= page.fStart + page.fRange))
+		{
+			return page.fBank;
+		}
 	}
 
+	// Otherwise, there's either no sub-bank there, the access straddles
+	// the end of one, or more than one sub-bank shares the page.  Look
+	// through them all.
+
 	EmRegsList::iterator	iter = fgSubBanks.begin ();
 	while (iter != fgSubBanks.end ())
 	{
@@ -623,10 +716,6 @@ EmRegs* EmBankRegs::GetSubBank (emuptr address, long size)
 
 		if ((addrStart64 >= start) && (addrEnd64 <= start + range))
 		{
-			gLastSubBank = *iter;
-			gLastStart = start;
-			gLastRange = range;
-
 			return *iter;
 		}
 
@@ -670,11 +759,85 @@ void EmBankRegs::PreventedAccess (emuptr address, long size, Bool forRead)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 PrvInvalidateSubBankPages
+// ---------------------------------------------------------------------------
+
+void PrvInvalidateSubBankPages (void)
+{
+	gSubBankPagesValid = false;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvDisposeSubBankPages
+// ---------------------------------------------------------------------------
+
+void PrvDisposeSubBankPages (void)
+{
+	for (int ii = 0; ii < 0x00010000; ++ii)
+	{
+		delete [] gSubBankPages[ii];
+		gSubBankPages[ii] = NULL;
+	}
+
+	gSubBankPagesValid = false;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvBuildSubBankPages
+// ---------------------------------------------------------------------------
+
+void PrvBuildSubBankPages (const EmRegsList& subBanks)
+{
+	::PrvDisposeSubBankPages ();
+
+	EmRegsList::const_iterator	iter = subBanks.begin ();
+	while (iter != subBanks.end ())
+	{
+		uint64	start	= (*iter)->GetAddressStart ();
+		uint32	range	= (*iter)->GetAddressRange ();
+
+		if (range > 0)
+		{
+			uint64	firstPage	= start >> kSubBankPageShift;
+			uint64	lastPage	= (start + range - 1) >> kSubBankPageShift;
+
+			for (uint64 pageNum = firstPage; pageNum <= lastPage; ++pageNum)
+			{
+				uint32			bankIndex	= (uint32) (pageNum >> (16 - kSubBankPageShift));
+				EmSubBankPage*&	pages		= gSubBankPages[bankIndex];
+
+				if (!pages)
+				{
+					pages = new EmSubBankPage[kSubBankPagesPerBank];
+					memset (pages, 0, kSubBankPagesPerBank * sizeof (EmSubBankPage));
+				}
+
+				EmSubBankPage&	page = pages[pageNum & (kSubBankPagesPerBank - 1)];
+
+				if (!page.fBank)
+				{
+					page.fBank	= *iter;
+					page.fStart	= start;
+					page.fRange	= range;
+				}
+			}
+		}
+
+		++iter;
+	}
+
+	gSubBankPagesValid = true;
+}
+
+
 // ---------------------------------------------------------------------------
 //		 PrvSwitchBanks
 // ---------------------------------------------------------------------------
 
-void PrvSwitchBanks (EmRegsList& fromList, EmRegsList& toList, emuptr address)
+EmRegs* PrvSwitchBanks (EmRegsList& fromList, EmRegsList& toList, emuptr address)
 {
 	EmRegsList::iterator	iter = fromList.begin ();
 	while (iter != fromList.end ())
@@ -684,11 +847,14 @@ void PrvSwitchBanks (EmRegsList& fromList, EmRegsList& toList, emuptr address)
 
 		if ((address >= start) && (address <= start + range))
 		{
-			toList.push_back (*iter);
+			EmRegs*	bank = *iter;
+			toList.push_back (bank);
 			fromList.erase (iter);
-			return;
+			return bank;
 		}
 
 		++iter;
 	}
+
+	return NULL;
 }
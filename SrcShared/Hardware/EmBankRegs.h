@@ -41,6 +41,8 @@ class EmBankRegs
 		static void				EnableSubBank		(emuptr address);
 		static void				DisableSubBank		(emuptr address);
 
+		static Bool				IsSoleSubBank		(EmRegs*, emuptr start, uint32 range);
+
 	private:
 		static EmRegs*			GetSubBank			(emuptr address, long size);
 		static void				AddressError		(emuptr address, long size, Bool forRead);
@@ -50,7 +52,8 @@ class EmBankRegs
 		static EmRegsList		fgSubBanks;
 		static EmRegsList		fgDisabledSubBanks;
 
-		friend class EmRegs;	// EmBankRegs::InvalidAccess
+		friend class EmRegs;				// EmBankRegs::InvalidAccess
+		friend class EmRegsFrameBuffer;		// EmBankRegs::AddressError, etc.
 };
 
 #endif	/* EmBankRegs_h */
@@ -16,13 +16,20 @@
 
 #include "Byteswapping.h"		// ByteswapWords
 #include "DebugMgr.h"			// Debug::CheckStepSpy
-#include "EmCPU68K.h"			// gCPU68K
+#include "EmBlockCache.h"		// EmBlockCache::NoteWrite
+#include "EmCPU68K.h"			// gCPU68K, EmCPU68K::NoteWrite
+#include "EmDirRef.h"			// EmDirRef
+#include "EmErrCodes.h"			// kError_InvalidSessionFile
+#include "EmFileRef.h"			// EmFileRef
 #include "EmMemory.h"			// gRAMBank_Size, gRAM_Memory, gMemoryAccess
 #include "EmScreen.h"			// EmScreen::MarkDirty
 #include "EmSession.h"			// GetDevice
+#include "ErrorHandling.h"		// Errors::Throw
 #include "MetaMemory.h"			// MetaMemory::
-#include "Miscellaneous.h"		// StWordSwapper
+#include "Miscellaneous.h"		// StMemory
+#include "PreferenceMgr.h"		// Preference, kPrefKeyHugePageRAM
 #include "Profiling.h"			// WAITSTATES_SRAM
+#include "EmStreamFile.h"		// EmStreamFile
 #include "SessionFile.h"		// WriteRAMImage
 
 
@@ -60,6 +67,47 @@ uint32 		gRAMBank_Size;
 uint32 		gRAMBank_Mask;
 uint8* 		gRAM_Memory;
 uint8* 		gRAM_MetaMemory;
+uint8* 		gRAM_MetaSummary;
+uint8*		gRAM_DirtyPages;
+
+static EmFileRef	gRAMBaseImage;
+static uint16		gRAMBaseCRC;		// CRC of RAM when it matched gRAMBaseImage
+
+	// Format of the kRAMDeltaTag chunk, after it's been decompressed:
+	//
+	//	uint32		version (kRAMDeltaVersion)
+	//	uint32		RAM size
+	//	string		full path of the session file holding the base image
+	//	uint32		number of directories to go up from the one holding
+	//				the delta file to reach a common ancestor with the
+	//				base file, or kNoRelativePath (version 2 and later)
+	//	StringList	names leading from that ancestor down to the base
+	//				file (version 2 and later)
+	//	uint16		CRC of the base image's RAM (version 3 and later)
+	//	uint32		page size (kDirtyPageSize)
+	//	uint32		number of pages
+	//
+	// followed by, for each page:
+	//
+	//	uint32		page index
+	//	bytes		page contents, in emulated (big-endian) byte order
+
+static const uint32	kRAMDeltaVersion	= 3;
+static const uint32	kNoRelativePath		= 0xFFFFFFFF;
+
+static void			PrvSaveRAMDelta		(SessionFile& f);
+static Bool			PrvLoadRAMDelta		(SessionFile& f);
+static Bool			PrvGetRelativePath	(const EmDirRef& from, const EmFileRef& to,
+										 uint32& ups, StringList& names);
+static EmFileRef	PrvResolveRelativePath	(const EmDirRef& from, uint32 ups,
+											 const StringList& names);
+static Bool			PrvLoadRAMBase		(const EmFileRef& baseRef);
+static uint16		PrvRAMImageCRC		(void);
+
+inline uint32		PrvNumDirtyPages	(void)
+{
+	return (gRAMBank_Size + kDirtyPageSize - 1) >> kDirtyPageShift;
+}
 
 #if defined (_DEBUG)
 
@@ -124,13 +172,25 @@ void EmBankSRAM::Initialize (RAMSizeType ramSize)
 {
 	EmAssert (gRAM_Memory == NULL);
 	EmAssert (gRAM_MetaMemory == NULL);
+	EmAssert (gRAM_MetaSummary == NULL);
+	EmAssert (gRAM_DirtyPages == NULL);
 
 	if (ramSize > 0)
 	{
 		gRAMBank_Size	= ramSize * 1024;
 		gRAMBank_Mask	= gRAMBank_Size - 1;
-		gRAM_Memory 	= (uint8*) Platform::AllocateMemoryClear (gRAMBank_Size);
-		gRAM_MetaMemory = (uint8*) Platform::AllocateMemoryClear (gRAMBank_Size);
+
+		// RAM and meta-memory are mostly zeros, so get them from the
+		// platform's large block allocator, which can hand out pages
+		// lazily (and, if asked, back them with huge pages).
+
+		Preference<bool>	prefHugePages (kPrefKeyHugePageRAM);
+
+		gRAM_Memory 	= (uint8*) Platform::AllocateLargeMemory (gRAMBank_Size, *prefHugePages);
+		gRAM_MetaMemory = (uint8*) Platform::AllocateLargeMemory (gRAMBank_Size, *prefHugePages);
+		gRAM_MetaSummary = (uint8*) Platform::AllocateMemoryClear (
+							(gRAMBank_Size + kMetaSummaryPageSize - 1) >> kMetaSummaryShift);
+		gRAM_DirtyPages = (uint8*) Platform::AllocateMemoryClear (::PrvNumDirtyPages ());
 
 #if defined (_DEBUG)
 		// In debug mode, define a global variable that points to the
@@ -177,7 +237,9 @@ void EmBankSRAM::Initialize (RAMSizeType ramSize)
 
 void EmBankSRAM::Reset (Bool /*hardwareReset*/)
 {
-	memset (gRAM_MetaMemory, 0, gRAMBank_Size);
+	MetaMemory::ClearRAMImage ();
+
+	EmBankSRAM::ClearBaseImage ();
 }
 
 
@@ -196,11 +258,25 @@ void EmBankSRAM::Reset (Bool /*hardwareReset*/)
 
 void EmBankSRAM::Save (SessionFile& f)
 {
-	StWordSwapper	swapper1 (gRAM_Memory, gRAMBank_Size);
-	f.WriteRAMImage (gRAM_Memory, gRAMBank_Size);
+	if (f.GetSaveRAMDelta () && gRAMBaseImage.IsSpecified ())
+	{
+		::PrvSaveRAMDelta (f);
+	}
+	else
+	{
+#if WORDSWAP_MEMORY
+	// Swap into a copy, rather than swapping RAM in place and then
+	// swapping it back.
+
+		StMemory	image (gRAMBank_Size);
+		::ByteswapWordsCopy (image.Get (), gRAM_Memory, gRAMBank_Size);
+		f.WriteRAMImage (image.Get (), gRAMBank_Size);
+#else
+		f.WriteRAMImage (gRAM_Memory, gRAMBank_Size);
+#endif
+	}
 
-	StWordSwapper	swapper2 (gRAM_MetaMemory, gRAMBank_Size);
-	f.WriteMetaRAMImage (gRAM_MetaMemory, gRAMBank_Size);
+	MetaMemory::SaveRAMImage (f);
 }
 
 
@@ -225,20 +301,33 @@ void EmBankSRAM::Load (SessionFile& f)
 	if (f.ReadRAMImage (gRAM_Memory))
 	{
 		ByteswapWords (gRAM_Memory, gRAMBank_Size);
+
+		// We don't know where this image came from, so there's nothing
+		// to base deltas on until someone tells us.
+
+		EmBankSRAM::ClearBaseImage ();
 	}
-	else
+	else if (!::PrvLoadRAMDelta (f))
 	{
 		f.SetCanReload (false);
 	}
 
-	if (f.ReadMetaRAMImage (gRAM_MetaMemory))
-	{
-		ByteswapWords (gRAM_MetaMemory, gRAMBank_Size);
-	}
-	else
+	// Older session files hold the full (word-swapped) meta-memory
+	// image instead of the packed list of runs.
+
+	if (!MetaMemory::LoadRAMImage (f))
 	{
-		f.SetCanReload (false);
+		if (f.ReadMetaRAMImage (gRAM_MetaMemory))
+		{
+			ByteswapWords (gRAM_MetaMemory, gRAMBank_Size);
+		}
+		else
+		{
+			f.SetCanReload (false);
+		}
 	}
+
+	MetaMemory::ResyncPageSummary ();
 }
 
 
@@ -258,8 +347,12 @@ void EmBankSRAM::Load (SessionFile& f)
 
 void EmBankSRAM::Dispose (void)
 {
-	Platform::DisposeMemory (gRAM_Memory);
-	Platform::DisposeMemory (gRAM_MetaMemory);
+	Platform::DisposeLargeMemory (gRAM_Memory, gRAMBank_Size);
+	Platform::DisposeLargeMemory (gRAM_MetaMemory, gRAMBank_Size);
+	Platform::DisposeMemory (gRAM_MetaSummary);
+	Platform::DisposeMemory (gRAM_DirtyPages);
+
+	EmBankSRAM::ClearBaseImage ();
 }
 
 
@@ -284,6 +377,16 @@ void EmBankSRAM::SetBankHandlers (void)
 	long	numBanks = EmMemBankIndex (gMemoryStart + gRAMBank_Size - 1) -
 									EmMemBankIndex (gMemoryStart) + 1;
 	Memory::InitializeBanks (gAddressBank, EmMemBankIndex (gMemoryStart), numBanks);
+
+#if !(PREVENT_USER_SRAM_GET || VALIDATE_SRAM_GET || PROFILE_MEMORY)
+	// Nothing's checked when reading SRAM, so EmMemGet can read it directly.
+	// (Writes still go through EmBankSRAM::SetLong, etc.)
+
+	if (gRAM_Memory && gRAMBank_Mask >= 0x0000FFFF)
+	{
+		Memory::InitializeFastRead (gRAM_Memory, gRAMBank_Mask, EmMemBankIndex (gMemoryStart), numBanks);
+	}
+#endif
 }
 
 
@@ -450,6 +553,9 @@ void EmBankSRAM::SetLong (emuptr address, uint32 value)
 	::PrvScreenCheck (metaAddress, address, sizeof (uint32));
 
 	EmMemDoPut32 (gRAM_Memory + phyAddress, value);
+	EmBlockCache::NoteWrite (gRAM_Memory + phyAddress);
+	EmCPU68K::NoteWrite (gRAM_Memory + phyAddress);
+	EmBankSRAM::NoteDirty (phyAddress, sizeof (uint32));
 
 	// See if any interesting memory locations have changed.  If so,
 	// CheckStepSpy will report it.
@@ -501,6 +607,9 @@ void EmBankSRAM::SetWord (emuptr address, uint32 value)
 	::PrvScreenCheck (metaAddress, address, sizeof (uint16));
 
 	EmMemDoPut16 (gRAM_Memory + phyAddress, value);
+	EmBlockCache::NoteWrite (gRAM_Memory + phyAddress);
+	EmCPU68K::NoteWrite (gRAM_Memory + phyAddress);
+	EmBankSRAM::NoteDirty (phyAddress, sizeof (uint16));
 
 	// See if any interesting memory locations have changed.  If so,
 	// CheckStepSpy will report it.
@@ -545,6 +654,9 @@ void EmBankSRAM::SetByte (emuptr address, uint32 value)
 	::PrvScreenCheck (metaAddress, address, sizeof (uint8));
 
 	EmMemDoPut8 (gRAM_Memory + phyAddress, value);
+	EmBlockCache::NoteWrite (gRAM_Memory + phyAddress);
+	EmCPU68K::NoteWrite (gRAM_Memory + phyAddress);
+	EmBankSRAM::NoteDirty (phyAddress, sizeof (uint8));
 
 	// See if any interesting memory locations have changed.  If so,
 	// CheckStepSpy will report it.
@@ -606,6 +718,52 @@ void EmBankSRAM::AddOpcodeCycles (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmBankSRAM::NoteDirtyRange
+// ---------------------------------------------------------------------------
+
+void EmBankSRAM::NoteDirtyRange (uint32 offset, uint32 size)
+{
+	if (size == 0)
+	{
+		return;
+	}
+
+	uint32	firstPage	= offset >> kDirtyPageShift;
+	uint32	lastPage	= (offset + size - 1) >> kDirtyPageShift;
+
+	EmAssert (lastPage < ::PrvNumDirtyPages ());
+
+	memset (gRAM_DirtyPages + firstPage, 1, lastPage - firstPage + 1);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBankSRAM::SetBaseImage
+// ---------------------------------------------------------------------------
+
+void EmBankSRAM::SetBaseImage (const EmFileRef& ref)
+{
+	gRAMBaseImage = ref;
+	gRAMBaseCRC = ::PrvRAMImageCRC ();
+
+	if (gRAM_DirtyPages)
+	{
+		memset (gRAM_DirtyPages, 0, ::PrvNumDirtyPages ());
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBankSRAM::ClearBaseImage
+// ---------------------------------------------------------------------------
+
+void EmBankSRAM::ClearBaseImage (void)
+{
+	gRAMBaseImage = EmFileRef ();
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmBankSRAM::AddressError
 // ---------------------------------------------------------------------------
@@ -638,3 +796,312 @@ void EmBankSRAM::ProtectedAccess (emuptr address, long size, Bool forRead)
 	gCPU68K->BusError (address, size, forRead);
 }
 
+
+// ---------------------------------------------------------------------------
+//		 PrvSaveRAMDelta
+// ---------------------------------------------------------------------------
+// Write out the RAM pages that have changed since RAM last matched the base
+// image, along with a reference to the base image.
+
+void PrvSaveRAMDelta (SessionFile& f)
+{
+	uint32	numPages = ::PrvNumDirtyPages ();
+	uint32	numDirty = 0;
+
+	for (uint32 ii = 0; ii < numPages; ++ii)
+	{
+		if (gRAM_DirtyPages[ii])
+		{
+			++numDirty;
+		}
+	}
+
+	// Refer to the base image relative to the delta file, too, so that
+	// the two can be moved together (as when a Horde directory is copied).
+
+	uint32		ups = kNoRelativePath;
+	StringList	names;
+	EmFileRef	deltaRef = f.GetFileRef ();
+
+	if (!deltaRef.IsSpecified () ||
+		!::PrvGetRelativePath (deltaRef.GetParent (), gRAMBaseImage, ups, names))
+	{
+		ups = kNoRelativePath;
+		names.clear ();
+	}
+
+	Chunk			chunk;
+	EmStreamChunk	s (chunk);
+
+	s << kRAMDeltaVersion;
+	s << gRAMBank_Size;
+	s << gRAMBaseImage.GetFullPath ();
+	s << ups;
+	s << names;
+	s << gRAMBaseCRC;
+	s << kDirtyPageSize;
+	s << numDirty;
+
+	// Size the chunk once, rather than letting it grow a page at a time.
+
+	s.SetLength (s.GetMarker () + numDirty * (sizeof (uint32) + kDirtyPageSize));
+
+	for (uint32 page = 0; page < numPages; ++page)
+	{
+		if (gRAM_DirtyPages[page])
+		{
+			uint32	offset	= page << kDirtyPageShift;
+			uint32	length	= min (kDirtyPageSize, gRAMBank_Size - offset);
+
+			s << page;
+
+			uint8*	dest = (uint8*) chunk.GetPointer () + s.GetMarker ();
+			::ByteswapWordsCopy (dest, gRAM_Memory + offset, length);
+			s.SetMarker (kDirtyPageSize, kStreamFromMarker);
+		}
+	}
+
+	f.WriteRAMDelta (chunk);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvLoadRAMDelta
+// ---------------------------------------------------------------------------
+// Load RAM from a delta chunk: read the full image from the base session
+// file it refers to, and then apply the changed pages.  The base file is
+// looked for relative to the delta file first, and then at its original
+// location; the first one whose RAM has the CRC recorded in the delta is
+// used.  Returns false if there's no delta.  Throws an error if there is
+// one but no matching base image can be found, so that the user hears about
+// it instead of getting a freshly reset device or RAM that's been patched
+// on top of the wrong image.
+
+Bool PrvLoadRAMDelta (SessionFile& f)
+{
+	Chunk	chunk;
+
+	if (!f.ReadRAMDelta (chunk))
+	{
+		return false;
+	}
+
+	EmStreamChunk	s (chunk);
+
+	uint32		version;
+	uint32		ramSize;
+	string		basePath;
+	uint32		ups = kNoRelativePath;
+	StringList	names;
+	uint16		baseCRC = 0;
+	uint32		pageSize;
+	uint32		numDirty;
+
+	s >> version;
+	s >> ramSize;
+	s >> basePath;
+
+	if (version >= 2)
+	{
+		s >> ups;
+		s >> names;
+	}
+
+	if (version >= 3)
+	{
+		s >> baseCRC;
+	}
+
+	s >> pageSize;
+	s >> numDirty;
+
+	if (version > kRAMDeltaVersion ||
+		ramSize != gRAMBank_Size ||
+		pageSize != kDirtyPageSize)
+	{
+		Errors::Throw (kError_InvalidSessionFile);
+	}
+
+	EmFileRef	candidates[2];
+	EmFileRef	deltaRef = f.GetFileRef ();
+
+	if (ups != kNoRelativePath && !names.empty () && deltaRef.IsSpecified ())
+	{
+		candidates[0] = ::PrvResolveRelativePath (deltaRef.GetParent (), ups, names);
+	}
+
+	candidates[1] = EmFileRef (basePath);
+
+	Bool	found = false;
+
+	for (int ii = 0; ii < 2 && !found; ++ii)
+	{
+		if (!candidates[ii].IsSpecified () || !::PrvLoadRAMBase (candidates[ii]))
+		{
+			continue;
+		}
+
+		// RAM now matches this base image; the pages we apply are the
+		// ones that differ from it.  Deltas older than version 3 don't
+		// record the base's CRC, so take the first base we find.
+
+		EmBankSRAM::SetBaseImage (candidates[ii]);
+
+		found = version < 3 || gRAMBaseCRC == baseCRC;
+	}
+
+	if (!found)
+	{
+		EmBankSRAM::ClearBaseImage ();
+		Errors::Throw (kError_InvalidSessionFile);
+	}
+
+	uint32	numPages = ::PrvNumDirtyPages ();
+
+	for (uint32 ii = 0; ii < numDirty; ++ii)
+	{
+		uint32	page;
+		s >> page;
+
+		if (page >= numPages)
+		{
+			Errors::Throw (kError_InvalidSessionFile);
+		}
+
+		uint32	offset	= page << kDirtyPageShift;
+		uint32	length	= min (kDirtyPageSize, gRAMBank_Size - offset);
+
+		uint8*	src = (uint8*) chunk.GetPointer () + s.GetMarker ();
+		::ByteswapWordsCopy (gRAM_Memory + offset, src, length);
+		s.SetMarker (kDirtyPageSize, kStreamFromMarker);
+
+		gRAM_DirtyPages[page] = 1;
+	}
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvLoadRAMBase
+// ---------------------------------------------------------------------------
+// Read RAM from the full image in the given session file.  Returns false if
+// the file doesn't exist or doesn't hold a RAM image of the right size.
+
+Bool PrvLoadRAMBase (const EmFileRef& baseRef)
+{
+	if (!baseRef.Exists ())
+	{
+		return false;
+	}
+
+	EmStreamFile	stream (baseRef, kOpenExistingForRead);
+	ChunkFile		chunkFile (stream);
+	SessionFile		baseFile (chunkFile);
+
+	if (baseFile.GetRAMImageSize () != (long) gRAMBank_Size ||
+		!baseFile.ReadRAMImage (gRAM_Memory))
+	{
+		return false;
+	}
+
+	ByteswapWords (gRAM_Memory, gRAMBank_Size);
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvRAMImageCRC
+// ---------------------------------------------------------------------------
+// Return a CRC of RAM.  It's taken over RAM in emulated (big-endian) byte
+// order, so that it doesn't depend on the host that saved the delta.
+
+uint16 PrvRAMImageCRC (void)
+{
+	uint8	buffer[kDirtyPageSize];
+	uint16	crc = 0;
+
+	for (uint32 offset = 0; offset < gRAMBank_Size; offset += kDirtyPageSize)
+	{
+		uint32	length = min (kDirtyPageSize, gRAMBank_Size - offset);
+
+		::ByteswapWordsCopy (buffer, gRAM_Memory + offset, length);
+		crc = ::Crc16CalcBigBlock (buffer, length, crc);
+	}
+
+	return crc;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvGetRelativePath
+// ---------------------------------------------------------------------------
+// Describe the location of "to" relative to the directory "from": the number
+// of parents of "from" to go up to reach a directory that contains "to", and
+// the names of the directories (and finally the file) leading down from
+// there.  Returns false if the two have no common ancestor.
+
+Bool PrvGetRelativePath (const EmDirRef& from, const EmFileRef& to,
+						 uint32& ups, StringList& names)
+{
+	names.clear ();
+	names.push_back (to.GetName ());
+
+	EmDirRef	dir = to.GetParent ();
+
+	while (dir.IsSpecified ())
+	{
+		// See if this directory is "from" or one of its parents.
+
+		uint32		count = 0;
+		EmDirRef	ancestor = from;
+
+		while (ancestor.IsSpecified ())
+		{
+			if (ancestor == dir)
+			{
+				ups = count;
+				return true;
+			}
+
+			ancestor = ancestor.GetParent ();
+			++count;
+		}
+
+		names.insert (names.begin (), dir.GetName ());
+		dir = dir.GetParent ();
+	}
+
+	return false;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvResolveRelativePath
+// ---------------------------------------------------------------------------
+// Reverse PrvGetRelativePath.  Returns an unspecified EmFileRef if "from"
+// doesn't have enough parents.
+
+EmFileRef PrvResolveRelativePath (const EmDirRef& from, uint32 ups,
+								  const StringList& names)
+{
+	EmDirRef	dir = from;
+
+	for (uint32 ii = 0; ii < ups; ++ii)
+	{
+		dir = dir.GetParent ();
+
+		if (!dir.IsSpecified ())
+		{
+			return EmFileRef ();
+		}
+	}
+
+	for (StringList::size_type jj = 0; jj + 1 < names.size (); ++jj)
+	{
+		dir = EmDirRef (dir, names[jj]);
+	}
+
+	return EmFileRef (dir, names.back ());
+}
@@ -14,6 +14,7 @@
 #ifndef EmBankSRAM_h
 #define EmBankSRAM_h
 
+class EmFileRef;
 class SessionFile;
 
 extern emuptr	gMemoryStart;
@@ -22,8 +23,27 @@ extern emuptr	gMemoryStart;
 extern uint32	gRAMBank_Size;
 extern uint32	gRAMBank_Mask;
 extern uint8*	gRAM_Memory;
+
+	// One byte of MetaMemory access bits per byte of RAM.  The CPU core
+	// and the bank accessors index it directly, so it's never packed in
+	// memory; only its session file image is (see MetaMemory::SaveRAMImage).
 extern uint8*	gRAM_MetaMemory;
 
+	// One byte per kMetaSummaryPageSize bytes of gRAM_MetaMemory, holding
+	// the access bits set anywhere in that page.  Maintained by MetaMemory.
+extern uint8*	gRAM_MetaSummary;
+
+const int		kMetaSummaryShift		= 8;
+const uint32	kMetaSummaryPageSize	= 1 << kMetaSummaryShift;
+
+	// One byte per kDirtyPageSize bytes of gRAM_Memory, non-zero if that
+	// page has changed since RAM last matched the base image (see
+	// EmBankSRAM::SetBaseImage).  Set by the SRAM and DRAM put functions.
+extern uint8*	gRAM_DirtyPages;
+
+const int		kDirtyPageShift			= 12;
+const uint32	kDirtyPageSize			= 1 << kDirtyPageShift;
+
 
 class EmBankSRAM
 {
@@ -49,6 +69,26 @@ class EmBankSRAM
 
 		static emuptr			GetMemoryStart		(void) { return gMemoryStart; }
 
+		// Record that the given range of gRAM_Memory (as an offset from
+		// its start) has been written to.
+
+		static void				NoteDirty			(uint32 offset, uint32 size)
+								{
+									gRAM_DirtyPages[offset >> kDirtyPageShift] = 1;
+									gRAM_DirtyPages[((offset + size - 1) & gRAMBank_Mask) >> kDirtyPageShift] = 1;
+								}
+
+		static void				NoteDirtyRange		(uint32 offset, uint32 size);
+
+		// Declare that RAM currently matches the RAM image in the given
+		// session file.  Until the base is cleared (on Reset, or on
+		// loading a full RAM image), session files saved with
+		// SessionFile::SetSaveRAMDelta hold only the pages that differ
+		// from it.
+
+		static void				SetBaseImage		(const EmFileRef&);
+		static void				ClearBaseImage		(void);
+
 	private:
 		static void				AddressError		(emuptr address, long size, Bool forRead);
 		static void				InvalidAccess		(emuptr address, long size, Bool forRead);
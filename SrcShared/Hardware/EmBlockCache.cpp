@@ -0,0 +1,552 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#include "EmCommon.h"
+#include "EmBlockCache.h"
+
+#include "EmBankDRAM.h"			// EmBankDRAM::SetLong
+#include "EmBankROM.h"			// EmBankROM::SetLong, EmBankFlash::SetLong
+#include "EmBankSRAM.h"			// EmBankSRAM::SetLong
+#include "EmMemory.h"			// EmMemGetBank, EmMemGetRealAddress
+#include "Platform.h"			// AllocateMemoryClear
+
+
+// Number of blocks in the cache.  Must be a power of 2.
+
+const int	kNumBlocks			= 4096;
+
+// Number of times a block start must be seen before we translate it.
+
+const int	kHotThreshold		= 16;
+
+// Translated code is protected by flags covering (kPageShift) pages of host
+// memory.  A write that starts up to 3 bytes before a block can modify its
+// first opcode, so the protected range is extended backwards to cover that.
+
+const int	kWriteSlop			= 3;
+
+// Number of blocks available for code in ROM.  When they're all used up,
+// the ROM blocks are thrown away and translation starts over.
+
+const int	kNumROMBlocks		= 8192;
+
+// Longest 68K instruction, in bytes.  Used to bound how far back from a
+// ROM write a block containing the written location can start.
+
+const int	kMaxOpLength		= 10;
+
+
+EmTranslatedBlock*	EmBlockCache::fgBlocks;
+uint8				EmBlockCache::fgCodePages[kNumPageFlags];
+uint8				EmBlockCache::fgEndsBlock[65536];
+
+uint8*				EmBlockCache::fgROMStart;
+uint32				EmBlockCache::fgROMSize;
+uint16*				EmBlockCache::fgROMSlots;
+EmTranslatedBlock*	EmBlockCache::fgROMBlocks;
+int					EmBlockCache::fgROMBlocksUsed;
+
+
+static inline uint32 PrvBlockIndex (uint8* hostPC)
+{
+	return (uint32) (((size_t) hostPC) >> 1) & (kNumBlocks - 1);
+}
+
+
+static inline void PrvClearBlock (EmTranslatedBlock* block)
+{
+	block->fHostStart	= NULL;
+	block->fHostEnd		= NULL;
+	block->fNumOps		= 0;
+	block->fHits		= 0;
+	block->fComplete	= false;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::Initialize
+// ---------------------------------------------------------------------------
+// Allocate the block storage.  Called when block translation is turned on.
+
+void EmBlockCache::Initialize (void)
+{
+	if (fgBlocks == NULL)
+	{
+		fgBlocks = (EmTranslatedBlock*) Platform::AllocateMemoryClear (
+						kNumBlocks * sizeof (EmTranslatedBlock));
+	}
+
+	if (fgROMBlocks == NULL)
+	{
+		fgROMBlocks = (EmTranslatedBlock*) Platform::AllocateMemoryClear (
+						kNumROMBlocks * sizeof (EmTranslatedBlock));
+	}
+
+	EmBlockCache::SetROM (fgROMStart, fgROMSize);
+	EmBlockCache::Reset ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::Reset
+// ---------------------------------------------------------------------------
+
+void EmBlockCache::Reset (void)
+{
+	EmBlockCache::InvalidateAll ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::Dispose
+// ---------------------------------------------------------------------------
+// Release the block storage.  Called when block translation is turned off.
+
+void EmBlockCache::Dispose (void)
+{
+	Platform::DisposeMemory (fgBlocks);
+	Platform::DisposeMemory (fgROMBlocks);
+	Platform::DisposeMemory (fgROMSlots);
+
+	fgROMBlocksUsed = 0;
+
+	memset (fgCodePages, 0, sizeof (fgCodePages));
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::SetROM
+// ---------------------------------------------------------------------------
+// Note the location of the ROM image.  If block translation is on, allocate
+// the table used to find ROM blocks; otherwise, just remember the range so
+// that Initialize can allocate it later.
+
+void EmBlockCache::SetROM (uint8* romStart, uint32 romSize)
+{
+	Platform::DisposeMemory (fgROMSlots);
+
+	fgROMStart		= romStart;
+	fgROMSize		= romSize;
+	fgROMBlocksUsed	= 0;
+
+	if (fgROMBlocks && romSize)
+	{
+		fgROMSlots = (uint16*) Platform::AllocateMemoryClear (
+						(romSize / sizeof (uint16)) * sizeof (uint16));
+	}
+
+	EmBlockCache::ResetROM ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::Lookup
+// ---------------------------------------------------------------------------
+// Return the translated block starting at the given host address, or NULL
+// if there isn't one.
+
+EmTranslatedBlock* EmBlockCache::Lookup (uint8* hostPC)
+{
+	EmAssert (fgBlocks);
+
+	EmTranslatedBlock*	block;
+
+	if (fgROMSlots && IsROM (hostPC))
+	{
+		uint16	slot = fgROMSlots[(hostPC - fgROMStart) / sizeof (uint16)];
+
+		if (slot == 0)
+		{
+			return NULL;
+		}
+
+		block = &fgROMBlocks[slot - 1];
+	}
+	else
+	{
+		block = &fgBlocks[::PrvBlockIndex (hostPC)];
+	}
+
+	if (block->fHostStart == hostPC && block->fComplete)
+	{
+		return block;
+	}
+
+	return NULL;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::BeginBlock
+// ---------------------------------------------------------------------------
+// Called after Lookup fails.  Counts the number of times the given block
+// start has been seen.  If it has been seen often enough, return a block
+// for the CPU loop to record the following instructions into.  Otherwise,
+// return NULL.  Code in ROM is always translated the first time it's seen.
+
+EmTranslatedBlock* EmBlockCache::BeginBlock (uint8* hostPC, emuptr pc)
+{
+	EmAssert (fgBlocks);
+
+	if (fgROMSlots && IsROM (hostPC))
+	{
+		return EmBlockCache::BeginROMBlock (hostPC);
+	}
+
+	EmTranslatedBlock*	block = &fgBlocks[::PrvBlockIndex (hostPC)];
+
+	if (block->fHostStart != hostPC)
+	{
+		::PrvClearBlock (block);
+		block->fHostStart = hostPC;
+	}
+
+	if (++block->fHits < kHotThreshold)
+	{
+		return NULL;
+	}
+
+	block->fHits = 0;
+
+	// Only translate code in RAM and ROM.  Those are the only banks whose
+	// "put" functions tell us when they change.
+
+	EmMemPutFunc	longSetter = EmMemGetBank (pc).lput;
+
+	if (longSetter != EmBankDRAM::SetLong &&
+		longSetter != EmBankSRAM::SetLong &&
+		longSetter != EmBankROM::SetLong &&
+		longSetter != EmBankFlash::SetLong)
+	{
+		return NULL;
+	}
+
+	block->fHostEnd		= hostPC;
+	block->fNumOps		= 0;
+	block->fComplete	= false;
+
+	return block;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::AppendOp
+// ---------------------------------------------------------------------------
+// Add an instruction to the block being recorded.  "length" is the number
+// of bytes the instruction occupies, or zero if it ends the block.  Returns
+// false if the block was invalidated while being recorded, or if it's full.
+
+Bool EmBlockCache::AppendOp (EmTranslatedBlock* block, uint8* hostPC,
+							 cpuop_func* handler, uint16 opcode, uint16 length)
+{
+	// Make sure that the block wasn't invalidated out from under us (say,
+	// by an instruction in it writing to itself), and that the instruction
+	// immediately follows the previous one.
+
+	if (block->fComplete || block->fHostEnd != hostPC || block->fHostStart == NULL)
+	{
+		return false;
+	}
+
+	if (block->fNumOps >= kBlockCacheMaxOps)
+	{
+		return false;
+	}
+
+	EmTranslatedOp&	op = block->fOps[block->fNumOps++];
+
+	op.fHandler	= handler;
+	op.fOpcode	= opcode;
+	op.fLength	= length;
+
+	// Protect the opcode word.  Extension words are always re-read from
+	// memory by the handler, so they don't need protecting, but they
+	// need to be skipped over to find the next opcode.  ROM blocks are
+	// protected by NoteROMWrite instead.
+
+	if (!IsROM (hostPC))
+	{
+		EmBlockCache::MarkPages (hostPC, hostPC + sizeof (uint16));
+	}
+
+	block->fHostEnd = hostPC + (length ? length : sizeof (uint16));
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::EndBlock
+// ---------------------------------------------------------------------------
+// Finish recording a block, making it available to Lookup.  Empty blocks
+// (e.g., the first instruction caused an exception) are thrown away.
+
+void EmBlockCache::EndBlock (EmTranslatedBlock* block)
+{
+	if (block->fHostStart == NULL)
+	{
+		return;
+	}
+
+	if (block->fNumOps == 0)
+	{
+		::PrvClearBlock (block);
+		return;
+	}
+
+	block->fComplete = true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::InvalidateAll
+// ---------------------------------------------------------------------------
+// Throw away all translated blocks.  Called when memory is wholesale
+// replaced (reset, session load, etc.).
+
+void EmBlockCache::InvalidateAll (void)
+{
+	if (fgBlocks)
+	{
+		for (int ii = 0; ii < kNumBlocks; ++ii)
+		{
+			::PrvClearBlock (&fgBlocks[ii]);
+		}
+	}
+
+	memset (fgCodePages, 0, sizeof (fgCodePages));
+
+	EmBlockCache::ResetROM ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::InvalidateAddress
+// ---------------------------------------------------------------------------
+// Throw away any translated blocks containing the given emulated address.
+// Called when an instruction breakpoint is set, as translated blocks don't
+// check for them.
+
+void EmBlockCache::InvalidateAddress (emuptr address)
+{
+	if (!EmMemCheckAddress (address, sizeof (uint16)))
+	{
+		return;
+	}
+
+	uint8*	realAddress = EmMemGetRealAddress (address);
+
+	EmBlockCache::NoteWrite (realAddress);
+
+	if (IsROM (realAddress))
+	{
+		EmBlockCache::NoteROMWrite (realAddress);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::InvalidatePage
+// ---------------------------------------------------------------------------
+// Throw away any translated blocks whose code pages map to the same page
+// flag as the given address.  Page flags are hashed, so this may also
+// throw away blocks in unrelated pages, which is harmless.
+
+void EmBlockCache::InvalidatePage (uint8* realAddress)
+{
+	uint32	index = PageIndex (realAddress);
+
+	if (fgBlocks)
+	{
+		for (int ii = 0; ii < kNumBlocks; ++ii)
+		{
+			EmTranslatedBlock*	block = &fgBlocks[ii];
+
+			if (block->fHostStart == NULL || block->fHostEnd == block->fHostStart)
+			{
+				continue;
+			}
+
+			uint32	first	= PageIndex (block->fHostStart - kWriteSlop);
+			uint32	last	= PageIndex (block->fHostEnd - 1);
+
+			for (uint32 page = first; ; page = (page + 1) & (kNumPageFlags - 1))
+			{
+				if (page == index)
+				{
+					::PrvClearBlock (block);
+					break;
+				}
+
+				if (page == last)
+				{
+					break;
+				}
+			}
+		}
+	}
+
+	fgCodePages[index] = 0;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::NoteWriteRange
+// ---------------------------------------------------------------------------
+// Like NoteWrite, but for a run of bytes written all at once (as by
+// EmMem_memcpy) rather than through the bank "put" functions.
+
+void EmBlockCache::NoteWriteRange (uint8* begin, uint8* end)
+{
+	if (begin >= end)
+	{
+		return;
+	}
+
+	uint32	first	= PageIndex (begin);
+	uint32	last	= PageIndex (end - 1);
+
+	for (uint32 page = first; ; page = (page + 1) & (kNumPageFlags - 1))
+	{
+		if (fgCodePages[page])
+		{
+			uint32	delta = (page - first) & (kNumPageFlags - 1);
+
+			InvalidatePage (begin + (delta << kPageShift));
+		}
+
+		if (page == last)
+		{
+			break;
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::MarkPages
+// ---------------------------------------------------------------------------
+
+void EmBlockCache::MarkPages (uint8* begin, uint8* end)
+{
+	uint32	first	= PageIndex (begin - kWriteSlop);
+	uint32	last	= PageIndex (end - 1);
+
+	for (uint32 page = first; ; page = (page + 1) & (kNumPageFlags - 1))
+	{
+		fgCodePages[page] = 1;
+
+		if (page == last)
+		{
+			break;
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::BeginROMBlock
+// ---------------------------------------------------------------------------
+// Return a block for recording the ROM code at the given address, reusing
+// the one already assigned to that address if there is one.
+
+EmTranslatedBlock* EmBlockCache::BeginROMBlock (uint8* hostPC)
+{
+	uint16&	slot = fgROMSlots[(hostPC - fgROMStart) / sizeof (uint16)];
+
+	if (slot == 0)
+	{
+		// Out of blocks.  Throw them all away and start over.  This is
+		// safe, as no block is being executed or recorded at this point.
+
+		if (fgROMBlocksUsed == kNumROMBlocks)
+		{
+			EmBlockCache::ResetROM ();
+		}
+
+		slot = (uint16) ++fgROMBlocksUsed;
+	}
+
+	EmTranslatedBlock*	block = &fgROMBlocks[slot - 1];
+
+	::PrvClearBlock (block);
+
+	block->fHostStart	= hostPC;
+	block->fHostEnd		= hostPC;
+
+	return block;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::InvalidateROM
+// ---------------------------------------------------------------------------
+// Throw away any ROM blocks that include the given address.  Called when the
+// flash is programmed.  A block can't start more than kBlockCacheMaxOps
+// instructions before the address, so only that many slots need checking.
+
+void EmBlockCache::InvalidateROM (uint8* realAddress)
+{
+	if (!fgROMSlots || !IsROM (realAddress))
+	{
+		return;
+	}
+
+	uint32	offset	= realAddress - fgROMStart;
+	uint32	first	= offset > kBlockCacheMaxOps * kMaxOpLength ?
+						offset - kBlockCacheMaxOps * kMaxOpLength : 0;
+	uint32	last	= offset + sizeof (uint32);
+
+	if (last > fgROMSize)
+	{
+		last = fgROMSize;
+	}
+
+	for (uint32 ii = first / sizeof (uint16); ii < last / sizeof (uint16); ++ii)
+	{
+		if (fgROMSlots[ii] == 0)
+		{
+			continue;
+		}
+
+		EmTranslatedBlock*	block = &fgROMBlocks[fgROMSlots[ii] - 1];
+
+		if (block->fHostStart &&
+			block->fHostStart - kWriteSlop <= realAddress &&
+			block->fHostEnd > realAddress)
+		{
+			::PrvClearBlock (block);
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmBlockCache::ResetROM
+// ---------------------------------------------------------------------------
+// Throw away all ROM blocks.
+
+void EmBlockCache::ResetROM (void)
+{
+	if (fgROMSlots)
+	{
+		memset (fgROMSlots, 0, (fgROMSize / sizeof (uint16)) * sizeof (uint16));
+	}
+
+	for (int ii = 0; ii < fgROMBlocksUsed; ++ii)
+	{
+		::PrvClearBlock (&fgROMBlocks[ii]);
+	}
+
+	fgROMBlocksUsed = 0;
+}
@@ -0,0 +1,151 @@
+/* -*- mode: C++; tab-width: 4 -*- */
+/* ===================================================================== *\
+	Copyright (c) 2001 Palm, Inc. or its subsidiaries.
+	All rights reserved.
+
+	This file is part of the Palm OS Emulator.
+
+	This program is free software; you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation; either version 2 of the License, or
+	(at your option) any later version.
+\* ===================================================================== */
+
+#ifndef EmBlockCache_h
+#define EmBlockCache_h
+
+#include "UAE.h"				// cpuop_func
+
+/*
+	EmBlockCache holds translated basic blocks for EmCPU68K.  A basic block
+	is a run of straight-line 68K instructions ending with an instruction
+	that changes the flow of control (a branch, jump, trap, RTS, etc.).
+
+	Instead of fetching, byteswapping, and dispatching each opcode as the
+	interpreter does, a translated block holds the already-decoded handler
+	and opcode for each instruction, along with its length.  The CPU loop
+	can then execute the block by calling the handlers in turn, checking
+	only that the PC advanced as expected.
+
+	Blocks are keyed on the host address of their first instruction.  They
+	are created by recording the instructions the interpreter executes
+	once a block start has been seen often enough to be considered "hot".
+
+	Blocks are dropped when the memory they were translated from changes.
+	The bank "put" functions call EmBlockCache::NoteWrite, which checks a
+	small table of page flags and, if any translated code lives in the
+	page being written to, invalidates the affected blocks.
+
+	Code in ROM is handled separately.  Most emulated time is spent in the
+	ROM, and the ROM only changes when the flash is programmed, so ROM
+	blocks are translated the first time they're executed and are found
+	through a table indexed directly by offset into the ROM image.  They
+	don't compete with RAM blocks for slots and don't use the page flags;
+	the ROM and flash banks call EmBlockCache::NoteROMWrite instead.
+*/
+
+const int	kBlockCacheMaxOps	= 32;	// Max instructions in a block.
+
+struct EmTranslatedOp
+{
+	cpuop_func*		fHandler;
+	uint16			fOpcode;
+	uint16			fLength;			// Zero for the block-ending instruction.
+};
+
+struct EmTranslatedBlock
+{
+	uint8*			fHostStart;			// Host address of first opcode; NULL if unused.
+	uint8*			fHostEnd;			// Host address just past last opcode word.
+	uint16			fNumOps;
+	uint16			fHits;
+	Bool			fComplete;
+	EmTranslatedOp	fOps[kBlockCacheMaxOps];
+};
+
+
+class EmBlockCache
+{
+	public:
+		static void					Initialize		(void);
+		static void					Reset			(void);
+		static void					Dispose			(void);
+
+		// Called from the CPU loop.
+
+		static EmTranslatedBlock*	Lookup			(uint8* hostPC);
+		static EmTranslatedBlock*	BeginBlock		(uint8* hostPC, emuptr pc);
+		static Bool					AppendOp		(EmTranslatedBlock*,
+													 uint8* hostPC,
+													 cpuop_func* handler,
+													 uint16 opcode,
+													 uint16 length);
+		static void					EndBlock		(EmTranslatedBlock*);
+
+		// Called when the code a block was translated from may have changed.
+
+		static void					InvalidateAll	(void);
+		static void					InvalidateAddress	(emuptr address);
+
+		static void					NoteWrite		(uint8* realAddress)
+									{
+										if (fgCodePages[PageIndex (realAddress)])
+										{
+											InvalidatePage (realAddress);
+										}
+									}
+
+		static void					NoteWriteRange	(uint8* begin, uint8* end);
+
+		static void					NoteROMWrite	(uint8* realAddress)
+									{
+										if (fgROMBlocksUsed)
+										{
+											InvalidateROM (realAddress);
+										}
+									}
+
+		// Called by EmBankROM when the ROM image is loaded or disposed of.
+
+		static void					SetROM			(uint8* romStart, uint32 romSize);
+
+		// Per-opcode table: non-zero if the opcode ends a basic block.
+		// Filled in by EmCPU68K::InitializeUAETables.
+
+		static uint8				fgEndsBlock[65536];
+
+	private:
+		enum
+		{
+			kPageShift		= 8,
+			kNumPageFlags	= 0x10000
+		};
+
+		static uint32				PageIndex		(uint8* p)
+									{
+										return (uint32) (((size_t) p) >> kPageShift) & (kNumPageFlags - 1);
+									}
+
+		static void					InvalidatePage	(uint8* realAddress);
+		static void					MarkPages		(uint8* begin, uint8* end);
+
+		static Bool					IsROM			(uint8* p)
+									{
+										return (size_t) (p - fgROMStart) < fgROMSize;
+									}
+
+		static EmTranslatedBlock*	BeginROMBlock	(uint8* hostPC);
+		static void					InvalidateROM	(uint8* realAddress);
+		static void					ResetROM		(void);
+
+		static EmTranslatedBlock*	fgBlocks;
+		static uint8				fgCodePages[kNumPageFlags];
+
+		static uint8*				fgROMStart;
+		static uint32				fgROMSize;
+		static uint16*				fgROMSlots;		// Per ROM word: 1 + index of its block, or 0.
+		static EmTranslatedBlock*	fgROMBlocks;
+		static int					fgROMBlocksUsed;
+};
+
+#endif	// EmBlockCache_h
@@ -15,15 +15,18 @@
 #include "EmCPU68K.h"
 
 #include "Byteswapping.h"		// Canonical
-#include "DebugMgr.h"			// gExceptionAddress, gExceptionSize, gExceptionForRead
+#include "DebugMgr.h"			// gExceptionAddress, gExceptionSize, gExceptionForRead, ConnectedToTCPDebugger
 #include "EmBankROM.h"			// EmBankROM::GetMemoryStart
+#include "EmBlockCache.h"		// EmBlockCache
 #include "EmEventPlayback.h"	// EmEventPlayback::ReplayingEvents
 #include "EmHAL.h"				// EmHAL::GetInterruptLevel
 #include "EmMemory.h"			// CEnableFullAccess
 #include "EmMinimize.h"			// IsOn
+#include "EmRPC.h"				// RPC::HandlingPacket
 #include "EmSession.h"			// HandleInstructionBreak
-#include "Logging.h"			// LogAppendMsg
+#include "Logging.h"			// LogAppendMsg, ReportStackAlmostOverflow
 #include "MetaMemory.h"			// IsCPUBreak
+#include "Miscellaneous.h"		// UseDeterministicClock
 #include "Platform.h"			// GetMilliseconds
 #include "SessionFile.h"		// WriteDBallRegs, etc.
 #include "StringData.h"			// kExceptionNames
@@ -31,6 +34,7 @@
 #include "EmPalmStructs.h"
 
 #include <algorithm>			// find
+#include <map>					// map
 
 #if __profile__
 #include <Profiler.h>
@@ -65,6 +69,62 @@ int	movem_next[256];						// (normally in newcpu.c)
 
 cpuop_func*	cpufunctbl[65536];				// (normally in newcpu.c)
 
+// The two tables that cpufunctbl is copied from.  The checked table is
+// built from op_smalltbl_3; its handlers call the hooks that Poser uses to
+// watch stack usage, subroutine calls, and changes to the PC.  The lean
+// table is built from op_smalltbl_4, which gencpu generates without the
+// JSR/BSR/RTS/RTE hooks and with pushes checked only for actual stack
+// overflow.  Both make the stack overflow and invalid PC checks.  See
+// EmCPU68K::UpdateFunctable.
+
+static cpuop_func*	gCheckedFunctbl[65536];
+static cpuop_func*	gLeanFunctbl[65536];
+static Bool			gLeanFunctblActive;
+
+static void			PrvBuildFunctbl (cpuop_func** functbl, struct cputbl* tbl);
+
+// Instruction breaks.  Rather than having the CPU loop check MetaMemory
+// for a break before every instruction, the cpufunctbl entries for the
+// opcodes found at break locations are replaced with PrvBreakHandler.
+// That checks for a break at the PC, handles it if there is one, and then
+// calls the real handler.  Emulated memory is left untouched, and when no
+// breaks are set, the CPU loop makes no checks at all.
+//
+// gBreakOpcodes maps each break location to the opcode we found there
+// (or kNoBreakOpcode if it couldn't be read), and gBreakOpcodeCounts
+// holds the number of break locations using each opcode.  The opcodes are
+// re-read when the break list changes, when memory in a page holding a
+// break location is written to (see EmCPU68K::NoteWrite), and when
+// Execute is entered.
+
+const EmOpcode68K	kNoBreakOpcode = 0x10000;
+
+typedef map<emuptr, EmOpcode68K>	EmBreakOpcodeMap;
+typedef map<EmOpcode68K, int>		EmBreakOpcodeCountMap;
+
+static EmBreakOpcodeMap			gBreakOpcodes;
+static EmBreakOpcodeCountMap	gBreakOpcodeCounts;
+
+uint8							EmCPU68K::fgBreakPages[kNumBreakPageFlags];
+
+static unsigned long		PrvBreakHandler (uae_u32 opcode);
+static EmOpcode68K			PrvGetBreakOpcode (emuptr opcodeLocation);
+static void					PrvAddBreakOpcode (EmOpcode68K opcode);
+static void					PrvRemoveBreakOpcode (EmOpcode68K opcode);
+static void					PrvSetHandler (EmOpcode68K opcode);
+
+#if HAS_THREADED_CPU
+// The threaded core's dispatch table, built by ExecuteThreaded.  It's kept
+// out here so that PrvSetHandler can send opcodes with breaks on them
+// through ThreadedCall, which calls PrvBreakHandler.
+
+static void*				gThreadedDispatch[0x10000];
+static map<cpuop_func*, void*>	gThreadedLabels;
+static void*				gThreadedCallLabel;
+
+static void*				PrvThreadedLabel (EmOpcode68K opcode);
+#endif
+
 uint16	last_op_for_exception_3;			/* Opcode of faulting instruction */
 emuptr	last_addr_for_exception_3;			/* PC at fault time */
 emuptr	last_fault_for_exception_3; 		/* Address that generated the exception */
@@ -150,6 +210,11 @@ EmCPU68K::EmCPU68K (EmSession* session) :
 	EmCPU (session),
 	fLastTraceAddress (EmMemNULL),
 	fCycleCount (0),
+	fExceptionCount (0),
+	fTranslateBlocks (false),
+	fFastForwardIdle (false),
+	fBlockCacheActive (false),
+	fActiveHooks (0),
 //	fExceptionHandlers (),
 	fHookJSR (),
 	fHookJSR_Ind (),
@@ -169,6 +234,16 @@ EmCPU68K::EmCPU68K (EmSession* session) :
 {
 	this->InitializeUAETables ();
 
+	Preference<bool>	pref (kPrefKeyTranslateBlocks);
+	fTranslateBlocks = *pref;
+
+	Preference<bool>	prefIdle (kPrefKeyFastForwardIdle);
+	fFastForwardIdle = *prefIdle || ::UseDeterministicClock ();
+
+	gPrefs->AddNotification (&EmCPU68K::PrefsChangedCB, kPrefKeyTranslateBlocks, this);
+	gPrefs->AddNotification (&EmCPU68K::PrefsChangedCB, kPrefKeyFastForwardIdle, this);
+	gPrefs->AddNotification (&EmCPU68K::PrefsChangedCB, kPrefKeyDeterministicClock, this);
+
 	EmAssert (gCPU68K == NULL);
 	gCPU68K = this;
 }
@@ -180,6 +255,20 @@ EmCPU68K::EmCPU68K (EmSession* session) :
 
 EmCPU68K::~EmCPU68K (void)
 {
+	gPrefs->RemoveNotification (&EmCPU68K::PrefsChangedCB);
+
+	if (fBlockCacheActive)
+	{
+		EmBlockCache::Dispose ();
+	}
+
+	// Forget about any instruction breaks left over from this session.
+
+	while (!gBreakOpcodes.empty ())
+	{
+		EmCPU68K::RemoveInstructionBreak (gBreakOpcodes.begin ()->first);
+	}
+
 	EmAssert (gCPU68K == this);
 	gCPU68K = NULL;
 }
@@ -209,6 +298,8 @@ void EmCPU68K::Reset (Bool hardwareReset)
 	gStackLow				= EmMemNULL;
 	gKernelStackOverflowed	= false;
 
+	EmBlockCache::InvalidateAll ();
+
 	if (hardwareReset)
 	{
 		// (taken from m68k_reset in newcpu.c)
@@ -273,6 +364,8 @@ void EmCPU68K::Load (SessionFile& f)
 
 	Canonical (tempRegs);
 	this->SetRegisters (tempRegs);
+
+	EmBlockCache::InvalidateAll ();
 }
 
 
@@ -288,6 +381,74 @@ void EmCPU68K::Execute (void)
 	// important that it run as quickly as possible.  To that end,
 	// fine tune register allocation as much as we can by hand.
 
+#if !REGISTER_HISTORY
+	// -----------------------------------------------------------------------
+	// If block translation is turned on, run the version of this loop that
+	// executes translated blocks.  Only switch modes at the outermost level;
+	// a nested call (made while calling the ROM as a subroutine) must not
+	// dispose of blocks the outer loop may be in the middle of executing.
+	// -----------------------------------------------------------------------
+
+	if (!fSession->IsNested () && fTranslateBlocks != fBlockCacheActive)
+	{
+		if (fTranslateBlocks)
+			EmBlockCache::Initialize ();
+		else
+			EmBlockCache::Dispose ();
+
+		fBlockCacheActive = fTranslateBlocks;
+	}
+
+	// -----------------------------------------------------------------------
+	// Switch between the checked and lean opcode tables if the need for the
+	// checks has changed.  This also throws away translated blocks, so it's
+	// subject to the same restriction on nested calls.
+	// -----------------------------------------------------------------------
+
+	if (!fSession->IsNested ())
+	{
+		this->UpdateFunctable ();
+	}
+
+	// -----------------------------------------------------------------------
+	// Make sure that the opcodes at instruction break locations still have
+	// their handlers replaced.  Writes made through the memory banks are
+	// caught by NoteWrite, but memory can also be replaced wholesale (as
+	// when a session is loaded) without going through them.
+	// -----------------------------------------------------------------------
+
+	EmCPU68K::UpdateInstructionBreaks ();
+
+#if HAS_PROFILING
+	if (fBlockCacheActive && !gProfilingEnabled)
+#else
+	if (fBlockCacheActive)
+#endif
+	{
+		this->ExecuteTranslated ();
+		return;
+	}
+
+#if HAS_THREADED_CPU
+	// -----------------------------------------------------------------------
+	// If we were built with the threaded CPU core, run that instead of the
+	// loop below.  It doesn't do the per-instruction profiling work, so
+	// fall back to the loop below when profiling.  Its handlers are the
+	// checked ones, so also fall back when the lean table is in use.
+	// -----------------------------------------------------------------------
+
+#if HAS_PROFILING
+	if (!gProfilingEnabled && !gLeanFunctblActive)
+#else
+	if (!gLeanFunctblActive)
+#endif
+	{
+		this->ExecuteThreaded ();
+		return;
+	}
+#endif
+#endif
+
 #if defined(__powerc) || defined(powerc) || \
 	defined(__powerpc) || defined(powerpc) || \
 	defined(__ppc__) || defined(ppc)
@@ -387,17 +548,11 @@ void EmCPU68K::Execute (void)
 #endif
 
 		// -----------------------------------------------------------------------
-		// See if we need to halt CPU execution at this location.  We could need
-		// to do this for several reasons, including hitting soft breakpoints or
-		// needing to execute tailpatches.
+		// There's no check here for halting CPU execution at this location
+		// (for soft breakpoints, tailpatches, etc.).  Opcodes at those
+		// locations are dispatched to PrvBreakHandler, which does it.
 		// -----------------------------------------------------------------------
 
-		if (MetaMemory::IsCPUBreak (pc_meta_oldp + (pc_p - pc_oldp)))
-		{
-			EmAssert (session);
-			session->HandleInstructionBreak ();
-		}
-
 #if HAS_PROFILING
 		emuptr	pcStart;
 		pcStart = m68k_getpc ();
@@ -457,11 +612,13 @@ void EmCPU68K::Execute (void)
 		//
 		//	both result in the period doubling, but also in better code
 		//	generation.  However, neither gives better performance.  Additionally,
-		//	I tried like heck to optimize the call to IsCPUBreak above.  I added
-		//	a preflight check that would skip 70% of the calls to IsCPUBreak (as
-		//	well as the calculation of the parameter passed to it) and re-
-		//	organized the code so that branch prediction would work.  However,
-		//	none of that resulted in better performance.
+		//	I tried like heck to optimize the call to IsCPUBreak that used to be
+		//	made here.  I added a preflight check that would skip 70% of the
+		//	calls to IsCPUBreak (as well as the calculation of the parameter
+		//	passed to it) and re-organized the code so that branch prediction
+		//	would work.  However, none of that resulted in better performance.
+		//	What finally worked was not making the call at all; see
+		//	PrvBreakHandler.
 		// -----------------------------------------------------------------------
 		EmOpcode68K	opcode;
 	//	opcode = get_iword (0);
@@ -569,11 +726,6 @@ void EmCPU68K::ExecuteSimple (void)
 
 	while (1)
 	{
-		if (MetaMemory::IsCPUBreak (regs.pc_meta_oldp + (regs.pc_p - regs.pc_oldp)))
-		{
-			this->HandleInstructionBreak ();
-		}
-
 		EmOpcode68K	opcode;
 		opcode = get_iword (0);
 		fCycleCount += cpufunctbl[opcode] (opcode);
@@ -592,6 +744,264 @@ StoppedLoop:
 #endif
 
 
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::ExecuteTranslated
+// ---------------------------------------------------------------------------
+// Version of Execute that runs translated basic blocks out of EmBlockCache.
+// Instructions that aren't part of a translated block are interpreted as
+// usual, and while doing that "hot" blocks are recorded for later use.
+//
+// This loop must behave exactly like Execute.  In particular:
+//
+//	*	Each instruction in a block is still followed by CYCLE, and the
+//		spcflags are checked after each one.  We leave the block if any
+//		are set so that ExecuteSpecial sees them at the same point.
+//
+//	*	Instruction breaks are handled by PrvBreakHandler, which blocks
+//		record like any other handler.  Setting a break throws away any
+//		blocks containing it, as they hold the handler from before.
+//
+//	*	We leave a block early if the PC doesn't advance to the next
+//		instruction (say, because of an exception) or if the block was
+//		invalidated by a write to the code it came from.
+
+void EmCPU68K::ExecuteTranslated (void)
+{
+	int					counter			= 0;
+	cpuop_func**		functable		= cpufunctbl;
+	EmSession*			session			= fSession;
+	Bool				blockStart		= true;
+	EmTranslatedBlock*	recording		= NULL;
+
+	if ((regs.spcflags & SPCFLAG_STOP) != 0)
+		goto StoppedLoop;
+
+	while (1)
+	{
+		// -----------------------------------------------------------------------
+		// At the start of a block, see if it's been translated.  If so, run it.
+		// If not, see if it's time to record it.
+		// -----------------------------------------------------------------------
+
+		if (blockStart)
+		{
+			EmAssert (recording == NULL);
+
+			EmTranslatedBlock*	block = EmBlockCache::Lookup (regs.pc_p);
+
+			if (block)
+			{
+				uint8*				start	= block->fHostStart;
+				EmTranslatedOp*		op		= block->fOps;
+				EmTranslatedOp*		end		= op + block->fNumOps;
+
+				while (1)
+				{
+					uint8*	next = regs.pc_p + op->fLength;
+
+					fCycleCount += (op->fHandler) (op->fOpcode);
+
+					CYCLE (false);
+
+					if (++op == end ||
+						regs.spcflags ||
+						regs.pc_p != next ||
+						block->fHostStart != start)
+					{
+						break;
+					}
+				}
+
+				goto StoppedLoop;
+			}
+
+			if (!session->IsNested ())
+			{
+				recording = EmBlockCache::BeginBlock (regs.pc_p, m68k_getpc ());
+			}
+		}
+
+		// -----------------------------------------------------------------------
+		// Interpret the opcode, adding it to the block being recorded (if any).
+		// -----------------------------------------------------------------------
+
+		{
+			EmOpcode68K		opcode;
+			uint8*			opStart		= regs.pc_p;
+			uint8*			opOldp		= regs.pc_oldp;
+			uint32			opExceptions	= fExceptionCount;
+
+			opcode = do_get_mem_word (opStart);
+			fCycleCount += (functable[opcode]) (opcode);
+
+			Bool	endsBlock	= EmBlockCache::fgEndsBlock[opcode];
+			Bool	redirected	= regs.pc_oldp != opOldp || fExceptionCount != opExceptions;
+
+			blockStart = endsBlock || redirected;
+
+			if (recording)
+			{
+				// Don't record an instruction that caused an exception; we
+				// can't tell how long it is.
+
+				if ((redirected && !endsBlock) ||
+					!EmBlockCache::AppendOp (recording, opStart, functable[opcode], opcode,
+						endsBlock ? 0 : (uint16) (regs.pc_p - opStart)))
+				{
+					blockStart = true;
+				}
+
+				if (blockStart)
+				{
+					EmBlockCache::EndBlock (recording);
+					recording = NULL;
+				}
+			}
+		}
+
+		// Perform periodic tasks.
+
+		CYCLE (false);
+
+StoppedLoop:
+
+		// -----------------------------------------------------------------------
+		// Handle special conditions.  If that moves the PC (say, to an
+		// interrupt handler), then we're at the start of a new block.
+		// -----------------------------------------------------------------------
+
+		if (regs.spcflags)
+		{
+			uint8*	pcBefore	= regs.pc_p;
+			Bool	stop		= this->ExecuteSpecial ();
+
+			if (regs.pc_p != pcBefore)
+			{
+				blockStart = true;
+			}
+
+			if (recording && (stop || blockStart))
+			{
+				EmBlockCache::EndBlock (recording);
+				recording = NULL;
+			}
+
+			if (stop)
+				break;
+		}
+	}	// while (1)
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::ExecuteThreaded
+// ---------------------------------------------------------------------------
+// Version of Execute that uses the "threaded" form of the opcode handlers
+// generated by gencpu into cputhreaded.c.  Instead of being functions called
+// from this loop, the handlers are labelled blocks of code inside it.  Each
+// one ends with THREADED_NEXT, which does the per-instruction work that
+// Execute does after calling a handler, and then fetches the next opcode
+// and jumps directly to its handler through a table of label addresses.
+//
+// This gives each handler its own indirect jump (which the host's branch
+// predictor can learn separately), and removes the call, prologue,
+// epilogue, and return from each emulated instruction.
+//
+// This requires GCC's "labels as values" extension, so it's only compiled
+// in when configured with --enable-threaded-cpu.
+
+#if HAS_THREADED_CPU
+
+void EmCPU68K::ExecuteThreaded (void)
+{
+	// The label table that cputhreaded.c provides is in the same order as
+	// op_smalltbl_3.  From that, build a table mapping each opcode to the
+	// label of the handler that the checked cpufunctbl calls for it.  Opcodes
+	// whose handlers don't come from op_smalltbl_3 (such as the illegal
+	// instruction handlers) are sent to ThreadedCall, which calls them.
+
+	static void* const	kHandlerLabels[] =
+	{
+#define CPUTHREADED_LABELS 1
+#include "cputhreaded.c"
+#undef CPUTHREADED_LABELS
+	};
+
+	void**				dispatch = gThreadedDispatch;
+
+	if (!gThreadedCallLabel)
+	{
+		map<cpuop_func*, void*>&	labels = gThreadedLabels;
+
+		// Make sure cputhreaded.c and cpustbl.c came from the same gencpu run.
+
+		EmAssert (op_smalltbl_3[countof (kHandlerLabels)].handler == NULL);
+
+		for (size_t ii = 0; ii < countof (kHandlerLabels); ++ii)
+		{
+			EmAssert (op_smalltbl_3[ii].handler);
+			labels[op_smalltbl_3[ii].handler] = kHandlerLabels[ii];
+		}
+
+		gThreadedCallLabel = &&ThreadedCall;
+
+		for (long op = 0; op < 0x10000; ++op)
+		{
+			dispatch[op] = ::PrvThreadedLabel (op);
+		}
+	}
+
+	int					counter			= 0;
+	cpuop_func**		functable		= cpufunctbl;
+	EmSession*			session			= fSession;
+	EmOpcode68K			opcode;
+
+	// Finish up after executing an opcode: count the cycles, perform
+	// periodic tasks, and either go handle special conditions or
+	// dispatch to the next opcode.
+
+	#define THREADED_NEXT(cycles)												\
+	{																			\
+		fCycleCount += (cycles);												\
+																				\
+		CYCLE (false);															\
+																				\
+		if (regs.spcflags)														\
+		{																		\
+			goto StoppedLoop;													\
+		}																		\
+																				\
+		opcode = do_get_mem_word (regs.pc_p);									\
+		goto *dispatch[opcode];													\
+	}
+
+	if ((regs.spcflags & SPCFLAG_STOP) != 0)
+		goto StoppedLoop;
+
+	while (1)
+	{
+		opcode = do_get_mem_word (regs.pc_p);
+		goto *dispatch[opcode];
+
+ThreadedCall:
+		THREADED_NEXT ((functable[opcode]) (opcode));
+
+#include "cputhreaded.c"
+
+StoppedLoop:
+		if (regs.spcflags)
+		{
+			if (this->ExecuteSpecial ())
+				break;
+		}
+	}	// while (1)
+
+	#undef THREADED_NEXT
+}
+
+#endif	// HAS_THREADED_CPU
+
+
 // ---------------------------------------------------------------------------
 //		 EmCPU68K::ExecuteSpecial
 // ---------------------------------------------------------------------------
@@ -845,6 +1255,13 @@ Bool EmCPU68K::ExecuteStoppedLoop (void)
 		// -----------------------------------------------------------------------
 		// Slow down processing so that the timer used
 		// to increment the tickcount doesn't run too quickly.
+		//
+		// If we've been asked to fast-forward through idle time, skip the
+		// delay.  Each pass through this loop advances the timers straight
+		// to their next compare and posts the interrupt, so the emulated
+		// clock then runs as fast as the OS can take its interrupts.  Keep
+		// to real time while there's input from the host to deliver, so
+		// that it's paced the way it would be on a device.
 		// -----------------------------------------------------------------------
 
 #if __profile__
@@ -852,7 +1269,10 @@ Bool EmCPU68K::ExecuteStoppedLoop (void)
 	ProfilerSetStatus (false);
 #endif
 
-		Platform::Delay ();
+		if (!fFastForwardIdle || this->HostEventPending ())
+		{
+			Platform::Delay ();
+		}
 
 #if __profile__
 	ProfilerSetStatus (oldStatus);
@@ -888,6 +1308,24 @@ Bool EmCPU68K::ExecuteStoppedLoop (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::HostEventPending
+// ---------------------------------------------------------------------------
+// Return whether there's input from the host (pen, key, or button events,
+// or an RPC packet waiting on the emulated device) that ExecuteStoppedLoop
+// shouldn't fast-forward past.
+
+Bool EmCPU68K::HostEventPending (void)
+{
+	EmAssert (fSession);
+
+	return	fSession->HasPenEvent () ||
+			fSession->HasKeyEvent () ||
+			fSession->HasButtonEvent () ||
+			RPC::HandlingPacket ();
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmCPU68K::CycleSlowly
 // ---------------------------------------------------------------------------
@@ -1096,6 +1534,10 @@ void EmCPU68K::ProcessInterrupt (int32 interrupt)
 
 void EmCPU68K::ProcessException (ExceptionNumber exception)
 {
+	// Let ExecuteTranslated know that the PC is about to be redirected.
+
+	++fExceptionCount;
+
 	// Make sure the Status Register is up-to-date.
 
 	this->UpdateSRFromRegisters ();
@@ -1275,6 +1717,14 @@ void EmCPU68K::ProcessIllegalInstruction (EmOpcode68K opcode)
 
 int EmCPU68K::ProcessJSR (emuptr oldPC, emuptr dest)
 {
+	// There's usually just the one subscriber, installed by EmPalmOS when
+	// profiling.  Skip setting up the loop in that case.
+
+	if (fHookJSR.size () == 1)
+	{
+		return fHookJSR.front () (oldPC, dest);
+	}
+
 	int	handled = false;
 
 	Hook68KJSRList::iterator	iter = fHookJSR.begin ();
@@ -1298,6 +1748,11 @@ int EmCPU68K::ProcessJSR (emuptr oldPC, emuptr dest)
 
 int EmCPU68K::ProcessJSR_Ind (emuptr oldPC, emuptr dest)
 {
+	if (fHookJSR_Ind.size () == 1)
+	{
+		return fHookJSR_Ind.front () (oldPC, dest);
+	}
+
 	int	handled = false;
 
 	Hook68KJSR_IndList::iterator	iter = fHookJSR_Ind.begin ();
@@ -1321,6 +1776,12 @@ int EmCPU68K::ProcessJSR_Ind (emuptr oldPC, emuptr dest)
 
 void EmCPU68K::ProcessLINK (int linkSize)
 {
+	if (fHookLINK.size () == 1)
+	{
+		fHookLINK.front () (linkSize);
+		return;
+	}
+
 	Hook68KLINKList::iterator	iter = fHookLINK.begin ();
 	while (iter != fHookLINK.end ())
 	{
@@ -1337,6 +1798,11 @@ void EmCPU68K::ProcessLINK (int linkSize)
 
 int EmCPU68K::ProcessRTE (emuptr dest)
 {
+	if (fHookRTE.size () == 1)
+	{
+		return fHookRTE.front () (dest);
+	}
+
 	int	handled = false;
 
 	Hook68KRTEList::iterator	iter = fHookRTE.begin ();
@@ -1360,6 +1826,11 @@ int EmCPU68K::ProcessRTE (emuptr dest)
 
 int EmCPU68K::ProcessRTS (emuptr dest)
 {
+	if (fHookRTS.size () == 1)
+	{
+		return fHookRTS.front () (dest);
+	}
+
 	int	handled = false;
 
 	Hook68KRTSList::iterator	iter = fHookRTS.begin ();
@@ -1383,12 +1854,15 @@ int EmCPU68K::ProcessRTS (emuptr dest)
 
 void EmCPU68K::CheckNewPC (emuptr dest)
 {
-	Hook68KNewPCList::iterator	iter = fHookNewPC.begin ();
-	while (iter != fHookNewPC.end ())
+	if (fActiveHooks & kHook68KNewPC)
 	{
-		(*iter) (dest);
+		Hook68KNewPCList::iterator	iter = fHookNewPC.begin ();
+		while (iter != fHookNewPC.end ())
+		{
+			(*iter) (dest);
 
-		++iter;
+			++iter;
+		}
 	}
 
 	EmMemory::CheckNewPC (dest);
@@ -1401,6 +1875,12 @@ void EmCPU68K::CheckNewPC (emuptr dest)
 
 void EmCPU68K::CheckNewSP (EmStackChangeType type)
 {
+	if (fHookNewSP.size () == 1)
+	{
+		fHookNewSP.front () (type);
+		return;
+	}
+
 	Hook68KNewSPList::iterator	iter = fHookNewSP.begin ();
 	while (iter != fHookNewSP.end ())
 	{
@@ -1434,42 +1914,49 @@ void EmCPU68K::InstallHookException (ExceptionNumber exceptionNumber,
 void EmCPU68K::InstallHookJSR (Hook68KJSR fn)
 {
 	fHookJSR.push_back (fn);
+	this->UpdateActiveHooks ();
 }
 
 
 void EmCPU68K::InstallHookJSR_Ind (Hook68KJSR_Ind fn)
 {
 	fHookJSR_Ind.push_back (fn);
+	this->UpdateActiveHooks ();
 }
 
 
 void EmCPU68K::InstallHookLINK (Hook68KLINK fn)
 {
 	fHookLINK.push_back (fn);
+	this->UpdateActiveHooks ();
 }
 
 
 void EmCPU68K::InstallHookRTE (Hook68KRTE fn)
 {
 	fHookRTE.push_back (fn);
+	this->UpdateActiveHooks ();
 }
 
 
 void EmCPU68K::InstallHookRTS (Hook68KRTS fn)
 {
 	fHookRTS.push_back (fn);
+	this->UpdateActiveHooks ();
 }
 
 
 void EmCPU68K::InstallHookNewPC (Hook68KNewPC fn)
 {
 	fHookNewPC.push_back (fn);
+	this->UpdateActiveHooks ();
 }
 
 
 void EmCPU68K::InstallHookNewSP (Hook68KNewSP fn)
 {
 	fHookNewSP.push_back (fn);
+	this->UpdateActiveHooks ();
 }
 
 
@@ -1506,6 +1993,7 @@ void EmCPU68K::RemoveHookJSR (Hook68KJSR fn)
 	if (iter != fHookJSR.end ())
 	{
 		fHookJSR.erase (iter);
+		this->UpdateActiveHooks ();
 	}
 }
 
@@ -1517,6 +2005,7 @@ void EmCPU68K::RemoveHookJSR_Ind (Hook68KJSR_Ind fn)
 	if (iter != fHookJSR_Ind.end ())
 	{
 		fHookJSR_Ind.erase (iter);
+		this->UpdateActiveHooks ();
 	}
 }
 
@@ -1528,6 +2017,7 @@ void EmCPU68K::RemoveHookLINK (Hook68KLINK fn)
 	if (iter != fHookLINK.end ())
 	{
 		fHookLINK.erase (iter);
+		this->UpdateActiveHooks ();
 	}
 }
 
@@ -1539,6 +2029,7 @@ void EmCPU68K::RemoveHookRTE (Hook68KRTE fn)
 	if (iter != fHookRTE.end ())
 	{
 		fHookRTE.erase (iter);
+		this->UpdateActiveHooks ();
 	}
 }
 
@@ -1550,6 +2041,7 @@ void EmCPU68K::RemoveHookRTS (Hook68KRTS fn)
 	if (iter != fHookRTS.end ())
 	{
 		fHookRTS.erase (iter);
+		this->UpdateActiveHooks ();
 	}
 }
 
@@ -1561,6 +2053,7 @@ void EmCPU68K::RemoveHookNewPC (Hook68KNewPC fn)
 	if (iter != fHookNewPC.end ())
 	{
 		fHookNewPC.erase (iter);
+		this->UpdateActiveHooks ();
 	}
 }
 
@@ -1572,10 +2065,32 @@ void EmCPU68K::RemoveHookNewSP (Hook68KNewSP fn)
 	if (iter != fHookNewSP.end ())
 	{
 		fHookNewSP.erase (iter);
+		this->UpdateActiveHooks ();
 	}
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::UpdateActiveHooks
+// ---------------------------------------------------------------------------
+// Recompute the mask of hook lists that have subscribers.  The glue
+// functions called from the generated code test this mask so that they
+// can skip calling into EmCPU68K when nobody is listening.
+
+void EmCPU68K::UpdateActiveHooks (void)
+{
+	fActiveHooks = 0;
+
+	if (!fHookJSR.empty ())		fActiveHooks |= kHook68KJSR;
+	if (!fHookJSR_Ind.empty ())	fActiveHooks |= kHook68KJSR_Ind;
+	if (!fHookLINK.empty ())	fActiveHooks |= kHook68KLINK;
+	if (!fHookRTE.empty ())		fActiveHooks |= kHook68KRTE;
+	if (!fHookRTS.empty ())		fActiveHooks |= kHook68KRTS;
+	if (!fHookNewPC.empty ())	fActiveHooks |= kHook68KNewPC;
+	if (!fHookNewSP.empty ())	fActiveHooks |= kHook68KNewSP;
+}
+
+
 #pragma mark -
 
 // ---------------------------------------------------------------------------
@@ -1787,21 +2302,84 @@ void EmCPU68K::InitializeUAETables (void)
 	read_table68k ();
 	do_merges ();
 
-	// The rest of this code is based on build_cpufunctbl in newcpu.c.
+	// Build both opcode tables, and start off with the checked one.
+
+	PrvBuildFunctbl (gLeanFunctbl, op_smalltbl_4);
+	PrvBuildFunctbl (gCheckedFunctbl, op_smalltbl_3);
+
+	memcpy (cpufunctbl, gCheckedFunctbl, sizeof (cpufunctbl));
+	gLeanFunctblActive = false;
+
+	// Note which opcodes end a basic block for EmBlockCache.  These are
+	// the ones that can change the flow of control, the ones that change
+	// the SR (and so can change the interrupt mask or trace state), and
+	// the ones we don't implement (A-traps, F-traps, and illegal opcodes).
+
+	unsigned long	opcode;
+
+	for (opcode = 0; opcode < 65536; opcode++)
+	{
+		Bool	endsBlock;
+
+		switch (table68k[opcode].mnemo)
+		{
+			case i_ORSR:
+			case i_ANDSR:
+			case i_EORSR:
+			case i_MV2SR:
+			case i_TRAP:
+			case i_RESET:
+			case i_STOP:
+			case i_RTE:
+			case i_RTD:
+			case i_RTS:
+			case i_TRAPV:
+			case i_RTR:
+			case i_JSR:
+			case i_JMP:
+			case i_BSR:
+			case i_Bcc:
+			case i_DBcc:
+			case i_CHK:
+				endsBlock = true;
+				break;
+
+			default:
+				endsBlock = cpufunctbl[opcode] == op_illg;
+				break;
+		}
+
+		EmBlockCache::fgEndsBlock[opcode] = endsBlock;
+	}
+
+	// (hey readcpu doesn't free this guy!)
+
+	Platform::DisposeMemory (table68k);
+}
+
 
+// ---------------------------------------------------------------------------
+//		 PrvBuildFunctbl
+// ---------------------------------------------------------------------------
+// Fill in an opcode-to-handler table from one of the tables generated by
+// gencpu.  This is based on build_cpufunctbl in newcpu.c.  The perftbl
+// entries are the same for either of the generated tables.
+
+void PrvBuildFunctbl (cpuop_func** functbl, struct cputbl* tbl)
+{
 	unsigned long	opcode;
-	struct cputbl*	tbl = op_smalltbl_3;
+	int				i;
 
 	for (opcode = 0; opcode < 65536; opcode++)
 	{
-		cpufunctbl[opcode] = op_illg;
+		functbl[opcode] = op_illg;
 	}
 
 	for (i = 0; tbl[i].handler != NULL; i++)
 	{
 		if (!tbl[i].specific)
 		{
-			cpufunctbl[tbl[i].opcode] = tbl[i].handler;
+			functbl[tbl[i].opcode] = tbl[i].handler;
 #if HAS_PROFILING
 			perftbl[tbl[i].opcode] = tbl[i].perf;
 #endif
@@ -1819,13 +2397,13 @@ void EmCPU68K::InitializeUAETables (void)
 
 		if (table68k[opcode].handler != -1)
 		{
-			f = cpufunctbl[table68k[opcode].handler];
+			f = functbl[table68k[opcode].handler];
 			if (f == op_illg)
 			{
 				abort ();
 			}
 
-			cpufunctbl[opcode] = f;
+			functbl[opcode] = f;
 #if HAS_PROFILING
 			perftbl[opcode] = perftbl[table68k[opcode].handler];
 #endif
@@ -1837,14 +2415,416 @@ void EmCPU68K::InitializeUAETables (void)
 	{
 		if (tbl[i].specific)
 		{
-			cpufunctbl[tbl[i].opcode] = tbl[i].handler;
+			functbl[tbl[i].opcode] = tbl[i].handler;
 #if HAS_PROFILING
 			perftbl[tbl[i].opcode] = tbl[i].perf;
 #endif
 		}
 	}
+}
 
-	// (hey readcpu doesn't free this guy!)
 
-	Platform::DisposeMemory (table68k);
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::UpdateFunctable
+// ---------------------------------------------------------------------------
+// Use the lean opcode table if nothing needs the checks made by the checked
+// one, otherwise use the checked table.  Called from Execute.
+
+void EmCPU68K::UpdateFunctable (void)
+{
+	Bool	lean = !this->NeedsCheckedFunctable ();
+
+	if (lean == gLeanFunctblActive)
+		return;
+
+	memcpy (cpufunctbl, lean ? gLeanFunctbl : gCheckedFunctbl, sizeof (cpufunctbl));
+	gLeanFunctblActive = lean;
+
+	EmBreakOpcodeCountMap::iterator	iter = gBreakOpcodeCounts.begin ();
+	while (iter != gBreakOpcodeCounts.end ())
+	{
+		::PrvSetHandler (iter->first);
+		++iter;
+	}
+
+	// Translated blocks hold on to handlers from the old table.
+
+	if (fBlockCacheActive)
+	{
+		EmBlockCache::InvalidateAll ();
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::NeedsCheckedFunctable
+// ---------------------------------------------------------------------------
+// Return whether anything needs the work done only by the checked opcode
+// handlers: the JSR/RTS/RTE hooks used by the profiler and an attached
+// external debugger, or the "stack almost full" check made on each push
+// when the user has asked for those reports.  The lean handlers still
+// check for stack overflow and invalid PCs, so those errors are always
+// reported.
+
+Bool EmCPU68K::NeedsCheckedFunctable (void)
+{
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		return true;
+#endif
+
+	if (Debug::ConnectedToTCPDebugger ())
+		return true;
+
+	return ::ReportStackAlmostOverflow ();
+}
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::AddInstructionBreak
+// ---------------------------------------------------------------------------
+// Called by MetaMemory when an instruction break is set.  Route the opcode
+// at that location through PrvBreakHandler.
+
+void EmCPU68K::AddInstructionBreak (emuptr opcodeLocation)
+{
+	EmOpcode68K	opcode = ::PrvGetBreakOpcode (opcodeLocation);
+
+	EmBreakOpcodeMap::iterator	iter = gBreakOpcodes.find (opcodeLocation);
+
+	if (iter != gBreakOpcodes.end ())
+	{
+		if (iter->second == opcode)
+			return;
+
+		::PrvRemoveBreakOpcode (iter->second);
+		iter->second = opcode;
+	}
+	else
+	{
+		gBreakOpcodes[opcodeLocation] = opcode;
+	}
+
+	::PrvAddBreakOpcode (opcode);
+
+	EmCPU68K::MarkBreakPages (opcodeLocation);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::RemoveInstructionBreak
+// ---------------------------------------------------------------------------
+// Called by MetaMemory when an instruction break is cleared.
+
+void EmCPU68K::RemoveInstructionBreak (emuptr opcodeLocation)
+{
+	EmBreakOpcodeMap::iterator	iter = gBreakOpcodes.find (opcodeLocation);
+
+	if (iter != gBreakOpcodes.end ())
+	{
+		::PrvRemoveBreakOpcode (iter->second);
+		gBreakOpcodes.erase (iter);
+	}
+
+	// Leave the page flags for other breaks alone; a stale flag only costs
+	// an extra NoteBreakPageWrite, which clears it.
+
+	if (gBreakOpcodes.empty ())
+	{
+		memset (fgBreakPages, 0, sizeof (fgBreakPages));
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::NoteWriteRange
+// ---------------------------------------------------------------------------
+// Like NoteWrite, but for a run of bytes written all at once (as by
+// EmMem_memcpy) rather than through the bank "put" functions.
+
+void EmCPU68K::NoteWriteRange (uint8* begin, uint8* end)
+{
+	if (begin >= end)
+	{
+		return;
+	}
+
+	uint32	first	= BreakPageIndex (begin);
+	uint32	last	= BreakPageIndex (end - 1);
+
+	for (uint32 page = first; ; page = (page + 1) & (kNumBreakPageFlags - 1))
+	{
+		if (fgBreakPages[page])
+		{
+			EmCPU68K::NoteBreakPageWrite ();
+			return;
+		}
+
+		if (page == last)
+		{
+			break;
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::UpdateInstructionBreaks
+// ---------------------------------------------------------------------------
+// Re-read the opcode at each instruction break location, in case the code
+// there has changed since the break was set.  Called from Execute and
+// NoteBreakPageWrite.  There are rarely more than a handful of breaks, so
+// this is cheap.
+
+void EmCPU68K::UpdateInstructionBreaks (void)
+{
+	EmBreakOpcodeMap::iterator	iter = gBreakOpcodes.begin ();
+
+	while (iter != gBreakOpcodes.end ())
+	{
+		EmOpcode68K	opcode = ::PrvGetBreakOpcode (iter->first);
+
+		if (iter->second != opcode)
+		{
+			::PrvRemoveBreakOpcode (iter->second);
+			::PrvAddBreakOpcode (opcode);
+			iter->second = opcode;
+		}
+
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::MarkBreakPages
+// ---------------------------------------------------------------------------
+// Flag the pages that writes changing the opcode at the given break
+// location would be made to.  A long written up to three bytes before the
+// opcode overlaps it, so flag the page holding those bytes, too.
+
+void EmCPU68K::MarkBreakPages (emuptr opcodeLocation)
+{
+	if (!EmMemCheckAddress (opcodeLocation, sizeof (uint16)))
+	{
+		return;
+	}
+
+	uint8*	realAddress = EmMemGetRealAddress (opcodeLocation);
+
+	if (!realAddress)
+	{
+		return;
+	}
+
+	fgBreakPages[BreakPageIndex (realAddress - 3)] = 1;
+	fgBreakPages[BreakPageIndex (realAddress + 1)] = 1;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::NoteBreakPageWrite
+// ---------------------------------------------------------------------------
+// Called by NoteWrite and NoteWriteRange when memory in a flagged page has
+// been written to.  Re-read the opcodes at the break locations, and rebuild
+// the page flags so that flags left behind by cleared breaks go away.
+
+void EmCPU68K::NoteBreakPageWrite (void)
+{
+	EmCPU68K::UpdateInstructionBreaks ();
+
+	memset (fgBreakPages, 0, sizeof (fgBreakPages));
+
+	EmBreakOpcodeMap::iterator	iter = gBreakOpcodes.begin ();
+
+	while (iter != gBreakOpcodes.end ())
+	{
+		EmCPU68K::MarkBreakPages (iter->first);
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvBreakHandler
+// ---------------------------------------------------------------------------
+// Handler installed in cpufunctbl for opcodes that appear at instruction
+// break locations.  Does what the CPU loop used to do before every opcode:
+// see if there's a break at the PC, and if so, handle it.  Then execute
+// the instruction at the PC with the real handler.
+
+unsigned long PrvBreakHandler (uae_u32 opcode)
+{
+	if (MetaMemory::IsCPUBreak (regs.pc_meta_oldp + (regs.pc_p - regs.pc_oldp)))
+	{
+		EmAssert (gSession);
+		gSession->HandleInstructionBreak ();
+
+		// Handling the break may have changed the PC.
+
+		opcode = do_get_mem_word (regs.pc_p);
+	}
+
+	cpuop_func**	functable = gLeanFunctblActive ? gLeanFunctbl : gCheckedFunctbl;
+
+	return (functable[opcode]) (opcode);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvGetBreakOpcode
+// ---------------------------------------------------------------------------
+
+EmOpcode68K PrvGetBreakOpcode (emuptr opcodeLocation)
+{
+	if (!EmMemCheckAddress (opcodeLocation, sizeof (uint16)))
+	{
+		return kNoBreakOpcode;
+	}
+
+	uint8*	realAddress = EmMemGetRealAddress (opcodeLocation);
+
+	if (!realAddress)
+	{
+		return kNoBreakOpcode;
+	}
+
+	return do_get_mem_word (realAddress);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvAddBreakOpcode
+//		 PrvRemoveBreakOpcode
+// ---------------------------------------------------------------------------
+
+void PrvAddBreakOpcode (EmOpcode68K opcode)
+{
+	if (opcode == kNoBreakOpcode)
+		return;
+
+	if (++gBreakOpcodeCounts[opcode] == 1)
+	{
+		::PrvSetHandler (opcode);
+	}
+}
+
+
+void PrvRemoveBreakOpcode (EmOpcode68K opcode)
+{
+	if (opcode == kNoBreakOpcode)
+		return;
+
+	EmBreakOpcodeCountMap::iterator	iter = gBreakOpcodeCounts.find (opcode);
+
+	EmAssert (iter != gBreakOpcodeCounts.end ());
+
+	if (--iter->second == 0)
+	{
+		gBreakOpcodeCounts.erase (iter);
+		::PrvSetHandler (opcode);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvSetHandler
+// ---------------------------------------------------------------------------
+// Install the right handler for the given opcode in cpufunctbl (and in the
+// threaded core's dispatch table): PrvBreakHandler if there's a break on
+// an instruction with that opcode, otherwise the one from the current
+// opcode table.
+
+void PrvSetHandler (EmOpcode68K opcode)
+{
+	if (gBreakOpcodeCounts.find (opcode) != gBreakOpcodeCounts.end ())
+	{
+		cpufunctbl[opcode] = PrvBreakHandler;
+	}
+	else
+	{
+		cpufunctbl[opcode] = gLeanFunctblActive ? gLeanFunctbl[opcode] : gCheckedFunctbl[opcode];
+	}
+
+#if HAS_THREADED_CPU
+	if (gThreadedCallLabel)
+	{
+		gThreadedDispatch[opcode] = ::PrvThreadedLabel (opcode);
+	}
+#endif
+}
+
+
+#if HAS_THREADED_CPU
+
+// ---------------------------------------------------------------------------
+//		 PrvThreadedLabel
+// ---------------------------------------------------------------------------
+// Return the threaded core's label for the handler cpufunctbl calls for the
+// given opcode, or ThreadedCall if it doesn't have one.
+
+void* PrvThreadedLabel (EmOpcode68K opcode)
+{
+	map<cpuop_func*, void*>::iterator	iter = gThreadedLabels.find (cpufunctbl[opcode]);
+
+	return iter != gThreadedLabels.end () ? iter->second : gThreadedCallLabel;
+}
+
+#endif
+
+
+#pragma mark -
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::PrefsChangedCB
+// ---------------------------------------------------------------------------
+
+void EmCPU68K::PrefsChangedCB (PrefKeyType key, void* data)
+{
+	EmAssert (data);
+
+	EmCPU68K* cpu = static_cast<EmCPU68K*>(data);
+	cpu->PrefsChanged (key);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmCPU68K::PrefsChanged
+// ---------------------------------------------------------------------------
+// Respond to a change in the block translation, idle fast-forward, or
+// deterministic clock preferences.  Execute picks up a new block
+// translation setting the next time it's entered, so stop the CPU to make
+// that happen promptly.
+
+void EmCPU68K::PrefsChanged (PrefKeyType key)
+{
+	if (::PrefKeysEqual (key, kPrefKeyTranslateBlocks))
+	{
+		Preference<bool>	pref (kPrefKeyTranslateBlocks, false);
+
+#if HAS_OMNI_THREAD
+		if (fSession->InCPUThread ())
+		{
+			fTranslateBlocks = *pref;
+		}
+		else
+#endif
+		{
+			EmSessionStopper	stopper (fSession, kStopNow);
+
+			fTranslateBlocks = *pref;
+		}
+	}
+	else if (::PrefKeysEqual (key, kPrefKeyFastForwardIdle) ||
+			 ::PrefKeysEqual (key, kPrefKeyDeterministicClock))
+	{
+		// Only looked at by ExecuteStoppedLoop, which picks up the
+		// change on its next pass.  A deterministic clock can't wait on
+		// the host's, so it implies fast-forwarding.
+
+		Preference<bool>	pref (kPrefKeyFastForwardIdle, false);
+		fFastForwardIdle = *pref || ::UseDeterministicClock ();
+	}
 }
@@ -15,6 +15,7 @@
 #define EmCPU68K_h
 
 #include "EmCPU.h"				// EmCPU
+#include "PreferenceMgr.h"		// PrefKeyType
 
 #include <vector>				// vector
 
@@ -186,6 +187,20 @@ typedef vector<Hook68KRTS>			Hook68KRTSList;
 typedef vector<Hook68KNewPC>		Hook68KNewPCList;
 typedef vector<Hook68KNewSP>		Hook68KNewSPList;
 
+// Bits in the mask returned by EmCPU68K::GetActiveHooks, one for each
+// hook list that has at least one subscriber.
+
+enum
+{
+	kHook68KJSR			= 0x0001,
+	kHook68KJSR_Ind		= 0x0002,
+	kHook68KLINK		= 0x0004,
+	kHook68KRTE			= 0x0008,
+	kHook68KRTS			= 0x0010,
+	kHook68KNewPC		= 0x0020,
+	kHook68KNewSP		= 0x0040
+};
+
 class EmCPU68K;
 extern EmCPU68K*	gCPU68K;
 
@@ -281,6 +296,30 @@ class EmCPU68K : public EmCPU
 		void					RemoveHookNewPC			(Hook68KNewPC);
 		void					RemoveHookNewSP			(Hook68KNewSP);
 
+		// Called by MetaMemory when instruction breaks are set or cleared.
+
+		static void				AddInstructionBreak		(emuptr opcodeLocation);
+		static void				RemoveInstructionBreak	(emuptr opcodeLocation);
+
+		// Called by the bank "put" functions after memory is written.  If
+		// the write may have changed the opcode at an instruction break
+		// location, re-read the opcodes at the break locations.
+
+		static void				NoteWrite				(uint8* realAddress)
+								{
+									if (fgBreakPages[BreakPageIndex (realAddress)])
+									{
+										NoteBreakPageWrite ();
+									}
+								}
+
+		static void				NoteWriteRange			(uint8* begin, uint8* end);
+
+		uint32					GetActiveHooks			(void) const
+								{
+									return fActiveHooks;
+								}
+
 		// Register management.  Clients should call Get/SetRegisters for
 		// the most part.  UpdateXFromY are here so that MakeSR and
 		// MakeFromSR (UAE glue functions) can call them.
@@ -296,8 +335,13 @@ class EmCPU68K : public EmCPU
 		void					AddressError			(emuptr address, long size, Bool forRead);
 
 	private:
+		void					ExecuteTranslated		(void);
+#if HAS_THREADED_CPU
+		void					ExecuteThreaded			(void);
+#endif
 		Bool 					ExecuteSpecial			(void);
 		Bool	 				ExecuteStoppedLoop		(void);
+		Bool					HostEventPending		(void);
 
 		void					CycleSlowly				(Bool sleeping);
 		Bool					CheckForBreak			(void);
@@ -305,10 +349,40 @@ class EmCPU68K : public EmCPU
 		void					ProcessInterrupt		(int32 interrupt);
 
 		void					InitializeUAETables		(void);
+		void					UpdateFunctable			(void);
+		Bool					NeedsCheckedFunctable	(void);
+		void					UpdateActiveHooks		(void);
+		static void				UpdateInstructionBreaks	(void);
+		static void				MarkBreakPages			(emuptr opcodeLocation);
+		static void				NoteBreakPageWrite		(void);
+
+		enum
+		{
+			kBreakPageShift		= 8,
+			kNumBreakPageFlags	= 0x10000
+		};
+
+		static uint32			BreakPageIndex			(uint8* p)
+								{
+									return (uint32) (((size_t) p) >> kBreakPageShift) & (kNumBreakPageFlags - 1);
+								}
+
+		// Page flags, hashed on host address: non-zero if an instruction
+		// break location may be in that page.
+
+		static uint8			fgBreakPages[kNumBreakPageFlags];
+
+		static void				PrefsChangedCB			(PrefKeyType key, void* data);
+		void					PrefsChanged			(PrefKeyType key);
 
 	private:
 		emuptr					fLastTraceAddress;
 		uint32					fCycleCount;
+		uint32					fExceptionCount;
+		Bool					fTranslateBlocks;
+		Bool					fFastForwardIdle;
+		Bool					fBlockCacheActive;
+		uint32					fActiveHooks;
 		Hook68KExceptionList	fExceptionHandlers[kException_LastException];
 		Hook68KJSRList			fHookJSR;
 		Hook68KJSR_IndList		fHookJSR_Ind;
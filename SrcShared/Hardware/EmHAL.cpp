@@ -22,6 +22,13 @@
 
 
 EmHALHandler*		EmHAL::fgRootHandler;
+uint32				EmHAL::fgCycle;
+uint32				EmHAL::fgNextCycle = 1;
+
+// Longest we'll go without calling the handlers' Cycle methods, even if
+// none of them have scheduled anything.
+
+const uint32		kMaxCycleInterval = 0x10000000;
 
 #define PRINTF	if (!0) ; else LogAppendMsg
 
@@ -44,6 +51,10 @@ void EmHAL::AddHandler (EmHALHandler* handler)
 	}
 
 	fgRootHandler = handler;
+
+	// Give the new handler a chance to schedule its first event.
+
+	fgNextCycle = fgCycle + 1;
 }
 
 
@@ -124,6 +135,79 @@ void EmHAL::Cycle (Bool sleeping)
 #endif
 
 
+// ---------------------------------------------------------------------------
+//		 EmHAL::CycleScheduled
+// ---------------------------------------------------------------------------
+// Called from Cycle when the cycle count reaches the earliest scheduled
+// cycle.  Pass the cycle on to the handlers, which will schedule their next
+// events.
+
+void EmHAL::CycleScheduled (void)
+{
+	fgNextCycle = fgCycle + kMaxCycleInterval;
+
+	EmAssert (EmHAL::GetRootHandler());
+	EmHAL::GetRootHandler()->Cycle (false);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmHAL::ScheduleCycle
+// ---------------------------------------------------------------------------
+// Make sure that the handlers' Cycle methods are called no later than the
+// given cycle.  Handlers may be called earlier than they asked for (say,
+// because another handler scheduled an earlier cycle).
+
+void EmHAL::ScheduleCycle (uint32 cycle)
+{
+	EmAssert ((int32) (cycle - fgCycle) > 0);
+
+	if ((int32) (cycle - fgCycle) < (int32) (fgNextCycle - fgCycle))
+	{
+		fgNextCycle = cycle;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmHAL::CyclesUntilCompare
+// ---------------------------------------------------------------------------
+// Helper for handlers emulating 16-bit timers.  Return the number of cycles
+// until a counter that's incremented by "increment" each cycle first has a
+// value greater than "compare", allowing for it wrapping around.  Return
+// zero if that will never happen.
+
+uint32 EmHAL::CyclesUntilCompare (uint16 counter, uint16 compare, uint32 increment)
+{
+	if (compare == 0xFFFF)
+	{
+		return 0;
+	}
+
+	// Try each range of matching values in turn.  After "increment" wraps,
+	// the counter's values start repeating themselves.
+
+	for (uint32 wraps = 0; wraps <= increment; ++wraps)
+	{
+		uint32	low		= wraps * 0x10000 + compare + 1;
+		uint32	high	= wraps * 0x10000 + 0xFFFF;
+		uint32	cycles	= 1;
+
+		if (low > counter + increment)
+		{
+			cycles = (low - counter + increment - 1) / increment;
+		}
+
+		if (counter + cycles * increment <= high)
+		{
+			return cycles;
+		}
+	}
+
+	return 0;
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmHAL::CycleSlowly
 // ---------------------------------------------------------------------------
@@ -108,6 +108,18 @@ class EmHAL
 		static void				Cycle					(Bool sleeping);
 		static void				CycleSlowly				(Bool sleeping);
 
+		// Virtual time.  EmHAL counts the (non-sleeping) cycles the CPU
+		// makes, but only passes one on to the handlers when it reaches the
+		// earliest cycle a handler has asked for with ScheduleCycle.  Handlers
+		// that keep time (e.g., the Dragonball timers) bring themselves up
+		// to date from GetCycle when they're called or their registers are
+		// accessed, and then schedule the cycle of their next event.
+
+		static uint32			GetCycle				(void) { return fgCycle; }
+		static void				ScheduleCycle			(uint32 cycle);
+		static uint32			CyclesUntilCompare		(uint16 counter, uint16 compare,
+														 uint32 increment);
+
 		static void				ButtonEvent				(SkinElementType, Bool buttonIsDown);
 		static void				TurnSoundOff			(void);
 		static void				ResetTimer				(void);
@@ -150,14 +162,27 @@ class EmHAL
 		static uint16			GetLEDState				(void);
 
 	private:
+		static void				CycleScheduled			(void);
+
 		static EmHALHandler*	GetRootHandler			(void) { return fgRootHandler; }
 		static EmHALHandler*	fgRootHandler;
+
+		static uint32			fgCycle;
+		static uint32			fgNextCycle;
 };
 
 inline void EmHAL::Cycle (Bool sleeping)
 {
 	EmAssert (EmHAL::GetRootHandler());
-	EmHAL::GetRootHandler()->Cycle (sleeping);
+
+	if (sleeping)
+	{
+		EmHAL::GetRootHandler()->Cycle (sleeping);
+	}
+	else if (++fgCycle == fgNextCycle)
+	{
+		EmHAL::CycleScheduled ();
+	}
 }
 
 
@@ -14,12 +14,17 @@
 #include "EmCommon.h"
 #include "EmMemory.h"
 
+#include "Byteswapping.h"		// ByteswapWordsCopy
+#include "DebugMgr.h"			// Debug::CheckStepSpy
 #include "EmBankDRAM.h"			// EmBankDRAM::Initialize
 #include "EmBankDummy.h"		// EmBankDummy::Initialize
 #include "EmBankMapped.h"		// EmBankMapped::Initialize
 #include "EmBankRegs.h"			// EmBankRegs::Initialize
 #include "EmBankROM.h"			// EmBankROM::Initialize
 #include "EmBankSRAM.h"			// EmBankSRAM::Initialize
+#include "EmBlockCache.h"		// EmBlockCache::NoteWriteRange
+#include "EmCPU68K.h"			// EmCPU68K::NoteWriteRange
+#include "EmScreen.h"			// EmScreen::MarkDirty
 #include "EmSession.h"			// gSession, GetDevice
 #include "MetaMemory.h"			// MetaMemory::Initialize
 
@@ -181,6 +186,7 @@
 #pragma mark Globals
 
 EmAddressBank*	gEmMemBanks[65536];		// (normally defined in memory.c)
+uint8*			gEmMemFastRead[65536];
 
 Bool			gPCInRAM;
 Bool			gPCInROM;
@@ -341,6 +347,7 @@ void Memory::Initialize (	EmStream&		hROM,
 	// Clear everything out.
 	
 	memset (gEmMemBanks, 0, sizeof (gEmMemBanks));
+	memset (gEmMemFastRead, 0, sizeof (gEmMemFastRead));
 
 	// Initialize the valid memory banks.
 
@@ -513,13 +520,19 @@ void Memory::Dispose (void)
 //		EmBankFlash::Dispose ();
 
 	MetaMemory::Dispose ();
+
+	// The memory the fast read table points into is gone.
+
+	memset (gEmMemFastRead, 0, sizeof (gEmMemFastRead));
 }
 
 
 // ---------------------------------------------------------------------------
 //		 Memory::InitializeBanks
 // ---------------------------------------------------------------------------
-// Initializes the specified memory banks with the given data.
+// Initializes the specified memory banks with the given data.  Any fast
+// read access to the banks is turned off; the caller can turn it back on
+// with InitializeFastRead.
 
 void Memory::InitializeBanks (	EmAddressBank&	iBankInitializer,
 								int32			iStartingBankIndex,
@@ -530,6 +543,34 @@ void Memory::InitializeBanks (	EmAddressBank&	iBankInitializer,
 		aBankIndex++)
 	{
 		gEmMemBanks[aBankIndex] = &iBankInitializer;
+		gEmMemFastRead[aBankIndex] = NULL;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 Memory::InitializeFastRead
+// ---------------------------------------------------------------------------
+// Allows the EmMemGet functions to read the specified memory banks directly
+// from the given block of host memory, instead of calling the banks' get
+// functions.  Only call this for banks whose get functions do nothing
+// more than check for odd addresses, count cycles when profiling, and
+// return the value at (address & iMemoryMask) in the block.
+
+void Memory::InitializeFastRead (	uint8*	iMemory,
+									uint32	iMemoryMask,
+									int32	iStartingBankIndex,
+									int32	iNumberOfBanks)
+{
+	EmAssert (iMemoryMask >= 0x0000FFFF);
+
+	for (int32 aBankIndex = iStartingBankIndex;
+		aBankIndex < iStartingBankIndex + iNumberOfBanks;
+		aBankIndex++)
+	{
+		emuptr	bankStart = ((emuptr) aBankIndex) << 16;
+
+		gEmMemFastRead[aBankIndex] = iMemory + (bankStart & iMemoryMask);
 	}
 }
 
@@ -771,6 +812,188 @@ inline void		_decrement (T& v)
 }
 
 
+// ---------------------------------------------------------------------------
+// Rather than moving data through the bank functions a byte at a time, the
+// routines below break a transfer into spans that don't cross a bank
+// boundary and, where it's safe, access each span through a host pointer.
+//
+// Reading directly is safe for any bank in the fast read table (see
+// EmMemGet32).  Reading and writing RAM directly is also safe while a
+// CEnableFullAccess is in effect, since that turns off the checks the RAM
+// bank functions would make.  Writes still have to tell the block cache,
+// the screen, and the debugger about the change, as the bank functions do.
+//
+// Spans that can't be accessed directly still go a byte at a time through
+// the bank functions.
+// ---------------------------------------------------------------------------
+
+static inline size_t PrvBankSpan (emuptr addr, size_t len)
+{
+	size_t	bankLeft = 0x00010000 - (addr & 0x0000FFFF);
+
+	return len < bankLeft ? len : bankLeft;
+}
+
+static uint8* PrvGetRAMSpan (emuptr addr, size_t len)
+{
+	if (!CEnableFullAccess::AccessOK () || gRAMBank_Mask < 0x0000FFFF)
+		return NULL;
+
+	EmMemTranslateFunc	xlate = EmMemGetBank(addr).xlateaddr;
+
+	if (xlate != &EmBankDRAM::GetRealAddress && xlate != &EmBankSRAM::GetRealAddress)
+		return NULL;
+
+	uint8*	p = xlate (addr);
+
+	if (p < gRAM_Memory || p + len > gRAM_Memory + gRAMBank_Size)
+		return NULL;
+
+	return p;
+}
+
+static uint8* PrvGetReadSpan (emuptr addr, size_t len)
+{
+#if HAS_FAST_READ
+	uint8*	base = EmMemFastReadBase(addr);
+	if (EmMemFastReadOK(base, addr, 0))
+		return EmMemFastReadAddr(base, addr);
+#endif
+
+	return PrvGetRAMSpan (addr, len);
+}
+
+static void PrvNoteSpanWrite (emuptr addr, uint8* p, size_t len)
+{
+	EmBlockCache::NoteWriteRange (p, p + len);
+	EmCPU68K::NoteWriteRange (p, p + len);
+	EmBankSRAM::NoteDirtyRange (p - gRAM_Memory, len);
+
+	if (MetaMemory::IsScreenBuffer (gRAM_MetaMemory + (p - gRAM_Memory), len))
+	{
+		EmScreen::MarkDirty (addr, len);
+	}
+
+	Debug::CheckStepSpy (addr, len);
+}
+
+// Copy between two host spans.  Spans in emulated memory are wordswapped
+// on hosts where WORDSWAP_MEMORY is set; spans in host buffers never are.
+// Copies between the two kinds (as when fetching the LCD scanlines for the
+// screen) are swapped a word at a time with ByteswapWordsCopy when both
+// spans start on the same byte of a word.
+
+static inline void PrvCopySpan (uint8* dst, Bool dstSwapped,
+								const uint8* src, Bool srcSwapped, size_t len)
+{
+#if WORDSWAP_MEMORY
+	if (dstSwapped || srcSwapped)
+	{
+		size_t	dstFlip = dstSwapped ? 1 : 0;
+		size_t	srcFlip = srcSwapped ? 1 : 0;
+
+		if (dstSwapped != srcSwapped && (((size_t) dst ^ (size_t) src) & 1) == 0)
+		{
+			if (len > 0 && ((size_t) dst & 1))
+			{
+				*(uint8*) (((size_t) dst) ^ dstFlip) =
+					*(const uint8*) (((size_t) src) ^ srcFlip);
+
+				++dst;
+				++src;
+				--len;
+			}
+
+			size_t	words = len & ~(size_t) 1;
+
+			::ByteswapWordsCopy (dst, src, words);
+
+			if (len > words)
+			{
+				*(uint8*) (((size_t) (dst + words)) ^ dstFlip) =
+					*(const uint8*) (((size_t) (src + words)) ^ srcFlip);
+			}
+
+			return;
+		}
+
+		for (size_t ii = 0; ii < len; ++ii)
+		{
+			*(uint8*) (((size_t) (dst + ii)) ^ dstFlip) =
+				*(const uint8*) (((size_t) (src + ii)) ^ srcFlip);
+		}
+
+		return;
+	}
+#else
+	UNUSED_PARAM (dstSwapped)
+	UNUSED_PARAM (srcSwapped)
+#endif
+
+	memmove (dst, src, len);
+}
+
+inline const uint8*	_get_read_span (const void* p, size_t& /*len*/, Bool& swapped)
+{
+	swapped = false;
+	return (const uint8*) p;
+}
+
+inline const uint8*	_get_read_span (emuptr p, size_t& len, Bool& swapped)
+{
+	len = PrvBankSpan (p, len);
+	swapped = WORDSWAP_MEMORY;
+	return PrvGetReadSpan (p, len);
+}
+
+inline uint8*	_get_write_span (void* p, size_t& /*len*/, Bool& swapped)
+{
+	swapped = false;
+	return (uint8*) p;
+}
+
+inline uint8*	_get_write_span (emuptr p, size_t& len, Bool& swapped)
+{
+	len = PrvBankSpan (p, len);
+	swapped = WORDSWAP_MEMORY;
+	return PrvGetRAMSpan (p, len);
+}
+
+inline void		_note_write (void* /*p*/, uint8* /*host*/, size_t /*len*/)
+{
+}
+
+inline void		_note_write (emuptr p, uint8* host, size_t len)
+{
+	PrvNoteSpanWrite (p, host, len);
+}
+
+inline size_t	_strlen (const void* p)
+{
+	return strlen ((const char*) p);
+}
+
+inline size_t	_strlen (emuptr p)
+{
+	return EmMem_strlen (p);
+}
+
+inline Bool		_may_overlap (const void* /*dst*/, emuptr /*src*/, size_t /*len*/)
+{
+	return false;
+}
+
+inline Bool		_may_overlap (emuptr /*dst*/, const void* /*src*/, size_t /*len*/)
+{
+	return false;
+}
+
+inline Bool		_may_overlap (emuptr dst, emuptr src, size_t len)
+{
+	return dst < src + len && src < dst + len;
+}
+
+
 #pragma mark -
 
 /***********************************************************************
@@ -785,16 +1008,14 @@ inline void		_decrement (T& v)
  *
  ***********************************************************************/
 
-emuptr 	EmMem_memset(emuptr dst, int val, size_t len)
+static void PrvSlowMemset (emuptr q, int val, size_t len)
 {
-	emuptr 	q = dst;
-
 	uint32 longVal = val;
 	longVal |= (longVal << 8);
 	longVal |= (longVal << 16);
 
-	EmMemPutFunc	longPutter = EmMemGetBank(dst).lput;
-	EmMemPutFunc	bytePutter = EmMemGetBank(dst).bput;
+	EmMemPutFunc	longPutter = EmMemGetBank(q).lput;
+	EmMemPutFunc	bytePutter = EmMemGetBank(q).bput;
 
 	while ((q & 3) && len > 0)		// while there are leading bytes
 	{
@@ -803,11 +1024,11 @@ emuptr 	EmMem_memset(emuptr dst, int val, size_t len)
 		len -= sizeof (char);
 	}
 
-	while (len >= sizeof (long))	// while there are middle longs
+	while (len >= sizeof (uint32))	// while there are middle longs
 	{
 		longPutter(q, longVal);
-		q += sizeof (long);
-		len -= sizeof (long);
+		q += sizeof (uint32);
+		len -= sizeof (uint32);
 	}
 
 	while (len > 0) 				// while there are trailing bytes
@@ -816,6 +1037,33 @@ emuptr 	EmMem_memset(emuptr dst, int val, size_t len)
 		q += sizeof (char);
 		len -= sizeof (char);
 	}
+}
+
+emuptr 	EmMem_memset(emuptr dst, int val, size_t len)
+{
+	emuptr 	q = dst;
+
+	while (len > 0)
+	{
+		size_t	n = len;
+		Bool	swapped;
+		uint8*	host = _get_write_span (q, n, swapped);
+
+		if (host)
+		{
+			// Every byte gets the same value, so wordswapping doesn't matter.
+
+			memset (host, val, n);
+			_note_write (q, host, n);
+		}
+		else
+		{
+			PrvSlowMemset (q, val, n);
+		}
+
+		q += n;
+		len -= n;
+	}
 
 	return dst;
 }
@@ -921,11 +1169,33 @@ T1		EmMem_memcpy (T1 dst, T2 src, size_t len)
 	T1		q = dst;
 	T2		p = src;
 
-	while (len--)
+	while (len > 0)
 	{
-		_put_byte(q, _get_byte(p));
-		_increment (q);
-		_increment (p);
+		size_t			n = len;
+		Bool			dstSwapped;
+		Bool			srcSwapped;
+		uint8*			dstHost = _get_write_span (q, n, dstSwapped);
+		const uint8*	srcHost = _get_read_span (p, n, srcSwapped);
+
+		len -= n;
+
+		if (dstHost && srcHost)
+		{
+			PrvCopySpan (dstHost, dstSwapped, srcHost, srcSwapped, n);
+			_note_write (q, dstHost, n);
+
+			_add_delta (q, n);
+			_add_delta (p, n);
+		}
+		else
+		{
+			while (n--)
+			{
+				_put_byte(q, _get_byte(p));
+				_increment (q);
+				_increment (p);
+			}
+		}
 	}
 
 	return dst;
@@ -961,6 +1231,13 @@ template emuptr	EmMem_memcpy<emuptr, emuptr>		(emuptr dst, emuptr src, size_t le
 template <class T1, class T2>
 T1		EmMem_memmove (T1 dst, T2 src, size_t len)
 {
+	// If the two ranges don't overlap, copy them a span at a time.
+
+	if (!_may_overlap (dst, src, len))
+	{
+		return EmMem_memcpy (dst, src, len);
+	}
+
 	T1		q = dst;
 	T2		p = src;
 
@@ -1024,8 +1301,36 @@ size_t	EmMem_strlen(emuptr str)
 {
 	emuptr eos = str;
 
-	while (_get_byte(eos))
-		_increment (eos);
+	for (;;)
+	{
+		size_t			n = 0x00010000;
+		Bool			swapped;
+		const uint8*	host = _get_read_span (eos, n, swapped);
+
+		if (host)
+		{
+			size_t	ii = 0;
+
+			while (ii < n && EmMemDoGet8 ((void*) (host + ii)) != 0)
+				++ii;
+
+			eos += ii;
+
+			if (ii < n)
+				break;
+		}
+		else
+		{
+			while (n && _get_byte(eos))
+			{
+				_increment (eos);
+				--n;
+			}
+
+			if (n)
+				break;
+		}
+	}
 
 	return ((size_t) (eos - str));
 }
@@ -1046,16 +1351,10 @@ size_t	EmMem_strlen(emuptr str)
 template <class T1, class T2>
 T1	EmMem_strcpy(T1 dst, T2 src)
 {
-	T1		q = dst;
-	T2		p = src;
-	char	ch;
+	// Find the length first so that the string can be copied a span
+	// at a time.
 
-	do {
-		ch = _get_byte (p);
-		_increment (p);
-		_put_byte (q, ch);
-		_increment (q);
-	} while (ch);
+	EmMem_memcpy (dst, src, _strlen (src) + 1);
 
 	return dst;
 }
@@ -67,12 +67,31 @@ typedef struct EmAddressBank
 
 	extern EmAddressBank*	gEmMemBanks[65536];
 
+	// Parallel to gEmMemBanks.  For banks whose reads have no side effects
+	// or checks (other than for odd addresses) -- that is, RAM and ROM
+	// banks -- holds the host address of the start of the bank.  Otherwise,
+	// holds NULL.  The EmMemGet functions use this to read those banks
+	// inline instead of calling through the bank's get function.
+
+	extern uint8*			gEmMemFastRead[65536];
+
+	#define HAS_FAST_READ	1
+
 #else // ECM_DYNAMIC_PATCH
 
 	extern EmAddressBank**	gDynEmMemBanksP;
 
+	#define HAS_FAST_READ	0
+
 #endif // ECM_DYNAMIC_PATCH
 
+#if HAS_PROFILING
+	// Cycles aren't counted on the fast path, so don't take it when
+	// profiling.  (Declared in Profiling.h, which UAE doesn't include.)
+
+	extern int				gProfilingEnabled;
+#endif
+
 
 // ---------------------------------------------------------------------------
 //		 Support macros
@@ -97,169 +116,201 @@ typedef struct EmAddressBank
 #define EmMemCallGetFunc(func, addr)	((*EmMemGetBank(addr).func)(addr))
 #define EmMemCallPutFunc(func, addr, v)	((*EmMemGetBank(addr).func)(addr, v))
 
+#if HAS_FAST_READ
+
+	#define EmMemFastReadBase(addr)		(gEmMemFastRead[EmMemBankIndex(addr)])
+	#define EmMemFastReadAddr(b, addr)	((b) + ((addr) & 0x0000FFFF))
+
+	#if HAS_PROFILING
+		#define EmMemFastReadOK(b, addr, mask)	((b) && ((addr) & (mask)) == 0 && !gProfilingEnabled)
+	#else
+		#define EmMemFastReadOK(b, addr, mask)	((b) && ((addr) & (mask)) == 0)
+	#endif
+
+#endif
+
 
 // ---------------------------------------------------------------------------
-//		 EmMemGet32
+//		 EmMemDoGet32
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE uint32 EmMemGet32(emuptr addr)
+STATIC_INLINE uint32 EmMemDoGet32 (void* a)
 {
-    return EmMemCallGetFunc(lget, addr);
+#if WORDSWAP_MEMORY || !UNALIGNED_LONG_ACCESS
+	return	(((uint32) *(((uint16*) a) + 0)) << 16) |
+			(((uint32) *(((uint16*) a) + 1)));
+#else
+	return *(uint32*) a;
+#endif
 }
 
 // ---------------------------------------------------------------------------
-//		 EmMemGet16
+//		 EmMemDoGet16
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE uint32 EmMemGet16(emuptr addr)
+STATIC_INLINE uint16 EmMemDoGet16 (void* a)
 {
-    return EmMemCallGetFunc(wget, addr);
+	return *(uint16*) a;
 }
 
 // ---------------------------------------------------------------------------
-//		 EmMemGet8
+//		 EmMemDoGet8
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE uint32 EmMemGet8(emuptr addr)
+STATIC_INLINE uint8 EmMemDoGet8 (void* a)
 {
-    return EmMemCallGetFunc(bget, addr);
+#if WORDSWAP_MEMORY
+	return *(uint8*) ((long) a ^ 1);
+#else
+	return *(uint8*) a;
+#endif
 }
 
 // ---------------------------------------------------------------------------
-//		 EmMemPut32
+//		 EmMemDoPut32
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE void EmMemPut32(emuptr addr, uint32 l)
+STATIC_INLINE void EmMemDoPut32 (void* a, uint32 v)
 {
-    EmMemCallPutFunc(lput, addr, l);
+#if WORDSWAP_MEMORY || !UNALIGNED_LONG_ACCESS
+	*(((uint16*) a) + 0) = (uint16) (v >> 16);
+	*(((uint16*) a) + 1) = (uint16) (v);
+#else
+	*(uint32*) a = v;
+#endif
 }
 
 // ---------------------------------------------------------------------------
-//		 EmMemPut16
+//		 EmMemDoPut16
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE void EmMemPut16(emuptr addr, uint32 w)
+STATIC_INLINE void EmMemDoPut16 (void* a, uint16 v)
 {
-    EmMemCallPutFunc(wput, addr, w);
+	*(uint16*) a = v;
 }
 
 // ---------------------------------------------------------------------------
-//		 EmMemPut8
+//		 EmMemDoPut8
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE void EmMemPut8(emuptr addr, uint32 b)
+STATIC_INLINE void EmMemDoPut8 (void* a, uint8 v)
 {
-    EmMemCallPutFunc(bput, addr, b);
+#if WORDSWAP_MEMORY
+	*(uint8*) ((long) a ^ 1) = v;
+#else
+	*(uint8*) a = v;
+#endif
 }
 
+
 // ---------------------------------------------------------------------------
-//		 EmMemGetRealAddress
+//		 EmMemGet32
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE uint8* EmMemGetRealAddress(emuptr addr)
+STATIC_INLINE uint32 EmMemGet32(emuptr addr)
 {
-    return EmMemGetBank(addr).xlateaddr(addr);
+#if HAS_FAST_READ
+	uint8*	base = EmMemFastReadBase(addr);
+	if (EmMemFastReadOK(base, addr, 1))
+		return EmMemDoGet32(EmMemFastReadAddr(base, addr));
+#endif
+
+    return EmMemCallGetFunc(lget, addr);
 }
 
 // ---------------------------------------------------------------------------
-//		 EmMemCheckAddress
+//		 EmMemGet16
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE int EmMemCheckAddress(emuptr addr, uint32 size)
+STATIC_INLINE uint32 EmMemGet16(emuptr addr)
 {
-    return EmMemGetBank(addr).checkaddr(addr, size);
+#if HAS_FAST_READ
+	uint8*	base = EmMemFastReadBase(addr);
+	if (EmMemFastReadOK(base, addr, 1))
+		return EmMemDoGet16(EmMemFastReadAddr(base, addr));
+#endif
+
+    return EmMemCallGetFunc(wget, addr);
 }
 
 // ---------------------------------------------------------------------------
-//		 EmMemAddOpcodeCycles
+//		 EmMemGet8
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE void EmMemAddOpcodeCycles(emuptr addr)
+STATIC_INLINE uint32 EmMemGet8(emuptr addr)
 {
-	EmAssert (EmMemGetBank(addr).EmMemAddOpcodeCycles);
-    EmMemGetBank(addr).EmMemAddOpcodeCycles();
+#if HAS_FAST_READ
+	uint8*	base = EmMemFastReadBase(addr);
+	if (EmMemFastReadOK(base, addr, 0))
+		return EmMemDoGet8(EmMemFastReadAddr(base, addr));
+#endif
+
+    return EmMemCallGetFunc(bget, addr);
 }
 
 // ---------------------------------------------------------------------------
-//		 EmMemGetMetaAddress
+//		 EmMemPut32
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE uint8* EmMemGetMetaAddress(emuptr addr)
+STATIC_INLINE void EmMemPut32(emuptr addr, uint32 l)
 {
-	EmAssert(EmMemGetBank(addr).xlatemetaaddr);
-    return EmMemGetBank(addr).xlatemetaaddr(addr);
+    EmMemCallPutFunc(lput, addr, l);
 }
 
 // ---------------------------------------------------------------------------
-//		 EmMemDoGet32
+//		 EmMemPut16
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE uint32 EmMemDoGet32 (void* a)
+STATIC_INLINE void EmMemPut16(emuptr addr, uint32 w)
 {
-#if WORDSWAP_MEMORY || !UNALIGNED_LONG_ACCESS
-	return	(((uint32) *(((uint16*) a) + 0)) << 16) |
-			(((uint32) *(((uint16*) a) + 1)));
-#else
-	return *(uint32*) a;
-#endif
+    EmMemCallPutFunc(wput, addr, w);
 }
 
 // ---------------------------------------------------------------------------
-//		 EmMemDoGet16
+//		 EmMemPut8
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE uint16 EmMemDoGet16 (void* a)
+STATIC_INLINE void EmMemPut8(emuptr addr, uint32 b)
 {
-	return *(uint16*) a;
+    EmMemCallPutFunc(bput, addr, b);
 }
 
 // ---------------------------------------------------------------------------
-//		 EmMemDoGet8
+//		 EmMemGetRealAddress
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE uint8 EmMemDoGet8 (void* a)
+STATIC_INLINE uint8* EmMemGetRealAddress(emuptr addr)
 {
-#if WORDSWAP_MEMORY
-	return *(uint8*) ((long) a ^ 1);
-#else
-	return *(uint8*) a;
-#endif
+    return EmMemGetBank(addr).xlateaddr(addr);
 }
 
 // ---------------------------------------------------------------------------
-//		 EmMemDoPut32
+//		 EmMemCheckAddress
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE void EmMemDoPut32 (void* a, uint32 v)
+STATIC_INLINE int EmMemCheckAddress(emuptr addr, uint32 size)
 {
-#if WORDSWAP_MEMORY || !UNALIGNED_LONG_ACCESS
-	*(((uint16*) a) + 0) = (uint16) (v >> 16);
-	*(((uint16*) a) + 1) = (uint16) (v);
-#else
-	*(uint32*) a = v;
-#endif
+    return EmMemGetBank(addr).checkaddr(addr, size);
 }
 
 // ---------------------------------------------------------------------------
-//		 EmMemDoPut16
+//		 EmMemAddOpcodeCycles
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE void EmMemDoPut16 (void* a, uint16 v)
+STATIC_INLINE void EmMemAddOpcodeCycles(emuptr addr)
 {
-	*(uint16*) a = v;
+	EmAssert (EmMemGetBank(addr).EmMemAddOpcodeCycles);
+    EmMemGetBank(addr).EmMemAddOpcodeCycles();
 }
 
 // ---------------------------------------------------------------------------
-//		 EmMemDoPut8
+//		 EmMemGetMetaAddress
 // ---------------------------------------------------------------------------
 
-STATIC_INLINE void EmMemDoPut8 (void* a, uint8 v)
+STATIC_INLINE uint8* EmMemGetMetaAddress(emuptr addr)
 {
-#if WORDSWAP_MEMORY
-	*(uint8*) ((long) a ^ 1) = v;
-#else
-	*(uint8*) a = v;
-#endif
+	EmAssert(EmMemGetBank(addr).xlatemetaaddr);
+    return EmMemGetBank(addr).xlatemetaaddr(addr);
 }
 
 
@@ -371,6 +422,10 @@ class Memory
 		static void				InitializeBanks		(EmAddressBank& iBankInitializer,
 													 int32 iStartingBankIndex,
 													 int32 iNumberOfBanks);
+		static void				InitializeFastRead	(uint8* iMemory,
+													 uint32 iMemoryMask,
+													 int32 iStartingBankIndex,
+													 int32 iNumberOfBanks);
 
 		static void				ResetBankHandlers	(void);
 
@@ -81,6 +81,7 @@
 // ---------------------------------------------------------------------------
 
 EmRegs::EmRegs (void) :
+	fHandlerStart (EmMemNULL),
 	fReadFunctions (),
 	fWriteFunctions ()
 {
@@ -153,6 +154,8 @@ void EmRegs::SetBankHandlers (EmAddressBank& bank)
 
 	Memory::InitializeBanks (bank, EmMemBankIndex (address), numBanks);
 
+	fHandlerStart = address;
+
 	this->SetSubBankHandlers ();
 }
 
@@ -176,7 +179,7 @@ uint32 EmRegs::GetLong (emuptr address)
 {
 //	EmAssert (this->ValidAddress (address, 4));
 
-	long			offset	= address - this->GetAddressStart ();
+	long			offset	= address - fHandlerStart;
 	ReadFunction	fn		= fReadFunctions [offset];
 	EmAssert (fn);
 
@@ -192,7 +195,7 @@ uint32 EmRegs::GetWord (emuptr address)
 {
 //	EmAssert (this->ValidAddress (address, 2));
 
-	long			offset	= address - this->GetAddressStart ();
+	long			offset	= address - fHandlerStart;
 	ReadFunction	fn		= fReadFunctions [offset];
 	EmAssert (fn);
 
@@ -208,7 +211,7 @@ uint32 EmRegs::GetByte (emuptr address)
 {
 //	EmAssert (this->ValidAddress (address, 1));
 
-	long			offset	= address - this->GetAddressStart ();
+	long			offset	= address - fHandlerStart;
 	ReadFunction	fn		= fReadFunctions [offset];
 	EmAssert (fn);
 
@@ -224,7 +227,7 @@ void EmRegs::SetLong (emuptr address, uint32 value)
 {
 //	EmAssert (this->ValidAddress (address, 4));
 
-	long			offset	= address - this->GetAddressStart ();
+	long			offset	= address - fHandlerStart;
 	WriteFunction	fn		= fWriteFunctions [offset];
 	EmAssert (fn);
 
@@ -240,7 +243,7 @@ void EmRegs::SetWord (emuptr address, uint32 value)
 {
 //	EmAssert (this->ValidAddress (address, 2));
 
-	long			offset	= address - this->GetAddressStart ();
+	long			offset	= address - fHandlerStart;
 	WriteFunction	fn		= fWriteFunctions [offset];
 	EmAssert (fn);
 
@@ -256,7 +259,7 @@ void EmRegs::SetByte (emuptr address, uint32 value)
 {
 //	EmAssert (this->ValidAddress (address, 1));
 
-	long			offset	= address - this->GetAddressStart ();
+	long			offset	= address - fHandlerStart;
 	WriteFunction	fn		= fWriteFunctions [offset];
 	EmAssert (fn);
 
@@ -312,9 +315,11 @@ void EmRegs::SetHandler (ReadFunction read, WriteFunction write,
 
 		fReadFunctions.resize (range, &EmRegs::UnsupportedRead);
 		fWriteFunctions.resize (range, &EmRegs::UnsupportedWrite);
+
+		fHandlerStart = this->GetAddressStart ();
 	}
 
-	int index = start - this->GetAddressStart ();
+	int index = start - fHandlerStart;
 
 	EmAssert (index >= 0);
 	EmAssert (index < (long) fReadFunctions.size ());
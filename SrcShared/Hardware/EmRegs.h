@@ -66,6 +66,7 @@ class EmRegs
 		typedef vector<ReadFunction>	ReadFunctionList;
 		typedef vector<WriteFunction>	WriteFunctionList;
 
+		emuptr					fHandlerStart;		// GetAddressStart, cached for the Get/Set functions.
 		ReadFunctionList		fReadFunctions;
 		WriteFunctionList		fWriteFunctions;
 };
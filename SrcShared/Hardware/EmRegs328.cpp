@@ -23,7 +23,7 @@
 #include "EmSession.h"			// GetDevice
 #include "Hordes.h"				// Hordes::IsOn
 #include "Logging.h"			// LogAppendMsg
-#include "Miscellaneous.h"		// GetHostTime
+#include "Miscellaneous.h"		// GetHostTime, UseDeterministicClock
 #include "PreferenceMgr.h"		// Preference
 #include "SessionFile.h"		// WriteHwrDBallType, etc.
 #include "UAE.h"				// regs, SPCFLAG_INT
@@ -342,6 +342,8 @@ EmRegs328::EmRegs328 (void) :
 	fSec (0),
 	fTick (0),
 	fCycle (0),
+	fLastCycle (EmHAL::GetCycle ()),
+	fNextEvent (EmHAL::GetCycle ()),
 	fUART (NULL)
 {
 }
@@ -374,6 +376,8 @@ void EmRegs328::Initialize (void)
 
 void EmRegs328::Reset (Bool hardwareReset)
 {
+	this->SyncTimers ();
+
 	EmRegs::Reset (hardwareReset);
 
 	if (hardwareReset)
@@ -396,6 +400,8 @@ void EmRegs328::Reset (Bool hardwareReset)
 		Bool	sendTxData = false;
 		EmRegs328::UARTStateChanged (sendTxData);
 	}
+
+	this->ScheduleTimers ();
 }
 
 
@@ -405,6 +411,10 @@ void EmRegs328::Reset (Bool hardwareReset)
 
 void EmRegs328::Save (SessionFile& f)
 {
+	// Bring the timer and time of day up to date before saving them.
+
+	this->SyncTimers ();
+
 	EmRegs::Save (f);
 
 	StWordSwapper		swapper1 (&f68328Regs, sizeof(f68328Regs));
@@ -524,6 +534,12 @@ void EmRegs328::Load (SessionFile& f)
 	{
 		f.SetCanReload (false);
 	}
+
+	// The timer is now as of the current cycle.  Schedule its next event
+	// based on the loaded register values.
+
+	fLastCycle = EmHAL::GetCycle ();
+	this->ScheduleTimers ();
 }
 
 
@@ -665,11 +681,11 @@ void EmRegs328::SetSubBankHandlers (void)
 	INSTALL_HANDLER (StdRead,			NullWrite,				tmr1Counter);
 	INSTALL_HANDLER (tmr1StatusRead,	tmr1StatusWrite,		tmr1Status);
 
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr2Control);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr2Prescaler);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr2Compare);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr2Control);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr2Prescaler);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr2Compare);
 	INSTALL_HANDLER (StdRead,			StdWrite,				tmr2Capture);
-	INSTALL_HANDLER (StdRead,			NullWrite,				tmr2Counter);
+	INSTALL_HANDLER (tmrCounterRead,	NullWrite,				tmr2Counter);
 	INSTALL_HANDLER (tmr2StatusRead,	tmr2StatusWrite,		tmr2Status);
 
 	INSTALL_HANDLER (StdRead,			StdWrite,				wdControl);
@@ -754,9 +770,10 @@ uint32 EmRegs328::GetAddressRange (void)
 //		 EmRegs328::Cycle
 // ---------------------------------------------------------------------------
 // Handles periodic events that need to occur when the processor cycles (like
-// updating timer registers).  This function is called in two places from
-// Emulator::Execute.  Interestingly, the loop runs 3% FASTER if this function
-// is in its own separate function instead of being inline.
+// updating timer registers).  EmHAL only calls this function on the cycles
+// we ask for in ScheduleTimers (and on every cycle while the processor is
+// sleeping).  The rest of the time, the timer is brought up to date in bulk
+// by SyncTimers.
 
 #if 0
 static int		calibrated;
@@ -803,6 +820,12 @@ static void PrvCalibrate (uint16 tmrCompare)
 		}
 	}
 }
+#else
+	#if _DEBUG
+		#define increment	20
+	#else
+		#define increment	4
+	#endif
 #endif
 
 void EmRegs328::Cycle (Bool sleeping)
@@ -814,14 +837,27 @@ void EmRegs328::Cycle (Bool sleeping)
 	{
 		::PrvCalibrate (READ_REGISTER (tmr2Compare));
 	}
-#else
-	#if _DEBUG
-		#define increment	20
-	#else
-		#define increment	4
-	#endif
 #endif
 
+	this->SyncTimers ();
+
+	if (sleeping)
+	{
+		this->StepTimers (sleeping);
+	}
+
+	this->ScheduleTimers ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegs328::StepTimers
+// ---------------------------------------------------------------------------
+// Advance timer 2 and the time of day by a single cycle, posting any
+// interrupt that results.
+
+void EmRegs328::StepTimers (Bool sleeping)
+{
 	// Determine whether timer 2 is enabled.
 
 	if ((READ_REGISTER (tmr2Control) & hwr328TmrControlEnable) != 0)
@@ -855,7 +891,10 @@ void EmRegs328::Cycle (Bool sleeping)
 		}
 	}
 
-	if ((fCycle += increment) > READ_REGISTER (tmr2Compare))
+	// A sleeping step stands for a whole timer period (the compares above
+	// are forced), so it advances the time of day by a whole tick, too.
+
+	if (sleeping || (fCycle += increment) > READ_REGISTER (tmr2Compare))
 	{
 		fCycle = 0;
 
@@ -882,6 +921,96 @@ void EmRegs328::Cycle (Bool sleeping)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmRegs328::SyncTimers
+// ---------------------------------------------------------------------------
+// Bring timer 2 and the time of day up to date with the number of cycles
+// EmHAL has counted since we last looked.  None of the cycles before our
+// scheduled one can cause an event, so they're accounted for in one go.
+
+void EmRegs328::SyncTimers (void)
+{
+	uint32	now		= EmHAL::GetCycle ();
+	uint32	elapsed	= now - fLastCycle;
+
+	if (elapsed == 0)
+	{
+		return;
+	}
+
+	fLastCycle = now;
+
+	if (now == fNextEvent)
+	{
+		this->AdvanceTimers (elapsed - 1);
+		this->StepTimers (false);
+	}
+	else
+	{
+		this->AdvanceTimers (elapsed);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegs328::AdvanceTimers
+// ---------------------------------------------------------------------------
+// Advance timer 2 and the time of day by the given number of cycles, none
+// of which cause the timer to reach its compare value.
+
+void EmRegs328::AdvanceTimers (uint32 cycles)
+{
+	if (cycles == 0)
+	{
+		return;
+	}
+
+	uint32	amount = cycles * increment;
+
+	if ((READ_REGISTER (tmr2Control) & hwr328TmrControlEnable) != 0)
+	{
+		WRITE_REGISTER (tmr2Counter, READ_REGISTER (tmr2Counter) + amount);
+	}
+
+	fCycle += amount;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegs328::ScheduleTimers
+// ---------------------------------------------------------------------------
+// Work out how many cycles it will be until the next timer event (timer 2
+// reaching its compare value or the time of day ticking), and ask EmHAL to
+// call us then.
+
+void EmRegs328::ScheduleTimers (void)
+{
+	EmAssert (fLastCycle == EmHAL::GetCycle ());
+
+	uint16	tmr2Compare	= READ_REGISTER (tmr2Compare);
+	uint32	cycles		= 1;
+
+	if (fCycle + increment <= tmr2Compare)
+	{
+		cycles = (tmr2Compare - fCycle) / increment + 1;
+	}
+
+	if ((READ_REGISTER (tmr2Control) & hwr328TmrControlEnable) != 0)
+	{
+		uint32	tmr2Cycles = EmHAL::CyclesUntilCompare (
+			READ_REGISTER (tmr2Counter), tmr2Compare, increment);
+
+		if (tmr2Cycles != 0 && tmr2Cycles < cycles)
+		{
+			cycles = tmr2Cycles;
+		}
+	}
+
+	fNextEvent = fLastCycle + cycles;
+	EmHAL::ScheduleCycle (fNextEvent);
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmRegs328::CycleSlowly
 // ---------------------------------------------------------------------------
@@ -931,7 +1060,20 @@ void EmRegs328::CycleSlowly (Bool sleeping)
 		long	nowHour;
 		long	nowMin;
 		long	nowSec;
-		::GetHostTime (&nowHour, &nowMin, &nowSec);
+
+		if (::UseDeterministicClock ())
+		{
+			this->SyncTimers ();
+
+			nowHour = fHour;
+			nowMin = fMin;
+			nowSec = fSec;
+		}
+		else
+		{
+			::GetHostTime (&nowHour, &nowMin, &nowSec);
+		}
+
 		long	nowInSeconds = (nowHour * 60 * 60) + (nowMin * 60) + nowSec;
 
 		if (almInSeconds <= nowInSeconds)
@@ -960,7 +1102,11 @@ void EmRegs328::TurnSoundOff (void)
 
 void EmRegs328::ResetTimer (void)
 {
+	this->SyncTimers ();
+
 	WRITE_REGISTER (tmr2Counter, 0);
+
+	this->ScheduleTimers ();
 }
 
 
@@ -970,11 +1116,15 @@ void EmRegs328::ResetTimer (void)
 
 void EmRegs328::ResetRTC (void)
 {
+	this->SyncTimers ();
+
 	fHour = 15;
 	fMin = 0;
 	fSec = 0;
 	fTick = 0;
 	fCycle = 0;
+
+	this->ScheduleTimers ();
 }
 
 
@@ -1540,6 +1690,8 @@ uint32 EmRegs328::tmr1StatusRead (emuptr address, int size)
 
 uint32 EmRegs328::tmr2StatusRead (emuptr address, int size)
 {
+	this->SyncTimers ();
+
 #if 0	// (Greg doesn't do this for Timer 2...I wonder why)
 
 	/*
@@ -1585,6 +1737,22 @@ uint32 EmRegs328::tmr2StatusRead (emuptr address, int size)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmRegs328::tmrCounterRead
+// ---------------------------------------------------------------------------
+
+uint32 EmRegs328::tmrCounterRead (emuptr address, int size)
+{
+	// Bring the counter up to date.
+
+	this->SyncTimers ();
+
+	// Finish up by doing a standard read.
+
+	return EmRegs328::StdRead (address, size);
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmRegs328::uartRead
 // ---------------------------------------------------------------------------
@@ -1615,8 +1783,10 @@ uint32 EmRegs328::rtcHourMinSecRead (emuptr address, int size)
 
 	long	hour, min, sec;
 
-	if (Hordes::IsOn ())
+	if (Hordes::IsOn () || ::UseDeterministicClock ())
 	{
+		this->SyncTimers ();
+
 		hour = fHour;
 		min = fMin;
 		sec = fSec;
@@ -1927,6 +2097,23 @@ void EmRegs328::tmr2StatusWrite (emuptr address, int size, uint32 value)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmRegs328::tmrRegisterWrite
+// ---------------------------------------------------------------------------
+
+void EmRegs328::tmrRegisterWrite (emuptr address, int size, uint32 value)
+{
+	// Account for the cycles run under the old settings before changing
+	// them, and then work out when the next event is under the new ones.
+
+	this->SyncTimers ();
+
+	EmRegs328::StdWrite (address, size, value);
+
+	this->ScheduleTimers ();
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmRegs328::wdCounterWrite
 // ---------------------------------------------------------------------------
@@ -76,6 +76,7 @@ class EmRegs328 : public EmRegs, public EmHALHandler
 		uint32					portXDataRead			(emuptr address, int size);
 		uint32					tmr1StatusRead			(emuptr address, int size);
 		uint32					tmr2StatusRead			(emuptr address, int size);
+		uint32					tmrCounterRead			(emuptr address, int size);
 		uint32					uartRead				(emuptr address, int size);
 		uint32					rtcHourMinSecRead		(emuptr address, int size);
 
@@ -89,6 +90,7 @@ class EmRegs328 : public EmRegs, public EmHALHandler
 		void					portDIntReqEnWrite		(emuptr address, int size, uint32 value);
 		void					tmr1StatusWrite			(emuptr address, int size, uint32 value);
 		void					tmr2StatusWrite			(emuptr address, int size, uint32 value);
+		void					tmrRegisterWrite		(emuptr address, int size, uint32 value);
 		void					wdCounterWrite			(emuptr address, int size, uint32 value);
 		void					spiMasterControlWrite	(emuptr address, int size, uint32 value);
 		void					uartWrite				(emuptr address, int size, uint32 value);
@@ -97,6 +99,12 @@ class EmRegs328 : public EmRegs, public EmHALHandler
 		void					rtcIntStatusWrite		(emuptr address, int size, uint32 value);
 		void					rtcIntEnableWrite		(emuptr address, int size, uint32 value);
 
+	private:
+		void					StepTimers				(Bool sleeping);
+		void					SyncTimers				(void);
+		void					AdvanceTimers			(uint32 cycles);
+		void					ScheduleTimers			(void);
+
 	protected:
 		void					HotSyncEvent			(Bool buttonIsDown);
 
@@ -140,6 +148,9 @@ class EmRegs328 : public EmRegs, public EmHALHandler
 		uint32					fTick;
 		uint32					fCycle;
 
+		uint32					fLastCycle;		// EmHAL cycle the timer is up to date with.
+		uint32					fNextEvent;		// EmHAL cycle of the next timer event.
+
 		EmUARTDragonball*		fUART;
 };
 
@@ -24,7 +24,7 @@
 #include "EmSPISlave.h"			// DoExchange
 #include "Hordes.h"				// Hordes::IsOn
 #include "Logging.h"			// LogAppendMsg
-#include "Miscellaneous.h"		// GetHostTime
+#include "Miscellaneous.h"		// GetHostTime, UseDeterministicClock
 #include "PreferenceMgr.h"		// Preference
 #include "SessionFile.h"		// WriteHwrDBallEZType, etc.
 #include "UAE.h"				// regs, SPCFLAG_INT
@@ -264,6 +264,8 @@ EmRegsEZ::EmRegsEZ (void) :
 	fSec (0),
 	fTick (0),
 	fCycle (0),
+	fLastCycle (EmHAL::GetCycle ()),
+	fNextEvent (EmHAL::GetCycle ()),
 	fUART (NULL)
 {
 }
@@ -296,6 +298,8 @@ void EmRegsEZ::Initialize (void)
 
 void EmRegsEZ::Reset (Bool hardwareReset)
 {
+	this->SyncTimers ();
+
 	EmRegs::Reset (hardwareReset);
 
 	if (hardwareReset)
@@ -317,6 +321,8 @@ void EmRegsEZ::Reset (Bool hardwareReset)
 		Bool	sendTxData = false;
 		EmRegsEZ::UARTStateChanged (sendTxData);
 	}
+
+	this->ScheduleTimers ();
 }
 
 
@@ -326,6 +332,10 @@ void EmRegsEZ::Reset (Bool hardwareReset)
 
 void EmRegsEZ::Save (SessionFile& f)
 {
+	// Bring the timer and time of day up to date before saving them.
+
+	this->SyncTimers ();
+
 	EmRegs::Save (f);
 
 	StWordSwapper				swapper1 (&f68EZ328Regs, sizeof(f68EZ328Regs));
@@ -437,6 +447,12 @@ void EmRegsEZ::Load (SessionFile& f)
 	{
 		f.SetCanReload (false);
 	}
+
+	// The timer is now as of the current cycle.  Schedule its next event
+	// based on the loaded register values.
+
+	fLastCycle = EmHAL::GetCycle ();
+	this->ScheduleTimers ();
 }
 
 
@@ -541,11 +557,11 @@ void EmRegsEZ::SetSubBankHandlers (void)
 	INSTALL_HANDLER (StdRead,			StdWrite,				pwmPeriod);
 	INSTALL_HANDLER (StdRead,			NullWrite,				pwmCounter);
 
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr1Control);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr1Prescaler);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr1Compare);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr1Control);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr1Prescaler);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr1Compare);
 	INSTALL_HANDLER (StdRead,			StdWrite,				tmr1Capture);
-	INSTALL_HANDLER (StdRead,			NullWrite,				tmr1Counter);
+	INSTALL_HANDLER (tmrCounterRead,	NullWrite,				tmr1Counter);
 	INSTALL_HANDLER (tmr1StatusRead,	tmr1StatusWrite,		tmr1Status);
 
 	INSTALL_HANDLER (StdRead,			StdWrite,				spiMasterData);
@@ -635,18 +651,38 @@ uint32 EmRegsEZ::GetAddressRange (void)
 //		 EmRegsEZ::Cycle
 // ---------------------------------------------------------------------------
 // Handles periodic events that need to occur when the processor cycles (like
-// updating timer registers).  This function is called in two places from
-// Emulator::Execute.  Interestingly, the loop runs 3% FASTER if this function
-// is in its own separate function instead of being inline.
+// updating timer registers).  EmHAL only calls this function on the cycles
+// we ask for in ScheduleTimers (and on every cycle while the processor is
+// sleeping).  The rest of the time, the timer is brought up to date in bulk
+// by SyncTimers.
 
-void EmRegsEZ::Cycle (Bool sleeping)
-{
 #if _DEBUG
 	#define increment	20
 #else
 	#define increment	4
 #endif
 
+void EmRegsEZ::Cycle (Bool sleeping)
+{
+	this->SyncTimers ();
+
+	if (sleeping)
+	{
+		this->StepTimers (sleeping);
+	}
+
+	this->ScheduleTimers ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsEZ::StepTimers
+// ---------------------------------------------------------------------------
+// Advance the timer and time of day by a single cycle, posting any
+// interrupt that results.
+
+void EmRegsEZ::StepTimers (Bool sleeping)
+{
 	// Determine whether timer is enabled.
 
 	if ((READ_REGISTER (tmr1Control) & hwrEZ328TmrControlEnable) != 0)
@@ -680,7 +716,10 @@ void EmRegsEZ::Cycle (Bool sleeping)
 		}
 	}
 
-	if ((fCycle += increment) > READ_REGISTER (tmr1Compare))
+	// A sleeping step stands for a whole timer period (the compares above
+	// are forced), so it advances the time of day by a whole tick, too.
+
+	if (sleeping || (fCycle += increment) > READ_REGISTER (tmr1Compare))
 	{
 		fCycle = 0;
 
@@ -707,6 +746,96 @@ void EmRegsEZ::Cycle (Bool sleeping)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmRegsEZ::SyncTimers
+// ---------------------------------------------------------------------------
+// Bring the timer and time of day up to date with the number of cycles
+// EmHAL has counted since we last looked.  None of the cycles before our
+// scheduled one can cause an event, so they're accounted for in one go.
+
+void EmRegsEZ::SyncTimers (void)
+{
+	uint32	now		= EmHAL::GetCycle ();
+	uint32	elapsed	= now - fLastCycle;
+
+	if (elapsed == 0)
+	{
+		return;
+	}
+
+	fLastCycle = now;
+
+	if (now == fNextEvent)
+	{
+		this->AdvanceTimers (elapsed - 1);
+		this->StepTimers (false);
+	}
+	else
+	{
+		this->AdvanceTimers (elapsed);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsEZ::AdvanceTimers
+// ---------------------------------------------------------------------------
+// Advance the timer and time of day by the given number of cycles, none of
+// which cause the timer to reach its compare value.
+
+void EmRegsEZ::AdvanceTimers (uint32 cycles)
+{
+	if (cycles == 0)
+	{
+		return;
+	}
+
+	uint32	amount = cycles * increment;
+
+	if ((READ_REGISTER (tmr1Control) & hwrEZ328TmrControlEnable) != 0)
+	{
+		WRITE_REGISTER (tmr1Counter, READ_REGISTER (tmr1Counter) + amount);
+	}
+
+	fCycle += amount;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsEZ::ScheduleTimers
+// ---------------------------------------------------------------------------
+// Work out how many cycles it will be until the next timer event (the timer
+// reaching its compare value or the time of day ticking), and ask EmHAL to
+// call us then.
+
+void EmRegsEZ::ScheduleTimers (void)
+{
+	EmAssert (fLastCycle == EmHAL::GetCycle ());
+
+	uint16	tmr1Compare	= READ_REGISTER (tmr1Compare);
+	uint32	cycles		= 1;
+
+	if (fCycle + increment <= tmr1Compare)
+	{
+		cycles = (tmr1Compare - fCycle) / increment + 1;
+	}
+
+	if ((READ_REGISTER (tmr1Control) & hwrEZ328TmrControlEnable) != 0)
+	{
+		uint32	tmr1Cycles = EmHAL::CyclesUntilCompare (
+			READ_REGISTER (tmr1Counter), tmr1Compare, increment);
+
+		if (tmr1Cycles != 0 && tmr1Cycles < cycles)
+		{
+			cycles = tmr1Cycles;
+		}
+	}
+
+	fNextEvent = fLastCycle + cycles;
+	EmHAL::ScheduleCycle (fNextEvent);
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmRegsEZ::CycleSlowly
 // ---------------------------------------------------------------------------
@@ -757,7 +886,20 @@ void EmRegsEZ::CycleSlowly (Bool sleeping)
 		long	nowHour;
 		long	nowMin;
 		long	nowSec;
-		::GetHostTime (&nowHour, &nowMin, &nowSec);
+
+		if (::UseDeterministicClock ())
+		{
+			this->SyncTimers ();
+
+			nowHour = fHour;
+			nowMin = fMin;
+			nowSec = fSec;
+		}
+		else
+		{
+			::GetHostTime (&nowHour, &nowMin, &nowSec);
+		}
+
 		long	nowInSeconds = (nowHour * 60 * 60) + (nowMin * 60) + nowSec;
 
 		if (almInSeconds <= nowInSeconds)
@@ -786,7 +928,11 @@ void EmRegsEZ::TurnSoundOff (void)
 
 void EmRegsEZ::ResetTimer (void)
 {
+	this->SyncTimers ();
+
 	WRITE_REGISTER (tmr1Counter, 0);
+
+	this->ScheduleTimers ();
 }
 
 
@@ -796,11 +942,15 @@ void EmRegsEZ::ResetTimer (void)
 
 void EmRegsEZ::ResetRTC (void)
 {
+	this->SyncTimers ();
+
 	fHour = 15;
 	fMin = 0;
 	fSec = 0;
 	fTick = 0;
 	fCycle = 0;
+
+	this->ScheduleTimers ();
 }
 
 
@@ -1376,6 +1526,8 @@ uint32 EmRegsEZ::portXDataRead (emuptr address, int)
 
 uint32 EmRegsEZ::tmr1StatusRead (emuptr address, int size)
 {
+	this->SyncTimers ();
+
 	uint16	tmr1Counter = READ_REGISTER (tmr1Counter) + 16;
 	uint16	tmr1Compare = READ_REGISTER (tmr1Compare);
 	uint16	tmr1Control = READ_REGISTER (tmr1Control);
@@ -1405,6 +1557,26 @@ uint32 EmRegsEZ::tmr1StatusRead (emuptr address, int size)
 
 	fLastTmr1Status |= READ_REGISTER (tmr1Status);
 
+	// We may have moved the counter; reschedule its next event.
+
+	this->ScheduleTimers ();
+
+	// Finish up by doing a standard read.
+
+	return EmRegsEZ::StdRead (address, size);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsEZ::tmrCounterRead
+// ---------------------------------------------------------------------------
+
+uint32 EmRegsEZ::tmrCounterRead (emuptr address, int size)
+{
+	// Bring the counter up to date.
+
+	this->SyncTimers ();
+
 	// Finish up by doing a standard read.
 
 	return EmRegsEZ::StdRead (address, size);
@@ -1441,8 +1613,10 @@ uint32 EmRegsEZ::rtcHourMinSecRead (emuptr address, int size)
 
 	long	hour, min, sec;
 
-	if (Hordes::IsOn ())
+	if (Hordes::IsOn () || ::UseDeterministicClock ())
 	{
+		this->SyncTimers ();
+
 		hour = fHour;
 		min = fMin;
 		sec = fSec;
@@ -1714,6 +1888,23 @@ void EmRegsEZ::tmr1StatusWrite (emuptr address, int size, uint32 value)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmRegsEZ::tmrRegisterWrite
+// ---------------------------------------------------------------------------
+
+void EmRegsEZ::tmrRegisterWrite (emuptr address, int size, uint32 value)
+{
+	// Account for the cycles run under the old settings before changing
+	// them, and then work out when the next event is under the new ones.
+
+	this->SyncTimers ();
+
+	EmRegsEZ::StdWrite (address, size, value);
+
+	this->ScheduleTimers ();
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmRegsEZ::spiMasterControlWrite
 // ---------------------------------------------------------------------------
@@ -78,6 +78,7 @@ class EmRegsEZ : public EmRegs, public EmHALHandler
 		uint32					pllFreqSelRead			(emuptr address, int size);
 		uint32					portXDataRead			(emuptr address, int size);
 		uint32					tmr1StatusRead			(emuptr address, int size);
+		uint32					tmrCounterRead			(emuptr address, int size);
 		uint32					uartRead				(emuptr address, int size);
 		uint32					rtcHourMinSecRead		(emuptr address, int size);
 
@@ -89,6 +90,7 @@ class EmRegsEZ : public EmRegs, public EmHALHandler
 		void					portXDataWrite			(emuptr address, int size, uint32 value);
 		void					portDIntReqEnWrite		(emuptr address, int size, uint32 value);
 		void					tmr1StatusWrite			(emuptr address, int size, uint32 value);
+		void					tmrRegisterWrite		(emuptr address, int size, uint32 value);
 		void					spiMasterControlWrite	(emuptr address, int size, uint32 value);
 		void					uartWrite				(emuptr address, int size, uint32 value);
 		void					lcdRegisterWrite		(emuptr address, int size, uint32 value);
@@ -96,6 +98,12 @@ class EmRegsEZ : public EmRegs, public EmHALHandler
 		void					rtcIntStatusWrite		(emuptr address, int size, uint32 value);
 		void					rtcIntEnableWrite		(emuptr address, int size, uint32 value);
 
+	protected:
+		void					StepTimers				(Bool sleeping);
+		void					SyncTimers				(void);
+		void					AdvanceTimers			(uint32 cycles);
+		void					ScheduleTimers			(void);
+
 	protected:
 		void					HotSyncEvent			(Bool buttonIsDown);
 
@@ -137,6 +145,9 @@ class EmRegsEZ : public EmRegs, public EmHALHandler
 		uint32					fTick;
 		uint32					fCycle;
 
+		uint32					fLastCycle;		// EmHAL cycle the timer is up to date with.
+		uint32					fNextEvent;		// EmHAL cycle of the next timer event.
+
 		EmUARTDragonball*		fUART;
 };
 
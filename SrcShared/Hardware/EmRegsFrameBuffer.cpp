@@ -14,14 +14,48 @@
 #include "EmCommon.h"
 #include "EmRegsFrameBuffer.h"
 
-#include "Byteswapping.h"		// ByteswapWords
+#include "Byteswapping.h"		// ByteswapWords, ByteswapWordsCopy
+#include "DebugMgr.h"			// Debug::CheckStepSpy
+#include "EmBankRegs.h"			// EmBankRegs::IsSoleSubBank
+#include "EmCPU.h"				// GetPC
 #include "EmMemory.h"			// EmMemDoGet32
 #include "EmScreen.h"			// EmScreen::MarkDirty
-#include "Miscellaneous.h"		// StWordSwapper
+#include "MetaMemory.h"			// MetaMemory::InRAMOSComponent
+#include "Miscellaneous.h"		// StMemory
 #include "Platform.h"			// Platform::AllocateMemoryClear
+#include "Profiling.h"			// WAITSTATES_PLD
 #include "SessionFile.h"		// SessionFile
 
 
+/*
+	VRAM accesses normally go through EmBankRegs, which finds the sub-bank
+	for the address and calls its virtual GetLong, SetLong, etc.  Graphics-
+	heavy applications can write a lot of pixels, so for any 64K bank lying
+	entirely within the frame buffer (and shared with no other sub-bank),
+	we install gVideoBank instead.  Its handlers perform the same checks
+	as EmBankRegs' handlers, and then access fVideoMem directly.
+
+	Only one frame buffer (fgMapped) can have its banks installed at a time.
+	That's all any device has, anyway.
+*/
+
+static EmAddressBank	gVideoBank =
+{
+	EmRegsFrameBuffer::VideoGetLong,
+	EmRegsFrameBuffer::VideoGetWord,
+	EmRegsFrameBuffer::VideoGetByte,
+	EmRegsFrameBuffer::VideoSetLong,
+	EmRegsFrameBuffer::VideoSetWord,
+	EmRegsFrameBuffer::VideoSetByte,
+	EmRegsFrameBuffer::VideoGetRealAddress,
+	EmRegsFrameBuffer::VideoValidAddress,
+	NULL,
+	NULL
+};
+
+EmRegsFrameBuffer*	EmRegsFrameBuffer::fgMapped;
+
+
 // ---------------------------------------------------------------------------
 //		 EmRegsFrameBuffer::EmRegsFrameBuffer
 // ---------------------------------------------------------------------------
@@ -78,8 +112,16 @@ void EmRegsFrameBuffer::Save (SessionFile& f)
 {
 	EmRegs::Save (f);
 
-	StWordSwapper	swapper (fVideoMem, fSize);
+#if WORDSWAP_MEMORY
+	// Swap into a copy, rather than swapping video memory in place and
+	// then swapping it back.
+
+	StMemory	image (fSize);
+	::ByteswapWordsCopy (image.Get (), fVideoMem, fSize);
+	f.WriteSED1375Image (image.Get (), fSize);
+#else
 	f.WriteSED1375Image (fVideoMem, fSize);
+#endif
 }
 
 
@@ -114,6 +156,11 @@ void EmRegsFrameBuffer::Dispose (void)
 	EmRegs::Dispose ();
 
 	Platform::DisposeMemory (fVideoMem);
+
+	if (fgMapped == this)
+	{
+		fgMapped = NULL;
+	}
 }
 
 
@@ -205,8 +252,28 @@ int EmRegsFrameBuffer::ValidAddress (emuptr address, uint32 size)
 
 void EmRegsFrameBuffer::SetSubBankHandlers (void)
 {
-	// We don't have handlers for each byte of memory, so there's nothing
-	// to install here.
+	// We don't have handlers for each byte of memory.  Instead, take over
+	// any 64K banks that we cover completely and don't share with another
+	// sub-bank.  The rest stay with EmBankRegs.
+
+	if (fgMapped && fgMapped != this)
+	{
+		return;
+	}
+
+	uint64	start64		= fBaseAddr;
+	uint64	end64		= start64 + fSize;
+	uint64	firstBank	= (start64 + 0x0000FFFF) >> 16;
+	uint64	lastBank	= end64 >> 16;	// Exclusive.
+
+	for (uint64 bankIndex = firstBank; bankIndex < lastBank; ++bankIndex)
+	{
+		if (EmBankRegs::IsSoleSubBank (this, (emuptr) (bankIndex << 16), 0x00010000))
+		{
+			Memory::InitializeBanks (gVideoBank, (int32) bankIndex, 1);
+			fgMapped = this;
+		}
+	}
 }
 
 
@@ -239,3 +306,249 @@ uint32 EmRegsFrameBuffer::GetAddressRange (void)
 {
 	return fSize;
 }
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsFrameBuffer::VideoGetLong
+// ---------------------------------------------------------------------------
+
+uint32 EmRegsFrameBuffer::VideoGetLong (emuptr address)
+{
+#if (CHECK_FOR_ADDRESS_ERROR)
+	if ((address & 1) != 0)
+	{
+		EmBankRegs::AddressError (address, sizeof (uint32), true);
+	}
+#endif
+
+#if (PREVENT_USER_REGISTER_GET)
+	if (gMemAccessFlags.fProtect_RegisterGet && EmMemory::IsPCInRAM () && !MetaMemory::InRAMOSComponent (gCPU->GetPC ()))
+	{
+		EmBankRegs::PreventedAccess (address, sizeof (uint32), true);
+	}
+#endif
+
+#if HAS_PROFILING
+	CYCLE_GETLONG (WAITSTATES_PLD);
+#endif
+
+	if (!EmRegsFrameBuffer::VideoInRange (address, sizeof (uint32)))
+	{
+		EmBankRegs::InvalidAccess (address, sizeof (uint32), true);
+		return ~0;
+	}
+
+	return EmMemDoGet32 (EmRegsFrameBuffer::VideoGetRealAddress (address));
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsFrameBuffer::VideoGetWord
+// ---------------------------------------------------------------------------
+
+uint32 EmRegsFrameBuffer::VideoGetWord (emuptr address)
+{
+#if (CHECK_FOR_ADDRESS_ERROR)
+	if ((address & 1) != 0)
+	{
+		EmBankRegs::AddressError (address, sizeof (uint16), true);
+	}
+#endif
+
+#if (PREVENT_USER_REGISTER_GET)
+	if (gMemAccessFlags.fProtect_RegisterGet && EmMemory::IsPCInRAM () && !MetaMemory::InRAMOSComponent (gCPU->GetPC ()))
+	{
+		EmBankRegs::PreventedAccess (address, sizeof (uint16), true);
+	}
+#endif
+
+#if HAS_PROFILING
+	CYCLE_GETWORD (WAITSTATES_PLD);
+#endif
+
+	if (!EmRegsFrameBuffer::VideoInRange (address, sizeof (uint16)))
+	{
+		EmBankRegs::InvalidAccess (address, sizeof (uint16), true);
+		return ~0;
+	}
+
+	return EmMemDoGet16 (EmRegsFrameBuffer::VideoGetRealAddress (address));
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsFrameBuffer::VideoGetByte
+// ---------------------------------------------------------------------------
+
+uint32 EmRegsFrameBuffer::VideoGetByte (emuptr address)
+{
+#if (PREVENT_USER_REGISTER_GET)
+	if (gMemAccessFlags.fProtect_RegisterGet && EmMemory::IsPCInRAM () && !MetaMemory::InRAMOSComponent (gCPU->GetPC ()))
+	{
+		EmBankRegs::PreventedAccess (address, sizeof (uint8), true);
+	}
+#endif
+
+#if HAS_PROFILING
+	CYCLE_GETBYTE (WAITSTATES_PLD);
+#endif
+
+	if (!EmRegsFrameBuffer::VideoInRange (address, sizeof (uint8)))
+	{
+		EmBankRegs::InvalidAccess (address, sizeof (uint8), true);
+		return ~0;
+	}
+
+	return EmMemDoGet8 (EmRegsFrameBuffer::VideoGetRealAddress (address));
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsFrameBuffer::VideoSetLong
+// ---------------------------------------------------------------------------
+
+void EmRegsFrameBuffer::VideoSetLong (emuptr address, uint32 value)
+{
+#if (CHECK_FOR_ADDRESS_ERROR)
+	if ((address & 1) != 0)
+	{
+		EmBankRegs::AddressError (address, sizeof (uint32), false);
+	}
+#endif
+
+#if (PREVENT_USER_REGISTER_SET)
+	if (gMemAccessFlags.fProtect_RegisterSet && EmMemory::IsPCInRAM () && !MetaMemory::InRAMOSComponent (gCPU->GetPC ()))
+	{
+		EmBankRegs::PreventedAccess (address, sizeof (uint32), false);
+	}
+#endif
+
+#if HAS_PROFILING
+	CYCLE_PUTLONG (WAITSTATES_PLD);
+#endif
+
+	if (!EmRegsFrameBuffer::VideoInRange (address, sizeof (uint32)))
+	{
+		EmBankRegs::InvalidAccess (address, sizeof (uint32), false);
+		return;
+	}
+
+	EmMemDoPut32 (EmRegsFrameBuffer::VideoGetRealAddress (address), value);
+
+	EmScreen::MarkDirty (address, sizeof (uint32));
+
+	// See if any interesting memory locations have changed.  If so,
+	// CheckStepSpy will report it.
+
+	Debug::CheckStepSpy (address, sizeof (uint32));
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsFrameBuffer::VideoSetWord
+// ---------------------------------------------------------------------------
+
+void EmRegsFrameBuffer::VideoSetWord (emuptr address, uint32 value)
+{
+#if (CHECK_FOR_ADDRESS_ERROR)
+	if ((address & 1) != 0)
+	{
+		EmBankRegs::AddressError (address, sizeof (uint16), false);
+	}
+#endif
+
+#if (PREVENT_USER_REGISTER_SET)
+	if (gMemAccessFlags.fProtect_RegisterSet && EmMemory::IsPCInRAM () && !MetaMemory::InRAMOSComponent (gCPU->GetPC ()))
+	{
+		EmBankRegs::PreventedAccess (address, sizeof (uint16), false);
+	}
+#endif
+
+#if HAS_PROFILING
+	CYCLE_PUTWORD (WAITSTATES_PLD);
+#endif
+
+	if (!EmRegsFrameBuffer::VideoInRange (address, sizeof (uint16)))
+	{
+		EmBankRegs::InvalidAccess (address, sizeof (uint16), false);
+		return;
+	}
+
+	EmMemDoPut16 (EmRegsFrameBuffer::VideoGetRealAddress (address), value);
+
+	EmScreen::MarkDirty (address, sizeof (uint16));
+
+	// See if any interesting memory locations have changed.  If so,
+	// CheckStepSpy will report it.
+
+	Debug::CheckStepSpy (address, sizeof (uint16));
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsFrameBuffer::VideoSetByte
+// ---------------------------------------------------------------------------
+
+void EmRegsFrameBuffer::VideoSetByte (emuptr address, uint32 value)
+{
+#if (PREVENT_USER_REGISTER_SET)
+	if (gMemAccessFlags.fProtect_RegisterSet && EmMemory::IsPCInRAM () && !MetaMemory::InRAMOSComponent (gCPU->GetPC ()))
+	{
+		EmBankRegs::PreventedAccess (address, sizeof (uint8), false);
+	}
+#endif
+
+#if HAS_PROFILING
+	CYCLE_PUTBYTE (WAITSTATES_PLD);
+#endif
+
+	if (!EmRegsFrameBuffer::VideoInRange (address, sizeof (uint8)))
+	{
+		EmBankRegs::InvalidAccess (address, sizeof (uint8), false);
+		return;
+	}
+
+	EmMemDoPut8 (EmRegsFrameBuffer::VideoGetRealAddress (address), value);
+
+	EmScreen::MarkDirty (address, sizeof (uint8));
+
+	// See if any interesting memory locations have changed.  If so,
+	// CheckStepSpy will report it.
+
+	Debug::CheckStepSpy (address, sizeof (uint8));
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsFrameBuffer::VideoValidAddress
+// ---------------------------------------------------------------------------
+
+int EmRegsFrameBuffer::VideoValidAddress (emuptr address, uint32 size)
+{
+	return EmRegsFrameBuffer::VideoInRange (address, size);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsFrameBuffer::VideoGetRealAddress
+// ---------------------------------------------------------------------------
+
+uint8* EmRegsFrameBuffer::VideoGetRealAddress (emuptr address)
+{
+	EmAssert (fgMapped);
+	return (uint8*) fgMapped->fVideoMem + (address - fgMapped->fBaseAddr);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsFrameBuffer::VideoInRange
+// ---------------------------------------------------------------------------
+
+Bool EmRegsFrameBuffer::VideoInRange (emuptr address, uint32 size)
+{
+	// The video bank is only installed over banks inside the frame
+	// buffer, so only an access straddling its end can be out of range.
+
+	EmAssert (fgMapped);
+	return (address - fgMapped->fBaseAddr) + size <= (uint32) fgMapped->fSize;
+}
@@ -43,10 +43,28 @@ class EmRegsFrameBuffer : public EmRegs
 		virtual emuptr			GetAddressStart		(void);
 		virtual uint32			GetAddressRange		(void);
 
+		// Handlers for the memory bank installed over the 64K banks that
+		// lie entirely within the frame buffer.  They go straight to
+		// fVideoMem instead of through EmBankRegs and the virtual
+		// GetLong, SetLong, etc.
+
+		static uint32			VideoGetLong		(emuptr address);
+		static uint32			VideoGetWord		(emuptr address);
+		static uint32			VideoGetByte		(emuptr address);
+		static void				VideoSetLong		(emuptr address, uint32 value);
+		static void				VideoSetWord		(emuptr address, uint32 value);
+		static void				VideoSetByte		(emuptr address, uint32 value);
+		static int				VideoValidAddress	(emuptr address, uint32 size);
+		static uint8*			VideoGetRealAddress	(emuptr address);
+
 	private:
+		static Bool				VideoInRange		(emuptr address, uint32 size);
+
 		emuptr					fBaseAddr;
 		int32					fSize;
 		void*					fVideoMem;
+
+		static EmRegsFrameBuffer*	fgMapped;
 };
 
 #endif	/* EmRegsFrameBuffer_h */
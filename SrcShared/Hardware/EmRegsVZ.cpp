@@ -25,7 +25,7 @@
 #include "EmSPISlave.h"			// DoExchange
 #include "Hordes.h"				// Hordes::IsOn
 #include "Logging.h"			// LogAppendMsg
-#include "Miscellaneous.h"		// GetHostTime
+#include "Miscellaneous.h"		// GetHostTime, UseDeterministicClock
 #include "PreferenceMgr.h"		// Preference
 #include "SessionFile.h"		// WriteHwrDBallVZType, etc.
 #include "UAE.h"				// regs, SPCFLAG_INT
@@ -356,7 +356,10 @@ EmRegsVZ::EmRegsVZ (void) :
 	fMin (0),
 	fSec (0),
 	fTick (0),
-	fCycle (0)
+	fCycle (0),
+	fLastCycle (EmHAL::GetCycle ()),
+	fNextEvent (EmHAL::GetCycle ()),
+	fTmr2Prescale (0)
 {
 	fUART[0] = NULL;
 	fUART[1] = NULL;
@@ -391,6 +394,8 @@ void EmRegsVZ::Initialize (void)
 
 void EmRegsVZ::Reset (Bool hardwareReset)
 {
+	this->SyncTimers ();
+
 	EmRegs::Reset (hardwareReset);
 	if (hardwareReset)
 	{
@@ -414,6 +419,8 @@ void EmRegsVZ::Reset (Bool hardwareReset)
 		EmRegsVZ::UARTStateChanged (sendTxData, 0);
 		EmRegsVZ::UARTStateChanged (sendTxData, 1);
 	}
+
+	this->ScheduleTimers ();
 }
 
 
@@ -423,6 +430,10 @@ void EmRegsVZ::Reset (Bool hardwareReset)
 
 void EmRegsVZ::Save (SessionFile& f)
 {
+	// Bring the timers and time of day up to date before saving them.
+
+	this->SyncTimers ();
+
 	EmRegs::Save (f);
 
 	StWordSwapper	swapper (&f68VZ328Regs, sizeof(f68VZ328Regs));
@@ -536,6 +547,12 @@ void EmRegsVZ::Load (SessionFile& f)
 	{
 		f.SetCanReload (false);
 	}
+
+	// The timers are now as of the current cycle.  Schedule their next
+	// events based on the loaded register values.
+
+	fLastCycle = EmHAL::GetCycle ();
+	this->ScheduleTimers ();
 }
 
 
@@ -668,18 +685,18 @@ void EmRegsVZ::SetSubBankHandlers (void)
 	INSTALL_HANDLER (StdRead,			StdWrite,				pwm2Width);
 	INSTALL_HANDLER (StdRead,			NullWrite,				pwm2Counter);
 
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr1Control);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr1Prescaler);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr1Compare);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr1Control);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr1Prescaler);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr1Compare);
 	INSTALL_HANDLER (StdRead,			StdWrite,				tmr1Capture);
-	INSTALL_HANDLER (StdRead,			NullWrite,				tmr1Counter);
+	INSTALL_HANDLER (tmrCounterRead,	NullWrite,				tmr1Counter);
 	INSTALL_HANDLER (tmr1StatusRead,	tmr1StatusWrite,		tmr1Status);
 
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr2Control);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr2Prescaler);
-	INSTALL_HANDLER (StdRead,			StdWrite,				tmr2Compare);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr2Control);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr2Prescaler);
+	INSTALL_HANDLER (StdRead,			tmrRegisterWrite,		tmr2Compare);
 	INSTALL_HANDLER (StdRead,			StdWrite,				tmr2Capture);
-	INSTALL_HANDLER (StdRead,			NullWrite,				tmr2Counter);
+	INSTALL_HANDLER (tmrCounterRead,	NullWrite,				tmr2Counter);
 	INSTALL_HANDLER (tmr2StatusRead,	tmr2StatusWrite,		tmr2Status);
 
 	INSTALL_HANDLER (StdRead,			StdWrite,				spiRxD);
@@ -788,18 +805,38 @@ uint32 EmRegsVZ::GetAddressRange (void)
 //		 EmRegsVZ::Cycle
 // ---------------------------------------------------------------------------
 // Handles periodic events that need to occur when the processor cycles (like
-// updating timer registers).  This function is called in two places from
-// Emulator::Execute.  Interestingly, the loop runs 3% FASTER if this function
-// is in its own separate function instead of being inline.
+// updating timer registers).  EmHAL only calls this function on the cycles
+// we ask for in ScheduleTimers (and on every cycle while the processor is
+// sleeping).  The rest of the time, the timers are brought up to date in
+// bulk by SyncTimers.
 
-void EmRegsVZ::Cycle (Bool sleeping)
-{
 #if _DEBUG
 	#define increment	20
 #else
 	#define increment	4
 #endif
 
+void EmRegsVZ::Cycle (Bool sleeping)
+{
+	this->SyncTimers ();
+
+	if (sleeping)
+	{
+		this->StepTimers (sleeping);
+	}
+
+	this->ScheduleTimers ();
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsVZ::StepTimers
+// ---------------------------------------------------------------------------
+// Advance the timers and time of day by a single cycle, posting any
+// interrupts that result.
+
+void EmRegsVZ::StepTimers (Bool sleeping)
+{
 	// ===== Handle Timer 1 =====
 
 	// Determine whether timer is enabled.
@@ -847,11 +884,9 @@ void EmRegsVZ::Cycle (Bool sleeping)
 		// a prescaler counter.  Only when this counter reaches zero
 		// do we increment the timer counter.
 
-		static int prescaleCounter;
-
-		if ((prescaleCounter -= (sleeping ? (increment * 1024) : increment)) <= 0)
+		if ((fTmr2Prescale -= (sleeping ? (increment * 1024) : increment)) <= 0)
 		{
-			prescaleCounter = READ_REGISTER (tmr2Prescaler) * 1024;
+			fTmr2Prescale = READ_REGISTER (tmr2Prescaler) * 1024;
 
 			// If so, increment the timer.
 
@@ -886,7 +921,10 @@ void EmRegsVZ::Cycle (Bool sleeping)
 
 	// ===== Handle time increment (used when running Gremlins) =====
 
-	if ((fCycle += increment) > READ_REGISTER (tmr1Compare))
+	// A sleeping step stands for a whole timer period (the compares above
+	// are forced), so it advances the time of day by a whole tick, too.
+
+	if (sleeping || (fCycle += increment) > READ_REGISTER (tmr1Compare))
 	{
 		fCycle = 0;
 
@@ -913,6 +951,116 @@ void EmRegsVZ::Cycle (Bool sleeping)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmRegsVZ::SyncTimers
+// ---------------------------------------------------------------------------
+// Bring the timers and time of day up to date with the number of cycles
+// EmHAL has counted since we last looked.  None of the cycles before our
+// scheduled one can cause an event, so they're accounted for in one go.
+
+void EmRegsVZ::SyncTimers (void)
+{
+	uint32	now		= EmHAL::GetCycle ();
+	uint32	elapsed	= now - fLastCycle;
+
+	if (elapsed == 0)
+	{
+		return;
+	}
+
+	fLastCycle = now;
+
+	if (now == fNextEvent)
+	{
+		this->AdvanceTimers (elapsed - 1);
+		this->StepTimers (false);
+	}
+	else
+	{
+		this->AdvanceTimers (elapsed);
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsVZ::AdvanceTimers
+// ---------------------------------------------------------------------------
+// Advance the timers and time of day by the given number of cycles, none of
+// which cause a timer to reach its compare value.
+
+void EmRegsVZ::AdvanceTimers (uint32 cycles)
+{
+	if (cycles == 0)
+	{
+		return;
+	}
+
+	uint32	amount = cycles * increment;
+
+	if ((READ_REGISTER (tmr1Control) & hwrVZ328TmrControlEnable) != 0)
+	{
+		WRITE_REGISTER (tmr1Counter, READ_REGISTER (tmr1Counter) + amount);
+	}
+
+	if ((READ_REGISTER (tmr2Control) & hwrVZ328TmrControlEnable) != 0)
+	{
+		fTmr2Prescale -= amount;
+	}
+
+	fCycle += amount;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsVZ::ScheduleTimers
+// ---------------------------------------------------------------------------
+// Work out how many cycles it will be until the next timer event (a timer
+// reaching its compare value, the timer 2 prescaler running out, or the
+// time of day ticking), and ask EmHAL to call us then.
+
+void EmRegsVZ::ScheduleTimers (void)
+{
+	EmAssert (fLastCycle == EmHAL::GetCycle ());
+
+	uint16	tmr1Compare	= READ_REGISTER (tmr1Compare);
+	uint32	cycles		= 1;
+
+	if (fCycle + increment <= tmr1Compare)
+	{
+		cycles = (tmr1Compare - fCycle) / increment + 1;
+	}
+
+	if ((READ_REGISTER (tmr1Control) & hwrVZ328TmrControlEnable) != 0)
+	{
+		uint32	tmr1Cycles = EmHAL::CyclesUntilCompare (
+			READ_REGISTER (tmr1Counter), tmr1Compare, increment);
+
+		if (tmr1Cycles != 0 && tmr1Cycles < cycles)
+		{
+			cycles = tmr1Cycles;
+		}
+	}
+
+	if ((READ_REGISTER (tmr2Control) & hwrVZ328TmrControlEnable) != 0)
+	{
+		uint32	tmr2Cycles = 1;
+
+		if (fTmr2Prescale > increment)
+		{
+			tmr2Cycles = (fTmr2Prescale + increment - 1) / increment;
+		}
+
+		if (tmr2Cycles < cycles)
+		{
+			cycles = tmr2Cycles;
+		}
+	}
+
+	fNextEvent = fLastCycle + cycles;
+	EmHAL::ScheduleCycle (fNextEvent);
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmRegsVZ::CycleSlowly
 // ---------------------------------------------------------------------------
@@ -963,7 +1111,20 @@ void EmRegsVZ::CycleSlowly (Bool sleeping)
 		long	nowHour;
 		long	nowMin;
 		long	nowSec;
-		::GetHostTime (&nowHour, &nowMin, &nowSec);
+
+		if (::UseDeterministicClock ())
+		{
+			this->SyncTimers ();
+
+			nowHour = fHour;
+			nowMin = fMin;
+			nowSec = fSec;
+		}
+		else
+		{
+			::GetHostTime (&nowHour, &nowMin, &nowSec);
+		}
+
 		long	nowInSeconds = (nowHour * 60 * 60) + (nowMin * 60) + nowSec;
 
 		if (almInSeconds <= nowInSeconds)
@@ -992,8 +1153,12 @@ void EmRegsVZ::TurnSoundOff (void)
 
 void EmRegsVZ::ResetTimer (void)
 {
+	this->SyncTimers ();
+
 	WRITE_REGISTER (tmr1Counter, 0);
 	WRITE_REGISTER (tmr2Counter, 0);
+
+	this->ScheduleTimers ();
 }
 
 
@@ -1003,11 +1168,15 @@ void EmRegsVZ::ResetTimer (void)
 
 void EmRegsVZ::ResetRTC (void)
 {
+	this->SyncTimers ();
+
 	fHour = 15;
 	fMin = 0;
 	fSec = 0;
 	fTick = 0;
 	fCycle = 0;
+
+	this->ScheduleTimers ();
 }
 
 
@@ -1602,6 +1771,8 @@ uint32 EmRegsVZ::portXDataRead (emuptr address, int)
 
 uint32 EmRegsVZ::tmr1StatusRead (emuptr address, int size)
 {
+	this->SyncTimers ();
+
 	uint16	tmr1Counter = READ_REGISTER (tmr1Counter) + 16;
 	uint16	tmr1Compare = READ_REGISTER (tmr1Compare);
 	uint16	tmr1Control = READ_REGISTER (tmr1Control);
@@ -1631,6 +1802,10 @@ uint32 EmRegsVZ::tmr1StatusRead (emuptr address, int size)
 
 	fLastTmr1Status |= READ_REGISTER (tmr1Status);
 
+	// We may have moved the counter; reschedule its next event.
+
+	this->ScheduleTimers ();
+
 	// Finish up by doing a standard read.
 
 	return EmRegsVZ::StdRead (address, size);
@@ -1643,6 +1818,8 @@ uint32 EmRegsVZ::tmr1StatusRead (emuptr address, int size)
 
 uint32 EmRegsVZ::tmr2StatusRead (emuptr address, int size)
 {
+	this->SyncTimers ();
+
 	uint16	tmr2Counter = READ_REGISTER (tmr2Counter) + 16;
 	uint16	tmr2Compare = READ_REGISTER (tmr2Compare);
 	uint16	tmr2Control = READ_REGISTER (tmr2Control);
@@ -1672,6 +1849,26 @@ uint32 EmRegsVZ::tmr2StatusRead (emuptr address, int size)
 
 	fLastTmr2Status |= READ_REGISTER (tmr2Status);
 
+	// We may have moved the counter; reschedule its next event.
+
+	this->ScheduleTimers ();
+
+	// Finish up by doing a standard read.
+
+	return EmRegsVZ::StdRead (address, size);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 EmRegsVZ::tmrCounterRead
+// ---------------------------------------------------------------------------
+
+uint32 EmRegsVZ::tmrCounterRead (emuptr address, int size)
+{
+	// Bring the counter up to date.
+
+	this->SyncTimers ();
+
 	// Finish up by doing a standard read.
 
 	return EmRegsVZ::StdRead (address, size);
@@ -1728,8 +1925,10 @@ uint32 EmRegsVZ::rtcHourMinSecRead (emuptr address, int size)
 
 	long	hour, min, sec;
 
-	if (Hordes::IsOn ())
+	if (Hordes::IsOn () || ::UseDeterministicClock ())
 	{
+		this->SyncTimers ();
+
 		hour = fHour;
 		min = fMin;
 		sec = fSec;
@@ -2078,6 +2277,23 @@ void EmRegsVZ::tmr2StatusWrite (emuptr address, int size, uint32 value)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 EmRegsVZ::tmrRegisterWrite
+// ---------------------------------------------------------------------------
+
+void EmRegsVZ::tmrRegisterWrite (emuptr address, int size, uint32 value)
+{
+	// Account for the cycles run under the old settings before changing
+	// them, and then work out when the next event is under the new ones.
+
+	this->SyncTimers ();
+
+	EmRegsVZ::StdWrite (address, size, value);
+
+	this->ScheduleTimers ();
+}
+
+
 // ---------------------------------------------------------------------------
 //		 EmRegsVZ::spiCont1Write
 // ---------------------------------------------------------------------------
@@ -78,6 +78,7 @@ class EmRegsVZ : public EmRegs, public EmHALHandler
 		uint32					portXDataRead			(emuptr address, int size);
 		uint32					tmr1StatusRead			(emuptr address, int size);
 		uint32					tmr2StatusRead			(emuptr address, int size);
+		uint32					tmrCounterRead			(emuptr address, int size);
 		uint32					uart1Read				(emuptr address, int size);
 		uint32					uart2Read				(emuptr address, int size);
 		uint32					rtcHourMinSecRead		(emuptr address, int size);
@@ -92,6 +93,7 @@ class EmRegsVZ : public EmRegs, public EmHALHandler
 		void					portDIntReqEnWrite		(emuptr address, int size, uint32 value);
 		void					tmr1StatusWrite			(emuptr address, int size, uint32 value);
 		void					tmr2StatusWrite			(emuptr address, int size, uint32 value);
+		void					tmrRegisterWrite		(emuptr address, int size, uint32 value);
 		void					spiCont1Write			(emuptr address, int size, uint32 value);
 		void					spiMasterControlWrite	(emuptr address, int size, uint32 value);
 		void					uart1Write				(emuptr address, int size, uint32 value);
@@ -101,6 +103,12 @@ class EmRegsVZ : public EmRegs, public EmHALHandler
 		void					rtcIntStatusWrite		(emuptr address, int size, uint32 value);
 		void					rtcIntEnableWrite		(emuptr address, int size, uint32 value);
 
+	private:
+		void					StepTimers				(Bool sleeping);
+		void					SyncTimers				(void);
+		void					AdvanceTimers			(uint32 cycles);
+		void					ScheduleTimers			(void);
+
 	protected:
 		void					HotSyncEvent			(Bool buttonIsDown);
 
@@ -139,6 +147,10 @@ class EmRegsVZ : public EmRegs, public EmHALHandler
 		uint32					fTick;
 		uint32					fCycle;
 
+		uint32					fLastCycle;		// EmHAL cycle the timers are up to date with.
+		uint32					fNextEvent;		// EmHAL cycle of the next timer event.
+		int32					fTmr2Prescale;
+
 		EmUARTDragonball*		fUART[2];
 };
 
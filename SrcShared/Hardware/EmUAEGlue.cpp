@@ -54,7 +54,10 @@ void Software_ProcessLINK (int32 linkSize)
 {
 	EmAssert (gCPU68K);
 
-	gCPU68K->ProcessLINK (linkSize);
+	if (gCPU68K->GetActiveHooks () & kHook68KLINK)
+	{
+		gCPU68K->ProcessLINK (linkSize);
+	}
 }
 
 
@@ -63,6 +66,11 @@ int Software_ProcessRTS (emuptr dest)
 	EmAssert (gCPU68K);
 
 	gCPU68K->CheckNewPC (dest);
+	if ((gCPU68K->GetActiveHooks () & kHook68KRTS) == 0)
+	{
+		return false;
+	}
+
 	return gCPU68K->ProcessRTS (dest);
 }
 
@@ -72,6 +80,11 @@ int Software_ProcessRTE (emuptr dest)
 	EmAssert (gCPU68K);
 
 	gCPU68K->CheckNewPC (dest);
+	if ((gCPU68K->GetActiveHooks () & kHook68KRTE) == 0)
+	{
+		return false;
+	}
+
 	return gCPU68K->ProcessRTE (dest);
 }
 
@@ -81,6 +94,11 @@ int Software_ProcessJSR (emuptr oldpc, emuptr dest)
 	EmAssert (gCPU68K);
 
 	gCPU68K->CheckNewPC (dest);
+	if ((gCPU68K->GetActiveHooks () & kHook68KJSR) == 0)
+	{
+		return false;
+	}
+
 	return gCPU68K->ProcessJSR (oldpc, dest);
 }
 
@@ -89,6 +107,11 @@ int Software_ProcessJSR_Ind (emuptr oldpc, emuptr dest)
 {
 	EmAssert (gCPU68K);
 
+	if ((gCPU68K->GetActiveHooks () & kHook68KJSR_Ind) == 0)
+	{
+		return false;
+	}
+
 	return gCPU68K->ProcessJSR_Ind (oldpc, dest);
 }
 
@@ -105,7 +128,10 @@ void Software_CheckStackPointerAssignment ()
 {
 	EmAssert (gCPU68K);
 
-	gCPU68K->CheckNewSP (kStackPointerChanged);
+	if (gCPU68K->GetActiveHooks () & kHook68KNewSP)
+	{
+		gCPU68K->CheckNewSP (kStackPointerChanged);
+	}
 }
 
 
@@ -113,7 +139,10 @@ void Software_CheckStackPointerDecrement ()
 {
 	EmAssert (gCPU68K);
 
-	gCPU68K->CheckNewSP (kStackPointerDecremented);
+	if (gCPU68K->GetActiveHooks () & kHook68KNewSP)
+	{
+		gCPU68K->CheckNewSP (kStackPointerDecremented);
+	}
 }
 
 
@@ -121,7 +150,10 @@ void Software_CheckStackPointerIncrement ()
 {
 	EmAssert (gCPU68K);
 
-	gCPU68K->CheckNewSP (kStackPointerIncremented);
+	if (gCPU68K->GetActiveHooks () & kHook68KNewSP)
+	{
+		gCPU68K->CheckNewSP (kStackPointerIncremented);
+	}
 }
 
 
@@ -129,7 +161,10 @@ void Software_CheckKernelStack ()
 {
 	EmAssert (gCPU68K);
 
-	gCPU68K->CheckNewSP (kStackPointerKernelStackHack);
+	if (gCPU68K->GetActiveHooks () & kHook68KNewSP)
+	{
+		gCPU68K->CheckNewSP (kStackPointerKernelStackHack);
+	}
 }
 
 
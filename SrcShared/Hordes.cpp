@@ -17,6 +17,7 @@
 #include "CGremlins.h"			// Gremlins
 #include "CGremlinsStubs.h"		// StubAppGremlinsOff
 #include "EmApplication.h"		// ScheduleQuit
+#include "EmBankSRAM.h"			// EmBankSRAM::SetBaseImage
 #include "EmEventPlayback.h"	// SaveEvents, LoadEvents, Clear, RecordEvents
 #include "EmMapFile.h"			// EmMapFile::Write, etc.
 #include "EmMinimize.h"			// EmMinimize::IsDone
@@ -65,6 +66,12 @@ static	EmDirRef	gHomeForHordesFiles;
 static Bool			gForceNewHordesDirectory;
 static EmDirRef		gGremlinDir;
 
+	// Uncompressed, in-memory copy of the root state.  Every Gremlin in
+	// a Horde starts from the root state, so we keep it here rather than
+	// reading and decompressing the root state file each time.
+
+static Chunk*		gRootState;
+
 Bool				gWarningHappened;
 Bool				gErrorHappened;
 
@@ -174,6 +181,9 @@ void Hordes::Load (SessionFile& f)
 void Hordes::Dispose (void)
 {
 	gTheGremlin.Reset ();
+
+	delete gRootState;
+	gRootState = NULL;
 }
 
 
@@ -1543,8 +1553,10 @@ Hordes::AutoSaveState (void)
 {
 	EmFileRef	fileRef = Hordes::SuggestFileRef (kHordeAutoCurrentFile);
 
+	// Save only the RAM pages changed since the root state.
+
 	EmAssert (gSession);
-	gSession->Save (fileRef, false);
+	gSession->Save (fileRef, false, true);
 }
 
 
@@ -1575,6 +1587,30 @@ Hordes::SaveRootState (void)
 	EmAssert (gSession);
 	gSession->Save (fileRef, false);
 
+	// Later auto-saved and suspended states can save their RAM as a
+	// delta against this one.
+
+	EmBankSRAM::SetBaseImage (fileRef);
+
+	// The file is still needed for SaveEvents, and for resuming the
+	// Horde later.  Also keep a copy in memory for LoadRootState.
+
+	delete gRootState;
+	gRootState = NULL;
+
+	Chunk*			rootState = new Chunk;
+
+	{
+		EmStreamChunk	stream (*rootState);
+		ChunkFile		chunkFile (stream);
+		SessionFile		sessionFile (chunkFile);
+
+		sessionFile.SetCompress (false);
+		gSession->Save (sessionFile);
+	}
+
+	gRootState = rootState;
+
 	Hordes::TurnOn (hordesWasOn);
 }
 
@@ -1615,6 +1651,52 @@ Hordes::LoadState (const EmFileRef& ref)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	Hordes::LoadState
+ *
+ * DESCRIPTION: Does the work of loading a state saved in memory while
+ *				Hordes is running.
+ *
+ * PARAMETERS:	state - the saved state, written with compression off.
+ *
+ *				ref - the file the state was also saved to; used
+ *					only for reporting errors.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+ErrCode
+Hordes::LoadState (Chunk& state, const EmFileRef& ref)
+{
+	ErrCode returnedErrCode = errNone;
+
+	try
+	{
+		EmStreamChunk	stream (state);
+		ChunkFile		chunkFile (stream);
+		SessionFile		sessionFile (chunkFile);
+
+		sessionFile.SetCompress (false);
+
+		EmAssert (gSession);
+		gSession->Load (sessionFile);
+	}
+	catch (ErrCode errCode)
+	{
+		Hordes::TurnOn (false);
+
+		Errors::SetParameter ("%filename", ref.GetName ());
+		Errors::ReportIfError (kStr_CmdOpen, errCode, 0, true);
+
+		returnedErrCode = errCode;
+	}
+
+	return returnedErrCode;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	Hordes::LoadRootState
@@ -1634,10 +1716,21 @@ Hordes::LoadRootState (void)
 {
 	EmFileRef	fileRef = Hordes::SuggestFileRef (kHordeRootFile);
 
-	ErrCode		result = Hordes::LoadState (fileRef);
+	ErrCode		result;
+
+	if (gRootState)
+	{
+		result = Hordes::LoadState (*gRootState, fileRef);
+	}
+	else
+	{
+		result = Hordes::LoadState (fileRef);
+	}
 
 	if (result == 0)
 	{
+		EmBankSRAM::SetBaseImage (fileRef);
+
 		// There are no events to load, but we need to make sure we at
 		// least clear out any old events.
 
@@ -1667,7 +1760,9 @@ Hordes::SaveSuspendedState (void)
 {
 	EmFileRef	fileRef = Hordes::SuggestFileRef (kHordeSuspendFile);
 
-	gSession->Save (fileRef, false);
+	// Save only the RAM pages changed since the root state.
+
+	gSession->Save (fileRef, false, true);
 
 	// This sort of overloads the function, but right now, any time we
 	// save the suspend state, we also want to save any recorded events.
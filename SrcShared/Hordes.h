@@ -34,6 +34,7 @@ enum HordeFileType
 ///////////////////////////////////////////////////////////////////////////////////////
 // HORDES CLASS
 
+class Chunk;
 class SessionFile;
 
 // Gremlins::Save, Gremlins::Load
@@ -137,6 +138,7 @@ class Hordes
 		static void				EndHordes				(void);
 
 		static ErrCode			LoadState				(const EmFileRef& ref);
+		static ErrCode			LoadState				(Chunk& state, const EmFileRef& ref);
 
 		static void				StartLog				(void);
 		static string			GremlinsFlagsToString	(void);
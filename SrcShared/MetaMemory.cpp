@@ -16,7 +16,7 @@
 
 #include "DebugMgr.h"			// Debug::GetRoutineName
 #include "EmBankSRAM.h"			// gRAMBank_Size
-#include "EmCPU68K.h"			// gCPU68K
+#include "EmCPU68K.h"			// gCPU68K, AddInstructionBreak
 #include "EmHAL.h"				// EmHAL
 #include "EmLowMem.h"			// LowMem_SetGlobal, LowMem_GetGlobal
 #include "EmMemory.h"			// CEnableFullAccess, EmMemGetMetaAddress
@@ -29,9 +29,12 @@
 #include "Miscellaneous.h"		// FindFunctionName
 #include "ROMStubs.h"			// SysKernelInfo
 #include "SessionFile.h"		// SessionFile::Write
+#include "EmBlockCache.h"		// EmBlockCache::InvalidateAddress (last: pulls in <limits.h>)
 
-#include <algorithm>			// find
+#include <algorithm>			// binary_search
 #include <ctype.h>				// islower
+#include <map>					// map
+#include <set>					// set
 
 struct EmTaggedPalmChunk : public EmPalmChunk
 {
@@ -50,8 +53,23 @@ static EmTaggedPalmChunkList	gTaggedChunks;
 static Bool						gHaveLastChunk;
 static EmTaggedPalmChunk		gLastChunk;
 
-static vector<MemHandle>		gBitmapHandleList;
-static vector<MemPtr>			gBitmapPointerList;
+static set<MemHandle>			gBitmapHandles;
+static set<MemPtr>				gBitmapPointers;
+
+// UI objects that we've marked as off-limits, mapped from their start
+// to their end.  This is kept up to date by MarkUIObjects, which is
+// called after the UI routines that create or dispose of windows and
+// form objects.  It's kept sorted by address so that Resync can find
+// the objects in the chunks that it has just re-marked.
+
+typedef map<emuptr, emuptr>		EmUIObjectMap;
+
+static EmUIObjectMap			gUIObjects;
+static uint32					gUIObjectMaxSize;
+
+// Master pointer tables that Resync has marked.
+
+static set<emuptr>				gMarkedMPTs;
 
 enum
 {
@@ -61,8 +79,9 @@ enum
 
 typedef Bool (*IterFn) (emuptr object, void* data, int type);
 static Bool PrvCheckUIObject (emuptr object, void* data, int type);
-static Bool PrvMarkUIObject (emuptr object, void* data, int type);
-static Bool PrvUnmarkUIObject (emuptr object, void* data, int type);
+static Bool PrvCollectUIObject (emuptr object, void* data, int type);
+static void PrvRemarkUIObjects (const EmPalmChunkList& delta);
+static Bool PrvOverlapsDelta (emuptr begin, emuptr end, const EmPalmChunkList& delta);
 static Bool PrvForEachBitmap (IterFn fn, void* data);
 static Bool PrvForEachWindow (IterFn fn, void* data);
 static Bool PrvForEachUIObject (IterFn fn, void* data);
@@ -88,8 +107,12 @@ void MetaMemory::Reset (void)
 	gTaggedChunks.clear ();
 	gHaveLastChunk = false;
 
-	gBitmapHandleList.clear ();
-	gBitmapPointerList.clear ();
+	gBitmapHandles.clear ();
+	gBitmapPointers.clear ();
+
+	gUIObjects.clear ();
+	gUIObjectMaxSize = 0;
+	gMarkedMPTs.clear ();
 }
 
 
@@ -106,11 +129,14 @@ void MetaMemory::Save (SessionFile& f)
 
 	s << kCurrentVersion;
 
-	gBitmapHandleList.clear ();
-	gBitmapPointerList.clear ();
+	gBitmapHandles.clear ();
+	gBitmapPointers.clear ();
+
+	vector<MemHandle>	bitmapHandles;
+	vector<MemPtr>		bitmapPointers;
 
-	s << gBitmapHandleList;
-	s << gBitmapPointerList;
+	s << bitmapHandles;
+	s << bitmapPointers;
 
 	f.WriteMetaInfo (chunk);
 }
@@ -125,6 +151,10 @@ void MetaMemory::Load (SessionFile& f)
 	gTaggedChunks.clear ();
 	gHaveLastChunk = false;
 
+	gUIObjects.clear ();
+	gUIObjectMaxSize = 0;
+	gMarkedMPTs.clear ();
+
 	Chunk	chunk;
 	if (f.ReadMetaInfo (chunk))
 	{
@@ -135,11 +165,14 @@ void MetaMemory::Load (SessionFile& f)
 
 		if (version >= 1)
 		{
-			s >> gBitmapHandleList;
-			s >> gBitmapPointerList;
+			vector<MemHandle>	bitmapHandles;
+			vector<MemPtr>		bitmapPointers;
+
+			s >> bitmapHandles;
+			s >> bitmapPointers;
 
-			gBitmapHandleList.clear ();
-			gBitmapPointerList.clear ();
+			gBitmapHandles.clear ();
+			gBitmapPointers.clear ();
 		}
 	}
 }
@@ -154,6 +187,161 @@ void MetaMemory::Dispose (void)
 }
 
 
+// ---------------------------------------------------------------------------
+//		 MetaMemory::SaveRAMImage
+// ---------------------------------------------------------------------------
+//	Save gRAM_MetaMemory as a list of (offset, length, value) runs of
+//	non-zero bytes.  Nearly all of meta-memory is zero, so this is much
+//	smaller than the full image, even before it's compressed.  The runs
+//	are in emulated address order, so no byteswapping is needed.
+
+void MetaMemory::SaveRAMImage (SessionFile& f)
+{
+	const long	kCurrentVersion = 1;
+
+	Chunk			chunk;
+	EmStreamChunk	s (chunk);
+
+	s << kCurrentVersion;
+	s << gRAMBank_Size;
+
+	// Make two passes: one to count the runs and one to write them.
+
+	for (int pass = 0; pass < 2; ++pass)
+	{
+		uint32	numRuns = 0;
+		uint32	offset = 0;
+
+		while (offset < gRAMBank_Size)
+		{
+			// Skip over unmarked memory a long at a time.
+
+			if ((offset & 3) == 0 && offset + 4 <= gRAMBank_Size &&
+				*(uint32*) (gRAM_MetaMemory + offset) == 0)
+			{
+				offset += 4;
+				continue;
+			}
+
+			uint8	value = gRAM_MetaMemory[offset];
+
+			if (value == 0)
+			{
+				offset += 1;
+				continue;
+			}
+
+			uint32	length = 1;
+
+			while (offset + length < gRAMBank_Size &&
+				gRAM_MetaMemory[offset + length] == value)
+			{
+				++length;
+			}
+
+			if (pass == 1)
+			{
+				s << offset;
+				s << length;
+				s << value;
+			}
+
+			++numRuns;
+			offset += length;
+		}
+
+		if (pass == 0)
+		{
+			s << numRuns;
+		}
+	}
+
+	f.WritePackedMetaRAMImage (chunk);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 MetaMemory::LoadRAMImage
+// ---------------------------------------------------------------------------
+//	Restore gRAM_MetaMemory from a list of runs written by SaveRAMImage.
+//	Returns false if the session file doesn't contain one (it may have
+//	been written with the full image instead), or if it's for a different
+//	amount of RAM.
+
+Bool MetaMemory::LoadRAMImage (SessionFile& f)
+{
+	Chunk	chunk;
+	if (!f.ReadPackedMetaRAMImage (chunk))
+	{
+		return false;
+	}
+
+	long			version;
+	uint32			ramSize;
+	EmStreamChunk	s (chunk);
+
+	s >> version;
+	s >> ramSize;
+
+	if (version < 1 || ramSize != gRAMBank_Size)
+	{
+		return false;
+	}
+
+	MetaMemory::ClearRAMImage ();
+
+	uint32	numRuns;
+	s >> numRuns;
+
+	while (numRuns--)
+	{
+		uint32	offset;
+		uint32	length;
+		uint8	value;
+
+		s >> offset;
+		s >> length;
+		s >> value;
+
+		if (offset >= gRAMBank_Size || length > gRAMBank_Size - offset)
+		{
+			return false;
+		}
+
+		memset (gRAM_MetaMemory + offset, value, length);
+	}
+
+	return true;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 MetaMemory::ClearRAMImage
+// ---------------------------------------------------------------------------
+//	Zero out gRAM_MetaMemory.  Only the longs that are actually non-zero
+//	are written to, so that pages of meta-memory that have never been
+//	marked don't have to be brought into memory by the host OS.
+
+void MetaMemory::ClearRAMImage (void)
+{
+	uint32*	p		= (uint32*) gRAM_MetaMemory;
+	uint32*	endP	= (uint32*) (gRAM_MetaMemory + gRAMBank_Size);
+
+	while (p < endP)
+	{
+		if (*p)
+		{
+			*p = 0;
+		}
+
+		++p;
+	}
+
+	memset (gRAM_MetaSummary, 0,
+			(gRAMBank_Size + kMetaSummaryPageSize - 1) >> kMetaSummaryShift);
+}
+
+
 #if FOR_LATER
 // ---------------------------------------------------------------------------
 //		 MetaMemory::MarkUninitialized
@@ -216,6 +404,45 @@ void MetaMemory::MarkInitialized (emuptr begin, emuptr end)
 #endif
 
 
+// ---------------------------------------------------------------------------
+//		 MetaMemory::MarkInstructionBreak
+// ---------------------------------------------------------------------------
+
+void MetaMemory::MarkInstructionBreak (emuptr opcodeLocation)
+{
+	EmAssert ((opcodeLocation & 1) == 0);
+
+	uint8*	ptr = EmMemGetMetaAddress (opcodeLocation);
+
+	*ptr |= kInstructionBreak;
+
+	// Have the CPU check for a break when it gets to this location.
+
+	EmCPU68K::AddInstructionBreak (opcodeLocation);
+
+	// Translated blocks hold the handler from before the break was set,
+	// so throw away any that contain this location.
+
+	EmBlockCache::InvalidateAddress (opcodeLocation);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 MetaMemory::UnmarkInstructionBreak
+// ---------------------------------------------------------------------------
+
+void MetaMemory::UnmarkInstructionBreak (emuptr opcodeLocation)
+{
+	EmAssert ((opcodeLocation & 1) == 0);
+
+	uint8*	ptr = EmMemGetMetaAddress (opcodeLocation);
+
+	*ptr &= ~kInstructionBreak;
+
+	EmCPU68K::RemoveInstructionBreak (opcodeLocation);
+}
+
+
 // ---------------------------------------------------------------------------
 //		 MetaMemory::SyncHeap
 // ---------------------------------------------------------------------------
@@ -296,22 +523,35 @@ void MetaMemory::Resync (const EmPalmChunkList& delta)
 	}
 
 	// This process has just wiped out any access bits we've set
-	// for UI objects.  Re-establish those.
+	// for UI objects in those chunks.  Re-establish those.
 
-	MetaMemory::MarkUIObjects ();
+	::PrvRemarkUIObjects (delta);
 
 	// Mark the master pointer tables.  Mark the MPT headers as
 	// for use by the Memory Manager.  However, mark the tables
 	// themselves as usable by any of the OS; a lot of the OS
 	// uses a MemMgr macro to deref handles directly.
+	//
+	// Tables we've marked before keep their marks unless they're
+	// in one of the chunks that were just synced.
+
+	set<emuptr>	markedMPTs;
 
 	ITERATE_MPTS(*heap, mpt_iter, end)
 	{
-		MarkMPT (mpt_iter->Start (), mpt_iter->TableStart ());
-		MarkMPT (mpt_iter->TableStart (), mpt_iter->End ());
+		if (gMarkedMPTs.find (mpt_iter->Start ()) == gMarkedMPTs.end () ||
+			::PrvOverlapsDelta (mpt_iter->Start (), mpt_iter->End (), delta))
+		{
+			MarkMPT (mpt_iter->Start (), mpt_iter->TableStart ());
+			MarkMPT (mpt_iter->TableStart (), mpt_iter->End ());
+		}
+
+		markedMPTs.insert (mpt_iter->Start ());
 		++mpt_iter;
 	}
 
+	gMarkedMPTs.swap (markedMPTs);
+
 	// Hack for startup time.  When MemInit is called, it creates
 	// a free block spanning the entire dynamic heap.  However,
 	// that's where the current stack happens to be.  We still need
@@ -845,6 +1085,8 @@ void MetaMemory::MarkRange (emuptr start, emuptr end, uint8 v)
 		*p |= v;
 	}
 #endif
+
+	UpdatePageSummary (startP, endP, 0xFF, v);
 }
 
 
@@ -927,6 +1169,8 @@ void MetaMemory::UnmarkRange (emuptr start, emuptr end, uint8 v)
 		*p &= v;
 	}
 #endif
+
+	UpdatePageSummary (startP, endP, v, 0x00);
 }
 
 
@@ -1032,6 +1276,102 @@ void MetaMemory::MarkUnmarkRange (emuptr start, emuptr end,
 		}
 #endif
 	}
+
+	UpdatePageSummary (startP, endP, andValue, orValue);
+}
+
+
+// ---------------------------------------------------------------------------
+//		 MetaMemory::UpdatePageSummary
+// ---------------------------------------------------------------------------
+//	Bring gRAM_MetaSummary up to date after the meta-memory bytes in
+//	[startP, endP) have been changed to (*p & andValue) | orValue.  Pages
+//	that were only added to, or that were completely overwritten, are
+//	updated directly; pages that may have had bits cleared are rescanned.
+
+void MetaMemory::UpdatePageSummary (uint8* startP, uint8* endP,
+									uint8 andValue, uint8 orValue)
+{
+	// Meta-memory for the ROM and for dedicated framebuffers isn't
+	// covered by the summary (META_CHECK is only used for RAM).
+
+	if (gRAM_MetaSummary == NULL ||
+		startP < gRAM_MetaMemory ||
+		startP >= gRAM_MetaMemory + gRAMBank_Size ||
+		endP <= startP)
+	{
+		return;
+	}
+
+	uint8	andBits		= andValue & kAccessBitMask;
+	uint8	orBits		= orValue & kAccessBitMask;
+
+	uint32	startOffset	= startP - gRAM_MetaMemory;
+	uint32	endOffset	= endP - gRAM_MetaMemory;
+	uint32	firstPage	= startOffset >> kMetaSummaryShift;
+	uint32	lastPage	= (endOffset - 1) >> kMetaSummaryShift;
+
+	for (uint32 page = firstPage; page <= lastPage; ++page)
+	{
+		uint32	pageStart	= page << kMetaSummaryShift;
+		uint32	pageEnd		= pageStart + kMetaSummaryPageSize;
+
+		if (andBits == kAccessBitMask)
+		{
+			gRAM_MetaSummary[page] |= orBits;
+		}
+		else if (andBits == 0 && pageStart >= startOffset && pageEnd <= endOffset)
+		{
+			gRAM_MetaSummary[page] = orBits;
+		}
+		else
+		{
+			gRAM_MetaSummary[page] = ScanPageSummary (page);
+		}
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 MetaMemory::ScanPageSummary
+// ---------------------------------------------------------------------------
+
+uint8 MetaMemory::ScanPageSummary (uint32 page)
+{
+	uint32	pageStart	= page << kMetaSummaryShift;
+	uint32	pageEnd		= pageStart + kMetaSummaryPageSize;
+
+	if (pageEnd > gRAMBank_Size)
+		pageEnd = gRAMBank_Size;
+
+	uint8	bits = 0;
+
+	for (uint32 ii = pageStart; ii < pageEnd; ++ii)
+	{
+		bits |= gRAM_MetaMemory[ii];
+	}
+
+	return bits & kAccessBitMask;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 MetaMemory::ResyncPageSummary
+// ---------------------------------------------------------------------------
+//	Rebuild gRAM_MetaSummary from scratch.  Called after gRAM_MetaMemory
+//	has been replaced wholesale (as when loading a session).
+
+void MetaMemory::ResyncPageSummary (void)
+{
+	if (gRAM_MetaSummary == NULL)
+		return;
+
+	uint32	numPages = (gRAMBank_Size + kMetaSummaryPageSize - 1) >> kMetaSummaryShift;
+
+	for (uint32 page = 0; page < numPages; ++page)
+	{
+		gRAM_MetaSummary[page] = ScanPageSummary (page);
+	}
 }
 
 
@@ -1348,7 +1688,8 @@ PlanB:
 				// push a parameter on the stack, causing us to get here while
 				// the PC is in cj_kptkdelete.  This will cause the call to InRange
 				// immediately above to return true, satisfying the precondition
-				// we need here.
+				// we need here.  (When the kernel is in ROM, InRange just
+				// looks the address up in the ROM function index instead.)
 
 				else
 				{
@@ -2914,11 +3255,9 @@ static Bool PrvAllowedBitmapAccess (EmAliasBitmapTypeV3<PAS>&, emuptr, Bool)
 void MetaMemory::RegisterBitmapHandle (MemHandle /*h*/)
 {
 #if 0
-	if (h && !IsBitmapHandle (h))
+	if (h)
 	{
-		MetaMemory::UnmarkUIObjects ();
-		gBitmapHandleList.push_back (h);
-		MetaMemory::MarkUIObjects ();
+		gBitmapHandles.insert (h);
 	}
 #endif
 }
@@ -2931,10 +3270,8 @@ void MetaMemory::RegisterBitmapHandle (MemHandle /*h*/)
 void MetaMemory::RegisterBitmapPointer (MemPtr /*p*/)
 {
 #if 0
-	if (p && !IsBitmapPointer (p))
+	if (p && gBitmapPointers.insert (p).second)
 	{
-		MetaMemory::UnmarkUIObjects ();
-		gBitmapPointerList.push_back (p);
 		MetaMemory::MarkUIObjects ();
 	}
 #endif
@@ -2947,9 +3284,7 @@ void MetaMemory::RegisterBitmapPointer (MemPtr /*p*/)
 
 Bool MetaMemory::IsBitmapHandle (MemHandle h)
 {
-	return h && find (
-		gBitmapHandleList.begin (),
-		gBitmapHandleList.end (), h) != gBitmapHandleList.end ();
+	return h && gBitmapHandles.find (h) != gBitmapHandles.end ();
 }
 
 
@@ -2959,9 +3294,7 @@ Bool MetaMemory::IsBitmapHandle (MemHandle h)
 
 Bool MetaMemory::IsBitmapPointer (MemPtr p)
 {
-	return p && find (
-		gBitmapPointerList.begin (),
-		gBitmapPointerList.end (), p) != gBitmapPointerList.end ();
+	return p && gBitmapPointers.find (p) != gBitmapPointers.end ();
 }
 
 
@@ -2973,16 +3306,7 @@ void MetaMemory::UnregisterBitmapHandle (MemHandle h)
 {
 	if (h)
 	{
-		vector<MemHandle>::iterator	iter = find (
-			gBitmapHandleList.begin (),
-			gBitmapHandleList.end (), h);
-
-		if (iter != gBitmapHandleList.end ())
-		{
-			MetaMemory::UnmarkUIObjects ();
-			gBitmapHandleList.erase (iter);
-			MetaMemory::MarkUIObjects ();
-		}
+		gBitmapHandles.erase (h);
 	}
 }
 
@@ -2993,18 +3317,9 @@ void MetaMemory::UnregisterBitmapHandle (MemHandle h)
 
 void MetaMemory::UnregisterBitmapPointer (MemPtr p)
 {
-	if (p)
+	if (p && gBitmapPointers.erase (p))
 	{
-		vector<MemPtr>::iterator	iter = find (
-			gBitmapPointerList.begin (),
-			gBitmapPointerList.end (), p);
-
-		if (iter != gBitmapPointerList.end ())
-		{
-			MetaMemory::UnmarkUIObjects ();
-			gBitmapPointerList.erase (iter);
-			MetaMemory::MarkUIObjects ();
-		}
+		MetaMemory::MarkUIObjects ();
 	}
 }
 
@@ -3509,34 +3824,81 @@ Bool PrvCheckUIObject (emuptr objectP, void* d, int type)
 
 
 // ---------------------------------------------------------------------------
-//		 PrvMarkUIObject
+//		 PrvCollectUIObject
 // ---------------------------------------------------------------------------
 // Get the size of the UI object, use it to get the end of the object, and
-// mark the whole thing as off-limits.
+// add the whole thing to the EmUIObjectMap passed in "data".
 
-Bool PrvMarkUIObject (emuptr object, void* /*data*/, int type)
+Bool PrvCollectUIObject (emuptr object, void* data, int type)
 {
+	EmUIObjectMap&	objects	= *(EmUIObjectMap*) data;
+
 	emuptr	begin	= object;
 	emuptr	end		= begin + ::PrvGetObjectSize (object, type);
 
-	MetaMemory::MarkUIObject (begin, end);
+	objects[begin] = end;
 
 	return false;
 }
 
 
 // ---------------------------------------------------------------------------
-//		 PrvUnmarkUIObject
+//		 PrvRemarkUIObjects
 // ---------------------------------------------------------------------------
-// Get the size of the UI object, use it to get the end of the object, and
-// mark the whole thing as accessible.
+// Re-mark the UI objects that lie in the given chunks, which have just had
+// their access bits reset by SyncOneChunk.  UI objects can't live in free
+// chunks, so any objects found in those have been disposed of; forget them.
 
-static Bool PrvUnmarkUIObject (emuptr object, void* /*data*/, int type)
+void PrvRemarkUIObjects (const EmPalmChunkList& delta)
 {
-	emuptr	begin	= object;
-	emuptr	end		= begin + ::PrvGetObjectSize (object, type);
+	EmPalmChunkList::const_iterator	iter = delta.begin ();
 
-	MetaMemory::UnmarkUIObject (begin, end);
+	while (iter != delta.end ())
+	{
+		// Objects starting before this chunk could still extend into
+		// it, so back up by the size of the largest one.
+
+		emuptr	start = iter->Start () > gUIObjectMaxSize ? iter->Start () - gUIObjectMaxSize : 0;
+
+		EmUIObjectMap::iterator	obj = gUIObjects.lower_bound (start);
+
+		while (obj != gUIObjects.end () && obj->first < iter->End ())
+		{
+			if (obj->second > iter->Start ())
+			{
+				if (iter->Free ())
+				{
+					gUIObjects.erase (obj++);
+					continue;
+				}
+
+				MetaMemory::MarkUIObject (obj->first, obj->second);
+			}
+
+			++obj;
+		}
+
+		++iter;
+	}
+}
+
+
+// ---------------------------------------------------------------------------
+//		 PrvOverlapsDelta
+// ---------------------------------------------------------------------------
+// Return whether or not the given range overlaps any of the given chunks.
+
+Bool PrvOverlapsDelta (emuptr begin, emuptr end, const EmPalmChunkList& delta)
+{
+	EmPalmChunkList::const_iterator	iter = delta.begin ();
+
+	while (iter != delta.end ())
+	{
+		if (begin < iter->End () && end > iter->Start ())
+			return true;
+
+		++iter;
+	}
 
 	return false;
 }
@@ -3591,8 +3953,8 @@ Bool PrvForEachBitmap (IterFn /*fn*/, void* /*data*/)
 #if 0
 	// Iterate over each bitmap in our list.
 
-	vector<MemPtr>::iterator	iter = gBitmapPointerList.begin ();
-	while (iter != gBitmapPointerList.end ())
+	set<MemPtr>::iterator	iter = gBitmapPointers.begin ();
+	while (iter != gBitmapPointers.end ())
 	{
 		emuptr	p = (emuptr) *iter;
 
@@ -3669,24 +4031,119 @@ void MetaMemory::CheckUIObjectAccess (emuptr address, size_t size, Bool forRead,
 // ---------------------------------------------------------------------------
 //		 MetaMemory::MarkUIObjects
 // ---------------------------------------------------------------------------
-// Iterate over all UI objects, calling a function that will mark each one
-// as off limits to applications.
+// Bring the marking of UI objects up to date.  Compare the current set of
+// UI objects to the ones we marked last time.  Objects that have gone away
+// get back the access they'd have if they weren't UI objects, and objects
+// that have appeared are marked as off limits to applications.  Objects
+// that haven't changed are left alone.
 
 void MetaMemory::MarkUIObjects (void)
 {
-	::PrvForEachUIObject (&::PrvMarkUIObject, NULL);
+	EmUIObjectMap	current;
+
+	::PrvForEachUIObject (&::PrvCollectUIObject, &current);
+
+	// Restore the objects that have gone away or changed size.
+
+	vector<pair<emuptr, emuptr> >	restored;
+
+	EmUIObjectMap::iterator	iter = gUIObjects.begin ();
+	while (iter != gUIObjects.end ())
+	{
+		EmUIObjectMap::iterator	found = current.find (iter->first);
+
+		if (found == current.end () || found->second != iter->second)
+		{
+			MetaMemory::RestoreUIObject (iter->first, iter->second);
+			restored.push_back (*iter);
+		}
+
+		++iter;
+	}
+
+	// Mark the objects that have appeared or changed size, as well as
+	// any that share memory with the ones just restored.
+
+	gUIObjectMaxSize = 0;
+
+	iter = current.begin ();
+	while (iter != current.end ())
+	{
+		EmUIObjectMap::iterator	found = gUIObjects.find (iter->first);
+		Bool	mark = found == gUIObjects.end () || found->second != iter->second;
+
+		for (size_t ii = 0; !mark && ii < restored.size (); ++ii)
+		{
+			mark = iter->first < restored[ii].second && iter->second > restored[ii].first;
+		}
+
+		if (mark)
+		{
+			MetaMemory::MarkUIObject (iter->first, iter->second);
+		}
+
+		if (iter->second - iter->first > gUIObjectMaxSize)
+		{
+			gUIObjectMaxSize = iter->second - iter->first;
+		}
+
+		++iter;
+	}
+
+	gUIObjects.swap (current);
 }
 
 
 // ---------------------------------------------------------------------------
 //		 MetaMemory::UnmarkUIObjects
 // ---------------------------------------------------------------------------
-// Iterate over all UI objects, calling a function that will mark each one
-// as accessible to applications.
+// Give all the UI objects we've marked back the access they'd have if they
+// weren't UI objects, and forget about them.
 
 void MetaMemory::UnmarkUIObjects (void)
 {
-	::PrvForEachUIObject (&::PrvUnmarkUIObject, NULL);
+	EmUIObjectMap::iterator	iter = gUIObjects.begin ();
+	while (iter != gUIObjects.end ())
+	{
+		MetaMemory::RestoreUIObject (iter->first, iter->second);
+		++iter;
+	}
+
+	gUIObjects.clear ();
+	gUIObjectMaxSize = 0;
+}
+
+
+// ---------------------------------------------------------------------------
+//		 MetaMemory::RestoreUIObject
+// ---------------------------------------------------------------------------
+// Remove the UI object marking from the given range.  If it's in the dynamic
+// heap, re-mark the chunks it's in the way Resync would.  Otherwise, make it
+// accessible.
+
+void MetaMemory::RestoreUIObject (emuptr begin, emuptr end)
+{
+	const EmPalmHeap*	heap = EmPalmHeap::GetHeapByPtr (begin);
+
+	if (heap && heap->HeapID () == 0)
+	{
+		while (begin < end)
+		{
+			const EmPalmChunk*	chunk = heap->GetChunkContaining (begin);
+
+			if (!chunk)
+				break;
+
+			SyncOneChunk (*chunk);
+
+			begin = chunk->End ();
+		}
+	}
+
+	if (begin < end)
+	{
+		MetaMemory::UnmarkUIObject (begin, end);
+	}
 }
 
 
@@ -14,6 +14,7 @@
 #ifndef _METAMEMORY_H_
 #define _METAMEMORY_H_
 
+#include "EmBankSRAM.h"			// gRAM_MetaMemory, gRAM_MetaSummary
 #include "EmMemory.h"			// EmMemGetMetaAddress
 #include "EmPalmHeap.h"			// EmPalmHeap, EmPalmChunkList
 #include "ErrorHandling.h"		// Errors::EAccessType
@@ -28,6 +29,15 @@ class MetaMemory
 		static void				Load					(SessionFile&);
 		static void				Dispose					(void);
 
+		// Called by EmBankSRAM to save, load, and clear the meta-memory
+		// for RAM.  In the session file, the image is a list of runs of
+		// marked bytes rather than a byte for every byte of RAM.  The
+		// resident copy in gRAM_MetaMemory is still a byte per byte.
+
+		static void				SaveRAMImage			(SessionFile&);
+		static Bool				LoadRAMImage			(SessionFile&);
+		static void				ClearRAMImage			(void);
+
 		// Called to mark and unmark some areas of memory.
 
 		static void				MarkTotalAccess			(emuptr begin, emuptr end);
@@ -110,6 +120,13 @@ class MetaMemory
 		static Bool				CanMemMgrSetWord		(uint8*);	// Inlined, defined below
 		static Bool				CanMemMgrSetByte		(uint8*);	// Inlined, defined below
 
+		// Is every byte of the RAM page(s) holding this access free of
+		// any restriction?  If so, the Can* tests above will all pass.
+		// The meta address must be in gRAM_MetaMemory.
+
+		static Bool				IsUnrestrictedPage		(uint8*, uint32 size);	// Inlined, defined below
+		static void				ResyncPageSummary		(void);
+
 		static Errors::EAccessType
 								GetWhatHappened			(emuptr address, long size, Bool forRead);
 		static Errors::EAccessType
@@ -177,8 +194,12 @@ class MetaMemory
 		static void				UnmarkRange				(emuptr start, emuptr end, uint8 v);
 		static void				MarkUnmarkRange			(emuptr start, emuptr end,
 														 uint8 andValue, uint8 orValue);
+		static void				UpdatePageSummary		(uint8* startP, uint8* endP,
+														 uint8 andValue, uint8 orValue);
+		static uint8			ScanPageSummary			(uint32 page);
 
 		static void				SyncOneChunk			(const EmPalmChunk& chunk);
+		static void				RestoreUIObject			(emuptr begin, emuptr end);
 
 		static void				GWH_ExamineHeap			(const EmPalmHeap& heap,
 														 WhatHappenedData& info);
@@ -331,6 +352,15 @@ DEFINE_FUNCTIONS(MemMgrSet, kNoMemMgrAccess)
 #endif
 
 
+inline Bool MetaMemory::IsUnrestrictedPage (uint8* metaAddress, uint32 size)
+{
+	uint32	offset = metaAddress - gRAM_MetaMemory;
+
+	return (gRAM_MetaSummary[offset >> kMetaSummaryShift] |
+			gRAM_MetaSummary[(offset + size - 1) >> kMetaSummaryShift]) == 0;
+}
+
+
 #if FOR_LATER
 inline void MetaMemory::MarkLongInitialized (emuptr p)
 {
@@ -430,6 +460,10 @@ inline Bool MetaMemory::IsCPUBreak (uint8* metaLocation)
 
 #define META_CHECK(metaAddress, address, op, size, forRead)		\
 do {															\
+	if (MetaMemory::IsUnrestrictedPage (metaAddress, sizeof (size)))	\
+	{															\
+		break;													\
+	}															\
 	if (Memory::IsPCInRAM ())									\
 	{															\
 		if (!MetaMemory::CanApp##op (metaAddress))				\
@@ -617,34 +651,6 @@ inline void MetaMemory::UnmarkUIObject (emuptr begin, emuptr end)
 }
 
 
-// ---------------------------------------------------------------------------
-//		 MetaMemory::MarkInstructionBreak
-// ---------------------------------------------------------------------------
-
-inline void MetaMemory::MarkInstructionBreak (emuptr opcodeLocation)
-{
-	EmAssert ((opcodeLocation & 1) == 0);
-
-	uint8*	ptr = EmMemGetMetaAddress (opcodeLocation);
-
-	*ptr |= kInstructionBreak;
-}
-
-
-// ---------------------------------------------------------------------------
-//		 MetaMemory::UnmarkInstructionBreak
-// ---------------------------------------------------------------------------
-
-inline void MetaMemory::UnmarkInstructionBreak (emuptr opcodeLocation)
-{
-	EmAssert ((opcodeLocation & 1) == 0);
-
-	uint8*	ptr = EmMemGetMetaAddress (opcodeLocation);
-
-	*ptr &= ~kInstructionBreak;
-}
-
-
 // ---------------------------------------------------------------------------
 //		 MetaMemory::MarkDataBreak
 // ---------------------------------------------------------------------------
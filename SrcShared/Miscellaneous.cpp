@@ -28,6 +28,7 @@
 #include "ErrorHandling.h"		// Errors::Throw
 #include "Logging.h"			// LogDump
 #include "Platform.h"			// Platform::AllocateMemory
+#include "PreferenceMgr.h"		// Preference, kPrefKeyDeterministicClock
 #include "ROMStubs.h"			// WinGetDisplayExtent, FrmGetNumberOfObjects, FrmGetObjectType, FrmGetObjectId, ...
 #include "Strings.r.h"			// kStr_INetLibTrapBase, etc.
 #include "UAE.h"				// m68k_dreg, etc.
@@ -2480,6 +2481,30 @@ void GetHostDate (long* year, long* month, long* day)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	UseDeterministicClock
+ *
+ * DESCRIPTION: Returns whether the emulated clock should be kept apart
+ *				from the host's.  If so, the Dragonball RTC reports the
+ *				time of day counted off by its timer instead of calling
+ *				GetHostTime, the date isn't set from GetHostDate, and the
+ *				CPU doesn't wait on real time when it's idle.  Runs then
+ *				see the same times no matter when or how fast they run.
+ *
+ * PARAMETERS:	none
+ *
+ * RETURNED:	True if the DeterministicClock preference is set.
+ *
+ ***********************************************************************/
+
+Bool UseDeterministicClock (void)
+{
+	Preference<bool>	pref (kPrefKeyDeterministicClock);
+	return *pref;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	StartsWith
@@ -152,6 +152,7 @@ Bool		GetSystemCallContext	(emuptr, SystemCallContext&);
 
 void		GetHostTime				(long* hour, long* min, long* sec);
 void		GetHostDate				(long* year, long* month, long* day);
+Bool		UseDeterministicClock	(void);
 
 Bool		StartsWith				(const char* s, const char* pattern);
 Bool		EndsWith				(const char* s, const char* pattern);
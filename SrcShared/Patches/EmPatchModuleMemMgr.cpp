@@ -422,7 +422,7 @@ void MemMgrTailpatch::MemChunkFree (void)
 	EmPalmHeap*	heap = ::PrvGetRememberedHeap ((emuptr) (MemPtr) p);
 
 	EmPalmChunkList	delta;
-	EmPalmHeap::MemChunkFree (heap, &delta);
+	EmPalmHeap::MemChunkFree (heap, p, &delta);
 	MetaMemory::Resync (delta);
 
 	{
@@ -558,7 +558,7 @@ void MemMgrTailpatch::MemHandleFree (void)
 	EmPalmHeap*	heap = ::PrvGetRememberedHeap ((emuptr) (MemHandle) h);
 
 	EmPalmChunkList	delta;
-	EmPalmHeap::MemHandleFree (heap, &delta);
+	EmPalmHeap::MemHandleFree (heap, h, &delta);
 	MetaMemory::Resync (delta);
 
 	EmPatchState::ExitMemMgr ("MemHandleFree");
@@ -149,16 +149,19 @@ ProtoPatchTableEntry	gProtoSysPatchTable[] =
 	{sysTrapUIInitialize,			NULL,									SysTailpatch::UIInitialize},
 	{sysTrapUIReset,				NULL,									SysTailpatch::UIReset},
 
-	{sysTrapCtlNewControl,			SysHeadpatch::UnmarkUIObjects,			SysTailpatch::MarkUIObjects},
-	{sysTrapFldNewField,			SysHeadpatch::UnmarkUIObjects,			SysTailpatch::MarkUIObjects},
-	{sysTrapFrmInitForm,			SysHeadpatch::UnmarkUIObjects,			SysTailpatch::MarkUIObjects},
-	{sysTrapFrmNewBitmap,			SysHeadpatch::UnmarkUIObjects,			SysTailpatch::MarkUIObjects},
-	{sysTrapFrmNewGadget,			SysHeadpatch::UnmarkUIObjects,			SysTailpatch::MarkUIObjects},
-	{sysTrapFrmNewGsi,				SysHeadpatch::UnmarkUIObjects,			SysTailpatch::MarkUIObjects},
-	{sysTrapFrmNewLabel,			SysHeadpatch::UnmarkUIObjects,			SysTailpatch::MarkUIObjects},
-	{sysTrapLstNewList,				SysHeadpatch::UnmarkUIObjects,			SysTailpatch::MarkUIObjects},
-	{sysTrapWinAddWindow,			SysHeadpatch::UnmarkUIObjects,			SysTailpatch::MarkUIObjects},
-	{sysTrapWinRemoveWindow,		SysHeadpatch::UnmarkUIObjects,			SysTailpatch::MarkUIObjects},
+	{sysTrapCtlNewControl,			NULL,									SysTailpatch::MarkUIObjects},
+	{sysTrapFldNewField,			NULL,									SysTailpatch::MarkUIObjects},
+	{sysTrapFrmDeleteForm,			NULL,									SysTailpatch::MarkUIObjects},
+	{sysTrapFrmInitForm,			NULL,									SysTailpatch::MarkUIObjects},
+	{sysTrapFrmNewBitmap,			NULL,									SysTailpatch::MarkUIObjects},
+	{sysTrapFrmNewGadget,			NULL,									SysTailpatch::MarkUIObjects},
+	{sysTrapFrmNewGsi,				NULL,									SysTailpatch::MarkUIObjects},
+	{sysTrapFrmNewLabel,			NULL,									SysTailpatch::MarkUIObjects},
+	{sysTrapLstNewList,				NULL,									SysTailpatch::MarkUIObjects},
+	{sysTrapWinAddWindow,			NULL,									SysTailpatch::MarkUIObjects},
+	{sysTrapWinCreateWindow,		NULL,									SysTailpatch::MarkUIObjects},
+	{sysTrapWinDeleteWindow,		NULL,									SysTailpatch::MarkUIObjects},
+	{sysTrapWinRemoveWindow,		NULL,									SysTailpatch::MarkUIObjects},
 
 	{0, 							NULL,									NULL}
 };
@@ -276,26 +279,6 @@ CallROMType SysHeadpatch::ClipboardGetItem (void)
 }
 
 
-/***********************************************************************
- *
- * FUNCTION:	SysHeadpatch::UnmarkUIObjects
- *
- * DESCRIPTION:	.
- *
- * PARAMETERS:	none
- *
- * RETURNED:	nothing
- *
- ***********************************************************************/
-
-CallROMType SysHeadpatch::UnmarkUIObjects (void)
-{
-	MetaMemory::UnmarkUIObjects ();
-
-	return kExecuteROM;
-}
-
-
 /***********************************************************************
  *
  * FUNCTION:	SysHeadpatch::DbgMessage
@@ -2186,7 +2169,9 @@ CallROMType SysHeadpatch::TblHandleEvent (void)
  *
  * FUNCTION:	SysTailpatch::MarkUIObjects
  *
- * DESCRIPTION:	
+ * DESCRIPTION:	Called after functions that create or dispose of UI
+ *				objects.  Marks the objects that have appeared and
+ *				unmarks the ones that have gone away.
  *
  * PARAMETERS:	none
  *
@@ -3003,6 +2988,10 @@ void SysTailpatch::UIReset (void)
 	// Void UIReset (void)
 
 	EmPatchState::SetUIReset (true);
+
+	// Forget about the previous application's UI objects.
+
+	MetaMemory::MarkUIObjects ();
 }
 
 
@@ -3076,6 +3065,13 @@ void PrvAutoload (void)
 
 void PrvSetCurrentDate (void)
 {
+	// Leave the date alone if it's not supposed to depend on the host.
+
+	if (::UseDeterministicClock ())
+	{
+		return;
+	}
+
 	CEnableFullAccess	munge;
 
 	// Get the current date.
@@ -32,7 +32,6 @@ class EmPatchModuleSys : public EmPatchModule
 class SysHeadpatch
 {
 	public:
-		static CallROMType		UnmarkUIObjects			(void); // CtlNewControl, FldNewField, FrmInitForm, FrmNewBitmap, FrmNewGadget, FrmNewGsi, FrmNewLabel, LstNewList, WinAddWindow, WinRemoveWindow
 		static CallROMType		RecordTrapNumber		(void); // EvtGetEvent & EvtGetPen
 
 		static CallROMType		ClipboardGetItem		(void);
@@ -71,7 +70,7 @@ class SysHeadpatch
 class SysTailpatch
 {
 	public:
-		static void		MarkUIObjects			(void); // 	CtlNewControl, FldNewField, FrmInitForm, FrmNewBitmap, FrmNewGadget, FrmNewGsi, FrmNewLabel, LstNewList, WinAddWindow, WinRemoveWindow
+		static void		MarkUIObjects			(void); // 	CtlNewControl, FldNewField, FrmDeleteForm, FrmInitForm, FrmNewBitmap, FrmNewGadget, FrmNewGsi, FrmNewLabel, LstNewList, WinAddWindow, WinCreateWindow, WinDeleteWindow, WinRemoveWindow
 
 		static void		BmpCreate				(void);
 		static void		BmpDelete				(void);
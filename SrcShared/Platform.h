@@ -137,6 +137,23 @@ class Platform
 								}
 		static void 			RealDisposeMemory		(void* p);
 
+			// Large, zero-filled blocks, such as the emulated RAM.  Where
+			// possible, these are mapped directly from the VM system so
+			// that pages aren't committed until they're written to.  If
+			// hugePages is true, the platform may back the block with
+			// large pages.  Must be released with DisposeLargeMemory.
+		static void*			AllocateLargeMemory		(size_t size, Bool hugePages);
+		template <class T>
+		static void 			DisposeLargeMemory		(T*& p, size_t size)
+								{
+									if (p)
+									{
+										RealDisposeLargeMemory ((void*) p, size);
+										p = NULL;
+									}
+								}
+		static void 			RealDisposeLargeMemory	(void* p, size_t size);
+
 			// Aliases for DisposeMemory, because I can never remember
 			// what the real name is...
 		template <class T>
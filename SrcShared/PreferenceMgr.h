@@ -371,6 +371,11 @@ extern EmulatorPreferences* gEmuPrefs;
 	DO_TO_PREF(FillDisposedBlocks,	bool,				(false))				\
 	DO_TO_PREF(FillStack,			bool,				(false))				\
 																				\
+	DO_TO_PREF(TranslateBlocks,		bool,				(false))				\
+	DO_TO_PREF(FastForwardIdle,		bool,				(false))				\
+	DO_TO_PREF(DeterministicClock,	bool,				(false))				\
+	DO_TO_PREF(HugePageRAM,			bool,				(false))				\
+																				\
 	DO_TO_PREF(LastConfiguration,	Configuration,		(EmDevice ("PalmIII"), 1024, EmFileRef()))	\
 																				\
 	DO_TO_PREF(GremlinInfo,			GremlinInfo,		())						\
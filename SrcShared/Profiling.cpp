@@ -17,6 +17,7 @@
 #include "EmHAL.h"				// GetSystemClockFrequency
 #include "EmMemory.h"			// EmMemCheckAddress, EmMemGet16
 #include "EmPalmFunction.h"		// FindFunctionName, GetTrapName
+#include "EmPalmOS.h"			// EmPalmOS::UpdateCallHooks
 #include "EmStreamFile.h"		// EmStreamFile
 #include "Miscellaneous.h"		// IsSystemTrap, StMemory
 #include "Platform.h"			// Platform::Debugger
@@ -1095,6 +1096,8 @@ void ProfileInit(int maxCalls, int maxDepth)
 
 	gProfilingEnabled	= true;
 	gProfilingOn		= false;
+
+	EmPalmOS::UpdateCallHooks ();
 	gProfilingCounted	= false;
 	gProfilingDetailed	= false;
 	gInterruptCycles	= 0;
@@ -1149,6 +1152,8 @@ void ProfileCleanup()
 
 	gProfilingEnabled = false;
 
+	EmPalmOS::UpdateCallHooks ();
+
 	Platform::DisposeMemory (gCallTree);
 	Platform::DisposeMemory (gCallStack);
 
@@ -43,7 +43,9 @@ SessionFile::SessionFile (ChunkFile& f) :
 	fCfg (),
 	fReadBugFixes (false),
 	fChangedBugFixes (false),
-	fBugFixes (0)
+	fBugFixes (0),
+	fCompress (true),
+	fSaveRAMDelta (false)
 {
 }
 
@@ -101,27 +103,15 @@ Bool SessionFile::ReadROMFileReference (EmFileRef& f)
 	{
 		// First, look in the same directory as the session file.
 
-		try
-		{
-			// Get the stream this ChunkFile is using and see if it's
-			// a file-based stream.
-
-			EmStream&		stream = fFile.GetStream ();
-			EmStreamFile&	fileStream = dynamic_cast<EmStreamFile&> (stream);
-
-			// If so, get the directory this file is in.
-
-			EmFileRef		sessionRef = fileStream.GetFileRef ();
-			EmDirRef		sessionParent = sessionRef.GetParent ();
+		EmFileRef	sessionRef = this->GetFileRef ();
 
-			f = EmFileRef (sessionParent, name);
+		if (sessionRef.IsSpecified ())
+		{
+			f = EmFileRef (sessionRef.GetParent (), name);
 
 			if (f.Exists ())
 				return true;
 		}
-		catch (...)	// Exception thrown if dynamic_cast fails.
-		{
-		}
 
 		// If not there, look in the same directory as Poser itself.
 
@@ -533,12 +523,30 @@ long SessionFile::GetRAMImageSize (void)
 {
 	long	numBytes;
 
+	// Uncompressed (in-memory) session files don't prefix the image with
+	// its size; the chunk is the image.
+
+	long	uncompSize = fCompress ? ChunkFile::kChunkNotFound : fFile.FindChunk (kRAMDataTag);
+
 	Chunk	chunk;
-	if (fFile.ReadChunk (kRAMDataTag, chunk) || fFile.ReadChunk (kRLERAMDataTag, chunk))
+	if (uncompSize != ChunkFile::kChunkNotFound)
+	{
+		numBytes = uncompSize;
+	}
+	else if (fFile.ReadChunk (kRAMDataTag, chunk) || fFile.ReadChunk (kRLERAMDataTag, chunk))
 	{
 		EmStreamChunk	s (chunk);
 		s >> numBytes;
 	}
+	else if (this->ReadRAMDelta (chunk))
+	{
+		// The delta holds the RAM size after its version number.
+
+		EmStreamChunk	s (chunk);
+		uint32			version;
+		s >> version;
+		s >> numBytes;
+	}
 	else
 	{
 		numBytes = fFile.FindChunk (kUncompRAMDataTag);
@@ -548,6 +556,39 @@ long SessionFile::GetRAMImageSize (void)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	SessionFile::GetFileRef
+ *
+ * DESCRIPTION:	Return the file this session file is stored in.
+ *
+ * PARAMETERS:	None
+ *
+ * RETURNED:	The file, or an unspecified EmFileRef if the ChunkFile
+ *				isn't using a file-based stream.
+ *
+ ***********************************************************************/
+
+EmFileRef SessionFile::GetFileRef (void)
+{
+	try
+	{
+		// Get the stream this ChunkFile is using and see if it's
+		// a file-based stream.
+
+		EmStream&		stream = fFile.GetStream ();
+		EmStreamFile&	fileStream = dynamic_cast<EmStreamFile&> (stream);
+
+		return fileStream.GetFileRef ();
+	}
+	catch (...)	// Exception thrown if dynamic_cast fails.
+	{
+	}
+
+	return EmFileRef ();
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	SessionFile::WriteROMFileReference
@@ -876,6 +917,82 @@ Bool SessionFile::GetCanReload (void)
 }
 
 
+/***********************************************************************
+ *
+ * FUNCTION:	SessionFile::SetCompress
+ *
+ * DESCRIPTION:	Set whether chunks normally stored compressed are to
+ *				be compressed.  Turned off for session files that are
+ *				kept in memory.
+ *
+ * PARAMETERS:	compress - true to compress chunks (the default).
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void SessionFile::SetCompress (Bool compress)
+{
+	fCompress = compress;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	SessionFile::GetCompress
+ *
+ * DESCRIPTION:	.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	True if chunks normally stored compressed are to be
+ *				compressed.
+ *
+ ***********************************************************************/
+
+Bool SessionFile::GetCompress (void)
+{
+	return fCompress;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	SessionFile::SetSaveRAMDelta
+ *
+ * DESCRIPTION:	Set whether RAM may be saved as a delta against the
+ *				base image known to EmBankSRAM, rather than in full.
+ *
+ * PARAMETERS:	saveDelta - true to allow saving a delta.
+ *
+ * RETURNED:	Nothing.
+ *
+ ***********************************************************************/
+
+void SessionFile::SetSaveRAMDelta (Bool saveDelta)
+{
+	fSaveRAMDelta = saveDelta;
+}
+
+
+/***********************************************************************
+ *
+ * FUNCTION:	SessionFile::GetSaveRAMDelta
+ *
+ * DESCRIPTION:	.
+ *
+ * PARAMETERS:	None.
+ *
+ * RETURNED:	True if RAM may be saved as a delta.
+ *
+ ***********************************************************************/
+
+Bool SessionFile::GetSaveRAMDelta (void)
+{
+	return fSaveRAMDelta;
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	SessionFile::FixBug
@@ -948,6 +1065,11 @@ Bool SessionFile::IncludesBugFix (BugFix val)
 Bool SessionFile::ReadChunk (ChunkFile::Tag tag, void* image,
 							 CompressionType compType)
 {
+	if (!fCompress)
+	{
+		compType = kNoCompression;
+	}
+
 	// Get the size of the chunk.
 
 	long	chunkSize = fFile.FindChunk (tag);
@@ -1005,6 +1127,11 @@ Bool SessionFile::ReadChunk (ChunkFile::Tag tag, void* image,
 Bool SessionFile::ReadChunk (ChunkFile::Tag tag, Chunk& chunk,
 							 CompressionType compType)
 {
+	if (!fCompress)
+	{
+		compType = kNoCompression;
+	}
+
 	// Get the size of the chunk.
 
 	long	chunkSize = fFile.FindChunk (tag);
@@ -1084,6 +1211,11 @@ Bool SessionFile::ReadChunk (ChunkFile::Tag tag, Chunk& chunk,
 void SessionFile::WriteChunk (ChunkFile::Tag tag, uint32 size,
 				const void* image, CompressionType compType)
 {
+	if (!fCompress)
+	{
+		compType = kNoCompression;
+	}
+
 	// No compression to be used; just write the data out as-is.
 
 	if (compType == kNoCompression)
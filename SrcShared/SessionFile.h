@@ -73,6 +73,8 @@ class SessionFile
 		Bool					ReadGremlinHistory		(Chunk& chunk) { return this->ReadChunk (kGremlinHistory, chunk, kGzipCompression); }
 		Bool					ReadDebugInfo			(Chunk& chunk) { return fFile.ReadChunk (kDebugInfo, chunk); }
 		Bool					ReadMetaInfo			(Chunk& chunk) { return fFile.ReadChunk (kMetaInfo, chunk); }
+		Bool					ReadPackedMetaRAMImage	(Chunk& chunk) { return this->ReadChunk (kPackedMetaRAMDataTag, chunk, kGzipCompression); }
+		Bool					ReadRAMDelta			(Chunk& chunk) { return this->ReadChunk (kRAMDeltaTag, chunk, kGzipCompression); }
 		Bool					ReadPatchInfo			(Chunk& chunk) { return fFile.ReadChunk (kPatchInfo, chunk); }
 		Bool					ReadProfileInfo			(Chunk& chunk) { return fFile.ReadChunk (kProfileInfo, chunk); }
 		Bool					ReadLoggingInfo			(Chunk& chunk) { return fFile.ReadChunk (kLoggingInfo, chunk); }
@@ -121,6 +123,8 @@ class SessionFile
 		void					WriteGremlinHistory		(const Chunk& chunk) { this->WriteChunk (kGremlinHistory, chunk, kGzipCompression); }
 		void					WriteDebugInfo			(const Chunk& chunk) { fFile.WriteChunk (kDebugInfo, chunk); }
 		void					WriteMetaInfo			(const Chunk& chunk) { fFile.WriteChunk (kMetaInfo, chunk); }
+		void					WritePackedMetaRAMImage	(const Chunk& chunk) { this->WriteChunk (kPackedMetaRAMDataTag, chunk, kGzipCompression); }
+		void					WriteRAMDelta			(const Chunk& chunk) { this->WriteChunk (kRAMDeltaTag, chunk, kGzipCompression); }
 		void					WritePatchInfo			(const Chunk& chunk) { fFile.WriteChunk (kPatchInfo, chunk); }
 		void					WriteProfileInfo		(const Chunk& chunk) { fFile.WriteChunk (kProfileInfo, chunk); }
 		void					WriteLoggingInfo		(const Chunk& chunk) { fFile.WriteChunk (kLoggingInfo, chunk); }
@@ -143,6 +147,11 @@ class SessionFile
 		Bool					ReadConfiguration		(Configuration&);
 		long					GetRAMImageSize			(void);
 
+		// Returns the file this session file is being read from or
+		// written to, or an unspecified EmFileRef if it's not file-based.
+
+		EmFileRef				GetFileRef				(void);
+
 		// As information is saved to the file, certain parts are recorded
 		// here.  That way, this information can be save to the preference
 		// file/registry so that newly created sessions can be based on the
@@ -156,6 +165,23 @@ class SessionFile
 		void					FixBug					(BugFix);
 		Bool					IncludesBugFix			(BugFix);
 
+		// Session files kept in memory (such as Hordes' root state) are
+		// read and written more often than they're stored, so they can
+		// skip compressing the large chunks.  The same setting must be
+		// used to read the file as was used to write it.
+
+		void					SetCompress				(Bool);
+		Bool					GetCompress				(void);
+
+		// If set, and EmBankSRAM has a base image, only the RAM pages
+		// that differ from the base image are saved, along with a
+		// reference to it.  Loading the file then requires the base
+		// image to be where it was, or in the same place relative to
+		// this file.
+
+		void					SetSaveRAMDelta			(Bool);
+		Bool					GetSaveRAMDelta			(void);
+
 	private:
 		enum CompressionType
 		{
@@ -237,6 +263,8 @@ class SessionFile
 			kRAMDataTag			= 'zram',	// gzip compressed RAM image
 			kMetaRAMDataTag		= 'zmrm',	// gzip compressed meta-RAM image
 			kMetaROMDataTag		= 'zmro',	// gzip compressed meta-ROM image
+			kPackedMetaRAMDataTag	= 'pmrm',	// gzip compressed list of marked meta-RAM runs
+			kRAMDeltaTag		= 'dram',	// gzip compressed RAM pages changed from a base image
 
 			kBugsTag			= 'bugz',	// bit flags indicating bug fixes in file format
 			
@@ -252,6 +280,8 @@ class SessionFile
 		bool					fReadBugFixes;
 		bool					fChangedBugFixes;
 		BugFixes				fBugFixes;
+		Bool					fCompress;
+		Bool					fSaveRAMDelta;
 };
 
 #endif	// _SESSIONFILE_H_
@@ -42,6 +42,18 @@ do {											\
 		Software_CheckKernelStack ();			\
 } while (0)
 
+// Used by the lean handlers in place of CHECK_STACK_POINTER_DECREMENT.
+// It only calls out when the stack has actually overflowed, skipping the
+// "stack almost full" check.
+
+#define CHECK_STACK_POINTER_OVERFLOW()			\
+do {											\
+	if (m68k_areg (regs, 7) < gStackLow)		\
+		Software_CheckStackPointerDecrement ();	\
+	if (gKernelStackOverflowed)					\
+		Software_CheckKernelStack ();			\
+} while (0)
+
 #define CHECK_STACK_POINTER_INCREMENT()			\
 do {											\
 	if (m68k_areg (regs, 7) > gStackHigh)		\
@@ -100,6 +112,36 @@ STATIC_INLINE void m68k_do_jsr(uaecptr oldpc, uaecptr dest)
     m68k_setpc(dest);
 }
 
+/* Versions of the above for the lean handlers.  They skip the JSR, RTS,
+ * and RTE hooks, but still check for stack overflow and a bad new PC. */
+
+STATIC_INLINE void m68k_do_rts_lean(void)
+{
+    m68k_setpc_lean(get_long(m68k_areg(regs, 7)));
+    m68k_areg(regs, 7) += 4;
+}
+
+STATIC_INLINE void m68k_do_rte_lean(uaecptr newpc)
+{
+	m68k_setpc_rte_lean(newpc);
+}
+
+STATIC_INLINE void m68k_do_bsr_lean(uaecptr oldpc, uae_s32 offset)
+{
+    m68k_areg(regs, 7) -= 4;
+	CHECK_STACK_POINTER_OVERFLOW ();
+    put_long(m68k_areg(regs, 7), oldpc);
+    m68k_incpc(offset);
+}
+
+STATIC_INLINE void m68k_do_jsr_lean(uaecptr oldpc, uaecptr dest)
+{
+    m68k_areg(regs, 7) -= 4;
+	CHECK_STACK_POINTER_OVERFLOW ();
+    put_long(m68k_areg(regs, 7), oldpc);
+    m68k_setpc_lean(dest);
+}
+
 #ifdef __cplusplus
 }
 #endif
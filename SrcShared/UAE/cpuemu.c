@@ -14,6 +14,46 @@
 #define PART_8 1
 #endif
 
+#ifdef PART_1
+struct lazy_flag_struct regflags_lazy;
+
+void flush_lazy_flags (void)
+{
+	uae_u32 kind = regflags_lazy.kind;
+	uae_u32 mask = LAZY_FLAGS_MASK (kind);
+	uae_u32 sign = LAZY_FLAGS_SIGN (kind);
+	uae_u32 src = regflags_lazy.src & mask;
+	uae_u32 dst = regflags_lazy.dst & mask;
+	uae_u32 res = regflags_lazy.res & mask;
+	int flgs = (src & sign) != 0;
+	int flgo = (dst & sign) != 0;
+	int flgn = (res & sign) != 0;
+	regflags_lazy.kind = LAZY_FLAGS_NONE;
+	switch (kind & LAZY_FLAGS_OP) {
+	 case LAZY_FLAGS_LOGICAL:
+		CFLG = 0;
+		VFLG = 0;
+		break;
+	 case LAZY_FLAGS_ADD:
+		VFLG = (flgs ^ flgn) & (flgo ^ flgn);
+		CFLG = XFLG = (~dst & mask) < src;
+		break;
+	 case LAZY_FLAGS_SUB:
+		VFLG = (flgs ^ flgo) & (flgn ^ flgo);
+		CFLG = XFLG = src > dst;
+		break;
+	 case LAZY_FLAGS_CMP:
+		VFLG = (flgs != flgo) && (flgn != flgo);
+		CFLG = src > dst;
+		break;
+	 default:
+		return;
+	}
+	ZFLG = res == 0;
+	NFLG = flgn;
+}
+#endif
+
 #ifdef PART_1
 unsigned long REGPARAM2 op_0_3(uae_u32 opcode) /* OR */
 {
@@ -21,9 +61,7 @@ unsigned long REGPARAM2 op_0_3(uae_u32 opcode) /* OR */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 4;
@@ -35,9 +73,7 @@ unsigned long REGPARAM2 op_10_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -50,9 +86,7 @@ unsigned long REGPARAM2 op_18_3(uae_u32 opcode) /* OR */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -66,9 +100,7 @@ unsigned long REGPARAM2 op_20_3(uae_u32 opcode) /* OR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -80,9 +112,7 @@ unsigned long REGPARAM2 op_28_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -94,9 +124,7 @@ unsigned long REGPARAM2 op_30_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -107,9 +135,7 @@ unsigned long REGPARAM2 op_38_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -120,9 +146,7 @@ unsigned long REGPARAM2 op_39_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -143,9 +167,7 @@ unsigned long REGPARAM2 op_40_3(uae_u32 opcode) /* OR */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 4;
@@ -157,9 +179,7 @@ unsigned long REGPARAM2 op_50_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -172,9 +192,7 @@ unsigned long REGPARAM2 op_58_3(uae_u32 opcode) /* OR */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -188,9 +206,7 @@ unsigned long REGPARAM2 op_60_3(uae_u32 opcode) /* OR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -202,9 +218,7 @@ unsigned long REGPARAM2 op_68_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -216,9 +230,7 @@ unsigned long REGPARAM2 op_70_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -229,9 +241,7 @@ unsigned long REGPARAM2 op_78_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -242,9 +252,7 @@ unsigned long REGPARAM2 op_79_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -266,9 +274,7 @@ unsigned long REGPARAM2 op_80_3(uae_u32 opcode) /* OR */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 6;
@@ -280,9 +286,7 @@ unsigned long REGPARAM2 op_90_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -295,9 +299,7 @@ unsigned long REGPARAM2 op_98_3(uae_u32 opcode) /* OR */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -311,9 +313,7 @@ unsigned long REGPARAM2 op_a0_3(uae_u32 opcode) /* OR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -325,9 +325,7 @@ unsigned long REGPARAM2 op_a8_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -339,9 +337,7 @@ unsigned long REGPARAM2 op_b0_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -352,9 +348,7 @@ unsigned long REGPARAM2 op_b8_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -365,9 +359,7 @@ unsigned long REGPARAM2 op_b9_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 return 18;
@@ -978,9 +970,7 @@ unsigned long REGPARAM2 op_200_3(uae_u32 opcode) /* AND */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 4;
@@ -992,9 +982,7 @@ unsigned long REGPARAM2 op_210_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -1007,9 +995,7 @@ unsigned long REGPARAM2 op_218_3(uae_u32 opcode) /* AND */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -1023,9 +1009,7 @@ unsigned long REGPARAM2 op_220_3(uae_u32 opcode) /* AND */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -1037,9 +1021,7 @@ unsigned long REGPARAM2 op_228_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -1051,9 +1033,7 @@ unsigned long REGPARAM2 op_230_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -1064,9 +1044,7 @@ unsigned long REGPARAM2 op_238_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -1077,9 +1055,7 @@ unsigned long REGPARAM2 op_239_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -1100,9 +1076,7 @@ unsigned long REGPARAM2 op_240_3(uae_u32 opcode) /* AND */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 4;
@@ -1114,9 +1088,7 @@ unsigned long REGPARAM2 op_250_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -1129,9 +1101,7 @@ unsigned long REGPARAM2 op_258_3(uae_u32 opcode) /* AND */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -1145,9 +1115,7 @@ unsigned long REGPARAM2 op_260_3(uae_u32 opcode) /* AND */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -1159,9 +1127,7 @@ unsigned long REGPARAM2 op_268_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -1173,9 +1139,7 @@ unsigned long REGPARAM2 op_270_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -1186,9 +1150,7 @@ unsigned long REGPARAM2 op_278_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -1199,9 +1161,7 @@ unsigned long REGPARAM2 op_279_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -1223,9 +1183,7 @@ unsigned long REGPARAM2 op_280_3(uae_u32 opcode) /* AND */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 6;
@@ -1237,9 +1195,7 @@ unsigned long REGPARAM2 op_290_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -1252,9 +1208,7 @@ unsigned long REGPARAM2 op_298_3(uae_u32 opcode) /* AND */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -1268,9 +1222,7 @@ unsigned long REGPARAM2 op_2a0_3(uae_u32 opcode) /* AND */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -1282,9 +1234,7 @@ unsigned long REGPARAM2 op_2a8_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -1296,9 +1246,7 @@ unsigned long REGPARAM2 op_2b0_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -1309,9 +1257,7 @@ unsigned long REGPARAM2 op_2b8_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -1322,9 +1268,7 @@ unsigned long REGPARAM2 op_2b9_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 return 18;
@@ -1335,16 +1279,9 @@ unsigned long REGPARAM2 op_400_3(uae_u32 opcode) /* SUB */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_410_3(uae_u32 opcode) /* SUB */
@@ -1354,16 +1291,9 @@ unsigned long REGPARAM2 op_410_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_418_3(uae_u32 opcode) /* SUB */
@@ -1374,16 +1304,9 @@ unsigned long REGPARAM2 op_418_3(uae_u32 opcode) /* SUB */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_420_3(uae_u32 opcode) /* SUB */
@@ -1395,16 +1318,9 @@ unsigned long REGPARAM2 op_420_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_428_3(uae_u32 opcode) /* SUB */
@@ -1414,16 +1330,9 @@ unsigned long REGPARAM2 op_428_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_430_3(uae_u32 opcode) /* SUB */
@@ -1433,16 +1342,9 @@ unsigned long REGPARAM2 op_430_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_438_3(uae_u32 opcode) /* SUB */
@@ -1451,16 +1353,9 @@ unsigned long REGPARAM2 op_438_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_439_3(uae_u32 opcode) /* SUB */
@@ -1469,16 +1364,9 @@ unsigned long REGPARAM2 op_439_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_440_3(uae_u32 opcode) /* SUB */
@@ -1487,16 +1375,9 @@ unsigned long REGPARAM2 op_440_3(uae_u32 opcode) /* SUB */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_450_3(uae_u32 opcode) /* SUB */
@@ -1506,16 +1387,9 @@ unsigned long REGPARAM2 op_450_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_458_3(uae_u32 opcode) /* SUB */
@@ -1526,16 +1400,9 @@ unsigned long REGPARAM2 op_458_3(uae_u32 opcode) /* SUB */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_460_3(uae_u32 opcode) /* SUB */
@@ -1547,16 +1414,9 @@ unsigned long REGPARAM2 op_460_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_468_3(uae_u32 opcode) /* SUB */
@@ -1566,16 +1426,9 @@ unsigned long REGPARAM2 op_468_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_470_3(uae_u32 opcode) /* SUB */
@@ -1585,16 +1438,9 @@ unsigned long REGPARAM2 op_470_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_478_3(uae_u32 opcode) /* SUB */
@@ -1603,16 +1449,9 @@ unsigned long REGPARAM2 op_478_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_479_3(uae_u32 opcode) /* SUB */
@@ -1621,16 +1460,9 @@ unsigned long REGPARAM2 op_479_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_480_3(uae_u32 opcode) /* SUB */
@@ -1639,16 +1471,9 @@ unsigned long REGPARAM2 op_480_3(uae_u32 opcode) /* SUB */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 6;
 }
 unsigned long REGPARAM2 op_490_3(uae_u32 opcode) /* SUB */
@@ -1658,16 +1483,9 @@ unsigned long REGPARAM2 op_490_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_498_3(uae_u32 opcode) /* SUB */
@@ -1678,16 +1496,9 @@ unsigned long REGPARAM2 op_498_3(uae_u32 opcode) /* SUB */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_4a0_3(uae_u32 opcode) /* SUB */
@@ -1699,16 +1510,9 @@ unsigned long REGPARAM2 op_4a0_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_4a8_3(uae_u32 opcode) /* SUB */
@@ -1718,16 +1522,9 @@ unsigned long REGPARAM2 op_4a8_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 16;
 }
 unsigned long REGPARAM2 op_4b0_3(uae_u32 opcode) /* SUB */
@@ -1737,16 +1534,9 @@ unsigned long REGPARAM2 op_4b0_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 16;
 }
 unsigned long REGPARAM2 op_4b8_3(uae_u32 opcode) /* SUB */
@@ -1755,16 +1545,9 @@ unsigned long REGPARAM2 op_4b8_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 16;
 }
 unsigned long REGPARAM2 op_4b9_3(uae_u32 opcode) /* SUB */
@@ -1773,16 +1556,9 @@ unsigned long REGPARAM2 op_4b9_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(10);
+}}}}}}m68k_incpc(10);
 return 18;
 }
 unsigned long REGPARAM2 op_600_3(uae_u32 opcode) /* ADD */
@@ -1791,16 +1567,9 @@ unsigned long REGPARAM2 op_600_3(uae_u32 opcode) /* ADD */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_610_3(uae_u32 opcode) /* ADD */
@@ -1810,16 +1579,9 @@ unsigned long REGPARAM2 op_610_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_618_3(uae_u32 opcode) /* ADD */
@@ -1830,16 +1592,9 @@ unsigned long REGPARAM2 op_618_3(uae_u32 opcode) /* ADD */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_620_3(uae_u32 opcode) /* ADD */
@@ -1851,16 +1606,9 @@ unsigned long REGPARAM2 op_620_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_628_3(uae_u32 opcode) /* ADD */
@@ -1870,16 +1618,9 @@ unsigned long REGPARAM2 op_628_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_630_3(uae_u32 opcode) /* ADD */
@@ -1889,16 +1630,9 @@ unsigned long REGPARAM2 op_630_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_638_3(uae_u32 opcode) /* ADD */
@@ -1907,16 +1641,9 @@ unsigned long REGPARAM2 op_638_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_639_3(uae_u32 opcode) /* ADD */
@@ -1925,16 +1652,9 @@ unsigned long REGPARAM2 op_639_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_640_3(uae_u32 opcode) /* ADD */
@@ -1943,16 +1663,9 @@ unsigned long REGPARAM2 op_640_3(uae_u32 opcode) /* ADD */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_650_3(uae_u32 opcode) /* ADD */
@@ -1962,16 +1675,9 @@ unsigned long REGPARAM2 op_650_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_658_3(uae_u32 opcode) /* ADD */
@@ -1982,16 +1688,9 @@ unsigned long REGPARAM2 op_658_3(uae_u32 opcode) /* ADD */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_660_3(uae_u32 opcode) /* ADD */
@@ -2003,16 +1702,9 @@ unsigned long REGPARAM2 op_660_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_668_3(uae_u32 opcode) /* ADD */
@@ -2022,16 +1714,9 @@ unsigned long REGPARAM2 op_668_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_670_3(uae_u32 opcode) /* ADD */
@@ -2041,16 +1726,9 @@ unsigned long REGPARAM2 op_670_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_678_3(uae_u32 opcode) /* ADD */
@@ -2059,16 +1737,9 @@ unsigned long REGPARAM2 op_678_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_679_3(uae_u32 opcode) /* ADD */
@@ -2077,16 +1748,9 @@ unsigned long REGPARAM2 op_679_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_680_3(uae_u32 opcode) /* ADD */
@@ -2095,16 +1759,9 @@ unsigned long REGPARAM2 op_680_3(uae_u32 opcode) /* ADD */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 6;
 }
 unsigned long REGPARAM2 op_690_3(uae_u32 opcode) /* ADD */
@@ -2114,16 +1771,9 @@ unsigned long REGPARAM2 op_690_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_698_3(uae_u32 opcode) /* ADD */
@@ -2134,16 +1784,9 @@ unsigned long REGPARAM2 op_698_3(uae_u32 opcode) /* ADD */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_6a0_3(uae_u32 opcode) /* ADD */
@@ -2155,16 +1798,9 @@ unsigned long REGPARAM2 op_6a0_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_6a8_3(uae_u32 opcode) /* ADD */
@@ -2174,16 +1810,9 @@ unsigned long REGPARAM2 op_6a8_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 16;
 }
 unsigned long REGPARAM2 op_6b0_3(uae_u32 opcode) /* ADD */
@@ -2193,16 +1822,9 @@ unsigned long REGPARAM2 op_6b0_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 16;
 }
 unsigned long REGPARAM2 op_6b8_3(uae_u32 opcode) /* ADD */
@@ -2211,16 +1833,9 @@ unsigned long REGPARAM2 op_6b8_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+}}}}}}m68k_incpc(8);
 return 16;
 }
 unsigned long REGPARAM2 op_6b9_3(uae_u32 opcode) /* ADD */
@@ -2229,16 +1844,9 @@ unsigned long REGPARAM2 op_6b9_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(10);
+}}}}}}m68k_incpc(10);
 return 18;
 }
 unsigned long REGPARAM2 op_800_3(uae_u32 opcode) /* BTST */
@@ -2764,9 +2372,7 @@ unsigned long REGPARAM2 op_a00_3(uae_u32 opcode) /* EOR */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 4;
@@ -2778,9 +2384,7 @@ unsigned long REGPARAM2 op_a10_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -2793,9 +2397,7 @@ unsigned long REGPARAM2 op_a18_3(uae_u32 opcode) /* EOR */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -2809,9 +2411,7 @@ unsigned long REGPARAM2 op_a20_3(uae_u32 opcode) /* EOR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -2823,9 +2423,7 @@ unsigned long REGPARAM2 op_a28_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -2837,9 +2435,7 @@ unsigned long REGPARAM2 op_a30_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -2850,9 +2446,7 @@ unsigned long REGPARAM2 op_a38_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -2863,9 +2457,7 @@ unsigned long REGPARAM2 op_a39_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -2886,9 +2478,7 @@ unsigned long REGPARAM2 op_a40_3(uae_u32 opcode) /* EOR */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 4;
@@ -2900,9 +2490,7 @@ unsigned long REGPARAM2 op_a50_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -2915,9 +2503,7 @@ unsigned long REGPARAM2 op_a58_3(uae_u32 opcode) /* EOR */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -2931,9 +2517,7 @@ unsigned long REGPARAM2 op_a60_3(uae_u32 opcode) /* EOR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -2945,9 +2529,7 @@ unsigned long REGPARAM2 op_a68_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -2959,9 +2541,7 @@ unsigned long REGPARAM2 op_a70_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -2975,9 +2555,7 @@ unsigned long REGPARAM2 op_a78_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -2988,9 +2566,7 @@ unsigned long REGPARAM2 op_a79_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -3012,9 +2588,7 @@ unsigned long REGPARAM2 op_a80_3(uae_u32 opcode) /* EOR */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 6;
@@ -3026,9 +2600,7 @@ unsigned long REGPARAM2 op_a90_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -3041,9 +2613,7 @@ unsigned long REGPARAM2 op_a98_3(uae_u32 opcode) /* EOR */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -3057,9 +2627,7 @@ unsigned long REGPARAM2 op_aa0_3(uae_u32 opcode) /* EOR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -3071,9 +2639,7 @@ unsigned long REGPARAM2 op_aa8_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -3085,9 +2651,7 @@ unsigned long REGPARAM2 op_ab0_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -3098,9 +2662,7 @@ unsigned long REGPARAM2 op_ab8_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -3111,9 +2673,7 @@ unsigned long REGPARAM2 op_ab9_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 return 18;
@@ -3124,14 +2684,8 @@ unsigned long REGPARAM2 op_c00_3(uae_u32 opcode) /* CMP */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_c10_3(uae_u32 opcode) /* CMP */
@@ -3141,14 +2695,8 @@ unsigned long REGPARAM2 op_c10_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_c18_3(uae_u32 opcode) /* CMP */
@@ -3159,14 +2707,8 @@ unsigned long REGPARAM2 op_c18_3(uae_u32 opcode) /* CMP */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_c20_3(uae_u32 opcode) /* CMP */
@@ -3178,14 +2720,8 @@ unsigned long REGPARAM2 op_c20_3(uae_u32 opcode) /* CMP */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_c28_3(uae_u32 opcode) /* CMP */
@@ -3195,14 +2731,8 @@ unsigned long REGPARAM2 op_c28_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c30_3(uae_u32 opcode) /* CMP */
@@ -3212,14 +2742,8 @@ unsigned long REGPARAM2 op_c30_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c38_3(uae_u32 opcode) /* CMP */
@@ -3228,14 +2752,8 @@ unsigned long REGPARAM2 op_c38_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c39_3(uae_u32 opcode) /* CMP */
@@ -3244,14 +2762,8 @@ unsigned long REGPARAM2 op_c39_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 10;
 }
 unsigned long REGPARAM2 op_c3a_3(uae_u32 opcode) /* CMP */
@@ -3262,14 +2774,8 @@ unsigned long REGPARAM2 op_c3a_3(uae_u32 opcode) /* CMP */
 	dsta += (uae_s32)(uae_s16)get_iword(4);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c3b_3(uae_u32 opcode) /* CMP */
@@ -3280,14 +2786,8 @@ unsigned long REGPARAM2 op_c3b_3(uae_u32 opcode) /* CMP */
 	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c40_3(uae_u32 opcode) /* CMP */
@@ -3296,14 +2796,8 @@ unsigned long REGPARAM2 op_c40_3(uae_u32 opcode) /* CMP */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_c50_3(uae_u32 opcode) /* CMP */
@@ -3313,14 +2807,8 @@ unsigned long REGPARAM2 op_c50_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_c58_3(uae_u32 opcode) /* CMP */
@@ -3331,14 +2819,8 @@ unsigned long REGPARAM2 op_c58_3(uae_u32 opcode) /* CMP */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_c60_3(uae_u32 opcode) /* CMP */
@@ -3350,14 +2832,8 @@ unsigned long REGPARAM2 op_c60_3(uae_u32 opcode) /* CMP */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_c68_3(uae_u32 opcode) /* CMP */
@@ -3367,14 +2843,8 @@ unsigned long REGPARAM2 op_c68_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c70_3(uae_u32 opcode) /* CMP */
@@ -3384,14 +2854,8 @@ unsigned long REGPARAM2 op_c70_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c78_3(uae_u32 opcode) /* CMP */
@@ -3400,14 +2864,8 @@ unsigned long REGPARAM2 op_c78_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c79_3(uae_u32 opcode) /* CMP */
@@ -3416,14 +2874,8 @@ unsigned long REGPARAM2 op_c79_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = get_ilong(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 10;
 }
 unsigned long REGPARAM2 op_c7a_3(uae_u32 opcode) /* CMP */
@@ -3434,14 +2886,8 @@ unsigned long REGPARAM2 op_c7a_3(uae_u32 opcode) /* CMP */
 	dsta += (uae_s32)(uae_s16)get_iword(4);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c7b_3(uae_u32 opcode) /* CMP */
@@ -3452,14 +2898,8 @@ unsigned long REGPARAM2 op_c7b_3(uae_u32 opcode) /* CMP */
 	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_c80_3(uae_u32 opcode) /* CMP */
@@ -3468,14 +2908,8 @@ unsigned long REGPARAM2 op_c80_3(uae_u32 opcode) /* CMP */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(6);
 return 6;
 }
 unsigned long REGPARAM2 op_c90_3(uae_u32 opcode) /* CMP */
@@ -3485,14 +2919,8 @@ unsigned long REGPARAM2 op_c90_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_c98_3(uae_u32 opcode) /* CMP */
@@ -3503,14 +2931,8 @@ unsigned long REGPARAM2 op_c98_3(uae_u32 opcode) /* CMP */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_ca0_3(uae_u32 opcode) /* CMP */
@@ -3522,14 +2944,8 @@ unsigned long REGPARAM2 op_ca0_3(uae_u32 opcode) /* CMP */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_ca8_3(uae_u32 opcode) /* CMP */
@@ -3539,14 +2955,8 @@ unsigned long REGPARAM2 op_ca8_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_cb0_3(uae_u32 opcode) /* CMP */
@@ -3556,14 +2966,8 @@ unsigned long REGPARAM2 op_cb0_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_cb8_3(uae_u32 opcode) /* CMP */
@@ -3572,14 +2976,8 @@ unsigned long REGPARAM2 op_cb8_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_cb9_3(uae_u32 opcode) /* CMP */
@@ -3588,14 +2986,8 @@ unsigned long REGPARAM2 op_cb9_3(uae_u32 opcode) /* CMP */
 {	uaecptr dsta = get_ilong(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(10);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(10);
 return 14;
 }
 unsigned long REGPARAM2 op_cba_3(uae_u32 opcode) /* CMP */
@@ -3606,14 +2998,8 @@ unsigned long REGPARAM2 op_cba_3(uae_u32 opcode) /* CMP */
 	dsta += (uae_s32)(uae_s16)get_iword(6);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_cbb_3(uae_u32 opcode) /* CMP */
@@ -3624,14 +3010,8 @@ unsigned long REGPARAM2 op_cbb_3(uae_u32 opcode) /* CMP */
 	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(6));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(8);
 return 12;
 }
 unsigned long REGPARAM2 op_1000_3(uae_u32 opcode) /* MOVE */
@@ -3639,9 +3019,7 @@ unsigned long REGPARAM2 op_1000_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 2;
@@ -3652,9 +3030,7 @@ unsigned long REGPARAM2 op_1010_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -3666,9 +3042,7 @@ unsigned long REGPARAM2 op_1018_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -3681,9 +3055,7 @@ unsigned long REGPARAM2 op_1020_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -3694,9 +3066,7 @@ unsigned long REGPARAM2 op_1028_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -3707,9 +3077,7 @@ unsigned long REGPARAM2 op_1030_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -3719,9 +3087,7 @@ unsigned long REGPARAM2 op_1038_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -3731,9 +3097,7 @@ unsigned long REGPARAM2 op_1039_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 return 8;
@@ -3744,9 +3108,7 @@ unsigned long REGPARAM2 op_103a_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -3757,9 +3119,7 @@ unsigned long REGPARAM2 op_103b_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -3768,9 +3128,7 @@ unsigned long REGPARAM2 op_103c_3(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 4;
@@ -3781,9 +3139,7 @@ unsigned long REGPARAM2 op_1080_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -3795,9 +3151,7 @@ unsigned long REGPARAM2 op_1090_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -3810,9 +3164,7 @@ unsigned long REGPARAM2 op_1098_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -3826,9 +3178,7 @@ unsigned long REGPARAM2 op_10a0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -3840,9 +3190,7 @@ unsigned long REGPARAM2 op_10a8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -3854,9 +3202,7 @@ unsigned long REGPARAM2 op_10b0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -3867,9 +3213,7 @@ unsigned long REGPARAM2 op_10b8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -3880,9 +3224,7 @@ unsigned long REGPARAM2 op_10b9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -3894,9 +3236,7 @@ unsigned long REGPARAM2 op_10ba_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -3908,9 +3248,7 @@ unsigned long REGPARAM2 op_10bb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -3920,9 +3258,7 @@ unsigned long REGPARAM2 op_10bc_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -3934,9 +3270,7 @@ unsigned long REGPARAM2 op_10c0_3(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -3949,9 +3283,7 @@ unsigned long REGPARAM2 op_10d0_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -3965,9 +3297,7 @@ unsigned long REGPARAM2 op_10d8_3(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -3982,9 +3312,7 @@ unsigned long REGPARAM2 op_10e0_3(uae_u32 opcode) /* MOVE */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -3997,9 +3325,7 @@ unsigned long REGPARAM2 op_10e8_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4012,9 +3338,7 @@ unsigned long REGPARAM2 op_10f0_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4026,9 +3350,7 @@ unsigned long REGPARAM2 op_10f8_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4040,9 +3362,7 @@ unsigned long REGPARAM2 op_10f9_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4055,9 +3375,7 @@ unsigned long REGPARAM2 op_10fa_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4070,9 +3388,7 @@ unsigned long REGPARAM2 op_10fb_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4083,9 +3399,7 @@ unsigned long REGPARAM2 op_10fc_3(uae_u32 opcode) /* MOVE */
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -4098,9 +3412,7 @@ unsigned long REGPARAM2 op_1100_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -4114,9 +3426,7 @@ unsigned long REGPARAM2 op_1110_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -4131,9 +3441,7 @@ unsigned long REGPARAM2 op_1118_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -4149,9 +3457,7 @@ unsigned long REGPARAM2 op_1120_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -4165,9 +3471,7 @@ unsigned long REGPARAM2 op_1128_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4181,9 +3485,7 @@ unsigned long REGPARAM2 op_1130_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4196,9 +3498,7 @@ unsigned long REGPARAM2 op_1138_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4211,9 +3511,7 @@ unsigned long REGPARAM2 op_1139_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4227,9 +3525,7 @@ unsigned long REGPARAM2 op_113a_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4243,9 +3539,7 @@ unsigned long REGPARAM2 op_113b_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4257,9 +3551,7 @@ unsigned long REGPARAM2 op_113c_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -4270,9 +3562,7 @@ unsigned long REGPARAM2 op_1140_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -4284,9 +3574,7 @@ unsigned long REGPARAM2 op_1150_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4299,9 +3587,7 @@ unsigned long REGPARAM2 op_1158_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4315,9 +3601,7 @@ unsigned long REGPARAM2 op_1160_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4329,9 +3613,7 @@ unsigned long REGPARAM2 op_1168_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4343,9 +3625,7 @@ unsigned long REGPARAM2 op_1170_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4356,9 +3636,7 @@ unsigned long REGPARAM2 op_1178_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4369,9 +3647,7 @@ unsigned long REGPARAM2 op_1179_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4383,9 +3659,7 @@ unsigned long REGPARAM2 op_117a_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4397,9 +3671,7 @@ unsigned long REGPARAM2 op_117b_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4409,9 +3681,7 @@ unsigned long REGPARAM2 op_117c_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -4422,9 +3692,7 @@ unsigned long REGPARAM2 op_1180_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -4436,9 +3704,7 @@ unsigned long REGPARAM2 op_1190_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4451,9 +3717,7 @@ unsigned long REGPARAM2 op_1198_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4467,9 +3731,7 @@ unsigned long REGPARAM2 op_11a0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4481,9 +3743,7 @@ unsigned long REGPARAM2 op_11a8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4495,9 +3755,7 @@ unsigned long REGPARAM2 op_11b0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4508,9 +3766,7 @@ unsigned long REGPARAM2 op_11b8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4521,9 +3777,7 @@ unsigned long REGPARAM2 op_11b9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4535,9 +3789,7 @@ unsigned long REGPARAM2 op_11ba_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4549,9 +3801,7 @@ unsigned long REGPARAM2 op_11bb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4561,9 +3811,7 @@ unsigned long REGPARAM2 op_11bc_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -4573,9 +3821,7 @@ unsigned long REGPARAM2 op_11c0_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -4586,9 +3832,7 @@ unsigned long REGPARAM2 op_11d0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4600,9 +3844,7 @@ unsigned long REGPARAM2 op_11d8_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4615,9 +3857,7 @@ unsigned long REGPARAM2 op_11e0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4628,9 +3868,7 @@ unsigned long REGPARAM2 op_11e8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4641,9 +3879,7 @@ unsigned long REGPARAM2 op_11f0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4653,9 +3889,7 @@ unsigned long REGPARAM2 op_11f8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4665,9 +3899,7 @@ unsigned long REGPARAM2 op_11f9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4678,9 +3910,7 @@ unsigned long REGPARAM2 op_11fa_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4691,9 +3921,7 @@ unsigned long REGPARAM2 op_11fb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4702,9 +3930,7 @@ unsigned long REGPARAM2 op_11fc_3(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -4714,9 +3940,7 @@ unsigned long REGPARAM2 op_13c0_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -4727,9 +3951,7 @@ unsigned long REGPARAM2 op_13d0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4741,9 +3963,7 @@ unsigned long REGPARAM2 op_13d8_3(uae_u32 opcode) /* MOVE */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4756,9 +3976,7 @@ unsigned long REGPARAM2 op_13e0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4769,9 +3987,7 @@ unsigned long REGPARAM2 op_13e8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4782,9 +3998,7 @@ unsigned long REGPARAM2 op_13f0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4794,9 +4008,7 @@ unsigned long REGPARAM2 op_13f8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4806,9 +4018,7 @@ unsigned long REGPARAM2 op_13f9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(10);
 return 14;
@@ -4819,9 +4029,7 @@ unsigned long REGPARAM2 op_13fa_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4832,9 +4040,7 @@ unsigned long REGPARAM2 op_13fb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -4843,9 +4049,7 @@ unsigned long REGPARAM2 op_13fc_3(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}m68k_incpc(8);
 return 10;
@@ -4855,9 +4059,7 @@ unsigned long REGPARAM2 op_2000_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 2;
@@ -4867,9 +4069,7 @@ unsigned long REGPARAM2 op_2008_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 2;
@@ -4880,9 +4080,7 @@ unsigned long REGPARAM2 op_2010_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -4894,9 +4092,7 @@ unsigned long REGPARAM2 op_2018_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -4909,9 +4105,7 @@ unsigned long REGPARAM2 op_2020_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -4922,9 +4116,7 @@ unsigned long REGPARAM2 op_2028_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4935,9 +4127,7 @@ unsigned long REGPARAM2 op_2030_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4947,9 +4137,7 @@ unsigned long REGPARAM2 op_2038_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4959,9 +4147,7 @@ unsigned long REGPARAM2 op_2039_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 return 10;
@@ -4972,9 +4158,7 @@ unsigned long REGPARAM2 op_203a_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4985,9 +4169,7 @@ unsigned long REGPARAM2 op_203b_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -4996,9 +4178,7 @@ unsigned long REGPARAM2 op_203c_3(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 6;
@@ -5150,9 +4330,7 @@ unsigned long REGPARAM2 op_2080_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 6;
@@ -5163,9 +4341,7 @@ unsigned long REGPARAM2 op_2088_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 6;
@@ -5177,9 +4353,7 @@ unsigned long REGPARAM2 op_2090_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5192,9 +4366,7 @@ unsigned long REGPARAM2 op_2098_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5208,9 +4380,7 @@ unsigned long REGPARAM2 op_20a0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5222,9 +4392,7 @@ unsigned long REGPARAM2 op_20a8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5236,9 +4404,7 @@ unsigned long REGPARAM2 op_20b0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5249,9 +4415,7 @@ unsigned long REGPARAM2 op_20b8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5262,9 +4426,7 @@ unsigned long REGPARAM2 op_20b9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5276,9 +4438,7 @@ unsigned long REGPARAM2 op_20ba_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5290,9 +4450,7 @@ unsigned long REGPARAM2 op_20bb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5302,9 +4460,7 @@ unsigned long REGPARAM2 op_20bc_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 return 10;
@@ -5316,9 +4472,7 @@ unsigned long REGPARAM2 op_20c0_3(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 6;
@@ -5330,9 +4484,7 @@ unsigned long REGPARAM2 op_20c8_3(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 6;
@@ -5345,9 +4497,7 @@ unsigned long REGPARAM2 op_20d0_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5361,9 +4511,7 @@ unsigned long REGPARAM2 op_20d8_3(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5378,9 +4526,7 @@ unsigned long REGPARAM2 op_20e0_3(uae_u32 opcode) /* MOVE */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5393,9 +4539,7 @@ unsigned long REGPARAM2 op_20e8_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5408,9 +4552,7 @@ unsigned long REGPARAM2 op_20f0_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5422,9 +4564,7 @@ unsigned long REGPARAM2 op_20f8_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5436,9 +4576,7 @@ unsigned long REGPARAM2 op_20f9_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5451,9 +4589,7 @@ unsigned long REGPARAM2 op_20fa_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5466,9 +4602,7 @@ unsigned long REGPARAM2 op_20fb_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5479,9 +4613,7 @@ unsigned long REGPARAM2 op_20fc_3(uae_u32 opcode) /* MOVE */
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 return 10;
@@ -5494,9 +4626,7 @@ unsigned long REGPARAM2 op_2100_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 6;
@@ -5509,9 +4639,7 @@ unsigned long REGPARAM2 op_2108_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(2);
 return 6;
@@ -5525,9 +4653,7 @@ unsigned long REGPARAM2 op_2110_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5542,9 +4668,7 @@ unsigned long REGPARAM2 op_2118_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5560,9 +4684,7 @@ unsigned long REGPARAM2 op_2120_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -5576,9 +4698,7 @@ unsigned long REGPARAM2 op_2128_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5592,9 +4712,7 @@ unsigned long REGPARAM2 op_2130_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5607,9 +4725,7 @@ unsigned long REGPARAM2 op_2138_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5622,9 +4738,7 @@ unsigned long REGPARAM2 op_2139_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5638,9 +4752,7 @@ unsigned long REGPARAM2 op_213a_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5654,9 +4766,7 @@ unsigned long REGPARAM2 op_213b_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5671,9 +4781,7 @@ unsigned long REGPARAM2 op_213c_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 return 10;
@@ -5684,9 +4792,7 @@ unsigned long REGPARAM2 op_2140_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 8;
@@ -5697,9 +4803,7 @@ unsigned long REGPARAM2 op_2148_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 8;
@@ -5711,9 +4815,7 @@ unsigned long REGPARAM2 op_2150_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5726,9 +4828,7 @@ unsigned long REGPARAM2 op_2158_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5742,9 +4842,7 @@ unsigned long REGPARAM2 op_2160_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5756,9 +4854,7 @@ unsigned long REGPARAM2 op_2168_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5770,9 +4866,7 @@ unsigned long REGPARAM2 op_2170_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5783,9 +4877,7 @@ unsigned long REGPARAM2 op_2178_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5796,9 +4888,7 @@ unsigned long REGPARAM2 op_2179_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -5810,9 +4900,7 @@ unsigned long REGPARAM2 op_217a_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5824,9 +4912,7 @@ unsigned long REGPARAM2 op_217b_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5836,9 +4922,7 @@ unsigned long REGPARAM2 op_217c_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 return 12;
@@ -5849,9 +4933,7 @@ unsigned long REGPARAM2 op_2180_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 8;
@@ -5862,9 +4944,7 @@ unsigned long REGPARAM2 op_2188_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 8;
@@ -5876,9 +4956,7 @@ unsigned long REGPARAM2 op_2190_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5891,9 +4969,7 @@ unsigned long REGPARAM2 op_2198_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5907,9 +4983,7 @@ unsigned long REGPARAM2 op_21a0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -5921,9 +4995,7 @@ unsigned long REGPARAM2 op_21a8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5935,9 +5007,7 @@ unsigned long REGPARAM2 op_21b0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5948,9 +5018,7 @@ unsigned long REGPARAM2 op_21b8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5961,9 +5029,7 @@ unsigned long REGPARAM2 op_21b9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -5975,9 +5041,7 @@ unsigned long REGPARAM2 op_21ba_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -5989,9 +5053,7 @@ unsigned long REGPARAM2 op_21bb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6001,9 +5063,7 @@ unsigned long REGPARAM2 op_21bc_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 return 12;
@@ -6013,9 +5073,7 @@ unsigned long REGPARAM2 op_21c0_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 8;
@@ -6025,9 +5083,7 @@ unsigned long REGPARAM2 op_21c8_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(4);
 return 8;
@@ -6038,9 +5094,7 @@ unsigned long REGPARAM2 op_21d0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -6052,9 +5106,7 @@ unsigned long REGPARAM2 op_21d8_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -6067,9 +5119,7 @@ unsigned long REGPARAM2 op_21e0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -6080,9 +5130,7 @@ unsigned long REGPARAM2 op_21e8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6093,9 +5141,7 @@ unsigned long REGPARAM2 op_21f0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6105,9 +5151,7 @@ unsigned long REGPARAM2 op_21f8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6117,9 +5161,7 @@ unsigned long REGPARAM2 op_21f9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -6130,9 +5172,7 @@ unsigned long REGPARAM2 op_21fa_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6143,9 +5183,7 @@ unsigned long REGPARAM2 op_21fb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6154,9 +5192,7 @@ unsigned long REGPARAM2 op_21fc_3(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(8);
 return 12;
@@ -6166,9 +5202,7 @@ unsigned long REGPARAM2 op_23c0_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 return 10;
@@ -6178,9 +5212,7 @@ unsigned long REGPARAM2 op_23c8_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(6);
 return 10;
@@ -6191,9 +5223,7 @@ unsigned long REGPARAM2 op_23d0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6205,9 +5235,7 @@ unsigned long REGPARAM2 op_23d8_3(uae_u32 opcode) /* MOVE */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6220,9 +5248,7 @@ unsigned long REGPARAM2 op_23e0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -6233,9 +5259,7 @@ unsigned long REGPARAM2 op_23e8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -6246,9 +5270,7 @@ unsigned long REGPARAM2 op_23f0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -6258,9 +5280,7 @@ unsigned long REGPARAM2 op_23f8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -6270,9 +5290,7 @@ unsigned long REGPARAM2 op_23f9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(10);
 return 18;
@@ -6283,9 +5301,7 @@ unsigned long REGPARAM2 op_23fa_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -6296,9 +5312,7 @@ unsigned long REGPARAM2 op_23fb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(8);
 return 16;
@@ -6307,9 +5321,7 @@ unsigned long REGPARAM2 op_23fc_3(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s32 src = get_ilong(2);
 {	uaecptr dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}m68k_incpc(10);
 return 14;
@@ -6319,9 +5331,7 @@ unsigned long REGPARAM2 op_3000_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 2;
@@ -6331,9 +5341,7 @@ unsigned long REGPARAM2 op_3008_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg(regs, srcreg);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 2;
@@ -6344,9 +5352,7 @@ unsigned long REGPARAM2 op_3010_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -6358,9 +5364,7 @@ unsigned long REGPARAM2 op_3018_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -6373,9 +5377,7 @@ unsigned long REGPARAM2 op_3020_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -6386,9 +5388,7 @@ unsigned long REGPARAM2 op_3028_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -6399,9 +5399,7 @@ unsigned long REGPARAM2 op_3030_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -6411,9 +5409,7 @@ unsigned long REGPARAM2 op_3038_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -6423,9 +5419,7 @@ unsigned long REGPARAM2 op_3039_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 return 8;
@@ -6436,9 +5430,7 @@ unsigned long REGPARAM2 op_303a_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -6449,9 +5441,7 @@ unsigned long REGPARAM2 op_303b_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -6460,9 +5450,7 @@ unsigned long REGPARAM2 op_303c_3(uae_u32 opcode) /* MOVE */
 {
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 4;
@@ -6614,9 +5602,7 @@ unsigned long REGPARAM2 op_3080_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -6627,9 +5613,7 @@ unsigned long REGPARAM2 op_3088_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -6641,9 +5625,7 @@ unsigned long REGPARAM2 op_3090_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -6656,9 +5638,7 @@ unsigned long REGPARAM2 op_3098_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -6672,9 +5652,7 @@ unsigned long REGPARAM2 op_30a0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -6686,9 +5664,7 @@ unsigned long REGPARAM2 op_30a8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6700,9 +5676,7 @@ unsigned long REGPARAM2 op_30b0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6713,9 +5687,7 @@ unsigned long REGPARAM2 op_30b8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6726,9 +5698,7 @@ unsigned long REGPARAM2 op_30b9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -6740,9 +5710,7 @@ unsigned long REGPARAM2 op_30ba_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6754,9 +5722,7 @@ unsigned long REGPARAM2 op_30bb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6766,9 +5732,7 @@ unsigned long REGPARAM2 op_30bc_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -6780,9 +5744,7 @@ unsigned long REGPARAM2 op_30c0_3(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -6794,9 +5756,7 @@ unsigned long REGPARAM2 op_30c8_3(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -6809,9 +5769,7 @@ unsigned long REGPARAM2 op_30d0_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -6825,9 +5783,7 @@ unsigned long REGPARAM2 op_30d8_3(uae_u32 opcode) /* MOVE */
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -6842,9 +5798,7 @@ unsigned long REGPARAM2 op_30e0_3(uae_u32 opcode) /* MOVE */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -6857,9 +5811,7 @@ unsigned long REGPARAM2 op_30e8_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6872,9 +5824,7 @@ unsigned long REGPARAM2 op_30f0_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6886,9 +5836,7 @@ unsigned long REGPARAM2 op_30f8_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6900,9 +5848,7 @@ unsigned long REGPARAM2 op_30f9_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -6915,9 +5861,7 @@ unsigned long REGPARAM2 op_30fa_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6930,9 +5874,7 @@ unsigned long REGPARAM2 op_30fb_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -6943,9 +5885,7 @@ unsigned long REGPARAM2 op_30fc_3(uae_u32 opcode) /* MOVE */
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -6958,9 +5898,7 @@ unsigned long REGPARAM2 op_3100_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -6973,9 +5911,7 @@ unsigned long REGPARAM2 op_3108_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(2);
 return 4;
@@ -6989,9 +5925,7 @@ unsigned long REGPARAM2 op_3110_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -7006,9 +5940,7 @@ unsigned long REGPARAM2 op_3118_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -7024,9 +5956,7 @@ unsigned long REGPARAM2 op_3120_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -7040,9 +5970,7 @@ unsigned long REGPARAM2 op_3128_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7056,9 +5984,7 @@ unsigned long REGPARAM2 op_3130_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7071,9 +5997,7 @@ unsigned long REGPARAM2 op_3138_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7086,9 +6010,7 @@ unsigned long REGPARAM2 op_3139_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7102,9 +6024,7 @@ unsigned long REGPARAM2 op_313a_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7118,9 +6038,7 @@ unsigned long REGPARAM2 op_313b_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7132,9 +6050,7 @@ unsigned long REGPARAM2 op_313c_3(uae_u32 opcode) /* MOVE */
 {	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -7145,9 +6061,7 @@ unsigned long REGPARAM2 op_3140_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -7158,9 +6072,7 @@ unsigned long REGPARAM2 op_3148_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -7172,9 +6084,7 @@ unsigned long REGPARAM2 op_3150_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7187,9 +6097,7 @@ unsigned long REGPARAM2 op_3158_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7203,9 +6111,7 @@ unsigned long REGPARAM2 op_3160_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7217,9 +6123,7 @@ unsigned long REGPARAM2 op_3168_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7231,9 +6135,7 @@ unsigned long REGPARAM2 op_3170_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7244,9 +6146,7 @@ unsigned long REGPARAM2 op_3178_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7257,9 +6157,7 @@ unsigned long REGPARAM2 op_3179_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7271,9 +6169,7 @@ unsigned long REGPARAM2 op_317a_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7285,9 +6181,7 @@ unsigned long REGPARAM2 op_317b_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7297,9 +6191,7 @@ unsigned long REGPARAM2 op_317c_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -7310,9 +6202,7 @@ unsigned long REGPARAM2 op_3180_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -7323,9 +6213,7 @@ unsigned long REGPARAM2 op_3188_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -7337,9 +6225,7 @@ unsigned long REGPARAM2 op_3190_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7352,9 +6238,7 @@ unsigned long REGPARAM2 op_3198_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7368,9 +6252,7 @@ unsigned long REGPARAM2 op_31a0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7382,9 +6264,7 @@ unsigned long REGPARAM2 op_31a8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7396,9 +6276,7 @@ unsigned long REGPARAM2 op_31b0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7409,9 +6287,7 @@ unsigned long REGPARAM2 op_31b8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7422,9 +6298,7 @@ unsigned long REGPARAM2 op_31b9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7436,9 +6310,7 @@ unsigned long REGPARAM2 op_31ba_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7450,9 +6322,7 @@ unsigned long REGPARAM2 op_31bb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7462,9 +6332,7 @@ unsigned long REGPARAM2 op_31bc_3(uae_u32 opcode) /* MOVE */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -7474,9 +6342,7 @@ unsigned long REGPARAM2 op_31c0_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -7486,9 +6352,7 @@ unsigned long REGPARAM2 op_31c8_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(4);
 return 6;
@@ -7499,9 +6363,7 @@ unsigned long REGPARAM2 op_31d0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7513,9 +6375,7 @@ unsigned long REGPARAM2 op_31d8_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7528,9 +6388,7 @@ unsigned long REGPARAM2 op_31e0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -7541,9 +6399,7 @@ unsigned long REGPARAM2 op_31e8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7554,9 +6410,7 @@ unsigned long REGPARAM2 op_31f0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7566,9 +6420,7 @@ unsigned long REGPARAM2 op_31f8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7578,9 +6430,7 @@ unsigned long REGPARAM2 op_31f9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7591,9 +6441,7 @@ unsigned long REGPARAM2 op_31fa_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7604,9 +6452,7 @@ unsigned long REGPARAM2 op_31fb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7615,9 +6461,7 @@ unsigned long REGPARAM2 op_31fc_3(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -7627,9 +6471,7 @@ unsigned long REGPARAM2 op_33c0_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -7639,9 +6481,7 @@ unsigned long REGPARAM2 op_33c8_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(6);
 return 8;
@@ -7652,9 +6492,7 @@ unsigned long REGPARAM2 op_33d0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7666,9 +6504,7 @@ unsigned long REGPARAM2 op_33d8_3(uae_u32 opcode) /* MOVE */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7681,9 +6517,7 @@ unsigned long REGPARAM2 op_33e0_3(uae_u32 opcode) /* MOVE */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uaecptr dsta = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -7694,9 +6528,7 @@ unsigned long REGPARAM2 op_33e8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7707,9 +6539,7 @@ unsigned long REGPARAM2 op_33f0_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7719,9 +6549,7 @@ unsigned long REGPARAM2 op_33f8_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7731,9 +6559,7 @@ unsigned long REGPARAM2 op_33f9_3(uae_u32 opcode) /* MOVE */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(6);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(10);
 return 14;
@@ -7744,9 +6570,7 @@ unsigned long REGPARAM2 op_33fa_3(uae_u32 opcode) /* MOVE */
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7757,9 +6581,7 @@ unsigned long REGPARAM2 op_33fb_3(uae_u32 opcode) /* MOVE */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(8);
 return 12;
@@ -7768,9 +6590,7 @@ unsigned long REGPARAM2 op_33fc_3(uae_u32 opcode) /* MOVE */
 {
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}m68k_incpc(8);
 return 10;
@@ -8678,9 +7498,7 @@ return 4;
 unsigned long REGPARAM2 op_4200_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+{{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((0) & 0xff);
 }}m68k_incpc(2);
 return 2;
@@ -8689,9 +7507,7 @@ unsigned long REGPARAM2 op_4210_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
 	put_byte(srca,0);
 }}m68k_incpc(2);
 return 4;
@@ -8701,9 +7517,7 @@ unsigned long REGPARAM2 op_4218_3(uae_u32 opcode) /* CLR */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
 	put_byte(srca,0);
 }}m68k_incpc(2);
 return 4;
@@ -8714,9 +7528,7 @@ unsigned long REGPARAM2 op_4220_3(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
 	put_byte(srca,0);
 }}m68k_incpc(2);
 return 4;
@@ -8725,9 +7537,7 @@ unsigned long REGPARAM2 op_4228_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
 	put_byte(srca,0);
 }}m68k_incpc(4);
 return 6;
@@ -8736,9 +7546,7 @@ unsigned long REGPARAM2 op_4230_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
 	put_byte(srca,0);
 }}m68k_incpc(4);
 return 6;
@@ -8746,9 +7554,7 @@ return 6;
 unsigned long REGPARAM2 op_4238_3(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
 	put_byte(srca,0);
 }}m68k_incpc(4);
 return 6;
@@ -8756,9 +7562,7 @@ return 6;
 unsigned long REGPARAM2 op_4239_3(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
 	put_byte(srca,0);
 }}m68k_incpc(6);
 return 8;
@@ -8766,9 +7570,7 @@ return 8;
 unsigned long REGPARAM2 op_4240_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+{{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((0) & 0xffff);
 }}m68k_incpc(2);
 return 2;
@@ -8777,9 +7579,7 @@ unsigned long REGPARAM2 op_4250_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
 	put_word(srca,0);
 }}m68k_incpc(2);
 return 4;
@@ -8789,9 +7589,7 @@ unsigned long REGPARAM2 op_4258_3(uae_u32 opcode) /* CLR */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
 	put_word(srca,0);
 }}m68k_incpc(2);
 return 4;
@@ -8802,9 +7600,7 @@ unsigned long REGPARAM2 op_4260_3(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
 	put_word(srca,0);
 }}m68k_incpc(2);
 return 4;
@@ -8813,9 +7609,7 @@ unsigned long REGPARAM2 op_4268_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
 	put_word(srca,0);
 }}m68k_incpc(4);
 return 6;
@@ -8827,9 +7621,7 @@ unsigned long REGPARAM2 op_4270_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
 	put_word(srca,0);
 }}m68k_incpc(4);
 return 6;
@@ -8837,9 +7629,7 @@ return 6;
 unsigned long REGPARAM2 op_4278_3(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
 	put_word(srca,0);
 }}m68k_incpc(4);
 return 6;
@@ -8847,9 +7637,7 @@ return 6;
 unsigned long REGPARAM2 op_4279_3(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
 	put_word(srca,0);
 }}m68k_incpc(6);
 return 8;
@@ -8857,9 +7645,7 @@ return 8;
 unsigned long REGPARAM2 op_4280_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+{{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
 	m68k_dreg(regs, srcreg) = (0);
 }}m68k_incpc(2);
 return 2;
@@ -8868,9 +7654,7 @@ unsigned long REGPARAM2 op_4290_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
 	put_long(srca,0);
 }}m68k_incpc(2);
 return 6;
@@ -8880,9 +7664,7 @@ unsigned long REGPARAM2 op_4298_3(uae_u32 opcode) /* CLR */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
 	put_long(srca,0);
 }}m68k_incpc(2);
 return 6;
@@ -8893,9 +7675,7 @@ unsigned long REGPARAM2 op_42a0_3(uae_u32 opcode) /* CLR */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
 	put_long(srca,0);
 }}m68k_incpc(2);
 return 6;
@@ -8904,9 +7684,7 @@ unsigned long REGPARAM2 op_42a8_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
 	put_long(srca,0);
 }}m68k_incpc(4);
 return 8;
@@ -8915,9 +7693,7 @@ unsigned long REGPARAM2 op_42b0_3(uae_u32 opcode) /* CLR */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
 	put_long(srca,0);
 }}m68k_incpc(4);
 return 8;
@@ -8925,9 +7701,7 @@ return 8;
 unsigned long REGPARAM2 op_42b8_3(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
 	put_long(srca,0);
 }}m68k_incpc(4);
 return 8;
@@ -8935,9 +7709,7 @@ return 8;
 unsigned long REGPARAM2 op_42b9_3(uae_u32 opcode) /* CLR */
 {
 {{	uaecptr srca = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
 	put_long(srca,0);
 }}m68k_incpc(6);
 return 10;
@@ -8947,16 +7719,9 @@ unsigned long REGPARAM2 op_4400_3(uae_u32 opcode) /* NEG */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_4410_3(uae_u32 opcode) /* NEG */
@@ -8965,16 +7730,9 @@ unsigned long REGPARAM2 op_4410_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_4418_3(uae_u32 opcode) /* NEG */
@@ -8984,16 +7742,9 @@ unsigned long REGPARAM2 op_4418_3(uae_u32 opcode) /* NEG */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_4420_3(uae_u32 opcode) /* NEG */
@@ -9004,16 +7755,9 @@ unsigned long REGPARAM2 op_4420_3(uae_u32 opcode) /* NEG */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_4428_3(uae_u32 opcode) /* NEG */
@@ -9022,16 +7766,9 @@ unsigned long REGPARAM2 op_4428_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_4430_3(uae_u32 opcode) /* NEG */
@@ -9040,16 +7777,9 @@ unsigned long REGPARAM2 op_4430_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_4438_3(uae_u32 opcode) /* NEG */
@@ -9057,16 +7787,9 @@ unsigned long REGPARAM2 op_4438_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_4439_3(uae_u32 opcode) /* NEG */
@@ -9074,16 +7797,9 @@ unsigned long REGPARAM2 op_4439_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
 	put_byte(srca,dst);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_4440_3(uae_u32 opcode) /* NEG */
@@ -9091,16 +7807,9 @@ unsigned long REGPARAM2 op_4440_3(uae_u32 opcode) /* NEG */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_4450_3(uae_u32 opcode) /* NEG */
@@ -9109,16 +7818,9 @@ unsigned long REGPARAM2 op_4450_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_4458_3(uae_u32 opcode) /* NEG */
@@ -9128,16 +7830,9 @@ unsigned long REGPARAM2 op_4458_3(uae_u32 opcode) /* NEG */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_4460_3(uae_u32 opcode) /* NEG */
@@ -9148,16 +7843,9 @@ unsigned long REGPARAM2 op_4460_3(uae_u32 opcode) /* NEG */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_4468_3(uae_u32 opcode) /* NEG */
@@ -9166,16 +7854,9 @@ unsigned long REGPARAM2 op_4468_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_4470_3(uae_u32 opcode) /* NEG */
@@ -9184,16 +7865,9 @@ unsigned long REGPARAM2 op_4470_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_4478_3(uae_u32 opcode) /* NEG */
@@ -9201,16 +7875,9 @@ unsigned long REGPARAM2 op_4478_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_4479_3(uae_u32 opcode) /* NEG */
@@ -9218,16 +7885,9 @@ unsigned long REGPARAM2 op_4479_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
 	put_word(srca,dst);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_4480_3(uae_u32 opcode) /* NEG */
@@ -9235,16 +7895,9 @@ unsigned long REGPARAM2 op_4480_3(uae_u32 opcode) /* NEG */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
 	m68k_dreg(regs, srcreg) = (dst);
-}}}}}m68k_incpc(2);
+}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_4490_3(uae_u32 opcode) /* NEG */
@@ -9253,16 +7906,9 @@ unsigned long REGPARAM2 op_4490_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_4498_3(uae_u32 opcode) /* NEG */
@@ -9272,16 +7918,9 @@ unsigned long REGPARAM2 op_4498_3(uae_u32 opcode) /* NEG */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_44a0_3(uae_u32 opcode) /* NEG */
@@ -9292,16 +7931,9 @@ unsigned long REGPARAM2 op_44a0_3(uae_u32 opcode) /* NEG */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_44a8_3(uae_u32 opcode) /* NEG */
@@ -9310,16 +7942,9 @@ unsigned long REGPARAM2 op_44a8_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_44b0_3(uae_u32 opcode) /* NEG */
@@ -9328,16 +7953,9 @@ unsigned long REGPARAM2 op_44b0_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_44b8_3(uae_u32 opcode) /* NEG */
@@ -9345,16 +7963,9 @@ unsigned long REGPARAM2 op_44b8_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_44b9_3(uae_u32 opcode) /* NEG */
@@ -9362,16 +7973,9 @@ unsigned long REGPARAM2 op_44b9_3(uae_u32 opcode) /* NEG */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
 	put_long(srca,dst);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_44c0_3(uae_u32 opcode) /* MV2SR */
@@ -9509,9 +8113,7 @@ unsigned long REGPARAM2 op_4600_3(uae_u32 opcode) /* NOT */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
 }}}m68k_incpc(2);
 return 2;
@@ -9522,9 +8124,7 @@ unsigned long REGPARAM2 op_4610_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 return 6;
@@ -9536,9 +8136,7 @@ unsigned long REGPARAM2 op_4618_3(uae_u32 opcode) /* NOT */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 return 6;
@@ -9551,9 +8149,7 @@ unsigned long REGPARAM2 op_4620_3(uae_u32 opcode) /* NOT */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(2);
 return 6;
@@ -9564,9 +8160,7 @@ unsigned long REGPARAM2 op_4628_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 return 8;
@@ -9577,9 +8171,7 @@ unsigned long REGPARAM2 op_4630_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 return 8;
@@ -9589,9 +8181,7 @@ unsigned long REGPARAM2 op_4638_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(4);
 return 8;
@@ -9601,9 +8191,7 @@ unsigned long REGPARAM2 op_4639_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
 	put_byte(srca,dst);
 }}}}m68k_incpc(6);
 return 10;
@@ -9613,9 +8201,7 @@ unsigned long REGPARAM2 op_4640_3(uae_u32 opcode) /* NOT */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 return 2;
@@ -9626,9 +8212,7 @@ unsigned long REGPARAM2 op_4650_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 return 6;
@@ -9640,9 +8224,7 @@ unsigned long REGPARAM2 op_4658_3(uae_u32 opcode) /* NOT */
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 return 6;
@@ -9655,9 +8237,7 @@ unsigned long REGPARAM2 op_4660_3(uae_u32 opcode) /* NOT */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(2);
 return 6;
@@ -9668,9 +8248,7 @@ unsigned long REGPARAM2 op_4668_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 return 8;
@@ -9681,9 +8259,7 @@ unsigned long REGPARAM2 op_4670_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 return 8;
@@ -9693,9 +8269,7 @@ unsigned long REGPARAM2 op_4678_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(4);
 return 8;
@@ -9705,9 +8279,7 @@ unsigned long REGPARAM2 op_4679_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
 	put_word(srca,dst);
 }}}}m68k_incpc(6);
 return 10;
@@ -9717,9 +8289,7 @@ unsigned long REGPARAM2 op_4680_3(uae_u32 opcode) /* NOT */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 return 2;
@@ -9730,9 +8300,7 @@ unsigned long REGPARAM2 op_4690_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 return 10;
@@ -9744,9 +8312,7 @@ unsigned long REGPARAM2 op_4698_3(uae_u32 opcode) /* NOT */
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 return 10;
@@ -9759,9 +8325,7 @@ unsigned long REGPARAM2 op_46a0_3(uae_u32 opcode) /* NOT */
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(2);
 return 10;
@@ -9772,9 +8336,7 @@ unsigned long REGPARAM2 op_46a8_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 return 12;
@@ -9785,9 +8347,7 @@ unsigned long REGPARAM2 op_46b0_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 return 12;
@@ -9797,9 +8357,7 @@ unsigned long REGPARAM2 op_46b8_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(4);
 return 12;
@@ -9809,9 +8367,7 @@ unsigned long REGPARAM2 op_46b9_3(uae_u32 opcode) /* NOT */
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
 {	uae_u32 dst = ~src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
 	put_long(srca,dst);
 }}}}m68k_incpc(6);
 return 14;
@@ -10103,9 +8659,7 @@ unsigned long REGPARAM2 op_4840_3(uae_u32 opcode) /* SWAP */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 return 2;
@@ -10190,9 +8744,7 @@ unsigned long REGPARAM2 op_4880_3(uae_u32 opcode) /* EXT */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u16 dst = (uae_s16)(uae_s8)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
 }}}m68k_incpc(2);
 return 2;
@@ -10214,7 +8766,7 @@ unsigned long REGPARAM2 op_48a0_3(uae_u32 opcode) /* MVMLE */
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = m68k_areg(regs, dstreg) - 0;
 {	uae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;
-	m68k_areg(regs, dstreg) -= 16*2;
+	m68k_areg (regs, dstreg) -= 16 * 2;
 	while (amask) { srca -= 2; put_word(srca, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
 	while (dmask) { srca -= 2; put_word(srca, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
 	m68k_areg(regs, dstreg) = srca;
@@ -10269,9 +8821,7 @@ unsigned long REGPARAM2 op_48c0_3(uae_u32 opcode) /* EXT */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 return 2;
@@ -10293,7 +8843,7 @@ unsigned long REGPARAM2 op_48e0_3(uae_u32 opcode) /* MVMLE */
 {	uae_u16 mask = get_iword(2);
 {	uaecptr srca = m68k_areg(regs, dstreg) - 0;
 {	uae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;
-	m68k_areg(regs, dstreg) -= 16*4;
+	m68k_areg (regs, dstreg) -= 16 * 4;
 	while (amask) { srca -= 4; put_long(srca, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
 	while (dmask) { srca -= 4; put_long(srca, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
 	m68k_areg(regs, dstreg) = srca;
@@ -10348,9 +8898,7 @@ unsigned long REGPARAM2 op_49c0_3(uae_u32 opcode) /* EXT */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_u32 dst = (uae_s32)(uae_s8)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
 	m68k_dreg(regs, srcreg) = (dst);
 }}}m68k_incpc(2);
 return 2;
@@ -10359,9 +8907,7 @@ unsigned long REGPARAM2 op_4a00_3(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 }}m68k_incpc(2);
 return 2;
 }
@@ -10370,9 +8916,7 @@ unsigned long REGPARAM2 op_4a10_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 }}}m68k_incpc(2);
 return 4;
 }
@@ -10382,9 +8926,7 @@ unsigned long REGPARAM2 op_4a18_3(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 }}}m68k_incpc(2);
 return 4;
 }
@@ -10395,9 +8937,7 @@ unsigned long REGPARAM2 op_4a20_3(uae_u32 opcode) /* TST */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 }}}m68k_incpc(2);
 return 4;
 }
@@ -10406,9 +8946,7 @@ unsigned long REGPARAM2 op_4a28_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10417,9 +8955,7 @@ unsigned long REGPARAM2 op_4a30_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10427,9 +8963,7 @@ unsigned long REGPARAM2 op_4a38_3(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10437,9 +8971,7 @@ unsigned long REGPARAM2 op_4a39_3(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 }}}m68k_incpc(6);
 return 8;
 }
@@ -10448,9 +8980,7 @@ unsigned long REGPARAM2 op_4a3a_3(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10459,18 +8989,14 @@ unsigned long REGPARAM2 op_4a3b_3(uae_u32 opcode) /* TST */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 }}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_4a3c_3(uae_u32 opcode) /* TST */
 {
 {{	uae_s8 src = get_ibyte(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 }}m68k_incpc(4);
 return 4;
 }
@@ -10478,9 +9004,7 @@ unsigned long REGPARAM2 op_4a40_3(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 }}m68k_incpc(2);
 return 2;
 }
@@ -10488,9 +9012,7 @@ unsigned long REGPARAM2 op_4a48_3(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 }}m68k_incpc(2);
 return 2;
 }
@@ -10499,9 +9021,7 @@ unsigned long REGPARAM2 op_4a50_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 }}}m68k_incpc(2);
 return 4;
 }
@@ -10511,9 +9031,7 @@ unsigned long REGPARAM2 op_4a58_3(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s16 src = get_word(srca);
 	m68k_areg(regs, srcreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 }}}m68k_incpc(2);
 return 4;
 }
@@ -10524,9 +9042,7 @@ unsigned long REGPARAM2 op_4a60_3(uae_u32 opcode) /* TST */
 {	uae_s16 src = get_word(srca);
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 }}}m68k_incpc(2);
 return 4;
 }
@@ -10535,9 +9051,7 @@ unsigned long REGPARAM2 op_4a68_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10546,9 +9060,7 @@ unsigned long REGPARAM2 op_4a70_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10556,9 +9068,7 @@ unsigned long REGPARAM2 op_4a78_3(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10566,9 +9076,7 @@ unsigned long REGPARAM2 op_4a79_3(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 }}}m68k_incpc(6);
 return 8;
 }
@@ -10577,9 +9085,7 @@ unsigned long REGPARAM2 op_4a7a_3(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 }}}m68k_incpc(4);
 return 6;
 }
@@ -10588,18 +9094,14 @@ unsigned long REGPARAM2 op_4a7b_3(uae_u32 opcode) /* TST */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 }}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_4a7c_3(uae_u32 opcode) /* TST */
 {
 {{	uae_s16 src = get_iword(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 }}m68k_incpc(4);
 return 4;
 }
@@ -10607,9 +9109,7 @@ unsigned long REGPARAM2 op_4a80_3(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 }}m68k_incpc(2);
 return 2;
 }
@@ -10617,9 +9117,7 @@ unsigned long REGPARAM2 op_4a88_3(uae_u32 opcode) /* TST */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s32 src = m68k_areg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 }}m68k_incpc(2);
 return 2;
 }
@@ -10628,9 +9126,7 @@ unsigned long REGPARAM2 op_4a90_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 }}}m68k_incpc(2);
 return 6;
 }
@@ -10640,9 +9136,7 @@ unsigned long REGPARAM2 op_4a98_3(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
 	m68k_areg(regs, srcreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 }}}m68k_incpc(2);
 return 6;
 }
@@ -10653,9 +9147,7 @@ unsigned long REGPARAM2 op_4aa0_3(uae_u32 opcode) /* TST */
 {	uae_s32 src = get_long(srca);
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 }}}m68k_incpc(2);
 return 6;
 }
@@ -10664,9 +9156,7 @@ unsigned long REGPARAM2 op_4aa8_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 }}}m68k_incpc(4);
 return 8;
 }
@@ -10675,9 +9165,7 @@ unsigned long REGPARAM2 op_4ab0_3(uae_u32 opcode) /* TST */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 }}}m68k_incpc(4);
 return 8;
 }
@@ -10685,9 +9173,7 @@ unsigned long REGPARAM2 op_4ab8_3(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 }}}m68k_incpc(4);
 return 8;
 }
@@ -10695,9 +9181,7 @@ unsigned long REGPARAM2 op_4ab9_3(uae_u32 opcode) /* TST */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 }}}m68k_incpc(6);
 return 10;
 }
@@ -10706,9 +9190,7 @@ unsigned long REGPARAM2 op_4aba_3(uae_u32 opcode) /* TST */
 {{	uaecptr srca = m68k_getpc () + 2;
 	srca += (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 }}}m68k_incpc(4);
 return 8;
 }
@@ -10717,18 +9199,14 @@ unsigned long REGPARAM2 op_4abb_3(uae_u32 opcode) /* TST */
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 }}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_4abc_3(uae_u32 opcode) /* TST */
 {
 {{	uae_s32 src = get_ilong(2);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 }}m68k_incpc(6);
 return 6;
 }
@@ -10736,9 +9214,7 @@ unsigned long REGPARAM2 op_4ac0_3(uae_u32 opcode) /* TAS */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	src |= 0x80;
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((src) & 0xff);
 }}m68k_incpc(2);
@@ -10749,9 +9225,7 @@ unsigned long REGPARAM2 op_4ad0_3(uae_u32 opcode) /* TAS */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -10763,9 +9237,7 @@ unsigned long REGPARAM2 op_4ad8_3(uae_u32 opcode) /* TAS */
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -10778,9 +9250,7 @@ unsigned long REGPARAM2 op_4ae0_3(uae_u32 opcode) /* TAS */
 {	uae_s8 src = get_byte(srca);
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(2);
@@ -10791,9 +9261,7 @@ unsigned long REGPARAM2 op_4ae8_3(uae_u32 opcode) /* TAS */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -10804,9 +9272,7 @@ unsigned long REGPARAM2 op_4af0_3(uae_u32 opcode) /* TAS */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -10816,9 +9282,7 @@ unsigned long REGPARAM2 op_4af8_3(uae_u32 opcode) /* TAS */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(4);
@@ -10828,9 +9292,7 @@ unsigned long REGPARAM2 op_4af9_3(uae_u32 opcode) /* TAS */
 {
 {{	uaecptr srca = get_ilong(2);
 {	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	src |= 0x80;
 	put_byte(srca,src);
 }}}m68k_incpc(6);
@@ -11118,6 +9580,7 @@ unsigned long REGPARAM2 op_4e74_3(uae_u32 opcode) /* RTD */
 	m68k_areg(regs, 7) += 4;
 {	uae_s16 offs = get_iword(2);
 	m68k_areg(regs, 7) += offs;
+	CHECK_STACK_POINTER_INCREMENT ();
 	m68k_setpc_rte(pc);
 }}}}return 8;
 }
@@ -11253,16 +9716,9 @@ unsigned long REGPARAM2 op_5000_3(uae_u32 opcode) /* ADD */
 {{	uae_u32 src = srcreg;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_5010_3(uae_u32 opcode) /* ADD */
@@ -11273,16 +9729,9 @@ unsigned long REGPARAM2 op_5010_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5018_3(uae_u32 opcode) /* ADD */
@@ -11294,16 +9743,9 @@ unsigned long REGPARAM2 op_5018_3(uae_u32 opcode) /* ADD */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5020_3(uae_u32 opcode) /* ADD */
@@ -11316,16 +9758,9 @@ unsigned long REGPARAM2 op_5020_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5028_3(uae_u32 opcode) /* ADD */
@@ -11336,16 +9771,9 @@ unsigned long REGPARAM2 op_5028_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5030_3(uae_u32 opcode) /* ADD */
@@ -11356,16 +9784,9 @@ unsigned long REGPARAM2 op_5030_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5038_3(uae_u32 opcode) /* ADD */
@@ -11375,16 +9796,9 @@ unsigned long REGPARAM2 op_5038_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5039_3(uae_u32 opcode) /* ADD */
@@ -11394,16 +9808,9 @@ unsigned long REGPARAM2 op_5039_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_5040_3(uae_u32 opcode) /* ADD */
@@ -11413,16 +9820,9 @@ unsigned long REGPARAM2 op_5040_3(uae_u32 opcode) /* ADD */
 {{	uae_u32 src = srcreg;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_5048_3(uae_u32 opcode) /* ADDA */
@@ -11445,16 +9845,9 @@ unsigned long REGPARAM2 op_5050_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5058_3(uae_u32 opcode) /* ADD */
@@ -11466,16 +9859,9 @@ unsigned long REGPARAM2 op_5058_3(uae_u32 opcode) /* ADD */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5060_3(uae_u32 opcode) /* ADD */
@@ -11488,16 +9874,9 @@ unsigned long REGPARAM2 op_5060_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5068_3(uae_u32 opcode) /* ADD */
@@ -11508,16 +9887,9 @@ unsigned long REGPARAM2 op_5068_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5070_3(uae_u32 opcode) /* ADD */
@@ -11528,16 +9900,9 @@ unsigned long REGPARAM2 op_5070_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5078_3(uae_u32 opcode) /* ADD */
@@ -11547,16 +9912,9 @@ unsigned long REGPARAM2 op_5078_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5079_3(uae_u32 opcode) /* ADD */
@@ -11566,16 +9924,9 @@ unsigned long REGPARAM2 op_5079_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_5080_3(uae_u32 opcode) /* ADD */
@@ -11585,16 +9936,9 @@ unsigned long REGPARAM2 op_5080_3(uae_u32 opcode) /* ADD */
 {{	uae_u32 src = srcreg;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_5088_3(uae_u32 opcode) /* ADDA */
@@ -11617,16 +9961,9 @@ unsigned long REGPARAM2 op_5090_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_5098_3(uae_u32 opcode) /* ADD */
@@ -11638,16 +9975,9 @@ unsigned long REGPARAM2 op_5098_3(uae_u32 opcode) /* ADD */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_50a0_3(uae_u32 opcode) /* ADD */
@@ -11660,16 +9990,9 @@ unsigned long REGPARAM2 op_50a0_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_50a8_3(uae_u32 opcode) /* ADD */
@@ -11680,16 +10003,9 @@ unsigned long REGPARAM2 op_50a8_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_50b0_3(uae_u32 opcode) /* ADD */
@@ -11700,16 +10016,9 @@ unsigned long REGPARAM2 op_50b0_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_50b8_3(uae_u32 opcode) /* ADD */
@@ -11719,16 +10028,9 @@ unsigned long REGPARAM2 op_50b8_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_50b9_3(uae_u32 opcode) /* ADD */
@@ -11738,22 +10040,15 @@ unsigned long REGPARAM2 op_50b9_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_50c0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(0) ? 0xff : 0;
+{{{	int val = lazy_cctrue(0) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -11767,7 +10062,7 @@ unsigned long REGPARAM2 op_50c8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(0)) {
+	if (!lazy_cctrue(0)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -11786,7 +10081,7 @@ unsigned long REGPARAM2 op_50d0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(0) ? 0xff : 0;
+{	int val = lazy_cctrue(0) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -11796,7 +10091,7 @@ unsigned long REGPARAM2 op_50d8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(0) ? 0xff : 0;
+{	int val = lazy_cctrue(0) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -11807,7 +10102,7 @@ unsigned long REGPARAM2 op_50e0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(0) ? 0xff : 0;
+{	int val = lazy_cctrue(0) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -11816,7 +10111,7 @@ unsigned long REGPARAM2 op_50e8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(0) ? 0xff : 0;
+{	int val = lazy_cctrue(0) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -11825,7 +10120,7 @@ unsigned long REGPARAM2 op_50f0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(0) ? 0xff : 0;
+{	int val = lazy_cctrue(0) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -11833,7 +10128,7 @@ return 6;
 unsigned long REGPARAM2 op_50f8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(0) ? 0xff : 0;
+{	int val = lazy_cctrue(0) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -11841,7 +10136,7 @@ return 6;
 unsigned long REGPARAM2 op_50f9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(0) ? 0xff : 0;
+{	int val = lazy_cctrue(0) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -11853,16 +10148,9 @@ unsigned long REGPARAM2 op_5100_3(uae_u32 opcode) /* SUB */
 {{	uae_u32 src = srcreg;
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_5110_3(uae_u32 opcode) /* SUB */
@@ -11873,16 +10161,9 @@ unsigned long REGPARAM2 op_5110_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5118_3(uae_u32 opcode) /* SUB */
@@ -11894,16 +10175,9 @@ unsigned long REGPARAM2 op_5118_3(uae_u32 opcode) /* SUB */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5120_3(uae_u32 opcode) /* SUB */
@@ -11916,16 +10190,9 @@ unsigned long REGPARAM2 op_5120_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5128_3(uae_u32 opcode) /* SUB */
@@ -11936,16 +10203,9 @@ unsigned long REGPARAM2 op_5128_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5130_3(uae_u32 opcode) /* SUB */
@@ -11956,16 +10216,9 @@ unsigned long REGPARAM2 op_5130_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5138_3(uae_u32 opcode) /* SUB */
@@ -11975,16 +10228,9 @@ unsigned long REGPARAM2 op_5138_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5139_3(uae_u32 opcode) /* SUB */
@@ -11994,16 +10240,9 @@ unsigned long REGPARAM2 op_5139_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_5140_3(uae_u32 opcode) /* SUB */
@@ -12013,16 +10252,9 @@ unsigned long REGPARAM2 op_5140_3(uae_u32 opcode) /* SUB */
 {{	uae_u32 src = srcreg;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_5148_3(uae_u32 opcode) /* SUBA */
@@ -12045,16 +10277,9 @@ unsigned long REGPARAM2 op_5150_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5158_3(uae_u32 opcode) /* SUB */
@@ -12066,16 +10291,9 @@ unsigned long REGPARAM2 op_5158_3(uae_u32 opcode) /* SUB */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5160_3(uae_u32 opcode) /* SUB */
@@ -12088,16 +10306,9 @@ unsigned long REGPARAM2 op_5160_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_5168_3(uae_u32 opcode) /* SUB */
@@ -12108,16 +10319,9 @@ unsigned long REGPARAM2 op_5168_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5170_3(uae_u32 opcode) /* SUB */
@@ -12128,16 +10332,9 @@ unsigned long REGPARAM2 op_5170_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5178_3(uae_u32 opcode) /* SUB */
@@ -12147,16 +10344,9 @@ unsigned long REGPARAM2 op_5178_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_5179_3(uae_u32 opcode) /* SUB */
@@ -12166,16 +10356,9 @@ unsigned long REGPARAM2 op_5179_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_5180_3(uae_u32 opcode) /* SUB */
@@ -12185,16 +10368,9 @@ unsigned long REGPARAM2 op_5180_3(uae_u32 opcode) /* SUB */
 {{	uae_u32 src = srcreg;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_5188_3(uae_u32 opcode) /* SUBA */
@@ -12217,16 +10393,9 @@ unsigned long REGPARAM2 op_5190_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_5198_3(uae_u32 opcode) /* SUB */
@@ -12238,16 +10407,9 @@ unsigned long REGPARAM2 op_5198_3(uae_u32 opcode) /* SUB */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_51a0_3(uae_u32 opcode) /* SUB */
@@ -12260,16 +10422,9 @@ unsigned long REGPARAM2 op_51a0_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_51a8_3(uae_u32 opcode) /* SUB */
@@ -12280,16 +10435,9 @@ unsigned long REGPARAM2 op_51a8_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_51b0_3(uae_u32 opcode) /* SUB */
@@ -12300,16 +10448,9 @@ unsigned long REGPARAM2 op_51b0_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_51b8_3(uae_u32 opcode) /* SUB */
@@ -12319,16 +10460,9 @@ unsigned long REGPARAM2 op_51b8_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_51b9_3(uae_u32 opcode) /* SUB */
@@ -12338,22 +10472,15 @@ unsigned long REGPARAM2 op_51b9_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_51c0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(1) ? 0xff : 0;
+{{{	int val = lazy_cctrue(1) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -12367,7 +10494,7 @@ unsigned long REGPARAM2 op_51c8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(1)) {
+	if (!lazy_cctrue(1)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -12386,7 +10513,7 @@ unsigned long REGPARAM2 op_51d0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(1) ? 0xff : 0;
+{	int val = lazy_cctrue(1) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12396,7 +10523,7 @@ unsigned long REGPARAM2 op_51d8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(1) ? 0xff : 0;
+{	int val = lazy_cctrue(1) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12407,7 +10534,7 @@ unsigned long REGPARAM2 op_51e0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(1) ? 0xff : 0;
+{	int val = lazy_cctrue(1) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12416,7 +10543,7 @@ unsigned long REGPARAM2 op_51e8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(1) ? 0xff : 0;
+{	int val = lazy_cctrue(1) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12425,7 +10552,7 @@ unsigned long REGPARAM2 op_51f0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(1) ? 0xff : 0;
+{	int val = lazy_cctrue(1) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12433,7 +10560,7 @@ return 6;
 unsigned long REGPARAM2 op_51f8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(1) ? 0xff : 0;
+{	int val = lazy_cctrue(1) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12441,7 +10568,7 @@ return 6;
 unsigned long REGPARAM2 op_51f9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(1) ? 0xff : 0;
+{	int val = lazy_cctrue(1) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -12449,7 +10576,7 @@ return 8;
 unsigned long REGPARAM2 op_52c0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(2) ? 0xff : 0;
+{{{	int val = lazy_cctrue(2) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -12463,7 +10590,7 @@ unsigned long REGPARAM2 op_52c8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(2)) {
+	if (!lazy_cctrue(2)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -12482,7 +10609,7 @@ unsigned long REGPARAM2 op_52d0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(2) ? 0xff : 0;
+{	int val = lazy_cctrue(2) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12492,7 +10619,7 @@ unsigned long REGPARAM2 op_52d8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(2) ? 0xff : 0;
+{	int val = lazy_cctrue(2) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12503,7 +10630,7 @@ unsigned long REGPARAM2 op_52e0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(2) ? 0xff : 0;
+{	int val = lazy_cctrue(2) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12512,7 +10639,7 @@ unsigned long REGPARAM2 op_52e8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(2) ? 0xff : 0;
+{	int val = lazy_cctrue(2) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12521,7 +10648,7 @@ unsigned long REGPARAM2 op_52f0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(2) ? 0xff : 0;
+{	int val = lazy_cctrue(2) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12529,7 +10656,7 @@ return 6;
 unsigned long REGPARAM2 op_52f8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(2) ? 0xff : 0;
+{	int val = lazy_cctrue(2) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12537,7 +10664,7 @@ return 6;
 unsigned long REGPARAM2 op_52f9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(2) ? 0xff : 0;
+{	int val = lazy_cctrue(2) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -12545,7 +10672,7 @@ return 8;
 unsigned long REGPARAM2 op_53c0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(3) ? 0xff : 0;
+{{{	int val = lazy_cctrue(3) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -12559,7 +10686,7 @@ unsigned long REGPARAM2 op_53c8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(3)) {
+	if (!lazy_cctrue(3)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -12578,7 +10705,7 @@ unsigned long REGPARAM2 op_53d0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(3) ? 0xff : 0;
+{	int val = lazy_cctrue(3) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12588,7 +10715,7 @@ unsigned long REGPARAM2 op_53d8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(3) ? 0xff : 0;
+{	int val = lazy_cctrue(3) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12599,7 +10726,7 @@ unsigned long REGPARAM2 op_53e0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(3) ? 0xff : 0;
+{	int val = lazy_cctrue(3) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12608,7 +10735,7 @@ unsigned long REGPARAM2 op_53e8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(3) ? 0xff : 0;
+{	int val = lazy_cctrue(3) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12617,7 +10744,7 @@ unsigned long REGPARAM2 op_53f0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(3) ? 0xff : 0;
+{	int val = lazy_cctrue(3) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12625,7 +10752,7 @@ return 6;
 unsigned long REGPARAM2 op_53f8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(3) ? 0xff : 0;
+{	int val = lazy_cctrue(3) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12633,7 +10760,7 @@ return 6;
 unsigned long REGPARAM2 op_53f9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(3) ? 0xff : 0;
+{	int val = lazy_cctrue(3) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -12641,7 +10768,7 @@ return 8;
 unsigned long REGPARAM2 op_54c0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(4) ? 0xff : 0;
+{{{	int val = lazy_cctrue(4) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -12655,7 +10782,7 @@ unsigned long REGPARAM2 op_54c8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(4)) {
+	if (!lazy_cctrue(4)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -12674,7 +10801,7 @@ unsigned long REGPARAM2 op_54d0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(4) ? 0xff : 0;
+{	int val = lazy_cctrue(4) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12684,7 +10811,7 @@ unsigned long REGPARAM2 op_54d8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(4) ? 0xff : 0;
+{	int val = lazy_cctrue(4) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12695,7 +10822,7 @@ unsigned long REGPARAM2 op_54e0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(4) ? 0xff : 0;
+{	int val = lazy_cctrue(4) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12704,7 +10831,7 @@ unsigned long REGPARAM2 op_54e8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(4) ? 0xff : 0;
+{	int val = lazy_cctrue(4) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12713,7 +10840,7 @@ unsigned long REGPARAM2 op_54f0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(4) ? 0xff : 0;
+{	int val = lazy_cctrue(4) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12721,7 +10848,7 @@ return 6;
 unsigned long REGPARAM2 op_54f8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(4) ? 0xff : 0;
+{	int val = lazy_cctrue(4) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12729,7 +10856,7 @@ return 6;
 unsigned long REGPARAM2 op_54f9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(4) ? 0xff : 0;
+{	int val = lazy_cctrue(4) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -12737,7 +10864,7 @@ return 8;
 unsigned long REGPARAM2 op_55c0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(5) ? 0xff : 0;
+{{{	int val = lazy_cctrue(5) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -12751,7 +10878,7 @@ unsigned long REGPARAM2 op_55c8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(5)) {
+	if (!lazy_cctrue(5)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -12770,7 +10897,7 @@ unsigned long REGPARAM2 op_55d0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(5) ? 0xff : 0;
+{	int val = lazy_cctrue(5) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12780,7 +10907,7 @@ unsigned long REGPARAM2 op_55d8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(5) ? 0xff : 0;
+{	int val = lazy_cctrue(5) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12791,7 +10918,7 @@ unsigned long REGPARAM2 op_55e0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(5) ? 0xff : 0;
+{	int val = lazy_cctrue(5) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12800,7 +10927,7 @@ unsigned long REGPARAM2 op_55e8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(5) ? 0xff : 0;
+{	int val = lazy_cctrue(5) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12809,7 +10936,7 @@ unsigned long REGPARAM2 op_55f0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(5) ? 0xff : 0;
+{	int val = lazy_cctrue(5) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12817,7 +10944,7 @@ return 6;
 unsigned long REGPARAM2 op_55f8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(5) ? 0xff : 0;
+{	int val = lazy_cctrue(5) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12825,7 +10952,7 @@ return 6;
 unsigned long REGPARAM2 op_55f9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(5) ? 0xff : 0;
+{	int val = lazy_cctrue(5) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -12833,7 +10960,7 @@ return 8;
 unsigned long REGPARAM2 op_56c0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(6) ? 0xff : 0;
+{{{	int val = lazy_cctrue(6) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -12847,7 +10974,7 @@ unsigned long REGPARAM2 op_56c8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(6)) {
+	if (!lazy_cctrue(6)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -12866,7 +10993,7 @@ unsigned long REGPARAM2 op_56d0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(6) ? 0xff : 0;
+{	int val = lazy_cctrue(6) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12876,7 +11003,7 @@ unsigned long REGPARAM2 op_56d8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(6) ? 0xff : 0;
+{	int val = lazy_cctrue(6) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12887,7 +11014,7 @@ unsigned long REGPARAM2 op_56e0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(6) ? 0xff : 0;
+{	int val = lazy_cctrue(6) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12896,7 +11023,7 @@ unsigned long REGPARAM2 op_56e8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(6) ? 0xff : 0;
+{	int val = lazy_cctrue(6) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12905,7 +11032,7 @@ unsigned long REGPARAM2 op_56f0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(6) ? 0xff : 0;
+{	int val = lazy_cctrue(6) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12913,7 +11040,7 @@ return 6;
 unsigned long REGPARAM2 op_56f8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(6) ? 0xff : 0;
+{	int val = lazy_cctrue(6) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -12921,7 +11048,7 @@ return 6;
 unsigned long REGPARAM2 op_56f9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(6) ? 0xff : 0;
+{	int val = lazy_cctrue(6) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -12929,7 +11056,7 @@ return 8;
 unsigned long REGPARAM2 op_57c0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(7) ? 0xff : 0;
+{{{	int val = lazy_cctrue(7) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -12943,7 +11070,7 @@ unsigned long REGPARAM2 op_57c8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(7)) {
+	if (!lazy_cctrue(7)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -12962,7 +11089,7 @@ unsigned long REGPARAM2 op_57d0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(7) ? 0xff : 0;
+{	int val = lazy_cctrue(7) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12972,7 +11099,7 @@ unsigned long REGPARAM2 op_57d8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(7) ? 0xff : 0;
+{	int val = lazy_cctrue(7) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12983,7 +11110,7 @@ unsigned long REGPARAM2 op_57e0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(7) ? 0xff : 0;
+{	int val = lazy_cctrue(7) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -12992,7 +11119,7 @@ unsigned long REGPARAM2 op_57e8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(7) ? 0xff : 0;
+{	int val = lazy_cctrue(7) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13001,7 +11128,7 @@ unsigned long REGPARAM2 op_57f0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(7) ? 0xff : 0;
+{	int val = lazy_cctrue(7) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13009,7 +11136,7 @@ return 6;
 unsigned long REGPARAM2 op_57f8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(7) ? 0xff : 0;
+{	int val = lazy_cctrue(7) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13017,7 +11144,7 @@ return 6;
 unsigned long REGPARAM2 op_57f9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(7) ? 0xff : 0;
+{	int val = lazy_cctrue(7) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -13025,7 +11152,7 @@ return 8;
 unsigned long REGPARAM2 op_58c0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(8) ? 0xff : 0;
+{{{	int val = lazy_cctrue(8) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -13039,7 +11166,7 @@ unsigned long REGPARAM2 op_58c8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(8)) {
+	if (!lazy_cctrue(8)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -13058,7 +11185,7 @@ unsigned long REGPARAM2 op_58d0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(8) ? 0xff : 0;
+{	int val = lazy_cctrue(8) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13068,7 +11195,7 @@ unsigned long REGPARAM2 op_58d8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(8) ? 0xff : 0;
+{	int val = lazy_cctrue(8) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13079,7 +11206,7 @@ unsigned long REGPARAM2 op_58e0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(8) ? 0xff : 0;
+{	int val = lazy_cctrue(8) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13088,7 +11215,7 @@ unsigned long REGPARAM2 op_58e8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(8) ? 0xff : 0;
+{	int val = lazy_cctrue(8) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13097,7 +11224,7 @@ unsigned long REGPARAM2 op_58f0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(8) ? 0xff : 0;
+{	int val = lazy_cctrue(8) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13105,7 +11232,7 @@ return 6;
 unsigned long REGPARAM2 op_58f8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(8) ? 0xff : 0;
+{	int val = lazy_cctrue(8) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13113,7 +11240,7 @@ return 6;
 unsigned long REGPARAM2 op_58f9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(8) ? 0xff : 0;
+{	int val = lazy_cctrue(8) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -13121,7 +11248,7 @@ return 8;
 unsigned long REGPARAM2 op_59c0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(9) ? 0xff : 0;
+{{{	int val = lazy_cctrue(9) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -13135,7 +11262,7 @@ unsigned long REGPARAM2 op_59c8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(9)) {
+	if (!lazy_cctrue(9)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -13154,7 +11281,7 @@ unsigned long REGPARAM2 op_59d0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(9) ? 0xff : 0;
+{	int val = lazy_cctrue(9) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13164,7 +11291,7 @@ unsigned long REGPARAM2 op_59d8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(9) ? 0xff : 0;
+{	int val = lazy_cctrue(9) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13175,7 +11302,7 @@ unsigned long REGPARAM2 op_59e0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(9) ? 0xff : 0;
+{	int val = lazy_cctrue(9) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13184,7 +11311,7 @@ unsigned long REGPARAM2 op_59e8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(9) ? 0xff : 0;
+{	int val = lazy_cctrue(9) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13193,7 +11320,7 @@ unsigned long REGPARAM2 op_59f0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(9) ? 0xff : 0;
+{	int val = lazy_cctrue(9) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13201,7 +11328,7 @@ return 6;
 unsigned long REGPARAM2 op_59f8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(9) ? 0xff : 0;
+{	int val = lazy_cctrue(9) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13209,7 +11336,7 @@ return 6;
 unsigned long REGPARAM2 op_59f9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(9) ? 0xff : 0;
+{	int val = lazy_cctrue(9) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -13217,7 +11344,7 @@ return 8;
 unsigned long REGPARAM2 op_5ac0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(10) ? 0xff : 0;
+{{{	int val = lazy_cctrue(10) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -13231,7 +11358,7 @@ unsigned long REGPARAM2 op_5ac8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(10)) {
+	if (!lazy_cctrue(10)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -13250,7 +11377,7 @@ unsigned long REGPARAM2 op_5ad0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(10) ? 0xff : 0;
+{	int val = lazy_cctrue(10) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13260,7 +11387,7 @@ unsigned long REGPARAM2 op_5ad8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(10) ? 0xff : 0;
+{	int val = lazy_cctrue(10) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13271,7 +11398,7 @@ unsigned long REGPARAM2 op_5ae0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(10) ? 0xff : 0;
+{	int val = lazy_cctrue(10) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13280,7 +11407,7 @@ unsigned long REGPARAM2 op_5ae8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(10) ? 0xff : 0;
+{	int val = lazy_cctrue(10) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13289,7 +11416,7 @@ unsigned long REGPARAM2 op_5af0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(10) ? 0xff : 0;
+{	int val = lazy_cctrue(10) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13297,7 +11424,7 @@ return 6;
 unsigned long REGPARAM2 op_5af8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(10) ? 0xff : 0;
+{	int val = lazy_cctrue(10) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13305,7 +11432,7 @@ return 6;
 unsigned long REGPARAM2 op_5af9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(10) ? 0xff : 0;
+{	int val = lazy_cctrue(10) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -13313,7 +11440,7 @@ return 8;
 unsigned long REGPARAM2 op_5bc0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(11) ? 0xff : 0;
+{{{	int val = lazy_cctrue(11) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -13327,7 +11454,7 @@ unsigned long REGPARAM2 op_5bc8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(11)) {
+	if (!lazy_cctrue(11)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -13346,7 +11473,7 @@ unsigned long REGPARAM2 op_5bd0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(11) ? 0xff : 0;
+{	int val = lazy_cctrue(11) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13356,7 +11483,7 @@ unsigned long REGPARAM2 op_5bd8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(11) ? 0xff : 0;
+{	int val = lazy_cctrue(11) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13367,7 +11494,7 @@ unsigned long REGPARAM2 op_5be0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(11) ? 0xff : 0;
+{	int val = lazy_cctrue(11) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13376,7 +11503,7 @@ unsigned long REGPARAM2 op_5be8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(11) ? 0xff : 0;
+{	int val = lazy_cctrue(11) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13385,7 +11512,7 @@ unsigned long REGPARAM2 op_5bf0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(11) ? 0xff : 0;
+{	int val = lazy_cctrue(11) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13393,7 +11520,7 @@ return 6;
 unsigned long REGPARAM2 op_5bf8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(11) ? 0xff : 0;
+{	int val = lazy_cctrue(11) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13401,7 +11528,7 @@ return 6;
 unsigned long REGPARAM2 op_5bf9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(11) ? 0xff : 0;
+{	int val = lazy_cctrue(11) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -13409,7 +11536,7 @@ return 8;
 unsigned long REGPARAM2 op_5cc0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(12) ? 0xff : 0;
+{{{	int val = lazy_cctrue(12) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -13423,7 +11550,7 @@ unsigned long REGPARAM2 op_5cc8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(12)) {
+	if (!lazy_cctrue(12)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -13442,7 +11569,7 @@ unsigned long REGPARAM2 op_5cd0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(12) ? 0xff : 0;
+{	int val = lazy_cctrue(12) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13452,7 +11579,7 @@ unsigned long REGPARAM2 op_5cd8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(12) ? 0xff : 0;
+{	int val = lazy_cctrue(12) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13463,7 +11590,7 @@ unsigned long REGPARAM2 op_5ce0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(12) ? 0xff : 0;
+{	int val = lazy_cctrue(12) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13472,7 +11599,7 @@ unsigned long REGPARAM2 op_5ce8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(12) ? 0xff : 0;
+{	int val = lazy_cctrue(12) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13481,7 +11608,7 @@ unsigned long REGPARAM2 op_5cf0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(12) ? 0xff : 0;
+{	int val = lazy_cctrue(12) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13489,7 +11616,7 @@ return 6;
 unsigned long REGPARAM2 op_5cf8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(12) ? 0xff : 0;
+{	int val = lazy_cctrue(12) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13497,7 +11624,7 @@ return 6;
 unsigned long REGPARAM2 op_5cf9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(12) ? 0xff : 0;
+{	int val = lazy_cctrue(12) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -13505,7 +11632,7 @@ return 8;
 unsigned long REGPARAM2 op_5dc0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(13) ? 0xff : 0;
+{{{	int val = lazy_cctrue(13) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -13519,7 +11646,7 @@ unsigned long REGPARAM2 op_5dc8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(13)) {
+	if (!lazy_cctrue(13)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -13538,7 +11665,7 @@ unsigned long REGPARAM2 op_5dd0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(13) ? 0xff : 0;
+{	int val = lazy_cctrue(13) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13548,7 +11675,7 @@ unsigned long REGPARAM2 op_5dd8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(13) ? 0xff : 0;
+{	int val = lazy_cctrue(13) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13559,7 +11686,7 @@ unsigned long REGPARAM2 op_5de0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(13) ? 0xff : 0;
+{	int val = lazy_cctrue(13) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13568,7 +11695,7 @@ unsigned long REGPARAM2 op_5de8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(13) ? 0xff : 0;
+{	int val = lazy_cctrue(13) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13577,7 +11704,7 @@ unsigned long REGPARAM2 op_5df0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(13) ? 0xff : 0;
+{	int val = lazy_cctrue(13) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13585,7 +11712,7 @@ return 6;
 unsigned long REGPARAM2 op_5df8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(13) ? 0xff : 0;
+{	int val = lazy_cctrue(13) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13593,7 +11720,7 @@ return 6;
 unsigned long REGPARAM2 op_5df9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(13) ? 0xff : 0;
+{	int val = lazy_cctrue(13) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -13601,7 +11728,7 @@ return 8;
 unsigned long REGPARAM2 op_5ec0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(14) ? 0xff : 0;
+{{{	int val = lazy_cctrue(14) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -13615,7 +11742,7 @@ unsigned long REGPARAM2 op_5ec8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(14)) {
+	if (!lazy_cctrue(14)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -13634,7 +11761,7 @@ unsigned long REGPARAM2 op_5ed0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(14) ? 0xff : 0;
+{	int val = lazy_cctrue(14) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13644,7 +11771,7 @@ unsigned long REGPARAM2 op_5ed8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(14) ? 0xff : 0;
+{	int val = lazy_cctrue(14) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13655,7 +11782,7 @@ unsigned long REGPARAM2 op_5ee0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(14) ? 0xff : 0;
+{	int val = lazy_cctrue(14) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13664,7 +11791,7 @@ unsigned long REGPARAM2 op_5ee8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(14) ? 0xff : 0;
+{	int val = lazy_cctrue(14) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13673,7 +11800,7 @@ unsigned long REGPARAM2 op_5ef0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(14) ? 0xff : 0;
+{	int val = lazy_cctrue(14) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13681,7 +11808,7 @@ return 6;
 unsigned long REGPARAM2 op_5ef8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(14) ? 0xff : 0;
+{	int val = lazy_cctrue(14) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13689,7 +11816,7 @@ return 6;
 unsigned long REGPARAM2 op_5ef9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(14) ? 0xff : 0;
+{	int val = lazy_cctrue(14) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -13700,7 +11827,7 @@ return 8;
 unsigned long REGPARAM2 op_5fc0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
-{{{	int val = cctrue(15) ? 0xff : 0;
+{{{	int val = lazy_cctrue(15) ? 0xff : 0;
 #if HAS_PROFILING
 	if (gProfilingEnabled)
 		ProfileIncrementClock(2);
@@ -13714,7 +11841,7 @@ unsigned long REGPARAM2 op_5fc8_3(uae_u32 opcode) /* DBcc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 offs = get_iword(2);
-	if (!cctrue(15)) {
+	if (!lazy_cctrue(15)) {
 	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
 		if (src) {
 			m68k_incpc((uae_s32)offs + 2);
@@ -13733,7 +11860,7 @@ unsigned long REGPARAM2 op_5fd0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
-{	int val = cctrue(15) ? 0xff : 0;
+{	int val = lazy_cctrue(15) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13743,7 +11870,7 @@ unsigned long REGPARAM2 op_5fd8_3(uae_u32 opcode) /* Scc */
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	int val = cctrue(15) ? 0xff : 0;
+{	int val = lazy_cctrue(15) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13754,7 +11881,7 @@ unsigned long REGPARAM2 op_5fe0_3(uae_u32 opcode) /* Scc */
 {{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
 	m68k_areg (regs, srcreg) = srca;
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
-{	int val = cctrue(15) ? 0xff : 0;
+{	int val = lazy_cctrue(15) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(2);
 return 4;
@@ -13763,7 +11890,7 @@ unsigned long REGPARAM2 op_5fe8_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(15) ? 0xff : 0;
+{	int val = lazy_cctrue(15) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13772,7 +11899,7 @@ unsigned long REGPARAM2 op_5ff0_3(uae_u32 opcode) /* Scc */
 {
 	uae_u32 srcreg = (opcode & 7);
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(15) ? 0xff : 0;
+{	int val = lazy_cctrue(15) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13780,7 +11907,7 @@ return 6;
 unsigned long REGPARAM2 op_5ff8_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	int val = cctrue(15) ? 0xff : 0;
+{	int val = lazy_cctrue(15) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(4);
 return 6;
@@ -13788,7 +11915,7 @@ return 6;
 unsigned long REGPARAM2 op_5ff9_3(uae_u32 opcode) /* Scc */
 {
 {{	uaecptr srca = get_ilong(2);
-{	int val = cctrue(15) ? 0xff : 0;
+{	int val = lazy_cctrue(15) ? 0xff : 0;
 	put_byte(srca,val);
 }}}m68k_incpc(6);
 return 8;
@@ -13796,7 +11923,7 @@ return 8;
 unsigned long REGPARAM2 op_6000_3(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
-	if (!cctrue(0)) goto didnt_jump;
+	if (!lazy_cctrue(0)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -13812,7 +11939,7 @@ unsigned long REGPARAM2 op_6001_3(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
-	if (!cctrue(0)) goto didnt_jump;
+	if (!lazy_cctrue(0)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -13827,12 +11954,12 @@ return 2;
 unsigned long REGPARAM2 op_60ff_3(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
-	if (!cctrue(0)) goto endlabel1017;
+	if (!lazy_cctrue(0)) goto endlabel1017;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
 		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel1017;
 {	uae_s32 src = get_ilong(2);
-	if (!cctrue(0)) goto didnt_jump;
+	if (!lazy_cctrue(0)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -13869,7 +11996,7 @@ unsigned long REGPARAM2 op_61ff_3(uae_u32 opcode) /* BSR */
 unsigned long REGPARAM2 op_6200_3(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
-	if (!cctrue(2)) goto didnt_jump;
+	if (!lazy_cctrue(2)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -13885,7 +12012,7 @@ unsigned long REGPARAM2 op_6201_3(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
-	if (!cctrue(2)) goto didnt_jump;
+	if (!lazy_cctrue(2)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -13900,12 +12027,12 @@ return 2;
 unsigned long REGPARAM2 op_62ff_3(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
-	if (!cctrue(2)) goto endlabel1023;
+	if (!lazy_cctrue(2)) goto endlabel1023;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
 		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel1023;
 {	uae_s32 src = get_ilong(2);
-	if (!cctrue(2)) goto didnt_jump;
+	if (!lazy_cctrue(2)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -13920,7 +12047,7 @@ return 6;
 unsigned long REGPARAM2 op_6300_3(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
-	if (!cctrue(3)) goto didnt_jump;
+	if (!lazy_cctrue(3)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -13936,7 +12063,7 @@ unsigned long REGPARAM2 op_6301_3(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
-	if (!cctrue(3)) goto didnt_jump;
+	if (!lazy_cctrue(3)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -13951,12 +12078,12 @@ return 2;
 unsigned long REGPARAM2 op_63ff_3(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
-	if (!cctrue(3)) goto endlabel1026;
+	if (!lazy_cctrue(3)) goto endlabel1026;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
 		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel1026;
 {	uae_s32 src = get_ilong(2);
-	if (!cctrue(3)) goto didnt_jump;
+	if (!lazy_cctrue(3)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -13971,7 +12098,7 @@ return 6;
 unsigned long REGPARAM2 op_6400_3(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
-	if (!cctrue(4)) goto didnt_jump;
+	if (!lazy_cctrue(4)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -13987,7 +12114,7 @@ unsigned long REGPARAM2 op_6401_3(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
-	if (!cctrue(4)) goto didnt_jump;
+	if (!lazy_cctrue(4)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14002,12 +12129,12 @@ return 2;
 unsigned long REGPARAM2 op_64ff_3(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
-	if (!cctrue(4)) goto endlabel1029;
+	if (!lazy_cctrue(4)) goto endlabel1029;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
 		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel1029;
 {	uae_s32 src = get_ilong(2);
-	if (!cctrue(4)) goto didnt_jump;
+	if (!lazy_cctrue(4)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14022,7 +12149,7 @@ return 6;
 unsigned long REGPARAM2 op_6500_3(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
-	if (!cctrue(5)) goto didnt_jump;
+	if (!lazy_cctrue(5)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14038,7 +12165,7 @@ unsigned long REGPARAM2 op_6501_3(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
-	if (!cctrue(5)) goto didnt_jump;
+	if (!lazy_cctrue(5)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14053,12 +12180,12 @@ return 2;
 unsigned long REGPARAM2 op_65ff_3(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
-	if (!cctrue(5)) goto endlabel1032;
+	if (!lazy_cctrue(5)) goto endlabel1032;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
 		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel1032;
 {	uae_s32 src = get_ilong(2);
-	if (!cctrue(5)) goto didnt_jump;
+	if (!lazy_cctrue(5)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14073,7 +12200,7 @@ return 6;
 unsigned long REGPARAM2 op_6600_3(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
-	if (!cctrue(6)) goto didnt_jump;
+	if (!lazy_cctrue(6)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14089,7 +12216,7 @@ unsigned long REGPARAM2 op_6601_3(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
-	if (!cctrue(6)) goto didnt_jump;
+	if (!lazy_cctrue(6)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14104,12 +12231,12 @@ return 2;
 unsigned long REGPARAM2 op_66ff_3(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
-	if (!cctrue(6)) goto endlabel1035;
+	if (!lazy_cctrue(6)) goto endlabel1035;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
 		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel1035;
 {	uae_s32 src = get_ilong(2);
-	if (!cctrue(6)) goto didnt_jump;
+	if (!lazy_cctrue(6)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14124,7 +12251,7 @@ return 6;
 unsigned long REGPARAM2 op_6700_3(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
-	if (!cctrue(7)) goto didnt_jump;
+	if (!lazy_cctrue(7)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14140,7 +12267,7 @@ unsigned long REGPARAM2 op_6701_3(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
-	if (!cctrue(7)) goto didnt_jump;
+	if (!lazy_cctrue(7)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14155,12 +12282,12 @@ return 2;
 unsigned long REGPARAM2 op_67ff_3(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
-	if (!cctrue(7)) goto endlabel1038;
+	if (!lazy_cctrue(7)) goto endlabel1038;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
 		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel1038;
 {	uae_s32 src = get_ilong(2);
-	if (!cctrue(7)) goto didnt_jump;
+	if (!lazy_cctrue(7)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14175,7 +12302,7 @@ return 6;
 unsigned long REGPARAM2 op_6800_3(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
-	if (!cctrue(8)) goto didnt_jump;
+	if (!lazy_cctrue(8)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14191,7 +12318,7 @@ unsigned long REGPARAM2 op_6801_3(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
-	if (!cctrue(8)) goto didnt_jump;
+	if (!lazy_cctrue(8)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14206,12 +12333,12 @@ return 2;
 unsigned long REGPARAM2 op_68ff_3(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
-	if (!cctrue(8)) goto endlabel1041;
+	if (!lazy_cctrue(8)) goto endlabel1041;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
 		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel1041;
 {	uae_s32 src = get_ilong(2);
-	if (!cctrue(8)) goto didnt_jump;
+	if (!lazy_cctrue(8)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14226,7 +12353,7 @@ return 6;
 unsigned long REGPARAM2 op_6900_3(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
-	if (!cctrue(9)) goto didnt_jump;
+	if (!lazy_cctrue(9)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14242,7 +12369,7 @@ unsigned long REGPARAM2 op_6901_3(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
-	if (!cctrue(9)) goto didnt_jump;
+	if (!lazy_cctrue(9)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14257,12 +12384,12 @@ return 2;
 unsigned long REGPARAM2 op_69ff_3(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
-	if (!cctrue(9)) goto endlabel1044;
+	if (!lazy_cctrue(9)) goto endlabel1044;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
 		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel1044;
 {	uae_s32 src = get_ilong(2);
-	if (!cctrue(9)) goto didnt_jump;
+	if (!lazy_cctrue(9)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14277,7 +12404,7 @@ return 6;
 unsigned long REGPARAM2 op_6a00_3(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
-	if (!cctrue(10)) goto didnt_jump;
+	if (!lazy_cctrue(10)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14293,7 +12420,7 @@ unsigned long REGPARAM2 op_6a01_3(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
-	if (!cctrue(10)) goto didnt_jump;
+	if (!lazy_cctrue(10)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14308,12 +12435,12 @@ return 2;
 unsigned long REGPARAM2 op_6aff_3(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
-	if (!cctrue(10)) goto endlabel1047;
+	if (!lazy_cctrue(10)) goto endlabel1047;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
 		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel1047;
 {	uae_s32 src = get_ilong(2);
-	if (!cctrue(10)) goto didnt_jump;
+	if (!lazy_cctrue(10)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14328,7 +12455,7 @@ return 6;
 unsigned long REGPARAM2 op_6b00_3(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
-	if (!cctrue(11)) goto didnt_jump;
+	if (!lazy_cctrue(11)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14344,7 +12471,7 @@ unsigned long REGPARAM2 op_6b01_3(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
-	if (!cctrue(11)) goto didnt_jump;
+	if (!lazy_cctrue(11)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14359,12 +12486,12 @@ return 2;
 unsigned long REGPARAM2 op_6bff_3(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
-	if (!cctrue(11)) goto endlabel1050;
+	if (!lazy_cctrue(11)) goto endlabel1050;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
 		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel1050;
 {	uae_s32 src = get_ilong(2);
-	if (!cctrue(11)) goto didnt_jump;
+	if (!lazy_cctrue(11)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14379,7 +12506,7 @@ return 6;
 unsigned long REGPARAM2 op_6c00_3(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
-	if (!cctrue(12)) goto didnt_jump;
+	if (!lazy_cctrue(12)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14395,7 +12522,7 @@ unsigned long REGPARAM2 op_6c01_3(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
-	if (!cctrue(12)) goto didnt_jump;
+	if (!lazy_cctrue(12)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14410,12 +12537,12 @@ return 2;
 unsigned long REGPARAM2 op_6cff_3(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
-	if (!cctrue(12)) goto endlabel1053;
+	if (!lazy_cctrue(12)) goto endlabel1053;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
 		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel1053;
 {	uae_s32 src = get_ilong(2);
-	if (!cctrue(12)) goto didnt_jump;
+	if (!lazy_cctrue(12)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14430,7 +12557,7 @@ return 6;
 unsigned long REGPARAM2 op_6d00_3(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
-	if (!cctrue(13)) goto didnt_jump;
+	if (!lazy_cctrue(13)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14446,7 +12573,7 @@ unsigned long REGPARAM2 op_6d01_3(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
-	if (!cctrue(13)) goto didnt_jump;
+	if (!lazy_cctrue(13)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14461,12 +12588,12 @@ return 2;
 unsigned long REGPARAM2 op_6dff_3(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
-	if (!cctrue(13)) goto endlabel1056;
+	if (!lazy_cctrue(13)) goto endlabel1056;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
 		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel1056;
 {	uae_s32 src = get_ilong(2);
-	if (!cctrue(13)) goto didnt_jump;
+	if (!lazy_cctrue(13)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14481,7 +12608,7 @@ return 6;
 unsigned long REGPARAM2 op_6e00_3(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
-	if (!cctrue(14)) goto didnt_jump;
+	if (!lazy_cctrue(14)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14497,7 +12624,7 @@ unsigned long REGPARAM2 op_6e01_3(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
-	if (!cctrue(14)) goto didnt_jump;
+	if (!lazy_cctrue(14)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14512,12 +12639,12 @@ return 2;
 unsigned long REGPARAM2 op_6eff_3(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
-	if (!cctrue(14)) goto endlabel1059;
+	if (!lazy_cctrue(14)) goto endlabel1059;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
 		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel1059;
 {	uae_s32 src = get_ilong(2);
-	if (!cctrue(14)) goto didnt_jump;
+	if (!lazy_cctrue(14)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14532,7 +12659,7 @@ return 6;
 unsigned long REGPARAM2 op_6f00_3(uae_u32 opcode) /* Bcc */
 {
 {{	uae_s16 src = get_iword(2);
-	if (!cctrue(15)) goto didnt_jump;
+	if (!lazy_cctrue(15)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14548,7 +12675,7 @@ unsigned long REGPARAM2 op_6f01_3(uae_u32 opcode) /* Bcc */
 {
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 {{	uae_u32 src = srcreg;
-	if (!cctrue(15)) goto didnt_jump;
+	if (!lazy_cctrue(15)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14563,12 +12690,12 @@ return 2;
 unsigned long REGPARAM2 op_6fff_3(uae_u32 opcode) /* Bcc */
 {
 {	m68k_incpc(2);
-	if (!cctrue(15)) goto endlabel1062;
+	if (!lazy_cctrue(15)) goto endlabel1062;
 		last_addr_for_exception_3 = m68k_getpc() + 2;
 		last_fault_for_exception_3 = m68k_getpc() + 1;
 		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel1062;
 {	uae_s32 src = get_ilong(2);
-	if (!cctrue(15)) goto didnt_jump;
+	if (!lazy_cctrue(15)) goto didnt_jump;
 	m68k_incpc ((uae_s32)src + 2);
 #if HAS_PROFILING
 	if (gProfilingEnabled)
@@ -14585,9 +12712,7 @@ unsigned long REGPARAM2 op_7000_3(uae_u32 opcode) /* MOVE */
 	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 	uae_u32 dstreg = (opcode >> 9) & 7;
 {{	uae_u32 src = srcreg;
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 2;
@@ -14599,9 +12724,7 @@ unsigned long REGPARAM2 op_8000_3(uae_u32 opcode) /* OR */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 2;
@@ -14614,9 +12737,7 @@ unsigned long REGPARAM2 op_8010_3(uae_u32 opcode) /* OR */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -14630,9 +12751,7 @@ unsigned long REGPARAM2 op_8018_3(uae_u32 opcode) /* OR */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -14647,9 +12766,7 @@ unsigned long REGPARAM2 op_8020_3(uae_u32 opcode) /* OR */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -14662,9 +12779,7 @@ unsigned long REGPARAM2 op_8028_3(uae_u32 opcode) /* OR */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14677,9 +12792,7 @@ unsigned long REGPARAM2 op_8030_3(uae_u32 opcode) /* OR */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14691,9 +12804,7 @@ unsigned long REGPARAM2 op_8038_3(uae_u32 opcode) /* OR */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14705,9 +12816,7 @@ unsigned long REGPARAM2 op_8039_3(uae_u32 opcode) /* OR */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 return 8;
@@ -14720,9 +12829,7 @@ unsigned long REGPARAM2 op_803a_3(uae_u32 opcode) /* OR */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14735,9 +12842,7 @@ unsigned long REGPARAM2 op_803b_3(uae_u32 opcode) /* OR */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14748,9 +12853,7 @@ unsigned long REGPARAM2 op_803c_3(uae_u32 opcode) /* OR */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 4;
@@ -14762,9 +12865,7 @@ unsigned long REGPARAM2 op_8040_3(uae_u32 opcode) /* OR */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 2;
@@ -14777,9 +12878,7 @@ unsigned long REGPARAM2 op_8050_3(uae_u32 opcode) /* OR */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -14793,9 +12892,7 @@ unsigned long REGPARAM2 op_8058_3(uae_u32 opcode) /* OR */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -14810,9 +12907,7 @@ unsigned long REGPARAM2 op_8060_3(uae_u32 opcode) /* OR */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -14825,9 +12920,7 @@ unsigned long REGPARAM2 op_8068_3(uae_u32 opcode) /* OR */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14840,9 +12933,7 @@ unsigned long REGPARAM2 op_8070_3(uae_u32 opcode) /* OR */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14854,9 +12945,7 @@ unsigned long REGPARAM2 op_8078_3(uae_u32 opcode) /* OR */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14868,9 +12957,7 @@ unsigned long REGPARAM2 op_8079_3(uae_u32 opcode) /* OR */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 return 8;
@@ -14883,9 +12970,7 @@ unsigned long REGPARAM2 op_807a_3(uae_u32 opcode) /* OR */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14898,9 +12983,7 @@ unsigned long REGPARAM2 op_807b_3(uae_u32 opcode) /* OR */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -14911,9 +12994,7 @@ unsigned long REGPARAM2 op_807c_3(uae_u32 opcode) /* OR */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 4;
@@ -14925,9 +13006,7 @@ unsigned long REGPARAM2 op_8080_3(uae_u32 opcode) /* OR */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 2;
@@ -14940,9 +13019,7 @@ unsigned long REGPARAM2 op_8090_3(uae_u32 opcode) /* OR */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -14956,9 +13033,7 @@ unsigned long REGPARAM2 op_8098_3(uae_u32 opcode) /* OR */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -14973,9 +13048,7 @@ unsigned long REGPARAM2 op_80a0_3(uae_u32 opcode) /* OR */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -14988,9 +13061,7 @@ unsigned long REGPARAM2 op_80a8_3(uae_u32 opcode) /* OR */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15003,9 +13074,7 @@ unsigned long REGPARAM2 op_80b0_3(uae_u32 opcode) /* OR */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15017,9 +13086,7 @@ unsigned long REGPARAM2 op_80b8_3(uae_u32 opcode) /* OR */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15031,9 +13098,7 @@ unsigned long REGPARAM2 op_80b9_3(uae_u32 opcode) /* OR */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 return 10;
@@ -15046,9 +13111,7 @@ unsigned long REGPARAM2 op_80ba_3(uae_u32 opcode) /* OR */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15061,9 +13124,7 @@ unsigned long REGPARAM2 op_80bb_3(uae_u32 opcode) /* OR */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15074,9 +13135,7 @@ unsigned long REGPARAM2 op_80bc_3(uae_u32 opcode) /* OR */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 6;
@@ -15093,9 +13152,7 @@ unsigned long REGPARAM2 op_80c0_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15117,9 +13174,7 @@ unsigned long REGPARAM2 op_80d0_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15142,9 +13197,7 @@ unsigned long REGPARAM2 op_80d8_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15168,9 +13221,7 @@ unsigned long REGPARAM2 op_80e0_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15192,9 +13243,7 @@ unsigned long REGPARAM2 op_80e8_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15216,9 +13265,7 @@ unsigned long REGPARAM2 op_80f0_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15239,9 +13286,7 @@ unsigned long REGPARAM2 op_80f8_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15262,9 +13307,7 @@ unsigned long REGPARAM2 op_80f9_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15286,9 +13329,7 @@ unsigned long REGPARAM2 op_80fa_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15310,9 +13351,7 @@ unsigned long REGPARAM2 op_80fb_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15332,9 +13371,7 @@ unsigned long REGPARAM2 op_80fc_3(uae_u32 opcode) /* DIVU */
 	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
 	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15405,9 +13442,7 @@ unsigned long REGPARAM2 op_8110_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -15421,9 +13456,7 @@ unsigned long REGPARAM2 op_8118_3(uae_u32 opcode) /* OR */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -15438,9 +13471,7 @@ unsigned long REGPARAM2 op_8120_3(uae_u32 opcode) /* OR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -15453,9 +13484,7 @@ unsigned long REGPARAM2 op_8128_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15468,9 +13497,7 @@ unsigned long REGPARAM2 op_8130_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15482,9 +13509,7 @@ unsigned long REGPARAM2 op_8138_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15496,9 +13521,7 @@ unsigned long REGPARAM2 op_8139_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -15511,9 +13534,7 @@ unsigned long REGPARAM2 op_8150_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -15527,9 +13548,7 @@ unsigned long REGPARAM2 op_8158_3(uae_u32 opcode) /* OR */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -15544,9 +13563,7 @@ unsigned long REGPARAM2 op_8160_3(uae_u32 opcode) /* OR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -15559,9 +13576,7 @@ unsigned long REGPARAM2 op_8168_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15574,9 +13589,7 @@ unsigned long REGPARAM2 op_8170_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15588,9 +13601,7 @@ unsigned long REGPARAM2 op_8178_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -15602,9 +13613,7 @@ unsigned long REGPARAM2 op_8179_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -15617,9 +13626,7 @@ unsigned long REGPARAM2 op_8190_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -15633,9 +13640,7 @@ unsigned long REGPARAM2 op_8198_3(uae_u32 opcode) /* OR */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -15650,9 +13655,7 @@ unsigned long REGPARAM2 op_81a0_3(uae_u32 opcode) /* OR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -15665,9 +13668,7 @@ unsigned long REGPARAM2 op_81a8_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -15680,9 +13681,7 @@ unsigned long REGPARAM2 op_81b0_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -15694,9 +13693,7 @@ unsigned long REGPARAM2 op_81b8_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -15708,9 +13705,7 @@ unsigned long REGPARAM2 op_81b9_3(uae_u32 opcode) /* OR */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -15728,9 +13723,7 @@ unsigned long REGPARAM2 op_81c0_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15753,9 +13746,7 @@ unsigned long REGPARAM2 op_81d0_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15779,9 +13770,7 @@ unsigned long REGPARAM2 op_81d8_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15806,9 +13795,7 @@ unsigned long REGPARAM2 op_81e0_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15831,9 +13818,7 @@ unsigned long REGPARAM2 op_81e8_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15856,9 +13841,7 @@ unsigned long REGPARAM2 op_81f0_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15880,9 +13863,7 @@ unsigned long REGPARAM2 op_81f8_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15904,9 +13885,7 @@ unsigned long REGPARAM2 op_81f9_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15929,9 +13908,7 @@ unsigned long REGPARAM2 op_81fa_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15954,9 +13931,7 @@ unsigned long REGPARAM2 op_81fb_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15977,9 +13952,7 @@ unsigned long REGPARAM2 op_81fc_3(uae_u32 opcode) /* DIVS */
 	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
 	{
 	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
 	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
 	m68k_dreg(regs, dstreg) = (newv);
 	}
@@ -15995,16 +13968,9 @@ unsigned long REGPARAM2 op_9000_3(uae_u32 opcode) /* SUB */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_9010_3(uae_u32 opcode) /* SUB */
@@ -16015,16 +13981,9 @@ unsigned long REGPARAM2 op_9010_3(uae_u32 opcode) /* SUB */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_9018_3(uae_u32 opcode) /* SUB */
@@ -16036,16 +13995,9 @@ unsigned long REGPARAM2 op_9018_3(uae_u32 opcode) /* SUB */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_9020_3(uae_u32 opcode) /* SUB */
@@ -16058,16 +14010,9 @@ unsigned long REGPARAM2 op_9020_3(uae_u32 opcode) /* SUB */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_9028_3(uae_u32 opcode) /* SUB */
@@ -16078,16 +14023,9 @@ unsigned long REGPARAM2 op_9028_3(uae_u32 opcode) /* SUB */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_9030_3(uae_u32 opcode) /* SUB */
@@ -16098,16 +14036,9 @@ unsigned long REGPARAM2 op_9030_3(uae_u32 opcode) /* SUB */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_9038_3(uae_u32 opcode) /* SUB */
@@ -16117,16 +14048,9 @@ unsigned long REGPARAM2 op_9038_3(uae_u32 opcode) /* SUB */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_9039_3(uae_u32 opcode) /* SUB */
@@ -16136,16 +14060,9 @@ unsigned long REGPARAM2 op_9039_3(uae_u32 opcode) /* SUB */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_903a_3(uae_u32 opcode) /* SUB */
@@ -16156,16 +14073,9 @@ unsigned long REGPARAM2 op_903a_3(uae_u32 opcode) /* SUB */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_903b_3(uae_u32 opcode) /* SUB */
@@ -16176,16 +14086,9 @@ unsigned long REGPARAM2 op_903b_3(uae_u32 opcode) /* SUB */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_903c_3(uae_u32 opcode) /* SUB */
@@ -16194,16 +14097,9 @@ unsigned long REGPARAM2 op_903c_3(uae_u32 opcode) /* SUB */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_9040_3(uae_u32 opcode) /* SUB */
@@ -16213,16 +14109,9 @@ unsigned long REGPARAM2 op_9040_3(uae_u32 opcode) /* SUB */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_9048_3(uae_u32 opcode) /* SUB */
@@ -16232,16 +14121,9 @@ unsigned long REGPARAM2 op_9048_3(uae_u32 opcode) /* SUB */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_9050_3(uae_u32 opcode) /* SUB */
@@ -16252,16 +14134,9 @@ unsigned long REGPARAM2 op_9050_3(uae_u32 opcode) /* SUB */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_9058_3(uae_u32 opcode) /* SUB */
@@ -16273,16 +14148,9 @@ unsigned long REGPARAM2 op_9058_3(uae_u32 opcode) /* SUB */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_9060_3(uae_u32 opcode) /* SUB */
@@ -16295,16 +14163,9 @@ unsigned long REGPARAM2 op_9060_3(uae_u32 opcode) /* SUB */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_9068_3(uae_u32 opcode) /* SUB */
@@ -16315,16 +14176,9 @@ unsigned long REGPARAM2 op_9068_3(uae_u32 opcode) /* SUB */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_9070_3(uae_u32 opcode) /* SUB */
@@ -16335,16 +14189,9 @@ unsigned long REGPARAM2 op_9070_3(uae_u32 opcode) /* SUB */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_9078_3(uae_u32 opcode) /* SUB */
@@ -16354,16 +14201,9 @@ unsigned long REGPARAM2 op_9078_3(uae_u32 opcode) /* SUB */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_9079_3(uae_u32 opcode) /* SUB */
@@ -16373,16 +14213,9 @@ unsigned long REGPARAM2 op_9079_3(uae_u32 opcode) /* SUB */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_907a_3(uae_u32 opcode) /* SUB */
@@ -16393,16 +14226,9 @@ unsigned long REGPARAM2 op_907a_3(uae_u32 opcode) /* SUB */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_907b_3(uae_u32 opcode) /* SUB */
@@ -16413,16 +14239,9 @@ unsigned long REGPARAM2 op_907b_3(uae_u32 opcode) /* SUB */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_907c_3(uae_u32 opcode) /* SUB */
@@ -16431,16 +14250,9 @@ unsigned long REGPARAM2 op_907c_3(uae_u32 opcode) /* SUB */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_9080_3(uae_u32 opcode) /* SUB */
@@ -16450,16 +14262,9 @@ unsigned long REGPARAM2 op_9080_3(uae_u32 opcode) /* SUB */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_9088_3(uae_u32 opcode) /* SUB */
@@ -16469,16 +14274,9 @@ unsigned long REGPARAM2 op_9088_3(uae_u32 opcode) /* SUB */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_9090_3(uae_u32 opcode) /* SUB */
@@ -16489,16 +14287,9 @@ unsigned long REGPARAM2 op_9090_3(uae_u32 opcode) /* SUB */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_9098_3(uae_u32 opcode) /* SUB */
@@ -16510,16 +14301,9 @@ unsigned long REGPARAM2 op_9098_3(uae_u32 opcode) /* SUB */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_90a0_3(uae_u32 opcode) /* SUB */
@@ -16532,16 +14316,9 @@ unsigned long REGPARAM2 op_90a0_3(uae_u32 opcode) /* SUB */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_90a8_3(uae_u32 opcode) /* SUB */
@@ -16552,16 +14329,9 @@ unsigned long REGPARAM2 op_90a8_3(uae_u32 opcode) /* SUB */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_90b0_3(uae_u32 opcode) /* SUB */
@@ -16572,16 +14342,9 @@ unsigned long REGPARAM2 op_90b0_3(uae_u32 opcode) /* SUB */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_90b8_3(uae_u32 opcode) /* SUB */
@@ -16591,16 +14354,9 @@ unsigned long REGPARAM2 op_90b8_3(uae_u32 opcode) /* SUB */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_90b9_3(uae_u32 opcode) /* SUB */
@@ -16610,16 +14366,9 @@ unsigned long REGPARAM2 op_90b9_3(uae_u32 opcode) /* SUB */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_90ba_3(uae_u32 opcode) /* SUB */
@@ -16630,16 +14379,9 @@ unsigned long REGPARAM2 op_90ba_3(uae_u32 opcode) /* SUB */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_90bb_3(uae_u32 opcode) /* SUB */
@@ -16650,16 +14392,9 @@ unsigned long REGPARAM2 op_90bb_3(uae_u32 opcode) /* SUB */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_90bc_3(uae_u32 opcode) /* SUB */
@@ -16668,16 +14403,9 @@ unsigned long REGPARAM2 op_90bc_3(uae_u32 opcode) /* SUB */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 6;
 }
 unsigned long REGPARAM2 op_90c0_3(uae_u32 opcode) /* SUBA */
@@ -16885,16 +14613,9 @@ unsigned long REGPARAM2 op_9110_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_9118_3(uae_u32 opcode) /* SUB */
@@ -16906,16 +14627,9 @@ unsigned long REGPARAM2 op_9118_3(uae_u32 opcode) /* SUB */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_9120_3(uae_u32 opcode) /* SUB */
@@ -16928,16 +14642,9 @@ unsigned long REGPARAM2 op_9120_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_9128_3(uae_u32 opcode) /* SUB */
@@ -16948,16 +14655,9 @@ unsigned long REGPARAM2 op_9128_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_9130_3(uae_u32 opcode) /* SUB */
@@ -16968,16 +14668,9 @@ unsigned long REGPARAM2 op_9130_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_9138_3(uae_u32 opcode) /* SUB */
@@ -16987,16 +14680,9 @@ unsigned long REGPARAM2 op_9138_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_9139_3(uae_u32 opcode) /* SUB */
@@ -17006,16 +14692,9 @@ unsigned long REGPARAM2 op_9139_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_9140_3(uae_u32 opcode) /* SUBX */
@@ -17070,16 +14749,9 @@ unsigned long REGPARAM2 op_9150_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_9158_3(uae_u32 opcode) /* SUB */
@@ -17091,16 +14763,9 @@ unsigned long REGPARAM2 op_9158_3(uae_u32 opcode) /* SUB */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_9160_3(uae_u32 opcode) /* SUB */
@@ -17113,16 +14778,9 @@ unsigned long REGPARAM2 op_9160_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_9168_3(uae_u32 opcode) /* SUB */
@@ -17133,16 +14791,9 @@ unsigned long REGPARAM2 op_9168_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_9170_3(uae_u32 opcode) /* SUB */
@@ -17153,16 +14804,9 @@ unsigned long REGPARAM2 op_9170_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_9178_3(uae_u32 opcode) /* SUB */
@@ -17172,16 +14816,9 @@ unsigned long REGPARAM2 op_9178_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_9179_3(uae_u32 opcode) /* SUB */
@@ -17191,16 +14828,9 @@ unsigned long REGPARAM2 op_9179_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_9180_3(uae_u32 opcode) /* SUBX */
@@ -17255,16 +14885,9 @@ unsigned long REGPARAM2 op_9190_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_9198_3(uae_u32 opcode) /* SUB */
@@ -17276,16 +14899,9 @@ unsigned long REGPARAM2 op_9198_3(uae_u32 opcode) /* SUB */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_91a0_3(uae_u32 opcode) /* SUB */
@@ -17298,16 +14914,9 @@ unsigned long REGPARAM2 op_91a0_3(uae_u32 opcode) /* SUB */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_91a8_3(uae_u32 opcode) /* SUB */
@@ -17318,16 +14927,9 @@ unsigned long REGPARAM2 op_91a8_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_91b0_3(uae_u32 opcode) /* SUB */
@@ -17338,16 +14940,9 @@ unsigned long REGPARAM2 op_91b0_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_91b8_3(uae_u32 opcode) /* SUB */
@@ -17357,16 +14952,9 @@ unsigned long REGPARAM2 op_91b8_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_91b9_3(uae_u32 opcode) /* SUB */
@@ -17376,16 +14964,9 @@ unsigned long REGPARAM2 op_91b9_3(uae_u32 opcode) /* SUB */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_91c0_3(uae_u32 opcode) /* SUBA */
@@ -17548,14 +15129,8 @@ unsigned long REGPARAM2 op_b000_3(uae_u32 opcode) /* CMP */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b010_3(uae_u32 opcode) /* CMP */
@@ -17566,14 +15141,8 @@ unsigned long REGPARAM2 op_b010_3(uae_u32 opcode) /* CMP */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 #endif
@@ -17588,14 +15157,8 @@ unsigned long REGPARAM2 op_b018_3(uae_u32 opcode) /* CMP */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b020_3(uae_u32 opcode) /* CMP */
@@ -17608,14 +15171,8 @@ unsigned long REGPARAM2 op_b020_3(uae_u32 opcode) /* CMP */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b028_3(uae_u32 opcode) /* CMP */
@@ -17626,14 +15183,8 @@ unsigned long REGPARAM2 op_b028_3(uae_u32 opcode) /* CMP */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b030_3(uae_u32 opcode) /* CMP */
@@ -17644,14 +15195,8 @@ unsigned long REGPARAM2 op_b030_3(uae_u32 opcode) /* CMP */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b038_3(uae_u32 opcode) /* CMP */
@@ -17661,14 +15206,8 @@ unsigned long REGPARAM2 op_b038_3(uae_u32 opcode) /* CMP */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b039_3(uae_u32 opcode) /* CMP */
@@ -17678,14 +15217,8 @@ unsigned long REGPARAM2 op_b039_3(uae_u32 opcode) /* CMP */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_b03a_3(uae_u32 opcode) /* CMP */
@@ -17696,14 +15229,8 @@ unsigned long REGPARAM2 op_b03a_3(uae_u32 opcode) /* CMP */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b03b_3(uae_u32 opcode) /* CMP */
@@ -17714,14 +15241,8 @@ unsigned long REGPARAM2 op_b03b_3(uae_u32 opcode) /* CMP */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b03c_3(uae_u32 opcode) /* CMP */
@@ -17730,14 +15251,8 @@ unsigned long REGPARAM2 op_b03c_3(uae_u32 opcode) /* CMP */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_b040_3(uae_u32 opcode) /* CMP */
@@ -17747,14 +15262,8 @@ unsigned long REGPARAM2 op_b040_3(uae_u32 opcode) /* CMP */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b048_3(uae_u32 opcode) /* CMP */
@@ -17764,14 +15273,8 @@ unsigned long REGPARAM2 op_b048_3(uae_u32 opcode) /* CMP */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b050_3(uae_u32 opcode) /* CMP */
@@ -17782,14 +15285,8 @@ unsigned long REGPARAM2 op_b050_3(uae_u32 opcode) /* CMP */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b058_3(uae_u32 opcode) /* CMP */
@@ -17801,14 +15298,8 @@ unsigned long REGPARAM2 op_b058_3(uae_u32 opcode) /* CMP */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b060_3(uae_u32 opcode) /* CMP */
@@ -17821,14 +15312,8 @@ unsigned long REGPARAM2 op_b060_3(uae_u32 opcode) /* CMP */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b068_3(uae_u32 opcode) /* CMP */
@@ -17839,14 +15324,8 @@ unsigned long REGPARAM2 op_b068_3(uae_u32 opcode) /* CMP */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b070_3(uae_u32 opcode) /* CMP */
@@ -17857,14 +15336,8 @@ unsigned long REGPARAM2 op_b070_3(uae_u32 opcode) /* CMP */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b078_3(uae_u32 opcode) /* CMP */
@@ -17874,14 +15347,8 @@ unsigned long REGPARAM2 op_b078_3(uae_u32 opcode) /* CMP */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b079_3(uae_u32 opcode) /* CMP */
@@ -17891,14 +15358,8 @@ unsigned long REGPARAM2 op_b079_3(uae_u32 opcode) /* CMP */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_b07a_3(uae_u32 opcode) /* CMP */
@@ -17909,14 +15370,8 @@ unsigned long REGPARAM2 op_b07a_3(uae_u32 opcode) /* CMP */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b07b_3(uae_u32 opcode) /* CMP */
@@ -17927,14 +15382,8 @@ unsigned long REGPARAM2 op_b07b_3(uae_u32 opcode) /* CMP */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b07c_3(uae_u32 opcode) /* CMP */
@@ -17943,14 +15392,8 @@ unsigned long REGPARAM2 op_b07c_3(uae_u32 opcode) /* CMP */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_b080_3(uae_u32 opcode) /* CMP */
@@ -17960,14 +15403,8 @@ unsigned long REGPARAM2 op_b080_3(uae_u32 opcode) /* CMP */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b088_3(uae_u32 opcode) /* CMP */
@@ -17977,14 +15414,8 @@ unsigned long REGPARAM2 op_b088_3(uae_u32 opcode) /* CMP */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b090_3(uae_u32 opcode) /* CMP */
@@ -17995,14 +15426,8 @@ unsigned long REGPARAM2 op_b090_3(uae_u32 opcode) /* CMP */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b098_3(uae_u32 opcode) /* CMP */
@@ -18014,14 +15439,8 @@ unsigned long REGPARAM2 op_b098_3(uae_u32 opcode) /* CMP */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b0a0_3(uae_u32 opcode) /* CMP */
@@ -18034,14 +15453,8 @@ unsigned long REGPARAM2 op_b0a0_3(uae_u32 opcode) /* CMP */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b0a8_3(uae_u32 opcode) /* CMP */
@@ -18052,14 +15465,8 @@ unsigned long REGPARAM2 op_b0a8_3(uae_u32 opcode) /* CMP */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b0b0_3(uae_u32 opcode) /* CMP */
@@ -18070,14 +15477,8 @@ unsigned long REGPARAM2 op_b0b0_3(uae_u32 opcode) /* CMP */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b0b8_3(uae_u32 opcode) /* CMP */
@@ -18087,14 +15488,8 @@ unsigned long REGPARAM2 op_b0b8_3(uae_u32 opcode) /* CMP */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b0b9_3(uae_u32 opcode) /* CMP */
@@ -18104,14 +15499,8 @@ unsigned long REGPARAM2 op_b0b9_3(uae_u32 opcode) /* CMP */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_b0ba_3(uae_u32 opcode) /* CMP */
@@ -18122,14 +15511,8 @@ unsigned long REGPARAM2 op_b0ba_3(uae_u32 opcode) /* CMP */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b0bb_3(uae_u32 opcode) /* CMP */
@@ -18140,14 +15523,8 @@ unsigned long REGPARAM2 op_b0bb_3(uae_u32 opcode) /* CMP */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b0bc_3(uae_u32 opcode) /* CMP */
@@ -18156,14 +15533,8 @@ unsigned long REGPARAM2 op_b0bc_3(uae_u32 opcode) /* CMP */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(6);
 return 6;
 }
 unsigned long REGPARAM2 op_b0c0_3(uae_u32 opcode) /* CMPA */
@@ -18173,14 +15544,8 @@ unsigned long REGPARAM2 op_b0c0_3(uae_u32 opcode) /* CMPA */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b0c8_3(uae_u32 opcode) /* CMPA */
@@ -18190,14 +15555,8 @@ unsigned long REGPARAM2 op_b0c8_3(uae_u32 opcode) /* CMPA */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b0d0_3(uae_u32 opcode) /* CMPA */
@@ -18208,14 +15567,8 @@ unsigned long REGPARAM2 op_b0d0_3(uae_u32 opcode) /* CMPA */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b0d8_3(uae_u32 opcode) /* CMPA */
@@ -18227,14 +15580,8 @@ unsigned long REGPARAM2 op_b0d8_3(uae_u32 opcode) /* CMPA */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b0e0_3(uae_u32 opcode) /* CMPA */
@@ -18247,14 +15594,8 @@ unsigned long REGPARAM2 op_b0e0_3(uae_u32 opcode) /* CMPA */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_b0e8_3(uae_u32 opcode) /* CMPA */
@@ -18265,14 +15606,8 @@ unsigned long REGPARAM2 op_b0e8_3(uae_u32 opcode) /* CMPA */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b0f0_3(uae_u32 opcode) /* CMPA */
@@ -18283,14 +15618,8 @@ unsigned long REGPARAM2 op_b0f0_3(uae_u32 opcode) /* CMPA */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b0f8_3(uae_u32 opcode) /* CMPA */
@@ -18300,14 +15629,8 @@ unsigned long REGPARAM2 op_b0f8_3(uae_u32 opcode) /* CMPA */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b0f9_3(uae_u32 opcode) /* CMPA */
@@ -18317,14 +15640,8 @@ unsigned long REGPARAM2 op_b0f9_3(uae_u32 opcode) /* CMPA */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_b0fa_3(uae_u32 opcode) /* CMPA */
@@ -18335,14 +15652,8 @@ unsigned long REGPARAM2 op_b0fa_3(uae_u32 opcode) /* CMPA */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b0fb_3(uae_u32 opcode) /* CMPA */
@@ -18353,14 +15664,8 @@ unsigned long REGPARAM2 op_b0fb_3(uae_u32 opcode) /* CMPA */
 {	uae_s16 src = get_word(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_b0fc_3(uae_u32 opcode) /* CMPA */
@@ -18369,14 +15674,8 @@ unsigned long REGPARAM2 op_b0fc_3(uae_u32 opcode) /* CMPA */
 {{	uae_s16 src = get_iword(2);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_b100_3(uae_u32 opcode) /* EOR */
@@ -18386,9 +15685,7 @@ unsigned long REGPARAM2 op_b100_3(uae_u32 opcode) /* EOR */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 2;
@@ -18404,14 +15701,8 @@ unsigned long REGPARAM2 op_b108_3(uae_u32 opcode) /* CMPM */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b110_3(uae_u32 opcode) /* EOR */
@@ -18422,9 +15713,7 @@ unsigned long REGPARAM2 op_b110_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -18438,9 +15727,7 @@ unsigned long REGPARAM2 op_b118_3(uae_u32 opcode) /* EOR */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -18455,9 +15742,7 @@ unsigned long REGPARAM2 op_b120_3(uae_u32 opcode) /* EOR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -18470,9 +15755,7 @@ unsigned long REGPARAM2 op_b128_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -18485,9 +15768,7 @@ unsigned long REGPARAM2 op_b130_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -18499,9 +15780,7 @@ unsigned long REGPARAM2 op_b138_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -18513,9 +15792,7 @@ unsigned long REGPARAM2 op_b139_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -18527,9 +15804,7 @@ unsigned long REGPARAM2 op_b140_3(uae_u32 opcode) /* EOR */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 2;
@@ -18545,14 +15820,8 @@ unsigned long REGPARAM2 op_b148_3(uae_u32 opcode) /* CMPM */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b150_3(uae_u32 opcode) /* EOR */
@@ -18563,9 +15832,7 @@ unsigned long REGPARAM2 op_b150_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -18579,9 +15846,7 @@ unsigned long REGPARAM2 op_b158_3(uae_u32 opcode) /* EOR */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -18596,9 +15861,7 @@ unsigned long REGPARAM2 op_b160_3(uae_u32 opcode) /* EOR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -18611,9 +15874,7 @@ unsigned long REGPARAM2 op_b168_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -18626,9 +15887,7 @@ unsigned long REGPARAM2 op_b170_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -18640,9 +15899,7 @@ unsigned long REGPARAM2 op_b178_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -18654,9 +15911,7 @@ unsigned long REGPARAM2 op_b179_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -18668,9 +15923,7 @@ unsigned long REGPARAM2 op_b180_3(uae_u32 opcode) /* EOR */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 2;
@@ -18686,14 +15939,8 @@ unsigned long REGPARAM2 op_b188_3(uae_u32 opcode) /* CMPM */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_b190_3(uae_u32 opcode) /* EOR */
@@ -18704,9 +15951,7 @@ unsigned long REGPARAM2 op_b190_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -18720,9 +15965,7 @@ unsigned long REGPARAM2 op_b198_3(uae_u32 opcode) /* EOR */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -18737,9 +15980,7 @@ unsigned long REGPARAM2 op_b1a0_3(uae_u32 opcode) /* EOR */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -18752,9 +15993,7 @@ unsigned long REGPARAM2 op_b1a8_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -18767,9 +16006,7 @@ unsigned long REGPARAM2 op_b1b0_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -18781,9 +16018,7 @@ unsigned long REGPARAM2 op_b1b8_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -18795,9 +16030,7 @@ unsigned long REGPARAM2 op_b1b9_3(uae_u32 opcode) /* EOR */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -18809,14 +16042,8 @@ unsigned long REGPARAM2 op_b1c0_3(uae_u32 opcode) /* CMPA */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b1c8_3(uae_u32 opcode) /* CMPA */
@@ -18826,14 +16053,8 @@ unsigned long REGPARAM2 op_b1c8_3(uae_u32 opcode) /* CMPA */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_b1d0_3(uae_u32 opcode) /* CMPA */
@@ -18844,14 +16065,8 @@ unsigned long REGPARAM2 op_b1d0_3(uae_u32 opcode) /* CMPA */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b1d8_3(uae_u32 opcode) /* CMPA */
@@ -18863,14 +16078,8 @@ unsigned long REGPARAM2 op_b1d8_3(uae_u32 opcode) /* CMPA */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b1e0_3(uae_u32 opcode) /* CMPA */
@@ -18883,14 +16092,8 @@ unsigned long REGPARAM2 op_b1e0_3(uae_u32 opcode) /* CMPA */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_b1e8_3(uae_u32 opcode) /* CMPA */
@@ -18901,14 +16104,8 @@ unsigned long REGPARAM2 op_b1e8_3(uae_u32 opcode) /* CMPA */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b1f0_3(uae_u32 opcode) /* CMPA */
@@ -18919,14 +16116,8 @@ unsigned long REGPARAM2 op_b1f0_3(uae_u32 opcode) /* CMPA */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b1f8_3(uae_u32 opcode) /* CMPA */
@@ -18936,14 +16127,8 @@ unsigned long REGPARAM2 op_b1f8_3(uae_u32 opcode) /* CMPA */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b1f9_3(uae_u32 opcode) /* CMPA */
@@ -18953,14 +16138,8 @@ unsigned long REGPARAM2 op_b1f9_3(uae_u32 opcode) /* CMPA */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_b1fa_3(uae_u32 opcode) /* CMPA */
@@ -18971,14 +16150,8 @@ unsigned long REGPARAM2 op_b1fa_3(uae_u32 opcode) /* CMPA */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b1fb_3(uae_u32 opcode) /* CMPA */
@@ -18989,14 +16162,8 @@ unsigned long REGPARAM2 op_b1fb_3(uae_u32 opcode) /* CMPA */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_b1fc_3(uae_u32 opcode) /* CMPA */
@@ -19005,14 +16172,8 @@ unsigned long REGPARAM2 op_b1fc_3(uae_u32 opcode) /* CMPA */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_areg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}m68k_incpc(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(6);
 return 6;
 }
 unsigned long REGPARAM2 op_c000_3(uae_u32 opcode) /* AND */
@@ -19022,9 +16183,7 @@ unsigned long REGPARAM2 op_c000_3(uae_u32 opcode) /* AND */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(2);
 return 2;
@@ -19037,9 +16196,7 @@ unsigned long REGPARAM2 op_c010_3(uae_u32 opcode) /* AND */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -19053,9 +16210,7 @@ unsigned long REGPARAM2 op_c018_3(uae_u32 opcode) /* AND */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -19070,9 +16225,7 @@ unsigned long REGPARAM2 op_c020_3(uae_u32 opcode) /* AND */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(2);
 return 4;
@@ -19085,9 +16238,7 @@ unsigned long REGPARAM2 op_c028_3(uae_u32 opcode) /* AND */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19100,9 +16251,7 @@ unsigned long REGPARAM2 op_c030_3(uae_u32 opcode) /* AND */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19114,9 +16263,7 @@ unsigned long REGPARAM2 op_c038_3(uae_u32 opcode) /* AND */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19128,9 +16275,7 @@ unsigned long REGPARAM2 op_c039_3(uae_u32 opcode) /* AND */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(6);
 return 8;
@@ -19143,9 +16288,7 @@ unsigned long REGPARAM2 op_c03a_3(uae_u32 opcode) /* AND */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19158,9 +16301,7 @@ unsigned long REGPARAM2 op_c03b_3(uae_u32 opcode) /* AND */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19171,9 +16312,7 @@ unsigned long REGPARAM2 op_c03c_3(uae_u32 opcode) /* AND */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}m68k_incpc(4);
 return 4;
@@ -19185,9 +16324,7 @@ unsigned long REGPARAM2 op_c040_3(uae_u32 opcode) /* AND */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(2);
 return 2;
@@ -19200,9 +16337,7 @@ unsigned long REGPARAM2 op_c050_3(uae_u32 opcode) /* AND */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -19216,9 +16351,7 @@ unsigned long REGPARAM2 op_c058_3(uae_u32 opcode) /* AND */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -19233,9 +16366,7 @@ unsigned long REGPARAM2 op_c060_3(uae_u32 opcode) /* AND */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(2);
 return 4;
@@ -19248,9 +16379,7 @@ unsigned long REGPARAM2 op_c068_3(uae_u32 opcode) /* AND */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19263,9 +16392,7 @@ unsigned long REGPARAM2 op_c070_3(uae_u32 opcode) /* AND */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19277,9 +16404,7 @@ unsigned long REGPARAM2 op_c078_3(uae_u32 opcode) /* AND */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19291,9 +16416,7 @@ unsigned long REGPARAM2 op_c079_3(uae_u32 opcode) /* AND */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(6);
 return 8;
@@ -19306,9 +16429,7 @@ unsigned long REGPARAM2 op_c07a_3(uae_u32 opcode) /* AND */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19321,9 +16442,7 @@ unsigned long REGPARAM2 op_c07b_3(uae_u32 opcode) /* AND */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}}m68k_incpc(4);
 return 6;
@@ -19334,9 +16453,7 @@ unsigned long REGPARAM2 op_c07c_3(uae_u32 opcode) /* AND */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
 }}}m68k_incpc(4);
 return 4;
@@ -19348,9 +16465,7 @@ unsigned long REGPARAM2 op_c080_3(uae_u32 opcode) /* AND */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(2);
 return 2;
@@ -19363,9 +16478,7 @@ unsigned long REGPARAM2 op_c090_3(uae_u32 opcode) /* AND */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19379,9 +16492,7 @@ unsigned long REGPARAM2 op_c098_3(uae_u32 opcode) /* AND */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19396,9 +16507,7 @@ unsigned long REGPARAM2 op_c0a0_3(uae_u32 opcode) /* AND */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19411,9 +16520,7 @@ unsigned long REGPARAM2 op_c0a8_3(uae_u32 opcode) /* AND */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19426,9 +16533,7 @@ unsigned long REGPARAM2 op_c0b0_3(uae_u32 opcode) /* AND */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19440,9 +16545,7 @@ unsigned long REGPARAM2 op_c0b8_3(uae_u32 opcode) /* AND */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19454,9 +16557,7 @@ unsigned long REGPARAM2 op_c0b9_3(uae_u32 opcode) /* AND */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(6);
 return 10;
@@ -19469,9 +16570,7 @@ unsigned long REGPARAM2 op_c0ba_3(uae_u32 opcode) /* AND */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19484,9 +16583,7 @@ unsigned long REGPARAM2 op_c0bb_3(uae_u32 opcode) /* AND */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19497,9 +16594,7 @@ unsigned long REGPARAM2 op_c0bc_3(uae_u32 opcode) /* AND */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	m68k_dreg(regs, dstreg) = (src);
 }}}m68k_incpc(6);
 return 6;
@@ -19511,9 +16606,7 @@ unsigned long REGPARAM2 op_c0c0_3(uae_u32 opcode) /* MULU */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(2);
 return 34;
@@ -19526,9 +16619,7 @@ unsigned long REGPARAM2 op_c0d0_3(uae_u32 opcode) /* MULU */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 return 36;
@@ -19542,9 +16633,7 @@ unsigned long REGPARAM2 op_c0d8_3(uae_u32 opcode) /* MULU */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 return 36;
@@ -19559,9 +16648,7 @@ unsigned long REGPARAM2 op_c0e0_3(uae_u32 opcode) /* MULU */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 return 36;
@@ -19574,9 +16661,7 @@ unsigned long REGPARAM2 op_c0e8_3(uae_u32 opcode) /* MULU */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -19589,9 +16674,7 @@ unsigned long REGPARAM2 op_c0f0_3(uae_u32 opcode) /* MULU */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -19603,9 +16686,7 @@ unsigned long REGPARAM2 op_c0f8_3(uae_u32 opcode) /* MULU */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -19617,9 +16698,7 @@ unsigned long REGPARAM2 op_c0f9_3(uae_u32 opcode) /* MULU */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(6);
 return 40;
@@ -19632,9 +16711,7 @@ unsigned long REGPARAM2 op_c0fa_3(uae_u32 opcode) /* MULU */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -19647,9 +16724,7 @@ unsigned long REGPARAM2 op_c0fb_3(uae_u32 opcode) /* MULU */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -19660,9 +16735,7 @@ unsigned long REGPARAM2 op_c0fc_3(uae_u32 opcode) /* MULU */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(4);
 return 36;
@@ -19729,9 +16802,7 @@ unsigned long REGPARAM2 op_c110_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19745,9 +16816,7 @@ unsigned long REGPARAM2 op_c118_3(uae_u32 opcode) /* AND */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19762,9 +16831,7 @@ unsigned long REGPARAM2 op_c120_3(uae_u32 opcode) /* AND */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19777,9 +16844,7 @@ unsigned long REGPARAM2 op_c128_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19792,9 +16857,7 @@ unsigned long REGPARAM2 op_c130_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19806,9 +16869,7 @@ unsigned long REGPARAM2 op_c138_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19820,9 +16881,7 @@ unsigned long REGPARAM2 op_c139_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
 	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -19859,9 +16918,7 @@ unsigned long REGPARAM2 op_c150_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19875,9 +16932,7 @@ unsigned long REGPARAM2 op_c158_3(uae_u32 opcode) /* AND */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19892,9 +16947,7 @@ unsigned long REGPARAM2 op_c160_3(uae_u32 opcode) /* AND */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(2);
 return 6;
@@ -19907,9 +16960,7 @@ unsigned long REGPARAM2 op_c168_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19922,9 +16973,7 @@ unsigned long REGPARAM2 op_c170_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19936,9 +16985,7 @@ unsigned long REGPARAM2 op_c178_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(4);
 return 8;
@@ -19950,9 +16997,7 @@ unsigned long REGPARAM2 op_c179_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
 	put_word(dsta,src);
 }}}}m68k_incpc(6);
 return 10;
@@ -19977,9 +17022,7 @@ unsigned long REGPARAM2 op_c190_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -19993,9 +17036,7 @@ unsigned long REGPARAM2 op_c198_3(uae_u32 opcode) /* AND */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -20010,9 +17051,7 @@ unsigned long REGPARAM2 op_c1a0_3(uae_u32 opcode) /* AND */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(2);
 return 10;
@@ -20025,9 +17064,7 @@ unsigned long REGPARAM2 op_c1a8_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -20040,9 +17077,7 @@ unsigned long REGPARAM2 op_c1b0_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -20054,9 +17089,7 @@ unsigned long REGPARAM2 op_c1b8_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(4);
 return 12;
@@ -20068,9 +17101,7 @@ unsigned long REGPARAM2 op_c1b9_3(uae_u32 opcode) /* AND */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
 	put_long(dsta,src);
 }}}}m68k_incpc(6);
 return 14;
@@ -20082,9 +17113,7 @@ unsigned long REGPARAM2 op_c1c0_3(uae_u32 opcode) /* MULS */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(2);
 return 34;
@@ -20097,9 +17126,7 @@ unsigned long REGPARAM2 op_c1d0_3(uae_u32 opcode) /* MULS */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 return 36;
@@ -20113,9 +17140,7 @@ unsigned long REGPARAM2 op_c1d8_3(uae_u32 opcode) /* MULS */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 return 36;
@@ -20130,9 +17155,7 @@ unsigned long REGPARAM2 op_c1e0_3(uae_u32 opcode) /* MULS */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(2);
 return 36;
@@ -20145,9 +17168,7 @@ unsigned long REGPARAM2 op_c1e8_3(uae_u32 opcode) /* MULS */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -20160,9 +17181,7 @@ unsigned long REGPARAM2 op_c1f0_3(uae_u32 opcode) /* MULS */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -20174,9 +17193,7 @@ unsigned long REGPARAM2 op_c1f8_3(uae_u32 opcode) /* MULS */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -20188,9 +17205,7 @@ unsigned long REGPARAM2 op_c1f9_3(uae_u32 opcode) /* MULS */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(6);
 return 40;
@@ -20203,9 +17218,7 @@ unsigned long REGPARAM2 op_c1fa_3(uae_u32 opcode) /* MULS */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -20218,9 +17231,7 @@ unsigned long REGPARAM2 op_c1fb_3(uae_u32 opcode) /* MULS */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}}m68k_incpc(4);
 return 38;
@@ -20231,9 +17242,7 @@ unsigned long REGPARAM2 op_c1fc_3(uae_u32 opcode) /* MULS */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
 	m68k_dreg(regs, dstreg) = (newv);
 }}}}m68k_incpc(4);
 return 36;
@@ -20245,16 +17254,9 @@ unsigned long REGPARAM2 op_d000_3(uae_u32 opcode) /* ADD */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_d010_3(uae_u32 opcode) /* ADD */
@@ -20265,16 +17267,9 @@ unsigned long REGPARAM2 op_d010_3(uae_u32 opcode) /* ADD */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_d018_3(uae_u32 opcode) /* ADD */
@@ -20286,16 +17281,9 @@ unsigned long REGPARAM2 op_d018_3(uae_u32 opcode) /* ADD */
 	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_d020_3(uae_u32 opcode) /* ADD */
@@ -20308,16 +17296,9 @@ unsigned long REGPARAM2 op_d020_3(uae_u32 opcode) /* ADD */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_d028_3(uae_u32 opcode) /* ADD */
@@ -20328,16 +17309,9 @@ unsigned long REGPARAM2 op_d028_3(uae_u32 opcode) /* ADD */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d030_3(uae_u32 opcode) /* ADD */
@@ -20348,16 +17322,9 @@ unsigned long REGPARAM2 op_d030_3(uae_u32 opcode) /* ADD */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d038_3(uae_u32 opcode) /* ADD */
@@ -20367,16 +17334,9 @@ unsigned long REGPARAM2 op_d038_3(uae_u32 opcode) /* ADD */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d039_3(uae_u32 opcode) /* ADD */
@@ -20386,16 +17346,9 @@ unsigned long REGPARAM2 op_d039_3(uae_u32 opcode) /* ADD */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_d03a_3(uae_u32 opcode) /* ADD */
@@ -20406,16 +17359,9 @@ unsigned long REGPARAM2 op_d03a_3(uae_u32 opcode) /* ADD */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d03b_3(uae_u32 opcode) /* ADD */
@@ -20426,16 +17372,9 @@ unsigned long REGPARAM2 op_d03b_3(uae_u32 opcode) /* ADD */
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d03c_3(uae_u32 opcode) /* ADD */
@@ -20444,16 +17383,9 @@ unsigned long REGPARAM2 op_d03c_3(uae_u32 opcode) /* ADD */
 {{	uae_s8 src = get_ibyte(2);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_d040_3(uae_u32 opcode) /* ADD */
@@ -20463,16 +17395,9 @@ unsigned long REGPARAM2 op_d040_3(uae_u32 opcode) /* ADD */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_d048_3(uae_u32 opcode) /* ADD */
@@ -20482,16 +17407,9 @@ unsigned long REGPARAM2 op_d048_3(uae_u32 opcode) /* ADD */
 {{	uae_s16 src = m68k_areg(regs, srcreg);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_d050_3(uae_u32 opcode) /* ADD */
@@ -20502,16 +17420,9 @@ unsigned long REGPARAM2 op_d050_3(uae_u32 opcode) /* ADD */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_d058_3(uae_u32 opcode) /* ADD */
@@ -20523,16 +17434,9 @@ unsigned long REGPARAM2 op_d058_3(uae_u32 opcode) /* ADD */
 	m68k_areg(regs, srcreg) += 2;
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_d060_3(uae_u32 opcode) /* ADD */
@@ -20545,16 +17449,9 @@ unsigned long REGPARAM2 op_d060_3(uae_u32 opcode) /* ADD */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 4;
 }
 unsigned long REGPARAM2 op_d068_3(uae_u32 opcode) /* ADD */
@@ -20565,16 +17462,9 @@ unsigned long REGPARAM2 op_d068_3(uae_u32 opcode) /* ADD */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d070_3(uae_u32 opcode) /* ADD */
@@ -20585,16 +17475,9 @@ unsigned long REGPARAM2 op_d070_3(uae_u32 opcode) /* ADD */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d078_3(uae_u32 opcode) /* ADD */
@@ -20604,16 +17487,9 @@ unsigned long REGPARAM2 op_d078_3(uae_u32 opcode) /* ADD */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d079_3(uae_u32 opcode) /* ADD */
@@ -20623,16 +17499,9 @@ unsigned long REGPARAM2 op_d079_3(uae_u32 opcode) /* ADD */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 8;
 }
 unsigned long REGPARAM2 op_d07a_3(uae_u32 opcode) /* ADD */
@@ -20643,16 +17512,9 @@ unsigned long REGPARAM2 op_d07a_3(uae_u32 opcode) /* ADD */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d07b_3(uae_u32 opcode) /* ADD */
@@ -20663,16 +17525,9 @@ unsigned long REGPARAM2 op_d07b_3(uae_u32 opcode) /* ADD */
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 6;
 }
 unsigned long REGPARAM2 op_d07c_3(uae_u32 opcode) /* ADD */
@@ -20681,16 +17536,9 @@ unsigned long REGPARAM2 op_d07c_3(uae_u32 opcode) /* ADD */
 {{	uae_s16 src = get_iword(2);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}m68k_incpc(4);
+}}}}}m68k_incpc(4);
 return 4;
 }
 unsigned long REGPARAM2 op_d080_3(uae_u32 opcode) /* ADD */
@@ -20700,16 +17548,9 @@ unsigned long REGPARAM2 op_d080_3(uae_u32 opcode) /* ADD */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_d088_3(uae_u32 opcode) /* ADD */
@@ -20719,16 +17560,9 @@ unsigned long REGPARAM2 op_d088_3(uae_u32 opcode) /* ADD */
 {{	uae_s32 src = m68k_areg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(2);
+}}}}}m68k_incpc(2);
 return 2;
 }
 unsigned long REGPARAM2 op_d090_3(uae_u32 opcode) /* ADD */
@@ -20739,16 +17573,9 @@ unsigned long REGPARAM2 op_d090_3(uae_u32 opcode) /* ADD */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d098_3(uae_u32 opcode) /* ADD */
@@ -20760,16 +17587,9 @@ unsigned long REGPARAM2 op_d098_3(uae_u32 opcode) /* ADD */
 	m68k_areg(regs, srcreg) += 4;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d0a0_3(uae_u32 opcode) /* ADD */
@@ -20782,16 +17602,9 @@ unsigned long REGPARAM2 op_d0a0_3(uae_u32 opcode) /* ADD */
 	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d0a8_3(uae_u32 opcode) /* ADD */
@@ -20802,16 +17615,9 @@ unsigned long REGPARAM2 op_d0a8_3(uae_u32 opcode) /* ADD */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d0b0_3(uae_u32 opcode) /* ADD */
@@ -20822,16 +17628,9 @@ unsigned long REGPARAM2 op_d0b0_3(uae_u32 opcode) /* ADD */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d0b8_3(uae_u32 opcode) /* ADD */
@@ -20841,16 +17640,9 @@ unsigned long REGPARAM2 op_d0b8_3(uae_u32 opcode) /* ADD */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d0b9_3(uae_u32 opcode) /* ADD */
@@ -20860,16 +17652,9 @@ unsigned long REGPARAM2 op_d0b9_3(uae_u32 opcode) /* ADD */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_d0ba_3(uae_u32 opcode) /* ADD */
@@ -20880,16 +17665,9 @@ unsigned long REGPARAM2 op_d0ba_3(uae_u32 opcode) /* ADD */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d0bb_3(uae_u32 opcode) /* ADD */
@@ -20900,16 +17678,9 @@ unsigned long REGPARAM2 op_d0bb_3(uae_u32 opcode) /* ADD */
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d0bc_3(uae_u32 opcode) /* ADD */
@@ -20918,16 +17689,9 @@ unsigned long REGPARAM2 op_d0bc_3(uae_u32 opcode) /* ADD */
 {{	uae_s32 src = get_ilong(2);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}m68k_incpc(6);
+}}}}}m68k_incpc(6);
 return 6;
 }
 unsigned long REGPARAM2 op_d0c0_3(uae_u32 opcode) /* ADDA */
@@ -21135,16 +17899,9 @@ unsigned long REGPARAM2 op_d110_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d118_3(uae_u32 opcode) /* ADD */
@@ -21156,16 +17913,9 @@ unsigned long REGPARAM2 op_d118_3(uae_u32 opcode) /* ADD */
 {	uae_s8 dst = get_byte(dsta);
 	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d120_3(uae_u32 opcode) /* ADD */
@@ -21178,16 +17928,9 @@ unsigned long REGPARAM2 op_d120_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d128_3(uae_u32 opcode) /* ADD */
@@ -21198,16 +17941,9 @@ unsigned long REGPARAM2 op_d128_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d130_3(uae_u32 opcode) /* ADD */
@@ -21218,16 +17954,9 @@ unsigned long REGPARAM2 op_d130_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d138_3(uae_u32 opcode) /* ADD */
@@ -21237,16 +17966,9 @@ unsigned long REGPARAM2 op_d138_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d139_3(uae_u32 opcode) /* ADD */
@@ -21256,16 +17978,9 @@ unsigned long REGPARAM2 op_d139_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s8 dst = get_byte(dsta);
 {{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
 	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_d140_3(uae_u32 opcode) /* ADDX */
@@ -21317,19 +18032,12 @@ unsigned long REGPARAM2 op_d150_3(uae_u32 opcode) /* ADD */
 	uae_u32 srcreg = ((opcode >> 9) & 7);
 	uae_u32 dstreg = opcode & 7;
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = m68k_areg(regs, dstreg);
-{	uae_s16 dst = get_word(dsta);
-{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d158_3(uae_u32 opcode) /* ADD */
@@ -21341,16 +18049,9 @@ unsigned long REGPARAM2 op_d158_3(uae_u32 opcode) /* ADD */
 {	uae_s16 dst = get_word(dsta);
 	m68k_areg(regs, dstreg) += 2;
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d160_3(uae_u32 opcode) /* ADD */
@@ -21363,16 +18064,9 @@ unsigned long REGPARAM2 op_d160_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 6;
 }
 unsigned long REGPARAM2 op_d168_3(uae_u32 opcode) /* ADD */
@@ -21383,16 +18077,9 @@ unsigned long REGPARAM2 op_d168_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d170_3(uae_u32 opcode) /* ADD */
@@ -21403,16 +18090,9 @@ unsigned long REGPARAM2 op_d170_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d178_3(uae_u32 opcode) /* ADD */
@@ -21422,16 +18102,9 @@ unsigned long REGPARAM2 op_d178_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 8;
 }
 unsigned long REGPARAM2 op_d179_3(uae_u32 opcode) /* ADD */
@@ -21441,16 +18114,9 @@ unsigned long REGPARAM2 op_d179_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s16 dst = get_word(dsta);
 {{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
 	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 10;
 }
 unsigned long REGPARAM2 op_d180_3(uae_u32 opcode) /* ADDX */
@@ -21508,16 +18174,9 @@ unsigned long REGPARAM2 op_d190_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_d198_3(uae_u32 opcode) /* ADD */
@@ -21529,16 +18188,9 @@ unsigned long REGPARAM2 op_d198_3(uae_u32 opcode) /* ADD */
 {	uae_s32 dst = get_long(dsta);
 	m68k_areg(regs, dstreg) += 4;
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_d1a0_3(uae_u32 opcode) /* ADD */
@@ -21551,16 +18203,9 @@ unsigned long REGPARAM2 op_d1a0_3(uae_u32 opcode) /* ADD */
 	m68k_areg (regs, dstreg) = dsta;
 	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(2);
+}}}}}}m68k_incpc(2);
 return 10;
 }
 unsigned long REGPARAM2 op_d1a8_3(uae_u32 opcode) /* ADD */
@@ -21571,16 +18216,9 @@ unsigned long REGPARAM2 op_d1a8_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_d1b0_3(uae_u32 opcode) /* ADD */
@@ -21591,16 +18229,9 @@ unsigned long REGPARAM2 op_d1b0_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_d1b8_3(uae_u32 opcode) /* ADD */
@@ -21610,16 +18241,9 @@ unsigned long REGPARAM2 op_d1b8_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(4);
 return 12;
 }
 unsigned long REGPARAM2 op_d1b9_3(uae_u32 opcode) /* ADD */
@@ -21629,16 +18253,9 @@ unsigned long REGPARAM2 op_d1b9_3(uae_u32 opcode) /* ADD */
 {	uaecptr dsta = get_ilong(2);
 {	uae_s32 dst = get_long(dsta);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
 	put_long(dsta,newv);
-}}}}}}}m68k_incpc(6);
+}}}}}}m68k_incpc(6);
 return 14;
 }
 unsigned long REGPARAM2 op_d1c0_3(uae_u32 opcode) /* ADDA */
@@ -21896,7 +18513,7 @@ unsigned long REGPARAM2 op_e018_3(uae_u32 opcode) /* ROR */
 {	uae_u8 val = data;
 	uae_u32 cmask = 0x80;
 	cnt &= 63;
-	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
 	for(;cnt;--cnt){
 	carry=val&1; val = val >> 1;
 	if(carry) val |= cmask;
@@ -22018,7 +18635,7 @@ unsigned long REGPARAM2 op_e038_3(uae_u32 opcode) /* ROR */
 {	uae_u8 val = data;
 	uae_u32 cmask = 0x80;
 	cnt &= 63;
-	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
 	for(;cnt;--cnt){
 	carry=val&1; val = val >> 1;
 	if(carry) val |= cmask;
@@ -22136,7 +18753,7 @@ unsigned long REGPARAM2 op_e058_3(uae_u32 opcode) /* ROR */
 {	uae_u16 val = data;
 	uae_u32 cmask = 0x8000;
 	cnt &= 63;
-	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
 	for(;cnt;--cnt){
 	carry=val&1; val = val >> 1;
 	if(carry) val |= cmask;
@@ -22257,7 +18874,7 @@ unsigned long REGPARAM2 op_e078_3(uae_u32 opcode) /* ROR */
 {	uae_u16 val = data;
 	uae_u32 cmask = 0x8000;
 	cnt &= 63;
-	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
 	for(;cnt;--cnt){
 	carry=val&1; val = val >> 1;
 	if(carry) val |= cmask;
@@ -22375,7 +18992,7 @@ unsigned long REGPARAM2 op_e098_3(uae_u32 opcode) /* ROR */
 {	uae_u32 val = data;
 	uae_u32 cmask = 0x80000000;
 	cnt &= 63;
-	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
 	for(;cnt;--cnt){
 	carry=val&1; val = val >> 1;
 	if(carry) val |= cmask;
@@ -22495,7 +19112,7 @@ unsigned long REGPARAM2 op_e0b8_3(uae_u32 opcode) /* ROR */
 {	uae_u32 val = data;
 	uae_u32 cmask = 0x80000000;
 	cnt &= 63;
-	if (!cnt) { CFLG = 0; } else {	uae_u32 carry;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
 	for(;cnt;--cnt){
 	carry=val&1; val = val >> 1;
 	if(carry) val |= cmask;
@@ -22520,9 +19137,7 @@ unsigned long REGPARAM2 op_e0d0_3(uae_u32 opcode) /* ASRW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -22539,9 +19154,7 @@ unsigned long REGPARAM2 op_e0d8_3(uae_u32 opcode) /* ASRW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -22559,9 +19172,7 @@ unsigned long REGPARAM2 op_e0e0_3(uae_u32 opcode) /* ASRW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -22577,9 +19188,7 @@ unsigned long REGPARAM2 op_e0e8_3(uae_u32 opcode) /* ASRW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -22595,9 +19204,7 @@ unsigned long REGPARAM2 op_e0f0_3(uae_u32 opcode) /* ASRW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -22612,9 +19219,7 @@ unsigned long REGPARAM2 op_e0f8_3(uae_u32 opcode) /* ASRW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -22629,9 +19234,7 @@ unsigned long REGPARAM2 op_e0f9_3(uae_u32 opcode) /* ASRW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 cflg = val & 1;
 	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 	SET_CFLG (cflg);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23373,9 +19976,7 @@ unsigned long REGPARAM2 op_e1d0_3(uae_u32 opcode) /* ASLW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -23394,9 +19995,7 @@ unsigned long REGPARAM2 op_e1d8_3(uae_u32 opcode) /* ASLW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -23416,9 +20015,7 @@ unsigned long REGPARAM2 op_e1e0_3(uae_u32 opcode) /* ASLW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -23436,9 +20033,7 @@ unsigned long REGPARAM2 op_e1e8_3(uae_u32 opcode) /* ASLW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -23456,9 +20051,7 @@ unsigned long REGPARAM2 op_e1f0_3(uae_u32 opcode) /* ASLW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -23475,9 +20068,7 @@ unsigned long REGPARAM2 op_e1f8_3(uae_u32 opcode) /* ASLW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -23494,9 +20085,7 @@ unsigned long REGPARAM2 op_e1f9_3(uae_u32 opcode) /* ASLW */
 	uae_u32 sign = 0x8000 & val;
 	uae_u32 sign2;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 	sign2 = 0x8000 & val;
 	SET_CFLG (sign != 0);
 	COPY_CARRY;
@@ -23513,9 +20102,7 @@ unsigned long REGPARAM2 op_e2d0_3(uae_u32 opcode) /* LSRW */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23531,9 +20118,7 @@ unsigned long REGPARAM2 op_e2d8_3(uae_u32 opcode) /* LSRW */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23550,9 +20135,7 @@ unsigned long REGPARAM2 op_e2e0_3(uae_u32 opcode) /* LSRW */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23567,9 +20150,7 @@ unsigned long REGPARAM2 op_e2e8_3(uae_u32 opcode) /* LSRW */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23584,9 +20165,7 @@ unsigned long REGPARAM2 op_e2f0_3(uae_u32 opcode) /* LSRW */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23600,9 +20179,7 @@ unsigned long REGPARAM2 op_e2f8_3(uae_u32 opcode) /* LSRW */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23616,9 +20193,7 @@ unsigned long REGPARAM2 op_e2f9_3(uae_u32 opcode) /* LSRW */
 {	uae_u32 val = (uae_u16)data;
 	uae_u32 carry = val & 1;
 	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23633,9 +20208,7 @@ unsigned long REGPARAM2 op_e3d0_3(uae_u32 opcode) /* LSLW */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23651,9 +20224,7 @@ unsigned long REGPARAM2 op_e3d8_3(uae_u32 opcode) /* LSLW */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23670,9 +20241,7 @@ unsigned long REGPARAM2 op_e3e0_3(uae_u32 opcode) /* LSLW */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23687,9 +20256,7 @@ unsigned long REGPARAM2 op_e3e8_3(uae_u32 opcode) /* LSLW */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23704,9 +20271,7 @@ unsigned long REGPARAM2 op_e3f0_3(uae_u32 opcode) /* LSLW */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23720,9 +20285,7 @@ unsigned long REGPARAM2 op_e3f8_3(uae_u32 opcode) /* LSLW */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23736,9 +20299,7 @@ unsigned long REGPARAM2 op_e3f9_3(uae_u32 opcode) /* LSLW */
 {	uae_u16 val = data;
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23754,9 +20315,7 @@ unsigned long REGPARAM2 op_e4d0_3(uae_u32 opcode) /* ROXRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23773,9 +20332,7 @@ unsigned long REGPARAM2 op_e4d8_3(uae_u32 opcode) /* ROXRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23793,9 +20350,7 @@ unsigned long REGPARAM2 op_e4e0_3(uae_u32 opcode) /* ROXRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23811,9 +20366,7 @@ unsigned long REGPARAM2 op_e4e8_3(uae_u32 opcode) /* ROXRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23829,9 +20382,7 @@ unsigned long REGPARAM2 op_e4f0_3(uae_u32 opcode) /* ROXRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23846,9 +20397,7 @@ unsigned long REGPARAM2 op_e4f8_3(uae_u32 opcode) /* ROXRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23863,9 +20412,7 @@ unsigned long REGPARAM2 op_e4f9_3(uae_u32 opcode) /* ROXRW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23881,9 +20428,7 @@ unsigned long REGPARAM2 op_e5d0_3(uae_u32 opcode) /* ROXLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23900,9 +20445,7 @@ unsigned long REGPARAM2 op_e5d8_3(uae_u32 opcode) /* ROXLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23920,9 +20463,7 @@ unsigned long REGPARAM2 op_e5e0_3(uae_u32 opcode) /* ROXLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23938,9 +20479,7 @@ unsigned long REGPARAM2 op_e5e8_3(uae_u32 opcode) /* ROXLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23956,9 +20495,7 @@ unsigned long REGPARAM2 op_e5f0_3(uae_u32 opcode) /* ROXLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23973,9 +20510,7 @@ unsigned long REGPARAM2 op_e5f8_3(uae_u32 opcode) /* ROXLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -23990,9 +20525,7 @@ unsigned long REGPARAM2 op_e5f9_3(uae_u32 opcode) /* ROXLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	COPY_CARRY;
 	put_word(dataa,val);
@@ -24008,9 +20541,7 @@ unsigned long REGPARAM2 op_e6d0_3(uae_u32 opcode) /* RORW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -24026,9 +20557,7 @@ unsigned long REGPARAM2 op_e6d8_3(uae_u32 opcode) /* RORW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -24045,9 +20574,7 @@ unsigned long REGPARAM2 op_e6e0_3(uae_u32 opcode) /* RORW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -24062,9 +20589,7 @@ unsigned long REGPARAM2 op_e6e8_3(uae_u32 opcode) /* RORW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -24079,9 +20604,7 @@ unsigned long REGPARAM2 op_e6f0_3(uae_u32 opcode) /* RORW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -24095,9 +20618,7 @@ unsigned long REGPARAM2 op_e6f8_3(uae_u32 opcode) /* RORW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -24111,9 +20632,7 @@ unsigned long REGPARAM2 op_e6f9_3(uae_u32 opcode) /* RORW */
 	uae_u32 carry = val & 1;
 	val >>= 1;
 	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry);
 	put_word(dataa,val);
 }}}}m68k_incpc(6);
@@ -24128,9 +20647,7 @@ unsigned long REGPARAM2 op_e7d0_3(uae_u32 opcode) /* ROLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -24146,9 +20663,7 @@ unsigned long REGPARAM2 op_e7d8_3(uae_u32 opcode) /* ROLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -24165,9 +20680,7 @@ unsigned long REGPARAM2 op_e7e0_3(uae_u32 opcode) /* ROLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(2);
@@ -24182,9 +20695,7 @@ unsigned long REGPARAM2 op_e7e8_3(uae_u32 opcode) /* ROLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -24199,9 +20710,7 @@ unsigned long REGPARAM2 op_e7f0_3(uae_u32 opcode) /* ROLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -24215,9 +20724,7 @@ unsigned long REGPARAM2 op_e7f8_3(uae_u32 opcode) /* ROLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(4);
@@ -24231,9 +20738,7 @@ unsigned long REGPARAM2 op_e7f9_3(uae_u32 opcode) /* ROLW */
 	uae_u32 carry = val & 0x8000;
 	val <<= 1;
 	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
 SET_CFLG (carry >> 15);
 	put_word(dataa,val);
 }}}}m68k_incpc(6);
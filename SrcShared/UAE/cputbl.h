@@ -1582,3 +1582,1587 @@ extern cpuop_func op_e7e8_3;
 extern cpuop_func op_e7f0_3;
 extern cpuop_func op_e7f8_3;
 extern cpuop_func op_e7f9_3;
+extern cpuop_func op_0_4;
+extern cpuop_func op_10_4;
+extern cpuop_func op_18_4;
+extern cpuop_func op_20_4;
+extern cpuop_func op_28_4;
+extern cpuop_func op_30_4;
+extern cpuop_func op_38_4;
+extern cpuop_func op_39_4;
+extern cpuop_func op_3c_4;
+extern cpuop_func op_40_4;
+extern cpuop_func op_50_4;
+extern cpuop_func op_58_4;
+extern cpuop_func op_60_4;
+extern cpuop_func op_68_4;
+extern cpuop_func op_70_4;
+extern cpuop_func op_78_4;
+extern cpuop_func op_79_4;
+extern cpuop_func op_7c_4;
+extern cpuop_func op_80_4;
+extern cpuop_func op_90_4;
+extern cpuop_func op_98_4;
+extern cpuop_func op_a0_4;
+extern cpuop_func op_a8_4;
+extern cpuop_func op_b0_4;
+extern cpuop_func op_b8_4;
+extern cpuop_func op_b9_4;
+extern cpuop_func op_100_4;
+extern cpuop_func op_108_4;
+extern cpuop_func op_110_4;
+extern cpuop_func op_118_4;
+extern cpuop_func op_120_4;
+extern cpuop_func op_128_4;
+extern cpuop_func op_130_4;
+extern cpuop_func op_138_4;
+extern cpuop_func op_139_4;
+extern cpuop_func op_13a_4;
+extern cpuop_func op_13b_4;
+extern cpuop_func op_13c_4;
+extern cpuop_func op_140_4;
+extern cpuop_func op_148_4;
+extern cpuop_func op_150_4;
+extern cpuop_func op_158_4;
+extern cpuop_func op_160_4;
+extern cpuop_func op_168_4;
+extern cpuop_func op_170_4;
+extern cpuop_func op_178_4;
+extern cpuop_func op_179_4;
+extern cpuop_func op_17a_4;
+extern cpuop_func op_17b_4;
+extern cpuop_func op_180_4;
+extern cpuop_func op_188_4;
+extern cpuop_func op_190_4;
+extern cpuop_func op_198_4;
+extern cpuop_func op_1a0_4;
+extern cpuop_func op_1a8_4;
+extern cpuop_func op_1b0_4;
+extern cpuop_func op_1b8_4;
+extern cpuop_func op_1b9_4;
+extern cpuop_func op_1ba_4;
+extern cpuop_func op_1bb_4;
+extern cpuop_func op_1c0_4;
+extern cpuop_func op_1c8_4;
+extern cpuop_func op_1d0_4;
+extern cpuop_func op_1d8_4;
+extern cpuop_func op_1e0_4;
+extern cpuop_func op_1e8_4;
+extern cpuop_func op_1f0_4;
+extern cpuop_func op_1f8_4;
+extern cpuop_func op_1f9_4;
+extern cpuop_func op_1fa_4;
+extern cpuop_func op_1fb_4;
+extern cpuop_func op_200_4;
+extern cpuop_func op_210_4;
+extern cpuop_func op_218_4;
+extern cpuop_func op_220_4;
+extern cpuop_func op_228_4;
+extern cpuop_func op_230_4;
+extern cpuop_func op_238_4;
+extern cpuop_func op_239_4;
+extern cpuop_func op_23c_4;
+extern cpuop_func op_240_4;
+extern cpuop_func op_250_4;
+extern cpuop_func op_258_4;
+extern cpuop_func op_260_4;
+extern cpuop_func op_268_4;
+extern cpuop_func op_270_4;
+extern cpuop_func op_278_4;
+extern cpuop_func op_279_4;
+extern cpuop_func op_27c_4;
+extern cpuop_func op_280_4;
+extern cpuop_func op_290_4;
+extern cpuop_func op_298_4;
+extern cpuop_func op_2a0_4;
+extern cpuop_func op_2a8_4;
+extern cpuop_func op_2b0_4;
+extern cpuop_func op_2b8_4;
+extern cpuop_func op_2b9_4;
+extern cpuop_func op_400_4;
+extern cpuop_func op_410_4;
+extern cpuop_func op_418_4;
+extern cpuop_func op_420_4;
+extern cpuop_func op_428_4;
+extern cpuop_func op_430_4;
+extern cpuop_func op_438_4;
+extern cpuop_func op_439_4;
+extern cpuop_func op_440_4;
+extern cpuop_func op_450_4;
+extern cpuop_func op_458_4;
+extern cpuop_func op_460_4;
+extern cpuop_func op_468_4;
+extern cpuop_func op_470_4;
+extern cpuop_func op_478_4;
+extern cpuop_func op_479_4;
+extern cpuop_func op_480_4;
+extern cpuop_func op_490_4;
+extern cpuop_func op_498_4;
+extern cpuop_func op_4a0_4;
+extern cpuop_func op_4a8_4;
+extern cpuop_func op_4b0_4;
+extern cpuop_func op_4b8_4;
+extern cpuop_func op_4b9_4;
+extern cpuop_func op_600_4;
+extern cpuop_func op_610_4;
+extern cpuop_func op_618_4;
+extern cpuop_func op_620_4;
+extern cpuop_func op_628_4;
+extern cpuop_func op_630_4;
+extern cpuop_func op_638_4;
+extern cpuop_func op_639_4;
+extern cpuop_func op_640_4;
+extern cpuop_func op_650_4;
+extern cpuop_func op_658_4;
+extern cpuop_func op_660_4;
+extern cpuop_func op_668_4;
+extern cpuop_func op_670_4;
+extern cpuop_func op_678_4;
+extern cpuop_func op_679_4;
+extern cpuop_func op_680_4;
+extern cpuop_func op_690_4;
+extern cpuop_func op_698_4;
+extern cpuop_func op_6a0_4;
+extern cpuop_func op_6a8_4;
+extern cpuop_func op_6b0_4;
+extern cpuop_func op_6b8_4;
+extern cpuop_func op_6b9_4;
+extern cpuop_func op_800_4;
+extern cpuop_func op_810_4;
+extern cpuop_func op_818_4;
+extern cpuop_func op_820_4;
+extern cpuop_func op_828_4;
+extern cpuop_func op_830_4;
+extern cpuop_func op_838_4;
+extern cpuop_func op_839_4;
+extern cpuop_func op_83a_4;
+extern cpuop_func op_83b_4;
+extern cpuop_func op_83c_4;
+extern cpuop_func op_840_4;
+extern cpuop_func op_850_4;
+extern cpuop_func op_858_4;
+extern cpuop_func op_860_4;
+extern cpuop_func op_868_4;
+extern cpuop_func op_870_4;
+extern cpuop_func op_878_4;
+extern cpuop_func op_879_4;
+extern cpuop_func op_87a_4;
+extern cpuop_func op_87b_4;
+extern cpuop_func op_880_4;
+extern cpuop_func op_890_4;
+extern cpuop_func op_898_4;
+extern cpuop_func op_8a0_4;
+extern cpuop_func op_8a8_4;
+extern cpuop_func op_8b0_4;
+extern cpuop_func op_8b8_4;
+extern cpuop_func op_8b9_4;
+extern cpuop_func op_8ba_4;
+extern cpuop_func op_8bb_4;
+extern cpuop_func op_8c0_4;
+extern cpuop_func op_8d0_4;
+extern cpuop_func op_8d8_4;
+extern cpuop_func op_8e0_4;
+extern cpuop_func op_8e8_4;
+extern cpuop_func op_8f0_4;
+extern cpuop_func op_8f8_4;
+extern cpuop_func op_8f9_4;
+extern cpuop_func op_8fa_4;
+extern cpuop_func op_8fb_4;
+extern cpuop_func op_a00_4;
+extern cpuop_func op_a10_4;
+extern cpuop_func op_a18_4;
+extern cpuop_func op_a20_4;
+extern cpuop_func op_a28_4;
+extern cpuop_func op_a30_4;
+extern cpuop_func op_a38_4;
+extern cpuop_func op_a39_4;
+extern cpuop_func op_a3c_4;
+extern cpuop_func op_a40_4;
+extern cpuop_func op_a50_4;
+extern cpuop_func op_a58_4;
+extern cpuop_func op_a60_4;
+extern cpuop_func op_a68_4;
+extern cpuop_func op_a70_4;
+extern cpuop_func op_a78_4;
+extern cpuop_func op_a79_4;
+extern cpuop_func op_a7c_4;
+extern cpuop_func op_a80_4;
+extern cpuop_func op_a90_4;
+extern cpuop_func op_a98_4;
+extern cpuop_func op_aa0_4;
+extern cpuop_func op_aa8_4;
+extern cpuop_func op_ab0_4;
+extern cpuop_func op_ab8_4;
+extern cpuop_func op_ab9_4;
+extern cpuop_func op_c00_4;
+extern cpuop_func op_c10_4;
+extern cpuop_func op_c18_4;
+extern cpuop_func op_c20_4;
+extern cpuop_func op_c28_4;
+extern cpuop_func op_c30_4;
+extern cpuop_func op_c38_4;
+extern cpuop_func op_c39_4;
+extern cpuop_func op_c3a_4;
+extern cpuop_func op_c3b_4;
+extern cpuop_func op_c40_4;
+extern cpuop_func op_c50_4;
+extern cpuop_func op_c58_4;
+extern cpuop_func op_c60_4;
+extern cpuop_func op_c68_4;
+extern cpuop_func op_c70_4;
+extern cpuop_func op_c78_4;
+extern cpuop_func op_c79_4;
+extern cpuop_func op_c7a_4;
+extern cpuop_func op_c7b_4;
+extern cpuop_func op_c80_4;
+extern cpuop_func op_c90_4;
+extern cpuop_func op_c98_4;
+extern cpuop_func op_ca0_4;
+extern cpuop_func op_ca8_4;
+extern cpuop_func op_cb0_4;
+extern cpuop_func op_cb8_4;
+extern cpuop_func op_cb9_4;
+extern cpuop_func op_cba_4;
+extern cpuop_func op_cbb_4;
+extern cpuop_func op_1000_4;
+extern cpuop_func op_1010_4;
+extern cpuop_func op_1018_4;
+extern cpuop_func op_1020_4;
+extern cpuop_func op_1028_4;
+extern cpuop_func op_1030_4;
+extern cpuop_func op_1038_4;
+extern cpuop_func op_1039_4;
+extern cpuop_func op_103a_4;
+extern cpuop_func op_103b_4;
+extern cpuop_func op_103c_4;
+extern cpuop_func op_1080_4;
+extern cpuop_func op_1090_4;
+extern cpuop_func op_1098_4;
+extern cpuop_func op_10a0_4;
+extern cpuop_func op_10a8_4;
+extern cpuop_func op_10b0_4;
+extern cpuop_func op_10b8_4;
+extern cpuop_func op_10b9_4;
+extern cpuop_func op_10ba_4;
+extern cpuop_func op_10bb_4;
+extern cpuop_func op_10bc_4;
+extern cpuop_func op_10c0_4;
+extern cpuop_func op_10d0_4;
+extern cpuop_func op_10d8_4;
+extern cpuop_func op_10e0_4;
+extern cpuop_func op_10e8_4;
+extern cpuop_func op_10f0_4;
+extern cpuop_func op_10f8_4;
+extern cpuop_func op_10f9_4;
+extern cpuop_func op_10fa_4;
+extern cpuop_func op_10fb_4;
+extern cpuop_func op_10fc_4;
+extern cpuop_func op_1100_4;
+extern cpuop_func op_1110_4;
+extern cpuop_func op_1118_4;
+extern cpuop_func op_1120_4;
+extern cpuop_func op_1128_4;
+extern cpuop_func op_1130_4;
+extern cpuop_func op_1138_4;
+extern cpuop_func op_1139_4;
+extern cpuop_func op_113a_4;
+extern cpuop_func op_113b_4;
+extern cpuop_func op_113c_4;
+extern cpuop_func op_1140_4;
+extern cpuop_func op_1150_4;
+extern cpuop_func op_1158_4;
+extern cpuop_func op_1160_4;
+extern cpuop_func op_1168_4;
+extern cpuop_func op_1170_4;
+extern cpuop_func op_1178_4;
+extern cpuop_func op_1179_4;
+extern cpuop_func op_117a_4;
+extern cpuop_func op_117b_4;
+extern cpuop_func op_117c_4;
+extern cpuop_func op_1180_4;
+extern cpuop_func op_1190_4;
+extern cpuop_func op_1198_4;
+extern cpuop_func op_11a0_4;
+extern cpuop_func op_11a8_4;
+extern cpuop_func op_11b0_4;
+extern cpuop_func op_11b8_4;
+extern cpuop_func op_11b9_4;
+extern cpuop_func op_11ba_4;
+extern cpuop_func op_11bb_4;
+extern cpuop_func op_11bc_4;
+extern cpuop_func op_11c0_4;
+extern cpuop_func op_11d0_4;
+extern cpuop_func op_11d8_4;
+extern cpuop_func op_11e0_4;
+extern cpuop_func op_11e8_4;
+extern cpuop_func op_11f0_4;
+extern cpuop_func op_11f8_4;
+extern cpuop_func op_11f9_4;
+extern cpuop_func op_11fa_4;
+extern cpuop_func op_11fb_4;
+extern cpuop_func op_11fc_4;
+extern cpuop_func op_13c0_4;
+extern cpuop_func op_13d0_4;
+extern cpuop_func op_13d8_4;
+extern cpuop_func op_13e0_4;
+extern cpuop_func op_13e8_4;
+extern cpuop_func op_13f0_4;
+extern cpuop_func op_13f8_4;
+extern cpuop_func op_13f9_4;
+extern cpuop_func op_13fa_4;
+extern cpuop_func op_13fb_4;
+extern cpuop_func op_13fc_4;
+extern cpuop_func op_2000_4;
+extern cpuop_func op_2008_4;
+extern cpuop_func op_2010_4;
+extern cpuop_func op_2018_4;
+extern cpuop_func op_2020_4;
+extern cpuop_func op_2028_4;
+extern cpuop_func op_2030_4;
+extern cpuop_func op_2038_4;
+extern cpuop_func op_2039_4;
+extern cpuop_func op_203a_4;
+extern cpuop_func op_203b_4;
+extern cpuop_func op_203c_4;
+extern cpuop_func op_2040_4;
+extern cpuop_func op_2048_4;
+extern cpuop_func op_2050_4;
+extern cpuop_func op_2058_4;
+extern cpuop_func op_2060_4;
+extern cpuop_func op_2068_4;
+extern cpuop_func op_2070_4;
+extern cpuop_func op_2078_4;
+extern cpuop_func op_2079_4;
+extern cpuop_func op_207a_4;
+extern cpuop_func op_207b_4;
+extern cpuop_func op_207c_4;
+extern cpuop_func op_2080_4;
+extern cpuop_func op_2088_4;
+extern cpuop_func op_2090_4;
+extern cpuop_func op_2098_4;
+extern cpuop_func op_20a0_4;
+extern cpuop_func op_20a8_4;
+extern cpuop_func op_20b0_4;
+extern cpuop_func op_20b8_4;
+extern cpuop_func op_20b9_4;
+extern cpuop_func op_20ba_4;
+extern cpuop_func op_20bb_4;
+extern cpuop_func op_20bc_4;
+extern cpuop_func op_20c0_4;
+extern cpuop_func op_20c8_4;
+extern cpuop_func op_20d0_4;
+extern cpuop_func op_20d8_4;
+extern cpuop_func op_20e0_4;
+extern cpuop_func op_20e8_4;
+extern cpuop_func op_20f0_4;
+extern cpuop_func op_20f8_4;
+extern cpuop_func op_20f9_4;
+extern cpuop_func op_20fa_4;
+extern cpuop_func op_20fb_4;
+extern cpuop_func op_20fc_4;
+extern cpuop_func op_2100_4;
+extern cpuop_func op_2108_4;
+extern cpuop_func op_2110_4;
+extern cpuop_func op_2118_4;
+extern cpuop_func op_2120_4;
+extern cpuop_func op_2128_4;
+extern cpuop_func op_2130_4;
+extern cpuop_func op_2138_4;
+extern cpuop_func op_2139_4;
+extern cpuop_func op_213a_4;
+extern cpuop_func op_213b_4;
+extern cpuop_func op_213c_4;
+extern cpuop_func op_2140_4;
+extern cpuop_func op_2148_4;
+extern cpuop_func op_2150_4;
+extern cpuop_func op_2158_4;
+extern cpuop_func op_2160_4;
+extern cpuop_func op_2168_4;
+extern cpuop_func op_2170_4;
+extern cpuop_func op_2178_4;
+extern cpuop_func op_2179_4;
+extern cpuop_func op_217a_4;
+extern cpuop_func op_217b_4;
+extern cpuop_func op_217c_4;
+extern cpuop_func op_2180_4;
+extern cpuop_func op_2188_4;
+extern cpuop_func op_2190_4;
+extern cpuop_func op_2198_4;
+extern cpuop_func op_21a0_4;
+extern cpuop_func op_21a8_4;
+extern cpuop_func op_21b0_4;
+extern cpuop_func op_21b8_4;
+extern cpuop_func op_21b9_4;
+extern cpuop_func op_21ba_4;
+extern cpuop_func op_21bb_4;
+extern cpuop_func op_21bc_4;
+extern cpuop_func op_21c0_4;
+extern cpuop_func op_21c8_4;
+extern cpuop_func op_21d0_4;
+extern cpuop_func op_21d8_4;
+extern cpuop_func op_21e0_4;
+extern cpuop_func op_21e8_4;
+extern cpuop_func op_21f0_4;
+extern cpuop_func op_21f8_4;
+extern cpuop_func op_21f9_4;
+extern cpuop_func op_21fa_4;
+extern cpuop_func op_21fb_4;
+extern cpuop_func op_21fc_4;
+extern cpuop_func op_23c0_4;
+extern cpuop_func op_23c8_4;
+extern cpuop_func op_23d0_4;
+extern cpuop_func op_23d8_4;
+extern cpuop_func op_23e0_4;
+extern cpuop_func op_23e8_4;
+extern cpuop_func op_23f0_4;
+extern cpuop_func op_23f8_4;
+extern cpuop_func op_23f9_4;
+extern cpuop_func op_23fa_4;
+extern cpuop_func op_23fb_4;
+extern cpuop_func op_23fc_4;
+extern cpuop_func op_3000_4;
+extern cpuop_func op_3008_4;
+extern cpuop_func op_3010_4;
+extern cpuop_func op_3018_4;
+extern cpuop_func op_3020_4;
+extern cpuop_func op_3028_4;
+extern cpuop_func op_3030_4;
+extern cpuop_func op_3038_4;
+extern cpuop_func op_3039_4;
+extern cpuop_func op_303a_4;
+extern cpuop_func op_303b_4;
+extern cpuop_func op_303c_4;
+extern cpuop_func op_3040_4;
+extern cpuop_func op_3048_4;
+extern cpuop_func op_3050_4;
+extern cpuop_func op_3058_4;
+extern cpuop_func op_3060_4;
+extern cpuop_func op_3068_4;
+extern cpuop_func op_3070_4;
+extern cpuop_func op_3078_4;
+extern cpuop_func op_3079_4;
+extern cpuop_func op_307a_4;
+extern cpuop_func op_307b_4;
+extern cpuop_func op_307c_4;
+extern cpuop_func op_3080_4;
+extern cpuop_func op_3088_4;
+extern cpuop_func op_3090_4;
+extern cpuop_func op_3098_4;
+extern cpuop_func op_30a0_4;
+extern cpuop_func op_30a8_4;
+extern cpuop_func op_30b0_4;
+extern cpuop_func op_30b8_4;
+extern cpuop_func op_30b9_4;
+extern cpuop_func op_30ba_4;
+extern cpuop_func op_30bb_4;
+extern cpuop_func op_30bc_4;
+extern cpuop_func op_30c0_4;
+extern cpuop_func op_30c8_4;
+extern cpuop_func op_30d0_4;
+extern cpuop_func op_30d8_4;
+extern cpuop_func op_30e0_4;
+extern cpuop_func op_30e8_4;
+extern cpuop_func op_30f0_4;
+extern cpuop_func op_30f8_4;
+extern cpuop_func op_30f9_4;
+extern cpuop_func op_30fa_4;
+extern cpuop_func op_30fb_4;
+extern cpuop_func op_30fc_4;
+extern cpuop_func op_3100_4;
+extern cpuop_func op_3108_4;
+extern cpuop_func op_3110_4;
+extern cpuop_func op_3118_4;
+extern cpuop_func op_3120_4;
+extern cpuop_func op_3128_4;
+extern cpuop_func op_3130_4;
+extern cpuop_func op_3138_4;
+extern cpuop_func op_3139_4;
+extern cpuop_func op_313a_4;
+extern cpuop_func op_313b_4;
+extern cpuop_func op_313c_4;
+extern cpuop_func op_3140_4;
+extern cpuop_func op_3148_4;
+extern cpuop_func op_3150_4;
+extern cpuop_func op_3158_4;
+extern cpuop_func op_3160_4;
+extern cpuop_func op_3168_4;
+extern cpuop_func op_3170_4;
+extern cpuop_func op_3178_4;
+extern cpuop_func op_3179_4;
+extern cpuop_func op_317a_4;
+extern cpuop_func op_317b_4;
+extern cpuop_func op_317c_4;
+extern cpuop_func op_3180_4;
+extern cpuop_func op_3188_4;
+extern cpuop_func op_3190_4;
+extern cpuop_func op_3198_4;
+extern cpuop_func op_31a0_4;
+extern cpuop_func op_31a8_4;
+extern cpuop_func op_31b0_4;
+extern cpuop_func op_31b8_4;
+extern cpuop_func op_31b9_4;
+extern cpuop_func op_31ba_4;
+extern cpuop_func op_31bb_4;
+extern cpuop_func op_31bc_4;
+extern cpuop_func op_31c0_4;
+extern cpuop_func op_31c8_4;
+extern cpuop_func op_31d0_4;
+extern cpuop_func op_31d8_4;
+extern cpuop_func op_31e0_4;
+extern cpuop_func op_31e8_4;
+extern cpuop_func op_31f0_4;
+extern cpuop_func op_31f8_4;
+extern cpuop_func op_31f9_4;
+extern cpuop_func op_31fa_4;
+extern cpuop_func op_31fb_4;
+extern cpuop_func op_31fc_4;
+extern cpuop_func op_33c0_4;
+extern cpuop_func op_33c8_4;
+extern cpuop_func op_33d0_4;
+extern cpuop_func op_33d8_4;
+extern cpuop_func op_33e0_4;
+extern cpuop_func op_33e8_4;
+extern cpuop_func op_33f0_4;
+extern cpuop_func op_33f8_4;
+extern cpuop_func op_33f9_4;
+extern cpuop_func op_33fa_4;
+extern cpuop_func op_33fb_4;
+extern cpuop_func op_33fc_4;
+extern cpuop_func op_4000_4;
+extern cpuop_func op_4010_4;
+extern cpuop_func op_4018_4;
+extern cpuop_func op_4020_4;
+extern cpuop_func op_4028_4;
+extern cpuop_func op_4030_4;
+extern cpuop_func op_4038_4;
+extern cpuop_func op_4039_4;
+extern cpuop_func op_4040_4;
+extern cpuop_func op_4050_4;
+extern cpuop_func op_4058_4;
+extern cpuop_func op_4060_4;
+extern cpuop_func op_4068_4;
+extern cpuop_func op_4070_4;
+extern cpuop_func op_4078_4;
+extern cpuop_func op_4079_4;
+extern cpuop_func op_4080_4;
+extern cpuop_func op_4090_4;
+extern cpuop_func op_4098_4;
+extern cpuop_func op_40a0_4;
+extern cpuop_func op_40a8_4;
+extern cpuop_func op_40b0_4;
+extern cpuop_func op_40b8_4;
+extern cpuop_func op_40b9_4;
+extern cpuop_func op_40c0_4;
+extern cpuop_func op_40d0_4;
+extern cpuop_func op_40d8_4;
+extern cpuop_func op_40e0_4;
+extern cpuop_func op_40e8_4;
+extern cpuop_func op_40f0_4;
+extern cpuop_func op_40f8_4;
+extern cpuop_func op_40f9_4;
+extern cpuop_func op_4100_4;
+extern cpuop_func op_4110_4;
+extern cpuop_func op_4118_4;
+extern cpuop_func op_4120_4;
+extern cpuop_func op_4128_4;
+extern cpuop_func op_4130_4;
+extern cpuop_func op_4138_4;
+extern cpuop_func op_4139_4;
+extern cpuop_func op_413a_4;
+extern cpuop_func op_413b_4;
+extern cpuop_func op_413c_4;
+extern cpuop_func op_4180_4;
+extern cpuop_func op_4190_4;
+extern cpuop_func op_4198_4;
+extern cpuop_func op_41a0_4;
+extern cpuop_func op_41a8_4;
+extern cpuop_func op_41b0_4;
+extern cpuop_func op_41b8_4;
+extern cpuop_func op_41b9_4;
+extern cpuop_func op_41ba_4;
+extern cpuop_func op_41bb_4;
+extern cpuop_func op_41bc_4;
+extern cpuop_func op_41d0_4;
+extern cpuop_func op_41e8_4;
+extern cpuop_func op_41f0_4;
+extern cpuop_func op_41f8_4;
+extern cpuop_func op_41f9_4;
+extern cpuop_func op_41fa_4;
+extern cpuop_func op_41fb_4;
+extern cpuop_func op_4200_4;
+extern cpuop_func op_4210_4;
+extern cpuop_func op_4218_4;
+extern cpuop_func op_4220_4;
+extern cpuop_func op_4228_4;
+extern cpuop_func op_4230_4;
+extern cpuop_func op_4238_4;
+extern cpuop_func op_4239_4;
+extern cpuop_func op_4240_4;
+extern cpuop_func op_4250_4;
+extern cpuop_func op_4258_4;
+extern cpuop_func op_4260_4;
+extern cpuop_func op_4268_4;
+extern cpuop_func op_4270_4;
+extern cpuop_func op_4278_4;
+extern cpuop_func op_4279_4;
+extern cpuop_func op_4280_4;
+extern cpuop_func op_4290_4;
+extern cpuop_func op_4298_4;
+extern cpuop_func op_42a0_4;
+extern cpuop_func op_42a8_4;
+extern cpuop_func op_42b0_4;
+extern cpuop_func op_42b8_4;
+extern cpuop_func op_42b9_4;
+extern cpuop_func op_4400_4;
+extern cpuop_func op_4410_4;
+extern cpuop_func op_4418_4;
+extern cpuop_func op_4420_4;
+extern cpuop_func op_4428_4;
+extern cpuop_func op_4430_4;
+extern cpuop_func op_4438_4;
+extern cpuop_func op_4439_4;
+extern cpuop_func op_4440_4;
+extern cpuop_func op_4450_4;
+extern cpuop_func op_4458_4;
+extern cpuop_func op_4460_4;
+extern cpuop_func op_4468_4;
+extern cpuop_func op_4470_4;
+extern cpuop_func op_4478_4;
+extern cpuop_func op_4479_4;
+extern cpuop_func op_4480_4;
+extern cpuop_func op_4490_4;
+extern cpuop_func op_4498_4;
+extern cpuop_func op_44a0_4;
+extern cpuop_func op_44a8_4;
+extern cpuop_func op_44b0_4;
+extern cpuop_func op_44b8_4;
+extern cpuop_func op_44b9_4;
+extern cpuop_func op_44c0_4;
+extern cpuop_func op_44d0_4;
+extern cpuop_func op_44d8_4;
+extern cpuop_func op_44e0_4;
+extern cpuop_func op_44e8_4;
+extern cpuop_func op_44f0_4;
+extern cpuop_func op_44f8_4;
+extern cpuop_func op_44f9_4;
+extern cpuop_func op_44fa_4;
+extern cpuop_func op_44fb_4;
+extern cpuop_func op_44fc_4;
+extern cpuop_func op_4600_4;
+extern cpuop_func op_4610_4;
+extern cpuop_func op_4618_4;
+extern cpuop_func op_4620_4;
+extern cpuop_func op_4628_4;
+extern cpuop_func op_4630_4;
+extern cpuop_func op_4638_4;
+extern cpuop_func op_4639_4;
+extern cpuop_func op_4640_4;
+extern cpuop_func op_4650_4;
+extern cpuop_func op_4658_4;
+extern cpuop_func op_4660_4;
+extern cpuop_func op_4668_4;
+extern cpuop_func op_4670_4;
+extern cpuop_func op_4678_4;
+extern cpuop_func op_4679_4;
+extern cpuop_func op_4680_4;
+extern cpuop_func op_4690_4;
+extern cpuop_func op_4698_4;
+extern cpuop_func op_46a0_4;
+extern cpuop_func op_46a8_4;
+extern cpuop_func op_46b0_4;
+extern cpuop_func op_46b8_4;
+extern cpuop_func op_46b9_4;
+extern cpuop_func op_46c0_4;
+extern cpuop_func op_46d0_4;
+extern cpuop_func op_46d8_4;
+extern cpuop_func op_46e0_4;
+extern cpuop_func op_46e8_4;
+extern cpuop_func op_46f0_4;
+extern cpuop_func op_46f8_4;
+extern cpuop_func op_46f9_4;
+extern cpuop_func op_46fa_4;
+extern cpuop_func op_46fb_4;
+extern cpuop_func op_46fc_4;
+extern cpuop_func op_4800_4;
+extern cpuop_func op_4810_4;
+extern cpuop_func op_4818_4;
+extern cpuop_func op_4820_4;
+extern cpuop_func op_4828_4;
+extern cpuop_func op_4830_4;
+extern cpuop_func op_4838_4;
+extern cpuop_func op_4839_4;
+extern cpuop_func op_4840_4;
+extern cpuop_func op_4850_4;
+extern cpuop_func op_4868_4;
+extern cpuop_func op_4870_4;
+extern cpuop_func op_4878_4;
+extern cpuop_func op_4879_4;
+extern cpuop_func op_487a_4;
+extern cpuop_func op_487b_4;
+extern cpuop_func op_4880_4;
+extern cpuop_func op_4890_4;
+extern cpuop_func op_48a0_4;
+extern cpuop_func op_48a8_4;
+extern cpuop_func op_48b0_4;
+extern cpuop_func op_48b8_4;
+extern cpuop_func op_48b9_4;
+extern cpuop_func op_48c0_4;
+extern cpuop_func op_48d0_4;
+extern cpuop_func op_48e0_4;
+extern cpuop_func op_48e8_4;
+extern cpuop_func op_48f0_4;
+extern cpuop_func op_48f8_4;
+extern cpuop_func op_48f9_4;
+extern cpuop_func op_49c0_4;
+extern cpuop_func op_4a00_4;
+extern cpuop_func op_4a10_4;
+extern cpuop_func op_4a18_4;
+extern cpuop_func op_4a20_4;
+extern cpuop_func op_4a28_4;
+extern cpuop_func op_4a30_4;
+extern cpuop_func op_4a38_4;
+extern cpuop_func op_4a39_4;
+extern cpuop_func op_4a3a_4;
+extern cpuop_func op_4a3b_4;
+extern cpuop_func op_4a3c_4;
+extern cpuop_func op_4a40_4;
+extern cpuop_func op_4a48_4;
+extern cpuop_func op_4a50_4;
+extern cpuop_func op_4a58_4;
+extern cpuop_func op_4a60_4;
+extern cpuop_func op_4a68_4;
+extern cpuop_func op_4a70_4;
+extern cpuop_func op_4a78_4;
+extern cpuop_func op_4a79_4;
+extern cpuop_func op_4a7a_4;
+extern cpuop_func op_4a7b_4;
+extern cpuop_func op_4a7c_4;
+extern cpuop_func op_4a80_4;
+extern cpuop_func op_4a88_4;
+extern cpuop_func op_4a90_4;
+extern cpuop_func op_4a98_4;
+extern cpuop_func op_4aa0_4;
+extern cpuop_func op_4aa8_4;
+extern cpuop_func op_4ab0_4;
+extern cpuop_func op_4ab8_4;
+extern cpuop_func op_4ab9_4;
+extern cpuop_func op_4aba_4;
+extern cpuop_func op_4abb_4;
+extern cpuop_func op_4abc_4;
+extern cpuop_func op_4ac0_4;
+extern cpuop_func op_4ad0_4;
+extern cpuop_func op_4ad8_4;
+extern cpuop_func op_4ae0_4;
+extern cpuop_func op_4ae8_4;
+extern cpuop_func op_4af0_4;
+extern cpuop_func op_4af8_4;
+extern cpuop_func op_4af9_4;
+extern cpuop_func op_4c90_4;
+extern cpuop_func op_4c98_4;
+extern cpuop_func op_4ca8_4;
+extern cpuop_func op_4cb0_4;
+extern cpuop_func op_4cb8_4;
+extern cpuop_func op_4cb9_4;
+extern cpuop_func op_4cba_4;
+extern cpuop_func op_4cbb_4;
+extern cpuop_func op_4cd0_4;
+extern cpuop_func op_4cd8_4;
+extern cpuop_func op_4ce8_4;
+extern cpuop_func op_4cf0_4;
+extern cpuop_func op_4cf8_4;
+extern cpuop_func op_4cf9_4;
+extern cpuop_func op_4cfa_4;
+extern cpuop_func op_4cfb_4;
+extern cpuop_func op_4e40_4;
+extern cpuop_func op_4e50_4;
+extern cpuop_func op_4e58_4;
+extern cpuop_func op_4e60_4;
+extern cpuop_func op_4e68_4;
+extern cpuop_func op_4e70_4;
+extern cpuop_func op_4e71_4;
+extern cpuop_func op_4e72_4;
+extern cpuop_func op_4e73_4;
+extern cpuop_func op_4e74_4;
+extern cpuop_func op_4e75_4;
+extern cpuop_func op_4e76_4;
+extern cpuop_func op_4e77_4;
+extern cpuop_func op_4e90_4;
+extern cpuop_func op_4ea8_4;
+extern cpuop_func op_4eb0_4;
+extern cpuop_func op_4eb8_4;
+extern cpuop_func op_4eb9_4;
+extern cpuop_func op_4eba_4;
+extern cpuop_func op_4ebb_4;
+extern cpuop_func op_4ed0_4;
+extern cpuop_func op_4ee8_4;
+extern cpuop_func op_4ef0_4;
+extern cpuop_func op_4ef8_4;
+extern cpuop_func op_4ef9_4;
+extern cpuop_func op_4efa_4;
+extern cpuop_func op_4efb_4;
+extern cpuop_func op_5000_4;
+extern cpuop_func op_5010_4;
+extern cpuop_func op_5018_4;
+extern cpuop_func op_5020_4;
+extern cpuop_func op_5028_4;
+extern cpuop_func op_5030_4;
+extern cpuop_func op_5038_4;
+extern cpuop_func op_5039_4;
+extern cpuop_func op_5040_4;
+extern cpuop_func op_5048_4;
+extern cpuop_func op_5050_4;
+extern cpuop_func op_5058_4;
+extern cpuop_func op_5060_4;
+extern cpuop_func op_5068_4;
+extern cpuop_func op_5070_4;
+extern cpuop_func op_5078_4;
+extern cpuop_func op_5079_4;
+extern cpuop_func op_5080_4;
+extern cpuop_func op_5088_4;
+extern cpuop_func op_5090_4;
+extern cpuop_func op_5098_4;
+extern cpuop_func op_50a0_4;
+extern cpuop_func op_50a8_4;
+extern cpuop_func op_50b0_4;
+extern cpuop_func op_50b8_4;
+extern cpuop_func op_50b9_4;
+extern cpuop_func op_50c0_4;
+extern cpuop_func op_50c8_4;
+extern cpuop_func op_50d0_4;
+extern cpuop_func op_50d8_4;
+extern cpuop_func op_50e0_4;
+extern cpuop_func op_50e8_4;
+extern cpuop_func op_50f0_4;
+extern cpuop_func op_50f8_4;
+extern cpuop_func op_50f9_4;
+extern cpuop_func op_5100_4;
+extern cpuop_func op_5110_4;
+extern cpuop_func op_5118_4;
+extern cpuop_func op_5120_4;
+extern cpuop_func op_5128_4;
+extern cpuop_func op_5130_4;
+extern cpuop_func op_5138_4;
+extern cpuop_func op_5139_4;
+extern cpuop_func op_5140_4;
+extern cpuop_func op_5148_4;
+extern cpuop_func op_5150_4;
+extern cpuop_func op_5158_4;
+extern cpuop_func op_5160_4;
+extern cpuop_func op_5168_4;
+extern cpuop_func op_5170_4;
+extern cpuop_func op_5178_4;
+extern cpuop_func op_5179_4;
+extern cpuop_func op_5180_4;
+extern cpuop_func op_5188_4;
+extern cpuop_func op_5190_4;
+extern cpuop_func op_5198_4;
+extern cpuop_func op_51a0_4;
+extern cpuop_func op_51a8_4;
+extern cpuop_func op_51b0_4;
+extern cpuop_func op_51b8_4;
+extern cpuop_func op_51b9_4;
+extern cpuop_func op_51c0_4;
+extern cpuop_func op_51c8_4;
+extern cpuop_func op_51d0_4;
+extern cpuop_func op_51d8_4;
+extern cpuop_func op_51e0_4;
+extern cpuop_func op_51e8_4;
+extern cpuop_func op_51f0_4;
+extern cpuop_func op_51f8_4;
+extern cpuop_func op_51f9_4;
+extern cpuop_func op_52c0_4;
+extern cpuop_func op_52c8_4;
+extern cpuop_func op_52d0_4;
+extern cpuop_func op_52d8_4;
+extern cpuop_func op_52e0_4;
+extern cpuop_func op_52e8_4;
+extern cpuop_func op_52f0_4;
+extern cpuop_func op_52f8_4;
+extern cpuop_func op_52f9_4;
+extern cpuop_func op_53c0_4;
+extern cpuop_func op_53c8_4;
+extern cpuop_func op_53d0_4;
+extern cpuop_func op_53d8_4;
+extern cpuop_func op_53e0_4;
+extern cpuop_func op_53e8_4;
+extern cpuop_func op_53f0_4;
+extern cpuop_func op_53f8_4;
+extern cpuop_func op_53f9_4;
+extern cpuop_func op_54c0_4;
+extern cpuop_func op_54c8_4;
+extern cpuop_func op_54d0_4;
+extern cpuop_func op_54d8_4;
+extern cpuop_func op_54e0_4;
+extern cpuop_func op_54e8_4;
+extern cpuop_func op_54f0_4;
+extern cpuop_func op_54f8_4;
+extern cpuop_func op_54f9_4;
+extern cpuop_func op_55c0_4;
+extern cpuop_func op_55c8_4;
+extern cpuop_func op_55d0_4;
+extern cpuop_func op_55d8_4;
+extern cpuop_func op_55e0_4;
+extern cpuop_func op_55e8_4;
+extern cpuop_func op_55f0_4;
+extern cpuop_func op_55f8_4;
+extern cpuop_func op_55f9_4;
+extern cpuop_func op_56c0_4;
+extern cpuop_func op_56c8_4;
+extern cpuop_func op_56d0_4;
+extern cpuop_func op_56d8_4;
+extern cpuop_func op_56e0_4;
+extern cpuop_func op_56e8_4;
+extern cpuop_func op_56f0_4;
+extern cpuop_func op_56f8_4;
+extern cpuop_func op_56f9_4;
+extern cpuop_func op_57c0_4;
+extern cpuop_func op_57c8_4;
+extern cpuop_func op_57d0_4;
+extern cpuop_func op_57d8_4;
+extern cpuop_func op_57e0_4;
+extern cpuop_func op_57e8_4;
+extern cpuop_func op_57f0_4;
+extern cpuop_func op_57f8_4;
+extern cpuop_func op_57f9_4;
+extern cpuop_func op_58c0_4;
+extern cpuop_func op_58c8_4;
+extern cpuop_func op_58d0_4;
+extern cpuop_func op_58d8_4;
+extern cpuop_func op_58e0_4;
+extern cpuop_func op_58e8_4;
+extern cpuop_func op_58f0_4;
+extern cpuop_func op_58f8_4;
+extern cpuop_func op_58f9_4;
+extern cpuop_func op_59c0_4;
+extern cpuop_func op_59c8_4;
+extern cpuop_func op_59d0_4;
+extern cpuop_func op_59d8_4;
+extern cpuop_func op_59e0_4;
+extern cpuop_func op_59e8_4;
+extern cpuop_func op_59f0_4;
+extern cpuop_func op_59f8_4;
+extern cpuop_func op_59f9_4;
+extern cpuop_func op_5ac0_4;
+extern cpuop_func op_5ac8_4;
+extern cpuop_func op_5ad0_4;
+extern cpuop_func op_5ad8_4;
+extern cpuop_func op_5ae0_4;
+extern cpuop_func op_5ae8_4;
+extern cpuop_func op_5af0_4;
+extern cpuop_func op_5af8_4;
+extern cpuop_func op_5af9_4;
+extern cpuop_func op_5bc0_4;
+extern cpuop_func op_5bc8_4;
+extern cpuop_func op_5bd0_4;
+extern cpuop_func op_5bd8_4;
+extern cpuop_func op_5be0_4;
+extern cpuop_func op_5be8_4;
+extern cpuop_func op_5bf0_4;
+extern cpuop_func op_5bf8_4;
+extern cpuop_func op_5bf9_4;
+extern cpuop_func op_5cc0_4;
+extern cpuop_func op_5cc8_4;
+extern cpuop_func op_5cd0_4;
+extern cpuop_func op_5cd8_4;
+extern cpuop_func op_5ce0_4;
+extern cpuop_func op_5ce8_4;
+extern cpuop_func op_5cf0_4;
+extern cpuop_func op_5cf8_4;
+extern cpuop_func op_5cf9_4;
+extern cpuop_func op_5dc0_4;
+extern cpuop_func op_5dc8_4;
+extern cpuop_func op_5dd0_4;
+extern cpuop_func op_5dd8_4;
+extern cpuop_func op_5de0_4;
+extern cpuop_func op_5de8_4;
+extern cpuop_func op_5df0_4;
+extern cpuop_func op_5df8_4;
+extern cpuop_func op_5df9_4;
+extern cpuop_func op_5ec0_4;
+extern cpuop_func op_5ec8_4;
+extern cpuop_func op_5ed0_4;
+extern cpuop_func op_5ed8_4;
+extern cpuop_func op_5ee0_4;
+extern cpuop_func op_5ee8_4;
+extern cpuop_func op_5ef0_4;
+extern cpuop_func op_5ef8_4;
+extern cpuop_func op_5ef9_4;
+extern cpuop_func op_5fc0_4;
+extern cpuop_func op_5fc8_4;
+extern cpuop_func op_5fd0_4;
+extern cpuop_func op_5fd8_4;
+extern cpuop_func op_5fe0_4;
+extern cpuop_func op_5fe8_4;
+extern cpuop_func op_5ff0_4;
+extern cpuop_func op_5ff8_4;
+extern cpuop_func op_5ff9_4;
+extern cpuop_func op_6000_4;
+extern cpuop_func op_6001_4;
+extern cpuop_func op_60ff_4;
+extern cpuop_func op_6100_4;
+extern cpuop_func op_6101_4;
+extern cpuop_func op_61ff_4;
+extern cpuop_func op_6200_4;
+extern cpuop_func op_6201_4;
+extern cpuop_func op_62ff_4;
+extern cpuop_func op_6300_4;
+extern cpuop_func op_6301_4;
+extern cpuop_func op_63ff_4;
+extern cpuop_func op_6400_4;
+extern cpuop_func op_6401_4;
+extern cpuop_func op_64ff_4;
+extern cpuop_func op_6500_4;
+extern cpuop_func op_6501_4;
+extern cpuop_func op_65ff_4;
+extern cpuop_func op_6600_4;
+extern cpuop_func op_6601_4;
+extern cpuop_func op_66ff_4;
+extern cpuop_func op_6700_4;
+extern cpuop_func op_6701_4;
+extern cpuop_func op_67ff_4;
+extern cpuop_func op_6800_4;
+extern cpuop_func op_6801_4;
+extern cpuop_func op_68ff_4;
+extern cpuop_func op_6900_4;
+extern cpuop_func op_6901_4;
+extern cpuop_func op_69ff_4;
+extern cpuop_func op_6a00_4;
+extern cpuop_func op_6a01_4;
+extern cpuop_func op_6aff_4;
+extern cpuop_func op_6b00_4;
+extern cpuop_func op_6b01_4;
+extern cpuop_func op_6bff_4;
+extern cpuop_func op_6c00_4;
+extern cpuop_func op_6c01_4;
+extern cpuop_func op_6cff_4;
+extern cpuop_func op_6d00_4;
+extern cpuop_func op_6d01_4;
+extern cpuop_func op_6dff_4;
+extern cpuop_func op_6e00_4;
+extern cpuop_func op_6e01_4;
+extern cpuop_func op_6eff_4;
+extern cpuop_func op_6f00_4;
+extern cpuop_func op_6f01_4;
+extern cpuop_func op_6fff_4;
+extern cpuop_func op_7000_4;
+extern cpuop_func op_8000_4;
+extern cpuop_func op_8010_4;
+extern cpuop_func op_8018_4;
+extern cpuop_func op_8020_4;
+extern cpuop_func op_8028_4;
+extern cpuop_func op_8030_4;
+extern cpuop_func op_8038_4;
+extern cpuop_func op_8039_4;
+extern cpuop_func op_803a_4;
+extern cpuop_func op_803b_4;
+extern cpuop_func op_803c_4;
+extern cpuop_func op_8040_4;
+extern cpuop_func op_8050_4;
+extern cpuop_func op_8058_4;
+extern cpuop_func op_8060_4;
+extern cpuop_func op_8068_4;
+extern cpuop_func op_8070_4;
+extern cpuop_func op_8078_4;
+extern cpuop_func op_8079_4;
+extern cpuop_func op_807a_4;
+extern cpuop_func op_807b_4;
+extern cpuop_func op_807c_4;
+extern cpuop_func op_8080_4;
+extern cpuop_func op_8090_4;
+extern cpuop_func op_8098_4;
+extern cpuop_func op_80a0_4;
+extern cpuop_func op_80a8_4;
+extern cpuop_func op_80b0_4;
+extern cpuop_func op_80b8_4;
+extern cpuop_func op_80b9_4;
+extern cpuop_func op_80ba_4;
+extern cpuop_func op_80bb_4;
+extern cpuop_func op_80bc_4;
+extern cpuop_func op_80c0_4;
+extern cpuop_func op_80d0_4;
+extern cpuop_func op_80d8_4;
+extern cpuop_func op_80e0_4;
+extern cpuop_func op_80e8_4;
+extern cpuop_func op_80f0_4;
+extern cpuop_func op_80f8_4;
+extern cpuop_func op_80f9_4;
+extern cpuop_func op_80fa_4;
+extern cpuop_func op_80fb_4;
+extern cpuop_func op_80fc_4;
+extern cpuop_func op_8100_4;
+extern cpuop_func op_8108_4;
+extern cpuop_func op_8110_4;
+extern cpuop_func op_8118_4;
+extern cpuop_func op_8120_4;
+extern cpuop_func op_8128_4;
+extern cpuop_func op_8130_4;
+extern cpuop_func op_8138_4;
+extern cpuop_func op_8139_4;
+extern cpuop_func op_8150_4;
+extern cpuop_func op_8158_4;
+extern cpuop_func op_8160_4;
+extern cpuop_func op_8168_4;
+extern cpuop_func op_8170_4;
+extern cpuop_func op_8178_4;
+extern cpuop_func op_8179_4;
+extern cpuop_func op_8190_4;
+extern cpuop_func op_8198_4;
+extern cpuop_func op_81a0_4;
+extern cpuop_func op_81a8_4;
+extern cpuop_func op_81b0_4;
+extern cpuop_func op_81b8_4;
+extern cpuop_func op_81b9_4;
+extern cpuop_func op_81c0_4;
+extern cpuop_func op_81d0_4;
+extern cpuop_func op_81d8_4;
+extern cpuop_func op_81e0_4;
+extern cpuop_func op_81e8_4;
+extern cpuop_func op_81f0_4;
+extern cpuop_func op_81f8_4;
+extern cpuop_func op_81f9_4;
+extern cpuop_func op_81fa_4;
+extern cpuop_func op_81fb_4;
+extern cpuop_func op_81fc_4;
+extern cpuop_func op_9000_4;
+extern cpuop_func op_9010_4;
+extern cpuop_func op_9018_4;
+extern cpuop_func op_9020_4;
+extern cpuop_func op_9028_4;
+extern cpuop_func op_9030_4;
+extern cpuop_func op_9038_4;
+extern cpuop_func op_9039_4;
+extern cpuop_func op_903a_4;
+extern cpuop_func op_903b_4;
+extern cpuop_func op_903c_4;
+extern cpuop_func op_9040_4;
+extern cpuop_func op_9048_4;
+extern cpuop_func op_9050_4;
+extern cpuop_func op_9058_4;
+extern cpuop_func op_9060_4;
+extern cpuop_func op_9068_4;
+extern cpuop_func op_9070_4;
+extern cpuop_func op_9078_4;
+extern cpuop_func op_9079_4;
+extern cpuop_func op_907a_4;
+extern cpuop_func op_907b_4;
+extern cpuop_func op_907c_4;
+extern cpuop_func op_9080_4;
+extern cpuop_func op_9088_4;
+extern cpuop_func op_9090_4;
+extern cpuop_func op_9098_4;
+extern cpuop_func op_90a0_4;
+extern cpuop_func op_90a8_4;
+extern cpuop_func op_90b0_4;
+extern cpuop_func op_90b8_4;
+extern cpuop_func op_90b9_4;
+extern cpuop_func op_90ba_4;
+extern cpuop_func op_90bb_4;
+extern cpuop_func op_90bc_4;
+extern cpuop_func op_90c0_4;
+extern cpuop_func op_90c8_4;
+extern cpuop_func op_90d0_4;
+extern cpuop_func op_90d8_4;
+extern cpuop_func op_90e0_4;
+extern cpuop_func op_90e8_4;
+extern cpuop_func op_90f0_4;
+extern cpuop_func op_90f8_4;
+extern cpuop_func op_90f9_4;
+extern cpuop_func op_90fa_4;
+extern cpuop_func op_90fb_4;
+extern cpuop_func op_90fc_4;
+extern cpuop_func op_9100_4;
+extern cpuop_func op_9108_4;
+extern cpuop_func op_9110_4;
+extern cpuop_func op_9118_4;
+extern cpuop_func op_9120_4;
+extern cpuop_func op_9128_4;
+extern cpuop_func op_9130_4;
+extern cpuop_func op_9138_4;
+extern cpuop_func op_9139_4;
+extern cpuop_func op_9140_4;
+extern cpuop_func op_9148_4;
+extern cpuop_func op_9150_4;
+extern cpuop_func op_9158_4;
+extern cpuop_func op_9160_4;
+extern cpuop_func op_9168_4;
+extern cpuop_func op_9170_4;
+extern cpuop_func op_9178_4;
+extern cpuop_func op_9179_4;
+extern cpuop_func op_9180_4;
+extern cpuop_func op_9188_4;
+extern cpuop_func op_9190_4;
+extern cpuop_func op_9198_4;
+extern cpuop_func op_91a0_4;
+extern cpuop_func op_91a8_4;
+extern cpuop_func op_91b0_4;
+extern cpuop_func op_91b8_4;
+extern cpuop_func op_91b9_4;
+extern cpuop_func op_91c0_4;
+extern cpuop_func op_91c8_4;
+extern cpuop_func op_91d0_4;
+extern cpuop_func op_91d8_4;
+extern cpuop_func op_91e0_4;
+extern cpuop_func op_91e8_4;
+extern cpuop_func op_91f0_4;
+extern cpuop_func op_91f8_4;
+extern cpuop_func op_91f9_4;
+extern cpuop_func op_91fa_4;
+extern cpuop_func op_91fb_4;
+extern cpuop_func op_91fc_4;
+extern cpuop_func op_b000_4;
+extern cpuop_func op_b010_4;
+extern cpuop_func op_b018_4;
+extern cpuop_func op_b020_4;
+extern cpuop_func op_b028_4;
+extern cpuop_func op_b030_4;
+extern cpuop_func op_b038_4;
+extern cpuop_func op_b039_4;
+extern cpuop_func op_b03a_4;
+extern cpuop_func op_b03b_4;
+extern cpuop_func op_b03c_4;
+extern cpuop_func op_b040_4;
+extern cpuop_func op_b048_4;
+extern cpuop_func op_b050_4;
+extern cpuop_func op_b058_4;
+extern cpuop_func op_b060_4;
+extern cpuop_func op_b068_4;
+extern cpuop_func op_b070_4;
+extern cpuop_func op_b078_4;
+extern cpuop_func op_b079_4;
+extern cpuop_func op_b07a_4;
+extern cpuop_func op_b07b_4;
+extern cpuop_func op_b07c_4;
+extern cpuop_func op_b080_4;
+extern cpuop_func op_b088_4;
+extern cpuop_func op_b090_4;
+extern cpuop_func op_b098_4;
+extern cpuop_func op_b0a0_4;
+extern cpuop_func op_b0a8_4;
+extern cpuop_func op_b0b0_4;
+extern cpuop_func op_b0b8_4;
+extern cpuop_func op_b0b9_4;
+extern cpuop_func op_b0ba_4;
+extern cpuop_func op_b0bb_4;
+extern cpuop_func op_b0bc_4;
+extern cpuop_func op_b0c0_4;
+extern cpuop_func op_b0c8_4;
+extern cpuop_func op_b0d0_4;
+extern cpuop_func op_b0d8_4;
+extern cpuop_func op_b0e0_4;
+extern cpuop_func op_b0e8_4;
+extern cpuop_func op_b0f0_4;
+extern cpuop_func op_b0f8_4;
+extern cpuop_func op_b0f9_4;
+extern cpuop_func op_b0fa_4;
+extern cpuop_func op_b0fb_4;
+extern cpuop_func op_b0fc_4;
+extern cpuop_func op_b100_4;
+extern cpuop_func op_b108_4;
+extern cpuop_func op_b110_4;
+extern cpuop_func op_b118_4;
+extern cpuop_func op_b120_4;
+extern cpuop_func op_b128_4;
+extern cpuop_func op_b130_4;
+extern cpuop_func op_b138_4;
+extern cpuop_func op_b139_4;
+extern cpuop_func op_b140_4;
+extern cpuop_func op_b148_4;
+extern cpuop_func op_b150_4;
+extern cpuop_func op_b158_4;
+extern cpuop_func op_b160_4;
+extern cpuop_func op_b168_4;
+extern cpuop_func op_b170_4;
+extern cpuop_func op_b178_4;
+extern cpuop_func op_b179_4;
+extern cpuop_func op_b180_4;
+extern cpuop_func op_b188_4;
+extern cpuop_func op_b190_4;
+extern cpuop_func op_b198_4;
+extern cpuop_func op_b1a0_4;
+extern cpuop_func op_b1a8_4;
+extern cpuop_func op_b1b0_4;
+extern cpuop_func op_b1b8_4;
+extern cpuop_func op_b1b9_4;
+extern cpuop_func op_b1c0_4;
+extern cpuop_func op_b1c8_4;
+extern cpuop_func op_b1d0_4;
+extern cpuop_func op_b1d8_4;
+extern cpuop_func op_b1e0_4;
+extern cpuop_func op_b1e8_4;
+extern cpuop_func op_b1f0_4;
+extern cpuop_func op_b1f8_4;
+extern cpuop_func op_b1f9_4;
+extern cpuop_func op_b1fa_4;
+extern cpuop_func op_b1fb_4;
+extern cpuop_func op_b1fc_4;
+extern cpuop_func op_c000_4;
+extern cpuop_func op_c010_4;
+extern cpuop_func op_c018_4;
+extern cpuop_func op_c020_4;
+extern cpuop_func op_c028_4;
+extern cpuop_func op_c030_4;
+extern cpuop_func op_c038_4;
+extern cpuop_func op_c039_4;
+extern cpuop_func op_c03a_4;
+extern cpuop_func op_c03b_4;
+extern cpuop_func op_c03c_4;
+extern cpuop_func op_c040_4;
+extern cpuop_func op_c050_4;
+extern cpuop_func op_c058_4;
+extern cpuop_func op_c060_4;
+extern cpuop_func op_c068_4;
+extern cpuop_func op_c070_4;
+extern cpuop_func op_c078_4;
+extern cpuop_func op_c079_4;
+extern cpuop_func op_c07a_4;
+extern cpuop_func op_c07b_4;
+extern cpuop_func op_c07c_4;
+extern cpuop_func op_c080_4;
+extern cpuop_func op_c090_4;
+extern cpuop_func op_c098_4;
+extern cpuop_func op_c0a0_4;
+extern cpuop_func op_c0a8_4;
+extern cpuop_func op_c0b0_4;
+extern cpuop_func op_c0b8_4;
+extern cpuop_func op_c0b9_4;
+extern cpuop_func op_c0ba_4;
+extern cpuop_func op_c0bb_4;
+extern cpuop_func op_c0bc_4;
+extern cpuop_func op_c0c0_4;
+extern cpuop_func op_c0d0_4;
+extern cpuop_func op_c0d8_4;
+extern cpuop_func op_c0e0_4;
+extern cpuop_func op_c0e8_4;
+extern cpuop_func op_c0f0_4;
+extern cpuop_func op_c0f8_4;
+extern cpuop_func op_c0f9_4;
+extern cpuop_func op_c0fa_4;
+extern cpuop_func op_c0fb_4;
+extern cpuop_func op_c0fc_4;
+extern cpuop_func op_c100_4;
+extern cpuop_func op_c108_4;
+extern cpuop_func op_c110_4;
+extern cpuop_func op_c118_4;
+extern cpuop_func op_c120_4;
+extern cpuop_func op_c128_4;
+extern cpuop_func op_c130_4;
+extern cpuop_func op_c138_4;
+extern cpuop_func op_c139_4;
+extern cpuop_func op_c140_4;
+extern cpuop_func op_c148_4;
+extern cpuop_func op_c150_4;
+extern cpuop_func op_c158_4;
+extern cpuop_func op_c160_4;
+extern cpuop_func op_c168_4;
+extern cpuop_func op_c170_4;
+extern cpuop_func op_c178_4;
+extern cpuop_func op_c179_4;
+extern cpuop_func op_c188_4;
+extern cpuop_func op_c190_4;
+extern cpuop_func op_c198_4;
+extern cpuop_func op_c1a0_4;
+extern cpuop_func op_c1a8_4;
+extern cpuop_func op_c1b0_4;
+extern cpuop_func op_c1b8_4;
+extern cpuop_func op_c1b9_4;
+extern cpuop_func op_c1c0_4;
+extern cpuop_func op_c1d0_4;
+extern cpuop_func op_c1d8_4;
+extern cpuop_func op_c1e0_4;
+extern cpuop_func op_c1e8_4;
+extern cpuop_func op_c1f0_4;
+extern cpuop_func op_c1f8_4;
+extern cpuop_func op_c1f9_4;
+extern cpuop_func op_c1fa_4;
+extern cpuop_func op_c1fb_4;
+extern cpuop_func op_c1fc_4;
+extern cpuop_func op_d000_4;
+extern cpuop_func op_d010_4;
+extern cpuop_func op_d018_4;
+extern cpuop_func op_d020_4;
+extern cpuop_func op_d028_4;
+extern cpuop_func op_d030_4;
+extern cpuop_func op_d038_4;
+extern cpuop_func op_d039_4;
+extern cpuop_func op_d03a_4;
+extern cpuop_func op_d03b_4;
+extern cpuop_func op_d03c_4;
+extern cpuop_func op_d040_4;
+extern cpuop_func op_d048_4;
+extern cpuop_func op_d050_4;
+extern cpuop_func op_d058_4;
+extern cpuop_func op_d060_4;
+extern cpuop_func op_d068_4;
+extern cpuop_func op_d070_4;
+extern cpuop_func op_d078_4;
+extern cpuop_func op_d079_4;
+extern cpuop_func op_d07a_4;
+extern cpuop_func op_d07b_4;
+extern cpuop_func op_d07c_4;
+extern cpuop_func op_d080_4;
+extern cpuop_func op_d088_4;
+extern cpuop_func op_d090_4;
+extern cpuop_func op_d098_4;
+extern cpuop_func op_d0a0_4;
+extern cpuop_func op_d0a8_4;
+extern cpuop_func op_d0b0_4;
+extern cpuop_func op_d0b8_4;
+extern cpuop_func op_d0b9_4;
+extern cpuop_func op_d0ba_4;
+extern cpuop_func op_d0bb_4;
+extern cpuop_func op_d0bc_4;
+extern cpuop_func op_d0c0_4;
+extern cpuop_func op_d0c8_4;
+extern cpuop_func op_d0d0_4;
+extern cpuop_func op_d0d8_4;
+extern cpuop_func op_d0e0_4;
+extern cpuop_func op_d0e8_4;
+extern cpuop_func op_d0f0_4;
+extern cpuop_func op_d0f8_4;
+extern cpuop_func op_d0f9_4;
+extern cpuop_func op_d0fa_4;
+extern cpuop_func op_d0fb_4;
+extern cpuop_func op_d0fc_4;
+extern cpuop_func op_d100_4;
+extern cpuop_func op_d108_4;
+extern cpuop_func op_d110_4;
+extern cpuop_func op_d118_4;
+extern cpuop_func op_d120_4;
+extern cpuop_func op_d128_4;
+extern cpuop_func op_d130_4;
+extern cpuop_func op_d138_4;
+extern cpuop_func op_d139_4;
+extern cpuop_func op_d140_4;
+extern cpuop_func op_d148_4;
+extern cpuop_func op_d150_4;
+extern cpuop_func op_d158_4;
+extern cpuop_func op_d160_4;
+extern cpuop_func op_d168_4;
+extern cpuop_func op_d170_4;
+extern cpuop_func op_d178_4;
+extern cpuop_func op_d179_4;
+extern cpuop_func op_d180_4;
+extern cpuop_func op_d188_4;
+extern cpuop_func op_d190_4;
+extern cpuop_func op_d198_4;
+extern cpuop_func op_d1a0_4;
+extern cpuop_func op_d1a8_4;
+extern cpuop_func op_d1b0_4;
+extern cpuop_func op_d1b8_4;
+extern cpuop_func op_d1b9_4;
+extern cpuop_func op_d1c0_4;
+extern cpuop_func op_d1c8_4;
+extern cpuop_func op_d1d0_4;
+extern cpuop_func op_d1d8_4;
+extern cpuop_func op_d1e0_4;
+extern cpuop_func op_d1e8_4;
+extern cpuop_func op_d1f0_4;
+extern cpuop_func op_d1f8_4;
+extern cpuop_func op_d1f9_4;
+extern cpuop_func op_d1fa_4;
+extern cpuop_func op_d1fb_4;
+extern cpuop_func op_d1fc_4;
+extern cpuop_func op_e000_4;
+extern cpuop_func op_e008_4;
+extern cpuop_func op_e010_4;
+extern cpuop_func op_e018_4;
+extern cpuop_func op_e020_4;
+extern cpuop_func op_e028_4;
+extern cpuop_func op_e030_4;
+extern cpuop_func op_e038_4;
+extern cpuop_func op_e040_4;
+extern cpuop_func op_e048_4;
+extern cpuop_func op_e050_4;
+extern cpuop_func op_e058_4;
+extern cpuop_func op_e060_4;
+extern cpuop_func op_e068_4;
+extern cpuop_func op_e070_4;
+extern cpuop_func op_e078_4;
+extern cpuop_func op_e080_4;
+extern cpuop_func op_e088_4;
+extern cpuop_func op_e090_4;
+extern cpuop_func op_e098_4;
+extern cpuop_func op_e0a0_4;
+extern cpuop_func op_e0a8_4;
+extern cpuop_func op_e0b0_4;
+extern cpuop_func op_e0b8_4;
+extern cpuop_func op_e0d0_4;
+extern cpuop_func op_e0d8_4;
+extern cpuop_func op_e0e0_4;
+extern cpuop_func op_e0e8_4;
+extern cpuop_func op_e0f0_4;
+extern cpuop_func op_e0f8_4;
+extern cpuop_func op_e0f9_4;
+extern cpuop_func op_e100_4;
+extern cpuop_func op_e108_4;
+extern cpuop_func op_e110_4;
+extern cpuop_func op_e118_4;
+extern cpuop_func op_e120_4;
+extern cpuop_func op_e128_4;
+extern cpuop_func op_e130_4;
+extern cpuop_func op_e138_4;
+extern cpuop_func op_e140_4;
+extern cpuop_func op_e148_4;
+extern cpuop_func op_e150_4;
+extern cpuop_func op_e158_4;
+extern cpuop_func op_e160_4;
+extern cpuop_func op_e168_4;
+extern cpuop_func op_e170_4;
+extern cpuop_func op_e178_4;
+extern cpuop_func op_e180_4;
+extern cpuop_func op_e188_4;
+extern cpuop_func op_e190_4;
+extern cpuop_func op_e198_4;
+extern cpuop_func op_e1a0_4;
+extern cpuop_func op_e1a8_4;
+extern cpuop_func op_e1b0_4;
+extern cpuop_func op_e1b8_4;
+extern cpuop_func op_e1d0_4;
+extern cpuop_func op_e1d8_4;
+extern cpuop_func op_e1e0_4;
+extern cpuop_func op_e1e8_4;
+extern cpuop_func op_e1f0_4;
+extern cpuop_func op_e1f8_4;
+extern cpuop_func op_e1f9_4;
+extern cpuop_func op_e2d0_4;
+extern cpuop_func op_e2d8_4;
+extern cpuop_func op_e2e0_4;
+extern cpuop_func op_e2e8_4;
+extern cpuop_func op_e2f0_4;
+extern cpuop_func op_e2f8_4;
+extern cpuop_func op_e2f9_4;
+extern cpuop_func op_e3d0_4;
+extern cpuop_func op_e3d8_4;
+extern cpuop_func op_e3e0_4;
+extern cpuop_func op_e3e8_4;
+extern cpuop_func op_e3f0_4;
+extern cpuop_func op_e3f8_4;
+extern cpuop_func op_e3f9_4;
+extern cpuop_func op_e4d0_4;
+extern cpuop_func op_e4d8_4;
+extern cpuop_func op_e4e0_4;
+extern cpuop_func op_e4e8_4;
+extern cpuop_func op_e4f0_4;
+extern cpuop_func op_e4f8_4;
+extern cpuop_func op_e4f9_4;
+extern cpuop_func op_e5d0_4;
+extern cpuop_func op_e5d8_4;
+extern cpuop_func op_e5e0_4;
+extern cpuop_func op_e5e8_4;
+extern cpuop_func op_e5f0_4;
+extern cpuop_func op_e5f8_4;
+extern cpuop_func op_e5f9_4;
+extern cpuop_func op_e6d0_4;
+extern cpuop_func op_e6d8_4;
+extern cpuop_func op_e6e0_4;
+extern cpuop_func op_e6e8_4;
+extern cpuop_func op_e6f0_4;
+extern cpuop_func op_e6f8_4;
+extern cpuop_func op_e6f9_4;
+extern cpuop_func op_e7d0_4;
+extern cpuop_func op_e7d8_4;
+extern cpuop_func op_e7e0_4;
+extern cpuop_func op_e7e8_4;
+extern cpuop_func op_e7f0_4;
+extern cpuop_func op_e7f8_4;
+extern cpuop_func op_e7f9_4;
@@ -0,0 +1,22262 @@
+/* Generated by gencpu: threaded form of cpuemu.c.  Do not compile
+ * on its own; it is #included twice by EmCPU68K::ExecuteThreaded. */
+
+#if !defined(CPUTHREADED_LABELS)
+
+op_0_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_10_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_18_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_20_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_28_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_30_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_38_3_t: /* OR */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_39_3_t: /* OR */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_3c_3_t: /* ORSR */
+{
+{	MakeSR();
+{	uae_s16 src = get_iword(2);
+	src &= 0xFF;
+	regs.sr |= src;
+	MakeFromSR();
+}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_40_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_50_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_58_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_60_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_68_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_70_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_78_3_t: /* OR */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_79_3_t: /* OR */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_7c_3_t: /* ORSR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel3186; }
+{	MakeSR();
+{	uae_s16 src = get_iword(2);
+	regs.sr |= src;
+	MakeFromSR();
+}}}m68k_incpc(4);
+endlabel3186: ;
+THREADED_NEXT (4);
+}
+op_80_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_90_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_98_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_a0_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_a8_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_b0_3_t: /* OR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_b8_3_t: /* OR */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_b9_3_t: /* OR */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_ilong(6);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(10);
+THREADED_NEXT (18);
+}
+op_100_3_t: /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_108_3_t: /* MVPMR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr memp = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_u16 val = (get_byte(memp) << 8) + get_byte(memp + 2);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_110_3_t: /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_118_3_t: /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_120_3_t: /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_128_3_t: /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_130_3_t: /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_138_3_t: /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_139_3_t: /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_13a_3_t: /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 2;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_getpc () + 2;
+	dsta += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_13b_3_t: /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_13c_3_t: /* BTST */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = get_ibyte(2);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_140_3_t: /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	m68k_dreg(regs, dstreg) = (dst);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_148_3_t: /* MVPMR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr memp = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_u32 val = (get_byte(memp) << 24) + (get_byte(memp + 2) << 16)
+              + (get_byte(memp + 4) << 8) + get_byte(memp + 6);
+	m68k_dreg(regs, dstreg) = (val);
+}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_150_3_t: /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_158_3_t: /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_160_3_t: /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_168_3_t: /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_170_3_t: /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_178_3_t: /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_179_3_t: /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_17a_3_t: /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 2;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_getpc () + 2;
+	dsta += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_17b_3_t: /* BCHG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_180_3_t: /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	m68k_dreg(regs, dstreg) = (dst);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_188_3_t: /* MVPRM */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+	uaecptr memp = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	put_byte(memp, src >> 8); put_byte(memp + 2, src);
+}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_190_3_t: /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_198_3_t: /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_1a0_3_t: /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_1a8_3_t: /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1b0_3_t: /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1b8_3_t: /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1b9_3_t: /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_1ba_3_t: /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 2;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_getpc () + 2;
+	dsta += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1bb_3_t: /* BCLR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1c0_3_t: /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	m68k_dreg(regs, dstreg) = (dst);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_1c8_3_t: /* MVPRM */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+	uaecptr memp = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	put_byte(memp, src >> 24); put_byte(memp + 2, src >> 16);
+	put_byte(memp + 4, src >> 8); put_byte(memp + 6, src);
+}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_1d0_3_t: /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_1d8_3_t: /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_1e0_3_t: /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_1e8_3_t: /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1f0_3_t: /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1f8_3_t: /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1f9_3_t: /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_1fa_3_t: /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 2;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_getpc () + 2;
+	dsta += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1fb_3_t: /* BSET */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_200_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_210_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_218_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_220_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_228_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_230_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_238_3_t: /* AND */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_239_3_t: /* AND */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_23c_3_t: /* ANDSR */
+{
+{	MakeSR();
+{	uae_s16 src = get_iword(2);
+	src |= 0xFF00;
+	regs.sr &= src;
+	MakeFromSR();
+}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_240_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_250_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_258_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_260_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_268_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_270_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_278_3_t: /* AND */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_279_3_t: /* AND */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_27c_3_t: /* ANDSR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel3257; }
+{	MakeSR();
+{	uae_s16 src = get_iword(2);
+	regs.sr &= src;
+	MakeFromSR();
+}}}m68k_incpc(4);
+endlabel3257: ;
+THREADED_NEXT (4);
+}
+op_280_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_290_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_298_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_2a0_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_2a8_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_2b0_3_t: /* AND */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_2b8_3_t: /* AND */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_2b9_3_t: /* AND */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_ilong(6);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(10);
+THREADED_NEXT (18);
+}
+op_400_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_410_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_418_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_420_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_428_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_430_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_438_3_t: /* SUB */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_439_3_t: /* SUB */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_440_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_450_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_458_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_460_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_468_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_470_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_478_3_t: /* SUB */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_479_3_t: /* SUB */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_480_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_490_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_498_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_4a0_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_4a8_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_4b0_3_t: /* SUB */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_4b8_3_t: /* SUB */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_4b9_3_t: /* SUB */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_ilong(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(10);
+THREADED_NEXT (18);
+}
+op_600_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_610_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_618_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_620_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_628_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_630_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_638_3_t: /* ADD */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_639_3_t: /* ADD */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_640_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_650_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_658_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_660_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_668_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_670_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_678_3_t: /* ADD */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_679_3_t: /* ADD */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_680_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_690_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_698_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_6a0_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_6a8_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_6b0_3_t: /* ADD */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_6b8_3_t: /* ADD */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_6b9_3_t: /* ADD */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_ilong(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(10);
+THREADED_NEXT (18);
+}
+op_800_3_t: /* BTST */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_810_3_t: /* BTST */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_818_3_t: /* BTST */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_820_3_t: /* BTST */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_828_3_t: /* BTST */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_830_3_t: /* BTST */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_838_3_t: /* BTST */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_839_3_t: /* BTST */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(8);
+THREADED_NEXT (10);
+}
+op_83a_3_t: /* BTST */
+{
+	uae_u32 dstreg = 2;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_83b_3_t: /* BTST */
+{
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_83c_3_t: /* BTST */
+{
+{{	uae_s16 src = get_iword(2);
+{	uae_s8 dst = get_ibyte(4);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_840_3_t: /* BCHG */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	m68k_dreg(regs, dstreg) = (dst);
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_850_3_t: /* BCHG */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_858_3_t: /* BCHG */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_860_3_t: /* BCHG */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_868_3_t: /* BCHG */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_870_3_t: /* BCHG */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_878_3_t: /* BCHG */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_879_3_t: /* BCHG */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_87a_3_t: /* BCHG */
+{
+	uae_u32 dstreg = 2;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_87b_3_t: /* BCHG */
+{
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG ((dst >> src) & 1);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_880_3_t: /* BCLR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	m68k_dreg(regs, dstreg) = (dst);
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_890_3_t: /* BCLR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_898_3_t: /* BCLR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_8a0_3_t: /* BCLR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_8a8_3_t: /* BCLR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_8b0_3_t: /* BCLR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_8b8_3_t: /* BCLR */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_8b9_3_t: /* BCLR */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_8ba_3_t: /* BCLR */
+{
+	uae_u32 dstreg = 2;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_8bb_3_t: /* BCLR */
+{
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_8c0_3_t: /* BSET */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= 31;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	m68k_dreg(regs, dstreg) = (dst);
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_8d0_3_t: /* BSET */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_8d8_3_t: /* BSET */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_8e0_3_t: /* BSET */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_8e8_3_t: /* BSET */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_8f0_3_t: /* BSET */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_8f8_3_t: /* BSET */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_8f9_3_t: /* BSET */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_8fa_3_t: /* BSET */
+{
+	uae_u32 dstreg = 2;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_8fb_3_t: /* BSET */
+{
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_a00_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_a10_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_a18_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_a20_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_a28_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_a30_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_a38_3_t: /* EOR */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_a39_3_t: /* EOR */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_a3c_3_t: /* EORSR */
+{
+{	MakeSR();
+{	uae_s16 src = get_iword(2);
+	src &= 0xFF;
+	regs.sr ^= src;
+	MakeFromSR();
+}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_a40_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_a50_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_a58_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_a60_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_a68_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_a70_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_a78_3_t: /* EOR */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_a79_3_t: /* EOR */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_a7c_3_t: /* EORSR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel3372; }
+{	MakeSR();
+{	uae_s16 src = get_iword(2);
+	regs.sr ^= src;
+	MakeFromSR();
+}}}m68k_incpc(4);
+endlabel3372: ;
+THREADED_NEXT (4);
+}
+op_a80_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_a90_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_a98_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_aa0_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_aa8_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_ab0_3_t: /* EOR */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_ab8_3_t: /* EOR */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_ab9_3_t: /* EOR */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_ilong(6);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(10);
+THREADED_NEXT (18);
+}
+op_c00_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_c10_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c18_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c20_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c28_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_c30_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_c38_3_t: /* CMP */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_c39_3_t: /* CMP */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (10);
+}
+op_c3a_3_t: /* CMP */
+{
+	uae_u32 dstreg = 2;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_c3b_3_t: /* CMP */
+{
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_c40_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_c50_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c58_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c60_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c68_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_c70_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_c78_3_t: /* CMP */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_c79_3_t: /* CMP */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (10);
+}
+op_c7a_3_t: /* CMP */
+{
+	uae_u32 dstreg = 2;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_getpc () + 4;
+	dsta += (uae_s32)(uae_s16)get_iword(4);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_c7b_3_t: /* CMP */
+{
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_c80_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_c90_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_c98_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_ca0_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_ca8_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_cb0_3_t: /* CMP */
+{
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_cb8_3_t: /* CMP */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_cb9_3_t: /* CMP */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_ilong(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(10);
+THREADED_NEXT (14);
+}
+op_cba_3_t: /* CMP */
+{
+	uae_u32 dstreg = 2;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_getpc () + 6;
+	dsta += (uae_s32)(uae_s16)get_iword(6);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_cbb_3_t: /* CMP */
+{
+	uae_u32 dstreg = 3;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr tmppc = m68k_getpc() + 6;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_1000_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_1010_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_1018_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_1020_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_1028_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_1030_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_1038_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_1039_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_103a_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_103b_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_103c_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_1080_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_1090_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_1098_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_10a0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_10a8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_10b0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_10b8_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_10b9_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_10ba_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_10bb_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_10bc_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_10c0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_10d0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_10d8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_10e0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_10e8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_10f0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_10f8_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_10f9_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_10fa_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_10fb_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_10fc_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_1100_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_1110_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_1118_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_1120_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_1128_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1130_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1138_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1139_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_113a_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_113b_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_113c_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_1140_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_1150_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1158_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1160_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1168_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_1170_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_1178_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_1179_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_117a_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_117b_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_117c_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_1180_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_1190_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_1198_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_11a0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_11a8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_11b0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_11b8_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_11b9_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_11ba_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_11bb_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_11bc_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_11c0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_11d0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_11d8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_11e0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_11e8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_11f0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_11f8_3_t: /* MOVE */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_11f9_3_t: /* MOVE */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_11fa_3_t: /* MOVE */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_11fb_3_t: /* MOVE */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_11fc_3_t: /* MOVE */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_13c0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_13d0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_13d8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_13e0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_13e8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_13f0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_13f8_3_t: /* MOVE */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_13f9_3_t: /* MOVE */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(10);
+THREADED_NEXT (14);
+}
+op_13fa_3_t: /* MOVE */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_13fb_3_t: /* MOVE */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_13fc_3_t: /* MOVE */
+{
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}m68k_incpc(8);
+THREADED_NEXT (10);
+}
+op_2000_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_2008_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_2010_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_2018_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_2020_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_2028_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_2030_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_2038_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_2039_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_203a_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_203b_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_203c_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_2040_3_t: /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_2048_3_t: /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_2050_3_t: /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_2058_3_t: /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_2060_3_t: /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_2068_3_t: /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_2070_3_t: /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_2078_3_t: /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_2079_3_t: /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_207a_3_t: /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_207b_3_t: /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_207c_3_t: /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_2080_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_2088_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_2090_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_2098_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_20a0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_20a8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_20b0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_20b8_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_20b9_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_20ba_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_20bb_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_20bc_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_20c0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_20c8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_20d0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_20d8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_20e0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_20e8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_20f0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_20f8_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_20f9_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_20fa_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_20fb_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_20fc_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_2100_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_2108_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_2110_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_2118_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_2120_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_2128_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_2130_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_2138_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_2139_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_213a_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_213b_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_213c_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_2140_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_2148_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_2150_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_2158_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_2160_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_2168_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_2170_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_2178_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_2179_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_217a_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_217b_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_217c_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_2180_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_2188_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_2190_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_2198_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_21a0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_21a8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_21b0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_21b8_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_21b9_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_21ba_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_21bb_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_21bc_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_21c0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_21c8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_21d0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_21d8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_21e0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_21e8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_21f0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_21f8_3_t: /* MOVE */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_21f9_3_t: /* MOVE */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_21fa_3_t: /* MOVE */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_21fb_3_t: /* MOVE */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_21fc_3_t: /* MOVE */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_23c0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_23c8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_23d0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_23d8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_23e0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_23e8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_23f0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_23f8_3_t: /* MOVE */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_23f9_3_t: /* MOVE */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(10);
+THREADED_NEXT (18);
+}
+op_23fa_3_t: /* MOVE */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_23fb_3_t: /* MOVE */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (16);
+}
+op_23fc_3_t: /* MOVE */
+{
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_ilong(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}m68k_incpc(10);
+THREADED_NEXT (14);
+}
+op_3000_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_3008_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_3010_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_3018_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_3020_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_3028_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_3030_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_3038_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_3039_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_303a_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_303b_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_303c_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_3040_3_t: /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_3048_3_t: /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_3050_3_t: /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_3058_3_t: /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_3060_3_t: /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_3068_3_t: /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_3070_3_t: /* MOVEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_3078_3_t: /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_3079_3_t: /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_307a_3_t: /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_307b_3_t: /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_307c_3_t: /* MOVEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_3080_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_3088_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_3090_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_3098_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_30a0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_30a8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_30b0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_30b8_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_30b9_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_30ba_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_30bb_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_30bc_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_30c0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_30c8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_30d0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_30d8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_30e0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_30e8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_30f0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_30f8_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_30f9_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_30fa_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_30fb_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_30fc_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_3100_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_3108_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_3110_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_3118_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_3120_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_3128_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_3130_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_3138_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_3139_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_313a_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_313b_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_313c_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_3140_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_3148_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_3150_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_3158_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_3160_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_3168_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_3170_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_3178_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_3179_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_317a_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_317b_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_317c_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_3180_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_3188_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_3190_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_3198_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_31a0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_31a8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_31b0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_31b8_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_31b9_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_31ba_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_31bb_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_31bc_3_t: /* MOVE */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_31c0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_31c8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_31d0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_31d8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_31e0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_31e8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_31f0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_31f8_3_t: /* MOVE */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_31f9_3_t: /* MOVE */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_31fa_3_t: /* MOVE */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_31fb_3_t: /* MOVE */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_31fc_3_t: /* MOVE */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_33c0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_33c8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_33d0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_33d8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_33e0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_33e8_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_33f0_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_33f8_3_t: /* MOVE */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_33f9_3_t: /* MOVE */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(6);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(10);
+THREADED_NEXT (14);
+}
+op_33fa_3_t: /* MOVE */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_33fb_3_t: /* MOVE */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+THREADED_NEXT (12);
+}
+op_33fc_3_t: /* MOVE */
+{
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_ilong(4);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}m68k_incpc(8);
+THREADED_NEXT (10);
+}
+op_4000_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((newv) & 0xff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4010_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4018_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4020_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4028_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4030_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4038_3_t: /* NEGX */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4039_3_t: /* NEGX */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_4040_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4050_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(srca,newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4058_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(srca,newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4060_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(srca,newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4068_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(srca,newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4070_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(srca,newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4078_3_t: /* NEGX */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(srca,newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4079_3_t: /* NEGX */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(srca,newv);
+}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_4080_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, srcreg) = (newv);
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4090_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(srca,newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_4098_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(srca,newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_40a0_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(srca,newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_40a8_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(srca,newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_40b0_3_t: /* NEGX */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(srca,newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_40b8_3_t: /* NEGX */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(srca,newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_40b9_3_t: /* NEGX */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(srca,newv);
+}}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_40c0_3_t: /* MVSR2 */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	MakeSR();
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((regs.sr) & 0xffff);
+}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_40d0_3_t: /* MVSR2 */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_40d8_3_t: /* MVSR2 */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += 2;
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_40e0_3_t: /* MVSR2 */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_40e8_3_t: /* MVSR2 */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_40f0_3_t: /* MVSR2 */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_40f8_3_t: /* MVSR2 */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_40f9_3_t: /* MVSR2 */
+{
+{{	uaecptr srca = get_ilong(2);
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_4100_3_t: /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3747; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3747; }
+}}}m68k_incpc(2);
+endlabel3747: ;
+THREADED_NEXT (2);
+}
+op_4110_3_t: /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3748; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3748; }
+}}}}m68k_incpc(2);
+endlabel3748: ;
+THREADED_NEXT (6);
+}
+op_4118_3_t: /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3749; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3749; }
+}}}}m68k_incpc(2);
+endlabel3749: ;
+THREADED_NEXT (6);
+}
+op_4120_3_t: /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3750; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3750; }
+}}}}m68k_incpc(2);
+endlabel3750: ;
+THREADED_NEXT (6);
+}
+op_4128_3_t: /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3751; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3751; }
+}}}}m68k_incpc(4);
+endlabel3751: ;
+THREADED_NEXT (8);
+}
+op_4130_3_t: /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3752; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3752; }
+}}}}m68k_incpc(4);
+endlabel3752: ;
+THREADED_NEXT (8);
+}
+op_4138_3_t: /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3753; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3753; }
+}}}}m68k_incpc(4);
+endlabel3753: ;
+THREADED_NEXT (8);
+}
+op_4139_3_t: /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3754; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3754; }
+}}}}m68k_incpc(6);
+endlabel3754: ;
+THREADED_NEXT (10);
+}
+op_413a_3_t: /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3755; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3755; }
+}}}}m68k_incpc(4);
+endlabel3755: ;
+THREADED_NEXT (8);
+}
+op_413b_3_t: /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3756; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3756; }
+}}}}m68k_incpc(4);
+endlabel3756: ;
+THREADED_NEXT (8);
+}
+op_413c_3_t: /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3757; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3757; }
+}}}m68k_incpc(6);
+endlabel3757: ;
+THREADED_NEXT (6);
+}
+op_4180_3_t: /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3758; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3758; }
+}}}m68k_incpc(2);
+endlabel3758: ;
+THREADED_NEXT (2);
+}
+op_4190_3_t: /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3759; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3759; }
+}}}}m68k_incpc(2);
+endlabel3759: ;
+THREADED_NEXT (4);
+}
+op_4198_3_t: /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3760; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3760; }
+}}}}m68k_incpc(2);
+endlabel3760: ;
+THREADED_NEXT (4);
+}
+op_41a0_3_t: /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3761; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3761; }
+}}}}m68k_incpc(2);
+endlabel3761: ;
+THREADED_NEXT (4);
+}
+op_41a8_3_t: /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3762; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3762; }
+}}}}m68k_incpc(4);
+endlabel3762: ;
+THREADED_NEXT (6);
+}
+op_41b0_3_t: /* CHK */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3763; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3763; }
+}}}}m68k_incpc(4);
+endlabel3763: ;
+THREADED_NEXT (6);
+}
+op_41b8_3_t: /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3764; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3764; }
+}}}}m68k_incpc(4);
+endlabel3764: ;
+THREADED_NEXT (6);
+}
+op_41b9_3_t: /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3765; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3765; }
+}}}}m68k_incpc(6);
+endlabel3765: ;
+THREADED_NEXT (8);
+}
+op_41ba_3_t: /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3766; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3766; }
+}}}}m68k_incpc(4);
+endlabel3766: ;
+THREADED_NEXT (6);
+}
+op_41bb_3_t: /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3767; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3767; }
+}}}}m68k_incpc(4);
+endlabel3767: ;
+THREADED_NEXT (6);
+}
+op_41bc_3_t: /* CHK */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel3768; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel3768; }
+}}}m68k_incpc(4);
+endlabel3768: ;
+THREADED_NEXT (4);
+}
+op_41d0_3_t: /* LEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{{	uaecptr prev_dstreg = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) = (srca);
+	if (dstreg == 7) {
+		if (srcreg == 7) {
+			if (prev_dstreg < (srca)) CHECK_STACK_POINTER_INCREMENT ();
+			if (prev_dstreg > (srca)) CHECK_STACK_POINTER_DECREMENT ();
+		} else {
+			CHECK_STACK_POINTER_ASSIGNMENT ();
+		}
+	}
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_41e8_3_t: /* LEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{{	uaecptr prev_dstreg = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) = (srca);
+	if (dstreg == 7) {
+		if (srcreg == 7) {
+			if (prev_dstreg < (srca)) CHECK_STACK_POINTER_INCREMENT ();
+			if (prev_dstreg > (srca)) CHECK_STACK_POINTER_DECREMENT ();
+		} else {
+			CHECK_STACK_POINTER_ASSIGNMENT ();
+		}
+	}
+}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_41f0_3_t: /* LEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{{	uaecptr prev_dstreg = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) = (srca);
+	if (dstreg == 7) {
+		if (srcreg == 7) {
+			if (prev_dstreg < (srca)) CHECK_STACK_POINTER_INCREMENT ();
+			if (prev_dstreg > (srca)) CHECK_STACK_POINTER_DECREMENT ();
+		} else {
+			CHECK_STACK_POINTER_ASSIGNMENT ();
+		}
+	}
+}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_41f8_3_t: /* LEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	m68k_areg(regs, dstreg) = (srca);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_41f9_3_t: /* LEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_41fa_3_t: /* LEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	m68k_areg(regs, dstreg) = (srca);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_41fb_3_t: /* LEA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	m68k_areg(regs, dstreg) = (srca);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_4200_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((0) & 0xff);
+}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4210_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
+	put_byte(srca,0);
+}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_4218_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
+	put_byte(srca,0);
+}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_4220_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
+	put_byte(srca,0);
+}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_4228_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
+	put_byte(srca,0);
+}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4230_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
+	put_byte(srca,0);
+}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4238_3_t: /* CLR */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
+	put_byte(srca,0);
+}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4239_3_t: /* CLR */
+{
+{{	uaecptr srca = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, 0);
+	put_byte(srca,0);
+}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_4240_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((0) & 0xffff);
+}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4250_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
+	put_word(srca,0);
+}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_4258_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += 2;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
+	put_word(srca,0);
+}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_4260_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
+	put_word(srca,0);
+}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_4268_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
+	put_word(srca,0);
+}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4270_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
+	put_word(srca,0);
+}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4278_3_t: /* CLR */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
+	put_word(srca,0);
+}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4279_3_t: /* CLR */
+{
+{{	uaecptr srca = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, 0);
+	put_word(srca,0);
+}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_4280_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
+	m68k_dreg(regs, srcreg) = (0);
+}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4290_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
+	put_long(srca,0);
+}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4298_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += 4;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
+	put_long(srca,0);
+}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_42a0_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
+	put_long(srca,0);
+}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_42a8_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
+	put_long(srca,0);
+}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_42b0_3_t: /* CLR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
+	put_long(srca,0);
+}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_42b8_3_t: /* CLR */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
+	put_long(srca,0);
+}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_42b9_3_t: /* CLR */
+{
+{{	uaecptr srca = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, 0);
+	put_long(srca,0);
+}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_4400_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4410_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
+	put_byte(srca,dst);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4418_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
+	put_byte(srca,dst);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4420_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
+	put_byte(srca,dst);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4428_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
+	put_byte(srca,dst);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4430_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
+	put_byte(srca,dst);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4438_3_t: /* NEG */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
+	put_byte(srca,dst);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4439_3_t: /* NEG */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, 0, dst);
+	put_byte(srca,dst);
+}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_4440_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4450_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
+	put_word(srca,dst);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4458_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
+	put_word(srca,dst);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4460_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
+	put_word(srca,dst);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4468_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
+	put_word(srca,dst);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4470_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
+	put_word(srca,dst);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4478_3_t: /* NEG */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
+	put_word(srca,dst);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4479_3_t: /* NEG */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, 0, dst);
+	put_word(srca,dst);
+}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_4480_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
+	m68k_dreg(regs, srcreg) = (dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4490_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
+	put_long(srca,dst);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_4498_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
+	put_long(srca,dst);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_44a0_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
+	put_long(srca,dst);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_44a8_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
+	put_long(srca,dst);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_44b0_3_t: /* NEG */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
+	put_long(srca,dst);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_44b8_3_t: /* NEG */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
+	put_long(srca,dst);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_44b9_3_t: /* NEG */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, 0, dst);
+	put_long(srca,dst);
+}}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_44c0_3_t: /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_44d0_3_t: /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_44d8_3_t: /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_44e0_3_t: /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_44e8_3_t: /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_44f0_3_t: /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_44f8_3_t: /* MV2SR */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_44f9_3_t: /* MV2SR */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_44fa_3_t: /* MV2SR */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_44fb_3_t: /* MV2SR */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_44fc_3_t: /* MV2SR */
+{
+{{	uae_s16 src = get_iword(2);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_4600_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((dst) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4610_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
+	put_byte(srca,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4618_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
+	put_byte(srca,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4620_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
+	put_byte(srca,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4628_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
+	put_byte(srca,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4630_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
+	put_byte(srca,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4638_3_t: /* NOT */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
+	put_byte(srca,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4639_3_t: /* NOT */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, dst);
+	put_byte(srca,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_4640_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4650_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
+	put_word(srca,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4658_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
+	put_word(srca,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4660_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
+	put_word(srca,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4668_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
+	put_word(srca,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4670_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
+	put_word(srca,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4678_3_t: /* NOT */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
+	put_word(srca,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4679_3_t: /* NOT */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
+	put_word(srca,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_4680_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
+	m68k_dreg(regs, srcreg) = (dst);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4690_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
+	put_long(srca,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_4698_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
+	put_long(srca,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_46a0_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
+	put_long(srca,dst);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_46a8_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
+	put_long(srca,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_46b0_3_t: /* NOT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
+	put_long(srca,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_46b8_3_t: /* NOT */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
+	put_long(srca,dst);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_46b9_3_t: /* NOT */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_u32 dst = ~src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
+	put_long(srca,dst);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_46c0_3_t: /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel3859; }
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+	regs.sr = src;
+	MakeFromSR();
+}}}m68k_incpc(2);
+endlabel3859: ;
+THREADED_NEXT (2);
+}
+op_46d0_3_t: /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel3860; }
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(2);
+endlabel3860: ;
+THREADED_NEXT (4);
+}
+op_46d8_3_t: /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel3861; }
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(2);
+endlabel3861: ;
+THREADED_NEXT (4);
+}
+op_46e0_3_t: /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel3862; }
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(2);
+endlabel3862: ;
+THREADED_NEXT (4);
+}
+op_46e8_3_t: /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel3863; }
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(4);
+endlabel3863: ;
+THREADED_NEXT (6);
+}
+op_46f0_3_t: /* MV2SR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel3864; }
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(4);
+endlabel3864: ;
+THREADED_NEXT (6);
+}
+op_46f8_3_t: /* MV2SR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel3865; }
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(4);
+endlabel3865: ;
+THREADED_NEXT (6);
+}
+op_46f9_3_t: /* MV2SR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel3866; }
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(6);
+endlabel3866: ;
+THREADED_NEXT (8);
+}
+op_46fa_3_t: /* MV2SR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel3867; }
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(4);
+endlabel3867: ;
+THREADED_NEXT (6);
+}
+op_46fb_3_t: /* MV2SR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel3868; }
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(4);
+endlabel3868: ;
+THREADED_NEXT (6);
+}
+op_46fc_3_t: /* MV2SR */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel3869; }
+{{	uae_s16 src = get_iword(2);
+	regs.sr = src;
+	MakeFromSR();
+}}}m68k_incpc(4);
+endlabel3869: ;
+THREADED_NEXT (4);
+}
+op_4800_3_t: /* NBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((newv) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4810_3_t: /* NBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4818_3_t: /* NBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4820_3_t: /* NBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4828_3_t: /* NBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4830_3_t: /* NBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4838_3_t: /* NBCD */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4839_3_t: /* NBCD */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_4840_3_t: /* SWAP */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_u32 dst = ((src >> 16)&0xFFFF) | ((src&0xFFFF)<<16);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
+	m68k_dreg(regs, srcreg) = (dst);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4850_3_t: /* PEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+	put_long(dsta,srca);
+}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4868_3_t: /* PEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+	put_long(dsta,srca);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4870_3_t: /* PEA */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+	put_long(dsta,srca);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4878_3_t: /* PEA */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+	put_long(dsta,srca);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4879_3_t: /* PEA */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+	put_long(dsta,srca);
+}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_487a_3_t: /* PEA */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+	put_long(dsta,srca);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_487b_3_t: /* PEA */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+	put_long(dsta,srca);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4880_3_t: /* EXT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_u16 dst = (uae_s16)(uae_s8)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, dst);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((dst) & 0xffff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4890_3_t: /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_48a0_3_t: /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg) - 0;
+{	uae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;
+	m68k_areg (regs, dstreg) -= 16 * 2;
+	while (amask) { srca -= 2; put_word(srca, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
+	while (dmask) { srca -= 2; put_word(srca, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
+	m68k_areg(regs, dstreg) = srca;
+	CHECK_STACK_POINTER_DECREMENT ();
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_48a8_3_t: /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_48b0_3_t: /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_48b8_3_t: /* MVMLE */
+{
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(4);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_48b9_3_t: /* MVMLE */
+{
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = get_ilong(4);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(8);
+THREADED_NEXT (8);
+}
+op_48c0_3_t: /* EXT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_u32 dst = (uae_s32)(uae_s16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
+	m68k_dreg(regs, srcreg) = (dst);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_48d0_3_t: /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_48e0_3_t: /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg) - 0;
+{	uae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;
+	m68k_areg (regs, dstreg) -= 16 * 4;
+	while (amask) { srca -= 4; put_long(srca, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
+	while (dmask) { srca -= 4; put_long(srca, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
+	m68k_areg(regs, dstreg) = srca;
+	CHECK_STACK_POINTER_DECREMENT ();
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_48e8_3_t: /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_48f0_3_t: /* MVMLE */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_48f8_3_t: /* MVMLE */
+{
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(4);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_48f9_3_t: /* MVMLE */
+{
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = get_ilong(4);
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(8);
+THREADED_NEXT (8);
+}
+op_49c0_3_t: /* EXT */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_u32 dst = (uae_s32)(uae_s8)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, dst);
+	m68k_dreg(regs, srcreg) = (dst);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4a00_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4a10_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_4a18_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_4a20_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_4a28_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4a30_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4a38_3_t: /* TST */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4a39_3_t: /* TST */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_4a3a_3_t: /* TST */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4a3b_3_t: /* TST */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4a3c_3_t: /* TST */
+{
+{{	uae_s8 src = get_ibyte(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_4a40_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4a48_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4a50_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_4a58_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_4a60_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_4a68_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4a70_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4a78_3_t: /* TST */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4a79_3_t: /* TST */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_4a7a_3_t: /* TST */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4a7b_3_t: /* TST */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_4a7c_3_t: /* TST */
+{
+{{	uae_s16 src = get_iword(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_4a80_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4a88_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4a90_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4a98_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4aa0_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4aa8_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4ab0_3_t: /* TST */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4ab8_3_t: /* TST */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4ab9_3_t: /* TST */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_4aba_3_t: /* TST */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4abb_3_t: /* TST */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4abc_3_t: /* TST */
+{
+{{	uae_s32 src = get_ilong(2);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_4ac0_3_t: /* TAS */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	src |= 0x80;
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((src) & 0xff);
+}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4ad0_3_t: /* TAS */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	src |= 0x80;
+	put_byte(srca,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4ad8_3_t: /* TAS */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	src |= 0x80;
+	put_byte(srca,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4ae0_3_t: /* TAS */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	src |= 0x80;
+	put_byte(srca,src);
+}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4ae8_3_t: /* TAS */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	src |= 0x80;
+	put_byte(srca,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4af0_3_t: /* TAS */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	src |= 0x80;
+	put_byte(srca,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4af8_3_t: /* TAS */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	src |= 0x80;
+	put_byte(srca,src);
+}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4af9_3_t: /* TAS */
+{
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	src |= 0x80;
+	put_byte(srca,src);
+}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_4c90_3_t: /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_4c98_3_t: /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_4ca8_3_t: /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_4cb0_3_t: /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_4cb8_3_t: /* MVMEL */
+{
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_4cb9_3_t: /* MVMEL */
+{
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = get_ilong(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(8);
+THREADED_NEXT (8);
+}
+op_4cba_3_t: /* MVMEL */
+{
+	uae_u32 dstreg = 2;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_getpc () + 4;
+	srca += (uae_s32)(uae_s16)get_iword(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_4cbb_3_t: /* MVMEL */
+{
+	uae_u32 dstreg = 3;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(4));
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_4cd0_3_t: /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_4cd8_3_t: /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_4ce8_3_t: /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_4cf0_3_t: /* MVMEL */
+{
+	uae_u32 dstreg = opcode & 7;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_4cf8_3_t: /* MVMEL */
+{
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_4cf9_3_t: /* MVMEL */
+{
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = get_ilong(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(8);
+THREADED_NEXT (8);
+}
+op_4cfa_3_t: /* MVMEL */
+{
+	uae_u32 dstreg = 2;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_getpc () + 4;
+	srca += (uae_s32)(uae_s16)get_iword(4);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_4cfb_3_t: /* MVMEL */
+{
+	uae_u32 dstreg = 3;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(4));
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_4e40_3_t: /* TRAP */
+{
+	uae_u32 srcreg = (opcode & 15);
+{{	uae_u32 src = srcreg;
+m68k_incpc(2);
+	Exception(src+32,0);
+}}THREADED_NEXT (2);
+}
+op_4e50_3_t: /* LINK */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr olda = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = olda;
+	if (7 == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 src = m68k_areg(regs, srcreg);
+	put_long(olda,src);
+	m68k_areg(regs, srcreg) = (m68k_areg(regs, 7));
+	if (srcreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+{	uae_s16 offs = get_iword(2);
+	m68k_areg(regs, 7) += offs;
+	CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_4e58_3_t: /* UNLK */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+	m68k_areg(regs, 7) = src;
+	CHECK_STACK_POINTER_INCREMENT ();
+{	uaecptr olda = m68k_areg(regs, 7);
+{	uae_s32 old = get_long(olda);
+	m68k_areg(regs, 7) += 4;
+	m68k_areg(regs, srcreg) = (old);
+	if (srcreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_4e60_3_t: /* MVR2USP */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel3963; }
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+	regs.usp = src;
+}}}m68k_incpc(2);
+endlabel3963: ;
+THREADED_NEXT (2);
+}
+op_4e68_3_t: /* MVUSP2R */
+{
+	uae_u32 srcreg = (opcode & 7);
+{if (!regs.s) { Exception(8,0); goto endlabel3964; }
+{{	m68k_areg(regs, srcreg) = (regs.usp);
+	if (srcreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(2);
+endlabel3964: ;
+THREADED_NEXT (2);
+}
+op_4e70_3_t: /* RESET */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel3965; }
+{	customreset();
+}}m68k_incpc(2);
+endlabel3965: ;
+THREADED_NEXT (2);
+}
+op_4e71_3_t: /* NOP */
+{
+{}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_4e72_3_t: /* STOP */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel3967; }
+{{	uae_s16 src = get_iword(2);
+	regs.sr = src;
+	MakeFromSR();
+	m68k_setstopped(1);
+}}}m68k_incpc(4);
+endlabel3967: ;
+THREADED_NEXT (4);
+}
+op_4e73_3_t: /* RTE */
+{
+{if (!regs.s) { Exception(8,0); goto endlabel3968; }
+{{	uaecptr sra = m68k_areg(regs, 7);
+{	uae_s16 sr = get_word(sra);
+	m68k_areg(regs, 7) += 2;
+{	uaecptr pca = m68k_areg(regs, 7);
+{	uae_s32 pc = get_long(pca);
+	m68k_areg(regs, 7) += 4;
+	regs.sr = sr; m68k_do_rte(pc);
+	MakeFromSR();
+}}}}}}endlabel3968: ;
+THREADED_NEXT (8);
+}
+op_4e74_3_t: /* RTD */
+{
+{	compiler_flush_jsr_stack();
+{	uaecptr pca = m68k_areg(regs, 7);
+{	uae_s32 pc = get_long(pca);
+	m68k_areg(regs, 7) += 4;
+{	uae_s16 offs = get_iword(2);
+	m68k_areg(regs, 7) += offs;
+	CHECK_STACK_POINTER_INCREMENT ();
+	m68k_setpc_rte(pc);
+}}}}THREADED_NEXT (8);
+}
+op_4e75_3_t: /* RTS */
+{
+{	m68k_do_rts();
+}THREADED_NEXT (2);
+}
+op_4e76_3_t: /* TRAPV */
+{
+{m68k_incpc(2);
+	if (GET_VFLG) { Exception(7,m68k_getpc()); goto endlabel3971; }
+}endlabel3971: ;
+THREADED_NEXT (2);
+}
+op_4e77_3_t: /* RTR */
+{
+{	compiler_flush_jsr_stack();
+	MakeSR();
+{	uaecptr sra = m68k_areg(regs, 7);
+{	uae_s16 sr = get_word(sra);
+	m68k_areg(regs, 7) += 2;
+{	uaecptr pca = m68k_areg(regs, 7);
+{	uae_s32 pc = get_long(pca);
+	m68k_areg(regs, 7) += 4;
+	regs.sr &= 0xFF00; sr &= 0xFF;
+	regs.sr |= sr; m68k_setpc(pc);
+	MakeFromSR();
+}}}}}THREADED_NEXT (8);
+}
+op_4e90_3_t: /* JSR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+if (!Software_ProcessJSR_Ind (m68k_getpc(), srca))
+	m68k_do_jsr(m68k_getpc() + 2, srca);
+}}THREADED_NEXT (2);
+}
+op_4ea8_3_t: /* JSR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+	m68k_do_jsr(m68k_getpc() + 4, srca);
+}}THREADED_NEXT (4);
+}
+op_4eb0_3_t: /* JSR */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	m68k_do_jsr(m68k_getpc() + 4, srca);
+}}THREADED_NEXT (4);
+}
+op_4eb8_3_t: /* JSR */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+	m68k_do_jsr(m68k_getpc() + 4, srca);
+}}THREADED_NEXT (4);
+}
+op_4eb9_3_t: /* JSR */
+{
+{{	uaecptr srca = get_ilong(2);
+	m68k_do_jsr(m68k_getpc() + 6, srca);
+}}THREADED_NEXT (6);
+}
+op_4eba_3_t: /* JSR */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+	m68k_do_jsr(m68k_getpc() + 4, srca);
+}}THREADED_NEXT (4);
+}
+op_4ebb_3_t: /* JSR */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+	m68k_do_jsr(m68k_getpc() + 4, srca);
+}}THREADED_NEXT (4);
+}
+op_4ed0_3_t: /* JMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_setpc(srca);
+}}THREADED_NEXT (2);
+}
+op_4ee8_3_t: /* JMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+	m68k_setpc(srca);
+}}THREADED_NEXT (4);
+}
+op_4ef0_3_t: /* JMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	m68k_setpc(srca);
+}}THREADED_NEXT (4);
+}
+op_4ef8_3_t: /* JMP */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+	m68k_setpc(srca);
+}}THREADED_NEXT (4);
+}
+op_4ef9_3_t: /* JMP */
+{
+{{	uaecptr srca = get_ilong(2);
+	m68k_setpc(srca);
+}}THREADED_NEXT (6);
+}
+op_4efa_3_t: /* JMP */
+{
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+	m68k_setpc(srca);
+}}THREADED_NEXT (4);
+}
+op_4efb_3_t: /* JMP */
+{
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+	m68k_setpc(srca);
+}}THREADED_NEXT (4);
+}
+op_5000_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5010_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_5018_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_5020_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_5028_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_5030_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_5038_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_5039_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_5040_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5048_3_t: /* ADDA */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5050_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_5058_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_5060_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_5068_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_5070_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_5078_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_5079_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_ilong(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_5080_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5088_3_t: /* ADDA */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5090_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_5098_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_50a0_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_50a8_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_50b0_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_50b8_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_50b9_3_t: /* ADD */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_ilong(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_50c0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(0) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_50c8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(0)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4014;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4014: ;
+THREADED_NEXT (4);
+}
+op_50d0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(0) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_50d8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(0) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_50e0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(0) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_50e8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(0) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_50f0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(0) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_50f8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(0) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_50f9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(0) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_5100_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5110_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_5118_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_5120_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_5128_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_5130_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_5138_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_5139_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_5140_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5148_3_t: /* SUBA */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5150_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_5158_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_5160_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_5168_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_5170_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_5178_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_5179_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_ilong(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_5180_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5188_3_t: /* SUBA */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5190_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_5198_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_51a0_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_51a8_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_51b0_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_51b8_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_51b9_3_t: /* SUB */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_ilong(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_51c0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(1) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_51c8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4049;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4049: ;
+THREADED_NEXT (4);
+}
+op_51d0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(1) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_51d8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(1) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_51e0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(1) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_51e8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(1) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_51f0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(1) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_51f8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(1) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_51f9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(1) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_52c0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(2) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_52c8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(2)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4058;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4058: ;
+THREADED_NEXT (4);
+}
+op_52d0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(2) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_52d8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(2) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_52e0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(2) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_52e8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(2) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_52f0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(2) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_52f8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(2) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_52f9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(2) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_53c0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(3) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_53c8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(3)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4067;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4067: ;
+THREADED_NEXT (4);
+}
+op_53d0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(3) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_53d8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(3) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_53e0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(3) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_53e8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(3) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_53f0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(3) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_53f8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(3) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_53f9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(3) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_54c0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(4) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_54c8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(4)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4076;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4076: ;
+THREADED_NEXT (4);
+}
+op_54d0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(4) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_54d8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(4) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_54e0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(4) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_54e8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(4) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_54f0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(4) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_54f8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(4) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_54f9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(4) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_55c0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(5) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_55c8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(5)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4085;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4085: ;
+THREADED_NEXT (4);
+}
+op_55d0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(5) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_55d8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(5) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_55e0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(5) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_55e8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(5) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_55f0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(5) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_55f8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(5) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_55f9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(5) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_56c0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(6) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_56c8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(6)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4094;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4094: ;
+THREADED_NEXT (4);
+}
+op_56d0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(6) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_56d8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(6) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_56e0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(6) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_56e8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(6) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_56f0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(6) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_56f8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(6) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_56f9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(6) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_57c0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(7) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_57c8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(7)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4103;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4103: ;
+THREADED_NEXT (4);
+}
+op_57d0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(7) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_57d8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(7) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_57e0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(7) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_57e8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(7) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_57f0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(7) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_57f8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(7) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_57f9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(7) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_58c0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(8) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_58c8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(8)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4112;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4112: ;
+THREADED_NEXT (4);
+}
+op_58d0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(8) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_58d8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(8) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_58e0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(8) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_58e8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(8) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_58f0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(8) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_58f8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(8) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_58f9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(8) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_59c0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(9) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_59c8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(9)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4121;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4121: ;
+THREADED_NEXT (4);
+}
+op_59d0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(9) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_59d8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(9) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_59e0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(9) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_59e8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(9) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_59f0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(9) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_59f8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(9) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_59f9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(9) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_5ac0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(10) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5ac8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(10)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4130;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4130: ;
+THREADED_NEXT (4);
+}
+op_5ad0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(10) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5ad8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(10) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5ae0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(10) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5ae8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(10) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5af0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(10) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5af8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(10) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5af9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(10) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_5bc0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(11) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5bc8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(11)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4139;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4139: ;
+THREADED_NEXT (4);
+}
+op_5bd0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(11) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5bd8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(11) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5be0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(11) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5be8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(11) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5bf0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(11) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5bf8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(11) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5bf9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(11) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_5cc0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(12) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5cc8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(12)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4148;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4148: ;
+THREADED_NEXT (4);
+}
+op_5cd0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(12) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5cd8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(12) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5ce0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(12) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5ce8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(12) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5cf0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(12) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5cf8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(12) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5cf9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(12) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_5dc0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(13) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5dc8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(13)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4157;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4157: ;
+THREADED_NEXT (4);
+}
+op_5dd0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(13) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5dd8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(13) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5de0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(13) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5de8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(13) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5df0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(13) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5df8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(13) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5df9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(13) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_5ec0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(14) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5ec8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(14)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4166;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4166: ;
+THREADED_NEXT (4);
+}
+op_5ed0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(14) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5ed8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(14) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5ee0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(14) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5ee8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(14) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5ef0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(14) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5ef8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(14) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5ef9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(14) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_5fc0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{{	int val = lazy_cctrue(15) ? 0xff : 0;
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((val) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_5fc8_3_t: /* DBcc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!lazy_cctrue(15)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+		goto endlabel4175;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel4175: ;
+THREADED_NEXT (4);
+}
+op_5fd0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	int val = lazy_cctrue(15) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5fd8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	int val = lazy_cctrue(15) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5fe0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	int val = lazy_cctrue(15) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_5fe8_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(15) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5ff0_3_t: /* Scc */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = lazy_cctrue(15) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5ff8_3_t: /* Scc */
+{
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	int val = lazy_cctrue(15) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_5ff9_3_t: /* Scc */
+{
+{{	uaecptr srca = get_ilong(2);
+{	int val = lazy_cctrue(15) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_6000_3_t: /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!lazy_cctrue(0)) goto didnt_jump4183;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4183;
+didnt_jump4183:;
+}}m68k_incpc(4);
+endlabel4183: ;
+THREADED_NEXT (4);
+}
+op_6001_3_t: /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!lazy_cctrue(0)) goto didnt_jump4184;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4184;
+didnt_jump4184:;
+}}m68k_incpc(2);
+endlabel4184: ;
+THREADED_NEXT (2);
+}
+op_60ff_3_t: /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!lazy_cctrue(0)) goto endlabel4185;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel4185;
+{	uae_s32 src = get_ilong(2);
+	if (!lazy_cctrue(0)) goto didnt_jump4185;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4185;
+didnt_jump4185:;
+}}m68k_incpc(6);
+endlabel4185: ;
+THREADED_NEXT (6);
+}
+op_6100_3_t: /* BSR */
+{
+{{	uae_s16 src = get_iword(2);
+	uae_s32 s = (uae_s32)src + 2;
+	m68k_do_bsr(m68k_getpc() + 4, s);
+}}THREADED_NEXT (4);
+}
+op_6101_3_t: /* BSR */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	uae_s32 s = (uae_s32)src + 2;
+	m68k_do_bsr(m68k_getpc() + 2, s);
+}}THREADED_NEXT (2);
+}
+op_61ff_3_t: /* BSR */
+{
+{{	uae_s32 src = get_ilong(2);
+	uae_s32 s = (uae_s32)src + 2;
+	m68k_do_bsr(m68k_getpc() + 6, s);
+}}THREADED_NEXT (6);
+}
+op_6200_3_t: /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!lazy_cctrue(2)) goto didnt_jump4189;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4189;
+didnt_jump4189:;
+}}m68k_incpc(4);
+endlabel4189: ;
+THREADED_NEXT (4);
+}
+op_6201_3_t: /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!lazy_cctrue(2)) goto didnt_jump4190;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4190;
+didnt_jump4190:;
+}}m68k_incpc(2);
+endlabel4190: ;
+THREADED_NEXT (2);
+}
+op_62ff_3_t: /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!lazy_cctrue(2)) goto endlabel4191;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel4191;
+{	uae_s32 src = get_ilong(2);
+	if (!lazy_cctrue(2)) goto didnt_jump4191;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4191;
+didnt_jump4191:;
+}}m68k_incpc(6);
+endlabel4191: ;
+THREADED_NEXT (6);
+}
+op_6300_3_t: /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!lazy_cctrue(3)) goto didnt_jump4192;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4192;
+didnt_jump4192:;
+}}m68k_incpc(4);
+endlabel4192: ;
+THREADED_NEXT (4);
+}
+op_6301_3_t: /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!lazy_cctrue(3)) goto didnt_jump4193;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4193;
+didnt_jump4193:;
+}}m68k_incpc(2);
+endlabel4193: ;
+THREADED_NEXT (2);
+}
+op_63ff_3_t: /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!lazy_cctrue(3)) goto endlabel4194;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel4194;
+{	uae_s32 src = get_ilong(2);
+	if (!lazy_cctrue(3)) goto didnt_jump4194;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4194;
+didnt_jump4194:;
+}}m68k_incpc(6);
+endlabel4194: ;
+THREADED_NEXT (6);
+}
+op_6400_3_t: /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!lazy_cctrue(4)) goto didnt_jump4195;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4195;
+didnt_jump4195:;
+}}m68k_incpc(4);
+endlabel4195: ;
+THREADED_NEXT (4);
+}
+op_6401_3_t: /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!lazy_cctrue(4)) goto didnt_jump4196;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4196;
+didnt_jump4196:;
+}}m68k_incpc(2);
+endlabel4196: ;
+THREADED_NEXT (2);
+}
+op_64ff_3_t: /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!lazy_cctrue(4)) goto endlabel4197;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel4197;
+{	uae_s32 src = get_ilong(2);
+	if (!lazy_cctrue(4)) goto didnt_jump4197;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4197;
+didnt_jump4197:;
+}}m68k_incpc(6);
+endlabel4197: ;
+THREADED_NEXT (6);
+}
+op_6500_3_t: /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!lazy_cctrue(5)) goto didnt_jump4198;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4198;
+didnt_jump4198:;
+}}m68k_incpc(4);
+endlabel4198: ;
+THREADED_NEXT (4);
+}
+op_6501_3_t: /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!lazy_cctrue(5)) goto didnt_jump4199;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4199;
+didnt_jump4199:;
+}}m68k_incpc(2);
+endlabel4199: ;
+THREADED_NEXT (2);
+}
+op_65ff_3_t: /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!lazy_cctrue(5)) goto endlabel4200;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel4200;
+{	uae_s32 src = get_ilong(2);
+	if (!lazy_cctrue(5)) goto didnt_jump4200;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4200;
+didnt_jump4200:;
+}}m68k_incpc(6);
+endlabel4200: ;
+THREADED_NEXT (6);
+}
+op_6600_3_t: /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!lazy_cctrue(6)) goto didnt_jump4201;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4201;
+didnt_jump4201:;
+}}m68k_incpc(4);
+endlabel4201: ;
+THREADED_NEXT (4);
+}
+op_6601_3_t: /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!lazy_cctrue(6)) goto didnt_jump4202;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4202;
+didnt_jump4202:;
+}}m68k_incpc(2);
+endlabel4202: ;
+THREADED_NEXT (2);
+}
+op_66ff_3_t: /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!lazy_cctrue(6)) goto endlabel4203;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel4203;
+{	uae_s32 src = get_ilong(2);
+	if (!lazy_cctrue(6)) goto didnt_jump4203;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4203;
+didnt_jump4203:;
+}}m68k_incpc(6);
+endlabel4203: ;
+THREADED_NEXT (6);
+}
+op_6700_3_t: /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!lazy_cctrue(7)) goto didnt_jump4204;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4204;
+didnt_jump4204:;
+}}m68k_incpc(4);
+endlabel4204: ;
+THREADED_NEXT (4);
+}
+op_6701_3_t: /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!lazy_cctrue(7)) goto didnt_jump4205;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4205;
+didnt_jump4205:;
+}}m68k_incpc(2);
+endlabel4205: ;
+THREADED_NEXT (2);
+}
+op_67ff_3_t: /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!lazy_cctrue(7)) goto endlabel4206;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel4206;
+{	uae_s32 src = get_ilong(2);
+	if (!lazy_cctrue(7)) goto didnt_jump4206;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4206;
+didnt_jump4206:;
+}}m68k_incpc(6);
+endlabel4206: ;
+THREADED_NEXT (6);
+}
+op_6800_3_t: /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!lazy_cctrue(8)) goto didnt_jump4207;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4207;
+didnt_jump4207:;
+}}m68k_incpc(4);
+endlabel4207: ;
+THREADED_NEXT (4);
+}
+op_6801_3_t: /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!lazy_cctrue(8)) goto didnt_jump4208;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4208;
+didnt_jump4208:;
+}}m68k_incpc(2);
+endlabel4208: ;
+THREADED_NEXT (2);
+}
+op_68ff_3_t: /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!lazy_cctrue(8)) goto endlabel4209;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel4209;
+{	uae_s32 src = get_ilong(2);
+	if (!lazy_cctrue(8)) goto didnt_jump4209;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4209;
+didnt_jump4209:;
+}}m68k_incpc(6);
+endlabel4209: ;
+THREADED_NEXT (6);
+}
+op_6900_3_t: /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!lazy_cctrue(9)) goto didnt_jump4210;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4210;
+didnt_jump4210:;
+}}m68k_incpc(4);
+endlabel4210: ;
+THREADED_NEXT (4);
+}
+op_6901_3_t: /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!lazy_cctrue(9)) goto didnt_jump4211;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4211;
+didnt_jump4211:;
+}}m68k_incpc(2);
+endlabel4211: ;
+THREADED_NEXT (2);
+}
+op_69ff_3_t: /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!lazy_cctrue(9)) goto endlabel4212;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel4212;
+{	uae_s32 src = get_ilong(2);
+	if (!lazy_cctrue(9)) goto didnt_jump4212;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4212;
+didnt_jump4212:;
+}}m68k_incpc(6);
+endlabel4212: ;
+THREADED_NEXT (6);
+}
+op_6a00_3_t: /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!lazy_cctrue(10)) goto didnt_jump4213;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4213;
+didnt_jump4213:;
+}}m68k_incpc(4);
+endlabel4213: ;
+THREADED_NEXT (4);
+}
+op_6a01_3_t: /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!lazy_cctrue(10)) goto didnt_jump4214;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4214;
+didnt_jump4214:;
+}}m68k_incpc(2);
+endlabel4214: ;
+THREADED_NEXT (2);
+}
+op_6aff_3_t: /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!lazy_cctrue(10)) goto endlabel4215;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel4215;
+{	uae_s32 src = get_ilong(2);
+	if (!lazy_cctrue(10)) goto didnt_jump4215;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4215;
+didnt_jump4215:;
+}}m68k_incpc(6);
+endlabel4215: ;
+THREADED_NEXT (6);
+}
+op_6b00_3_t: /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!lazy_cctrue(11)) goto didnt_jump4216;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4216;
+didnt_jump4216:;
+}}m68k_incpc(4);
+endlabel4216: ;
+THREADED_NEXT (4);
+}
+op_6b01_3_t: /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!lazy_cctrue(11)) goto didnt_jump4217;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4217;
+didnt_jump4217:;
+}}m68k_incpc(2);
+endlabel4217: ;
+THREADED_NEXT (2);
+}
+op_6bff_3_t: /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!lazy_cctrue(11)) goto endlabel4218;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel4218;
+{	uae_s32 src = get_ilong(2);
+	if (!lazy_cctrue(11)) goto didnt_jump4218;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4218;
+didnt_jump4218:;
+}}m68k_incpc(6);
+endlabel4218: ;
+THREADED_NEXT (6);
+}
+op_6c00_3_t: /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!lazy_cctrue(12)) goto didnt_jump4219;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4219;
+didnt_jump4219:;
+}}m68k_incpc(4);
+endlabel4219: ;
+THREADED_NEXT (4);
+}
+op_6c01_3_t: /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!lazy_cctrue(12)) goto didnt_jump4220;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4220;
+didnt_jump4220:;
+}}m68k_incpc(2);
+endlabel4220: ;
+THREADED_NEXT (2);
+}
+op_6cff_3_t: /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!lazy_cctrue(12)) goto endlabel4221;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel4221;
+{	uae_s32 src = get_ilong(2);
+	if (!lazy_cctrue(12)) goto didnt_jump4221;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4221;
+didnt_jump4221:;
+}}m68k_incpc(6);
+endlabel4221: ;
+THREADED_NEXT (6);
+}
+op_6d00_3_t: /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!lazy_cctrue(13)) goto didnt_jump4222;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4222;
+didnt_jump4222:;
+}}m68k_incpc(4);
+endlabel4222: ;
+THREADED_NEXT (4);
+}
+op_6d01_3_t: /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!lazy_cctrue(13)) goto didnt_jump4223;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4223;
+didnt_jump4223:;
+}}m68k_incpc(2);
+endlabel4223: ;
+THREADED_NEXT (2);
+}
+op_6dff_3_t: /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!lazy_cctrue(13)) goto endlabel4224;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel4224;
+{	uae_s32 src = get_ilong(2);
+	if (!lazy_cctrue(13)) goto didnt_jump4224;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4224;
+didnt_jump4224:;
+}}m68k_incpc(6);
+endlabel4224: ;
+THREADED_NEXT (6);
+}
+op_6e00_3_t: /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!lazy_cctrue(14)) goto didnt_jump4225;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4225;
+didnt_jump4225:;
+}}m68k_incpc(4);
+endlabel4225: ;
+THREADED_NEXT (4);
+}
+op_6e01_3_t: /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!lazy_cctrue(14)) goto didnt_jump4226;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4226;
+didnt_jump4226:;
+}}m68k_incpc(2);
+endlabel4226: ;
+THREADED_NEXT (2);
+}
+op_6eff_3_t: /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!lazy_cctrue(14)) goto endlabel4227;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel4227;
+{	uae_s32 src = get_ilong(2);
+	if (!lazy_cctrue(14)) goto didnt_jump4227;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4227;
+didnt_jump4227:;
+}}m68k_incpc(6);
+endlabel4227: ;
+THREADED_NEXT (6);
+}
+op_6f00_3_t: /* Bcc */
+{
+{{	uae_s16 src = get_iword(2);
+	if (!lazy_cctrue(15)) goto didnt_jump4228;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4228;
+didnt_jump4228:;
+}}m68k_incpc(4);
+endlabel4228: ;
+THREADED_NEXT (4);
+}
+op_6f01_3_t: /* Bcc */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+{{	uae_u32 src = srcreg;
+	if (!lazy_cctrue(15)) goto didnt_jump4229;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4229;
+didnt_jump4229:;
+}}m68k_incpc(2);
+endlabel4229: ;
+THREADED_NEXT (2);
+}
+op_6fff_3_t: /* Bcc */
+{
+{	m68k_incpc(2);
+	if (!lazy_cctrue(15)) goto endlabel4230;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel4230;
+{	uae_s32 src = get_ilong(2);
+	if (!lazy_cctrue(15)) goto didnt_jump4230;
+	m68k_incpc ((uae_s32)src + 2);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2);
+#endif
+	goto endlabel4230;
+didnt_jump4230:;
+}}m68k_incpc(6);
+endlabel4230: ;
+THREADED_NEXT (6);
+}
+op_7000_3_t: /* MOVE */
+{
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_u32 src = srcreg;
+{	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_8000_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_8010_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_8018_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_8020_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_8028_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_8030_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_8038_3_t: /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_8039_3_t: /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_803a_3_t: /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_803b_3_t: /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_803c_3_t: /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_8040_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_8050_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_8058_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_8060_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_8068_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_8070_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_8078_3_t: /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_8079_3_t: /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_807a_3_t: /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_807b_3_t: /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_807c_3_t: /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_8080_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_8090_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_8098_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_80a0_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_80a8_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_80b0_3_t: /* OR */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_80b8_3_t: /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_80b9_3_t: /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_80ba_3_t: /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_80bb_3_t: /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_80bc_3_t: /* OR */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_80c0_3_t: /* DIVU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4265; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}m68k_incpc(2);
+endlabel4265: ;
+THREADED_NEXT (70);
+}
+op_80d0_3_t: /* DIVU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4266; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(2);
+endlabel4266: ;
+THREADED_NEXT (72);
+}
+op_80d8_3_t: /* DIVU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4267; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(2);
+endlabel4267: ;
+THREADED_NEXT (72);
+}
+op_80e0_3_t: /* DIVU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4268; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(2);
+endlabel4268: ;
+THREADED_NEXT (72);
+}
+op_80e8_3_t: /* DIVU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4269; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel4269: ;
+THREADED_NEXT (74);
+}
+op_80f0_3_t: /* DIVU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4270; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel4270: ;
+THREADED_NEXT (74);
+}
+op_80f8_3_t: /* DIVU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4271; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel4271: ;
+THREADED_NEXT (74);
+}
+op_80f9_3_t: /* DIVU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4272; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(6);
+endlabel4272: ;
+THREADED_NEXT (76);
+}
+op_80fa_3_t: /* DIVU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4273; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel4273: ;
+THREADED_NEXT (74);
+}
+op_80fb_3_t: /* DIVU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4274; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel4274: ;
+THREADED_NEXT (74);
+}
+op_80fc_3_t: /* DIVU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4275; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}m68k_incpc(4);
+endlabel4275: ;
+THREADED_NEXT (72);
+}
+op_8100_3_t: /* SBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{	uae_u16 newv_lo = (dst & 0xF) - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = (dst & 0xF0) - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_8108_3_t: /* SBCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 newv_lo = (dst & 0xF) - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = (dst & 0xF0) - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo-=6; newv_hi-=0x10; }
+	newv = newv_hi + (newv_lo & 0xF);	SET_CFLG (cflg = (newv_hi & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv -= 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+THREADED_NEXT (8);
+}
+op_8110_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_8118_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_8120_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_8128_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_8130_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_8138_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_8139_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_8150_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_8158_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_8160_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_8168_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_8170_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_8178_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_8179_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_8190_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_8198_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_81a0_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_81a8_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_81b0_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_81b8_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_81b9_3_t: /* OR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_81c0_3_t: /* DIVS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4299; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}m68k_incpc(2);
+endlabel4299: ;
+THREADED_NEXT (74);
+}
+op_81d0_3_t: /* DIVS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4300; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(2);
+endlabel4300: ;
+THREADED_NEXT (76);
+}
+op_81d8_3_t: /* DIVS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4301; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(2);
+endlabel4301: ;
+THREADED_NEXT (76);
+}
+op_81e0_3_t: /* DIVS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4302; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(2);
+endlabel4302: ;
+THREADED_NEXT (76);
+}
+op_81e8_3_t: /* DIVS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4303; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel4303: ;
+THREADED_NEXT (78);
+}
+op_81f0_3_t: /* DIVS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4304; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel4304: ;
+THREADED_NEXT (78);
+}
+op_81f8_3_t: /* DIVS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4305; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel4305: ;
+THREADED_NEXT (78);
+}
+op_81f9_3_t: /* DIVS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4306; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(6);
+endlabel4306: ;
+THREADED_NEXT (80);
+}
+op_81fa_3_t: /* DIVS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4307; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel4307: ;
+THREADED_NEXT (78);
+}
+op_81fb_3_t: /* DIVS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4308; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}m68k_incpc(4);
+endlabel4308: ;
+THREADED_NEXT (78);
+}
+op_81fc_3_t: /* DIVS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{	uaecptr oldpc = m68k_getpc();
+{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if(src == 0) { Exception(5,oldpc); goto endlabel4309; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, newv);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}m68k_incpc(4);
+endlabel4309: ;
+THREADED_NEXT (76);
+}
+op_9000_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_9010_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_9018_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_9020_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_9028_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_9030_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_9038_3_t: /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_9039_3_t: /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_903a_3_t: /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_903b_3_t: /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_903c_3_t: /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_9040_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_9048_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_9050_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_9058_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_9060_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_9068_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_9070_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_9078_3_t: /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_9079_3_t: /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_907a_3_t: /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_907b_3_t: /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_907c_3_t: /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_9080_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_9088_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_9090_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_9098_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_90a0_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_90a8_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_90b0_3_t: /* SUB */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_90b8_3_t: /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_90b9_3_t: /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_90ba_3_t: /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_90bb_3_t: /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_90bc_3_t: /* SUB */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_90c0_3_t: /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_90c8_3_t: /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_90d0_3_t: /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_90d8_3_t: /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_90e0_3_t: /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_90e8_3_t: /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_90f0_3_t: /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_90f8_3_t: /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_90f9_3_t: /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_90fa_3_t: /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_90fb_3_t: /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_90fc_3_t: /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_9100_3_t: /* SUBX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = dst - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_9108_3_t: /* SUBX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = dst - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+THREADED_NEXT (8);
+}
+op_9110_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_9118_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_9120_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_9128_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_9130_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_9138_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_9139_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_9140_3_t: /* SUBX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = dst - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_9148_3_t: /* SUBX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = dst - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+THREADED_NEXT (8);
+}
+op_9150_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_9158_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_9160_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_9168_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_9170_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_9178_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_9179_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_9180_3_t: /* SUBX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = dst - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_9188_3_t: /* SUBX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = dst - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+THREADED_NEXT (14);
+}
+op_9190_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_9198_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_91a0_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_91a8_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_91b0_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_91b8_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_91b9_3_t: /* SUB */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_SUB | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_91c0_3_t: /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_91c8_3_t: /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_91d0_3_t: /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_91d8_3_t: /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_91e0_3_t: /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_91e8_3_t: /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_91f0_3_t: /* SUBA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_91f8_3_t: /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_91f9_3_t: /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_91fa_3_t: /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_91fb_3_t: /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_91fc_3_t: /* SUBA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+}}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_b000_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_b010_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_b018_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_b020_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_b028_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_b030_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_b038_3_t: /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_b039_3_t: /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_b03a_3_t: /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_b03b_3_t: /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_b03c_3_t: /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_b040_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_b048_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_b050_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_b058_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_b060_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_b068_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_b070_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_b078_3_t: /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_b079_3_t: /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_b07a_3_t: /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_b07b_3_t: /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_b07c_3_t: /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_b080_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_b088_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_b090_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_b098_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_b0a0_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_b0a8_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b0b0_3_t: /* CMP */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b0b8_3_t: /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b0b9_3_t: /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_b0ba_3_t: /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b0bb_3_t: /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b0bc_3_t: /* CMP */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_b0c0_3_t: /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_b0c8_3_t: /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_b0d0_3_t: /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_b0d8_3_t: /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_b0e0_3_t: /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_b0e8_3_t: /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_b0f0_3_t: /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_b0f8_3_t: /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_b0f9_3_t: /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_b0fa_3_t: /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_b0fb_3_t: /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_b0fc_3_t: /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_b100_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_b108_3_t: /* CMPM */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_B, src, dst, newv);
+}}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_b110_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_b118_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_b120_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_b128_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b130_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b138_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b139_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_b140_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_b148_3_t: /* CMPM */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_W, src, dst, newv);
+}}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_b150_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_b158_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_b160_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_b168_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b170_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b178_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b179_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_b180_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_b188_3_t: /* CMPM */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_b190_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_b198_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_b1a0_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_b1a8_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_b1b0_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_b1b8_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_b1b9_3_t: /* EOR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_b1c0_3_t: /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_b1c8_3_t: /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_b1d0_3_t: /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_b1d8_3_t: /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_b1e0_3_t: /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_b1e8_3_t: /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b1f0_3_t: /* CMPA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b1f8_3_t: /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b1f9_3_t: /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_b1fa_3_t: /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b1fb_3_t: /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_b1fc_3_t: /* CMPA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_CMP | LAZY_FLAGS_L, src, dst, newv);
+}}}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_c000_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_c010_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_c018_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_c020_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_c028_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c030_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c038_3_t: /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c039_3_t: /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_c03a_3_t: /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c03b_3_t: /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c03c_3_t: /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_c040_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_c050_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_c058_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_c060_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_c068_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c070_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c078_3_t: /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c079_3_t: /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_c07a_3_t: /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c07b_3_t: /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_c07c_3_t: /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_c080_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_c090_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_c098_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_c0a0_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_c0a8_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_c0b0_3_t: /* AND */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_c0b8_3_t: /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_c0b9_3_t: /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_c0ba_3_t: /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_c0bb_3_t: /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_c0bc_3_t: /* AND */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_c0c0_3_t: /* MULU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}m68k_incpc(2);
+THREADED_NEXT (34);
+}
+op_c0d0_3_t: /* MULU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (36);
+}
+op_c0d8_3_t: /* MULU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (36);
+}
+op_c0e0_3_t: /* MULU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (36);
+}
+op_c0e8_3_t: /* MULU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (38);
+}
+op_c0f0_3_t: /* MULU */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (38);
+}
+op_c0f8_3_t: /* MULU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (38);
+}
+op_c0f9_3_t: /* MULU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(6);
+THREADED_NEXT (40);
+}
+op_c0fa_3_t: /* MULU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (38);
+}
+op_c0fb_3_t: /* MULU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (38);
+}
+op_c0fc_3_t: /* MULU */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}m68k_incpc(4);
+THREADED_NEXT (36);
+}
+op_c100_3_t: /* ABCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{	uae_u16 newv_lo = (src & 0xF) + (dst & 0xF) + (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = (src & 0xF0) + (dst & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo +=6; }
+	newv = newv_hi + newv_lo;	SET_CFLG (cflg = (newv & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv += 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_c108_3_t: /* ABCD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 newv_lo = (src & 0xF) + (dst & 0xF) + (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = (src & 0xF0) + (dst & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo +=6; }
+	newv = newv_hi + newv_lo;	SET_CFLG (cflg = (newv & 0x1F0) > 0x90);
+	COPY_CARRY;
+	if (cflg) newv += 0x60;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+THREADED_NEXT (8);
+}
+op_c110_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_c118_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_c120_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_c128_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_c130_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_c138_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_c139_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_B, 0, 0, src);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_c140_3_t: /* EXG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	m68k_dreg(regs, srcreg) = (dst);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_c148_3_t: /* EXG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+	m68k_areg(regs, srcreg) = (dst);
+	if (srcreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+	m68k_areg(regs, dstreg) = (src);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_c150_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_c158_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_c160_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_c168_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_c170_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_c178_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_c179_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, src);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_c188_3_t: /* EXG */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+	m68k_dreg(regs, srcreg) = (dst);
+	m68k_areg(regs, dstreg) = (src);
+	if (dstreg == 7) CHECK_STACK_POINTER_ASSIGNMENT ();
+}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_c190_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_c198_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_c1a0_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_c1a8_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_c1b0_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_c1b8_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_c1b9_3_t: /* AND */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, src);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_c1c0_3_t: /* MULS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}m68k_incpc(2);
+THREADED_NEXT (34);
+}
+op_c1d0_3_t: /* MULS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (36);
+}
+op_c1d8_3_t: /* MULS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (36);
+}
+op_c1e0_3_t: /* MULS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (36);
+}
+op_c1e8_3_t: /* MULS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (38);
+}
+op_c1f0_3_t: /* MULS */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (38);
+}
+op_c1f8_3_t: /* MULS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (38);
+}
+op_c1f9_3_t: /* MULS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(6);
+THREADED_NEXT (40);
+}
+op_c1fa_3_t: /* MULS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (38);
+}
+op_c1fb_3_t: /* MULS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (38);
+}
+op_c1fc_3_t: /* MULS */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_L, 0, 0, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}m68k_incpc(4);
+THREADED_NEXT (36);
+}
+op_d000_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_d010_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_d018_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_d020_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_d028_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_d030_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_d038_3_t: /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_d039_3_t: /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_d03a_3_t: /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_d03b_3_t: /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_d03c_3_t: /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = get_ibyte(2);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_d040_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_d048_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_d050_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_d058_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_d060_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_d068_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_d070_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_d078_3_t: /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_d079_3_t: /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_d07a_3_t: /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_d07b_3_t: /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_d07c_3_t: /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_d080_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_d088_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_d090_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_d098_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_d0a0_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_d0a8_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d0b0_3_t: /* ADD */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d0b8_3_t: /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d0b9_3_t: /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_d0ba_3_t: /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d0bb_3_t: /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d0bc_3_t: /* ADD */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_d0c0_3_t: /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_d0c8_3_t: /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_d0d0_3_t: /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_d0d8_3_t: /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_d0e0_3_t: /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(2);
+THREADED_NEXT (4);
+}
+op_d0e8_3_t: /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_d0f0_3_t: /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_d0f8_3_t: /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_d0f9_3_t: /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(6);
+THREADED_NEXT (8);
+}
+op_d0fa_3_t: /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_d0fb_3_t: /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (6);
+}
+op_d0fc_3_t: /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = get_iword(2);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(4);
+THREADED_NEXT (4);
+}
+op_d100_3_t: /* ADDX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = dst + src + (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgo) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_d108_3_t: /* ADDX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = dst + src + (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgo) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(2);
+THREADED_NEXT (8);
+}
+op_d110_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_d118_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_d120_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_d128_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d130_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d138_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d139_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_B, src, dst, newv);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_d140_3_t: /* ADDX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = dst + src + (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgo) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_d148_3_t: /* ADDX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = dst + src + (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgo) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(2);
+THREADED_NEXT (8);
+}
+op_d150_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_d158_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg(regs, dstreg) += 2;
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_d160_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+{	uae_s16 dst = get_word(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_d168_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d170_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d178_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d179_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_W, src, dst, newv);
+	put_word(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_d180_3_t: /* ADDX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = dst + src + (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgo) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_d188_3_t: /* ADDX */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 newv = dst + src + (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgo) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(2);
+THREADED_NEXT (14);
+}
+op_d190_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_d198_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg(regs, dstreg) += 4;
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_d1a0_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+{	uae_s32 dst = get_long(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+	if (dstreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(2);
+THREADED_NEXT (10);
+}
+op_d1a8_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_d1b0_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_d1b8_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(4);
+THREADED_NEXT (12);
+}
+op_d1b9_3_t: /* ADD */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+	SET_LAZY_FLAGS (LAZY_FLAGS_ADD | LAZY_FLAGS_L, src, dst, newv);
+	put_long(dsta,newv);
+}}}}}}m68k_incpc(6);
+THREADED_NEXT (14);
+}
+op_d1c0_3_t: /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_d1c8_3_t: /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_d1d0_3_t: /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_d1d8_3_t: /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_d1e0_3_t: /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_d1e8_3_t: /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d1f0_3_t: /* ADDA */
+{
+	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d1f8_3_t: /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d1f9_3_t: /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_d1fa_3_t: /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d1fb_3_t: /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_d1fc_3_t: /* ADDA */
+{
+	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uae_s32 src = get_ilong(2);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+	if (dstreg == 7) CHECK_STACK_POINTER_INCREMENT ();
+}}}}m68k_incpc(6);
+THREADED_NEXT (6);
+}
+op_e000_3_t: /* ASR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	uae_u32 sign = (0x80 & val) >> 7;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		val = 0xff & (uae_u32)-sign;
+		SET_CFLG (sign);
+	COPY_CARRY;
+	} else {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+		val |= (0xff << (8 - cnt)) & (uae_u32)-sign;
+		val &= 0xff;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e008_3_t: /* LSR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		SET_CFLG ((cnt == 8) & (val >> 7));
+	COPY_CARRY;
+		val = 0;
+	} else {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e010_3_t: /* ROXR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 hival = (val << 1) | GET_XFLG;
+	hival <<= (7 - cnt);
+	val >>= cnt;
+	carry = val & 1;
+	val >>= 1;
+	val |= hival;
+	SET_XFLG (carry);
+	val &= 0xff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e018_3_t: /* ROR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u8 val = data;
+	uae_u32 cmask = 0x80;
+	cnt &= 63;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
+	for(;cnt;--cnt){
+	carry=val&1; val = val >> 1;
+	if(carry) val |= cmask;
+	}
+	SET_CFLG (carry);
+}
+	SET_NFLG ((val & cmask) != 0); SET_ZFLG (val == 0); SET_VFLG (0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e020_3_t: /* ASR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	uae_u32 sign = (0x80 & val) >> 7;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		val = 0xff & (uae_u32)-sign;
+		SET_CFLG (sign);
+	COPY_CARRY;
+	} else if (cnt > 0) {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+		val |= (0xff << (8 - cnt)) & (uae_u32)-sign;
+		val &= 0xff;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e028_3_t: /* LSR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		SET_CFLG ((cnt == 8) & (val >> 7));
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e030_3_t: /* ROXR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 36) cnt -= 36;
+	if (cnt >= 18) cnt -= 18;
+	if (cnt >= 9) cnt -= 9;
+	if (cnt > 0) {
+	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 hival = (val << 1) | GET_XFLG;
+	hival <<= (7 - cnt);
+	val >>= cnt;
+	carry = val & 1;
+	val >>= 1;
+	val |= hival;
+	SET_XFLG (carry);
+	val &= 0xff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e038_3_t: /* ROR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u8 val = data;
+	uae_u32 cmask = 0x80;
+	cnt &= 63;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
+	for(;cnt;--cnt){
+	carry=val&1; val = val >> 1;
+	if(carry) val |= cmask;
+	}
+	SET_CFLG (carry);
+}
+	SET_NFLG ((val & cmask) != 0); SET_ZFLG (val == 0); SET_VFLG (0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e040_3_t: /* ASR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = (0x8000 & val) >> 15;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		val = 0xffff & (uae_u32)-sign;
+		SET_CFLG (sign);
+	COPY_CARRY;
+	} else {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+		val |= (0xffff << (16 - cnt)) & (uae_u32)-sign;
+		val &= 0xffff;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e048_3_t: /* LSR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		SET_CFLG ((cnt == 16) & (val >> 15));
+	COPY_CARRY;
+		val = 0;
+	} else {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e050_3_t: /* ROXR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 hival = (val << 1) | GET_XFLG;
+	hival <<= (15 - cnt);
+	val >>= cnt;
+	carry = val & 1;
+	val >>= 1;
+	val |= hival;
+	SET_XFLG (carry);
+	val &= 0xffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e058_3_t: /* ROR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u16 val = data;
+	uae_u32 cmask = 0x8000;
+	cnt &= 63;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
+	for(;cnt;--cnt){
+	carry=val&1; val = val >> 1;
+	if(carry) val |= cmask;
+	}
+	SET_CFLG (carry);
+}
+	SET_NFLG ((val & cmask) != 0); SET_ZFLG (val == 0); SET_VFLG (0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e060_3_t: /* ASR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = (0x8000 & val) >> 15;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		val = 0xffff & (uae_u32)-sign;
+		SET_CFLG (sign);
+	COPY_CARRY;
+	} else if (cnt > 0) {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+		val |= (0xffff << (16 - cnt)) & (uae_u32)-sign;
+		val &= 0xffff;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e068_3_t: /* LSR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		SET_CFLG ((cnt == 16) & (val >> 15));
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e070_3_t: /* ROXR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 34) cnt -= 34;
+	if (cnt >= 17) cnt -= 17;
+	if (cnt > 0) {
+	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 hival = (val << 1) | GET_XFLG;
+	hival <<= (15 - cnt);
+	val >>= cnt;
+	carry = val & 1;
+	val >>= 1;
+	val |= hival;
+	SET_XFLG (carry);
+	val &= 0xffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e078_3_t: /* ROR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u16 val = data;
+	uae_u32 cmask = 0x8000;
+	cnt &= 63;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
+	for(;cnt;--cnt){
+	carry=val&1; val = val >> 1;
+	if(carry) val |= cmask;
+	}
+	SET_CFLG (carry);
+}
+	SET_NFLG ((val & cmask) != 0); SET_ZFLG (val == 0); SET_VFLG (0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e080_3_t: /* ASR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	uae_u32 sign = (0x80000000 & val) >> 31;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		val = 0xffffffff & (uae_u32)-sign;
+		SET_CFLG (sign);
+	COPY_CARRY;
+	} else {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+		val |= (0xffffffff << (32 - cnt)) & (uae_u32)-sign;
+		val &= 0xffffffff;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e088_3_t: /* LSR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		SET_CFLG ((cnt == 32) & (val >> 31));
+	COPY_CARRY;
+		val = 0;
+	} else {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e090_3_t: /* ROXR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 hival = (val << 1) | GET_XFLG;
+	hival <<= (31 - cnt);
+	val >>= cnt;
+	carry = val & 1;
+	val >>= 1;
+	val |= hival;
+	SET_XFLG (carry);
+	val &= 0xffffffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e098_3_t: /* ROR */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	uae_u32 cmask = 0x80000000;
+	cnt &= 63;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
+	for(;cnt;--cnt){
+	carry=val&1; val = val >> 1;
+	if(carry) val |= cmask;
+	}
+	SET_CFLG (carry);
+}
+	SET_NFLG ((val & cmask) != 0); SET_ZFLG (val == 0); SET_VFLG (0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e0a0_3_t: /* ASR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	uae_u32 sign = (0x80000000 & val) >> 31;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		val = 0xffffffff & (uae_u32)-sign;
+		SET_CFLG (sign);
+	COPY_CARRY;
+	} else if (cnt > 0) {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+		val |= (0xffffffff << (32 - cnt)) & (uae_u32)-sign;
+		val &= 0xffffffff;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e0a8_3_t: /* LSR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		SET_CFLG ((cnt == 32) & (val >> 31));
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		val >>= cnt - 1;
+		SET_CFLG (val & 1);
+	COPY_CARRY;
+		val >>= 1;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e0b0_3_t: /* ROXR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 33) cnt -= 33;
+	if (cnt > 0) {
+	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 hival = (val << 1) | GET_XFLG;
+	hival <<= (31 - cnt);
+	val >>= cnt;
+	carry = val & 1;
+	val >>= 1;
+	val |= hival;
+	SET_XFLG (carry);
+	val &= 0xffffffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e0b8_3_t: /* ROR */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	uae_u32 cmask = 0x80000000;
+	cnt &= 63;
+	if (!cnt) { SET_CFLG (0); } else {	uae_u32 carry;
+	for(;cnt;--cnt){
+	carry=val&1; val = val >> 1;
+	if(carry) val |= cmask;
+	}
+	SET_CFLG (carry);
+}
+	SET_NFLG ((val & cmask) != 0); SET_ZFLG (val == 0); SET_VFLG (0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e0d0_3_t: /* ASRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 cflg = val & 1;
+	val = (val >> 1) | sign;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e0d8_3_t: /* ASRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 cflg = val & 1;
+	val = (val >> 1) | sign;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e0e0_3_t: /* ASRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 cflg = val & 1;
+	val = (val >> 1) | sign;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e0e8_3_t: /* ASRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 cflg = val & 1;
+	val = (val >> 1) | sign;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e0f0_3_t: /* ASRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 cflg = val & 1;
+	val = (val >> 1) | sign;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e0f8_3_t: /* ASRW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 cflg = val & 1;
+	val = (val >> 1) | sign;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e0f9_3_t: /* ASRW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 cflg = val & 1;
+	val = (val >> 1) | sign;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_e100_3_t: /* ASL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		SET_VFLG (val != 0);
+		SET_CFLG (cnt == 8 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else {
+		uae_u32 mask = (0xff << (7 - cnt)) & 0xff;
+		SET_VFLG ((val & mask) != mask && (val & mask) != 0);
+		val <<= cnt - 1;
+		SET_CFLG ((val & 0x80) >> 7);
+	COPY_CARRY;
+		val <<= 1;
+		val &= 0xff;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e108_3_t: /* LSL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		SET_CFLG (cnt == 8 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else {
+		val <<= (cnt - 1);
+		SET_CFLG ((val & 0x80) >> 7);
+	COPY_CARRY;
+		val <<= 1;
+	val &= 0xff;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e110_3_t: /* ROXL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 loval = val >> (7 - cnt);
+	carry = loval & 1;
+	val = (((val << 1) | GET_XFLG) << cnt) | (loval >> 1);
+	SET_XFLG (carry);
+	val &= 0xff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e118_3_t: /* ROL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	uae_u32 loval;
+	cnt &= 7;
+	loval = val >> (8 - cnt);
+	val <<= cnt;
+	val |= loval;
+	val &= 0xff;
+	SET_CFLG (val & 1);
+}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e120_3_t: /* ASL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		SET_VFLG (val != 0);
+		SET_CFLG (cnt == 8 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		uae_u32 mask = (0xff << (7 - cnt)) & 0xff;
+		SET_VFLG ((val & mask) != mask && (val & mask) != 0);
+		val <<= cnt - 1;
+		SET_CFLG ((val & 0x80) >> 7);
+	COPY_CARRY;
+		val <<= 1;
+		val &= 0xff;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e128_3_t: /* LSL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 8) {
+		SET_CFLG (cnt == 8 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		val <<= (cnt - 1);
+		SET_CFLG ((val & 0x80) >> 7);
+	COPY_CARRY;
+		val <<= 1;
+	val &= 0xff;
+	}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e130_3_t: /* ROXL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 36) cnt -= 36;
+	if (cnt >= 18) cnt -= 18;
+	if (cnt >= 9) cnt -= 9;
+	if (cnt > 0) {
+	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 loval = val >> (7 - cnt);
+	carry = loval & 1;
+	val = (((val << 1) | GET_XFLG) << cnt) | (loval >> 1);
+	SET_XFLG (carry);
+	val &= 0xff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e138_3_t: /* ROL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s8 cnt = m68k_dreg(regs, srcreg);
+{	uae_s8 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u8)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt > 0) {
+	uae_u32 loval;
+	cnt &= 7;
+	loval = val >> (8 - cnt);
+	val <<= cnt;
+	val |= loval;
+	val &= 0xff;
+	SET_CFLG (val & 1);
+}
+	SET_ZFLG (((uae_s8)(val)) == 0);
+	SET_NFLG (((uae_s8)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((val) & 0xff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e140_3_t: /* ASL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		SET_VFLG (val != 0);
+		SET_CFLG (cnt == 16 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else {
+		uae_u32 mask = (0xffff << (15 - cnt)) & 0xffff;
+		SET_VFLG ((val & mask) != mask && (val & mask) != 0);
+		val <<= cnt - 1;
+		SET_CFLG ((val & 0x8000) >> 15);
+	COPY_CARRY;
+		val <<= 1;
+		val &= 0xffff;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e148_3_t: /* LSL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		SET_CFLG (cnt == 16 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else {
+		val <<= (cnt - 1);
+		SET_CFLG ((val & 0x8000) >> 15);
+	COPY_CARRY;
+		val <<= 1;
+	val &= 0xffff;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e150_3_t: /* ROXL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 loval = val >> (15 - cnt);
+	carry = loval & 1;
+	val = (((val << 1) | GET_XFLG) << cnt) | (loval >> 1);
+	SET_XFLG (carry);
+	val &= 0xffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e158_3_t: /* ROL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	uae_u32 loval;
+	cnt &= 15;
+	loval = val >> (16 - cnt);
+	val <<= cnt;
+	val |= loval;
+	val &= 0xffff;
+	SET_CFLG (val & 1);
+}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e160_3_t: /* ASL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		SET_VFLG (val != 0);
+		SET_CFLG (cnt == 16 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		uae_u32 mask = (0xffff << (15 - cnt)) & 0xffff;
+		SET_VFLG ((val & mask) != mask && (val & mask) != 0);
+		val <<= cnt - 1;
+		SET_CFLG ((val & 0x8000) >> 15);
+	COPY_CARRY;
+		val <<= 1;
+		val &= 0xffff;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e168_3_t: /* LSL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 16) {
+		SET_CFLG (cnt == 16 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		val <<= (cnt - 1);
+		SET_CFLG ((val & 0x8000) >> 15);
+	COPY_CARRY;
+		val <<= 1;
+	val &= 0xffff;
+	}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e170_3_t: /* ROXL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 34) cnt -= 34;
+	if (cnt >= 17) cnt -= 17;
+	if (cnt > 0) {
+	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 loval = val >> (15 - cnt);
+	carry = loval & 1;
+	val = (((val << 1) | GET_XFLG) << cnt) | (loval >> 1);
+	SET_XFLG (carry);
+	val &= 0xffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e178_3_t: /* ROL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s16 cnt = m68k_dreg(regs, srcreg);
+{	uae_s16 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = (uae_u16)data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt > 0) {
+	uae_u32 loval;
+	cnt &= 15;
+	loval = val >> (16 - cnt);
+	val <<= cnt;
+	val |= loval;
+	val &= 0xffff;
+	SET_CFLG (val & 1);
+}
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((val) & 0xffff);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e180_3_t: /* ASL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		SET_VFLG (val != 0);
+		SET_CFLG (cnt == 32 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else {
+		uae_u32 mask = (0xffffffff << (31 - cnt)) & 0xffffffff;
+		SET_VFLG ((val & mask) != mask && (val & mask) != 0);
+		val <<= cnt - 1;
+		SET_CFLG ((val & 0x80000000) >> 31);
+	COPY_CARRY;
+		val <<= 1;
+		val &= 0xffffffff;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e188_3_t: /* LSL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		SET_CFLG (cnt == 32 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else {
+		val <<= (cnt - 1);
+		SET_CFLG ((val & 0x80000000) >> 31);
+	COPY_CARRY;
+		val <<= 1;
+	val &= 0xffffffff;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e190_3_t: /* ROXL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 loval = val >> (31 - cnt);
+	carry = loval & 1;
+	val = (((val << 1) | GET_XFLG) << cnt) | (loval >> 1);
+	SET_XFLG (carry);
+	val &= 0xffffffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e198_3_t: /* ROL */
+{
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 dstreg = opcode & 7;
+{{	uae_u32 cnt = srcreg;
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+{	uae_u32 loval;
+	cnt &= 31;
+	loval = val >> (32 - cnt);
+	val <<= cnt;
+	val |= loval;
+	val &= 0xffffffff;
+	SET_CFLG (val & 1);
+}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e1a0_3_t: /* ASL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		SET_VFLG (val != 0);
+		SET_CFLG (cnt == 32 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		uae_u32 mask = (0xffffffff << (31 - cnt)) & 0xffffffff;
+		SET_VFLG ((val & mask) != mask && (val & mask) != 0);
+		val <<= cnt - 1;
+		SET_CFLG ((val & 0x80000000) >> 31);
+	COPY_CARRY;
+		val <<= 1;
+		val &= 0xffffffff;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e1a8_3_t: /* LSL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 32) {
+		SET_CFLG (cnt == 32 ? val & 1 : 0);
+	COPY_CARRY;
+		val = 0;
+	} else if (cnt > 0) {
+		val <<= (cnt - 1);
+		SET_CFLG ((val & 0x80000000) >> 31);
+	COPY_CARRY;
+		val <<= 1;
+	val &= 0xffffffff;
+	}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e1b0_3_t: /* ROXL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt >= 33) cnt -= 33;
+	if (cnt > 0) {
+	cnt--;
+	{
+	uae_u32 carry;
+	uae_u32 loval = val >> (31 - cnt);
+	carry = loval & 1;
+	val = (((val << 1) | GET_XFLG) << cnt) | (loval >> 1);
+	SET_XFLG (carry);
+	val &= 0xffffffff;
+	} }
+	SET_CFLG (GET_XFLG);
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e1b8_3_t: /* ROL */
+{
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+{{	uae_s32 cnt = m68k_dreg(regs, srcreg);
+{	uae_s32 data = m68k_dreg(regs, dstreg);
+{	uae_u32 val = data;
+	cnt &= 63;
+	CLEAR_CZNV;
+	if (cnt > 0) {
+	uae_u32 loval;
+	cnt &= 31;
+	loval = val >> (32 - cnt);
+	val <<= cnt;
+	val |= loval;
+	val &= 0xffffffff;
+	SET_CFLG (val & 1);
+}
+	SET_ZFLG (((uae_s32)(val)) == 0);
+	SET_NFLG (((uae_s32)(val)) < 0);
+	m68k_dreg(regs, dstreg) = (val);
+#if HAS_PROFILING
+	if (gProfilingEnabled)
+		ProfileIncrementClock(2*cnt);
+#endif
+}}}}m68k_incpc(2);
+THREADED_NEXT (2);
+}
+op_e1d0_3_t: /* ASLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 sign2;
+	val <<= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+	sign2 = 0x8000 & val;
+	SET_CFLG (sign != 0);
+	COPY_CARRY;
+	SET_VFLG (GET_VFLG | (sign2 != sign));
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e1d8_3_t: /* ASLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 sign2;
+	val <<= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+	sign2 = 0x8000 & val;
+	SET_CFLG (sign != 0);
+	COPY_CARRY;
+	SET_VFLG (GET_VFLG | (sign2 != sign));
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e1e0_3_t: /* ASLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 sign2;
+	val <<= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+	sign2 = 0x8000 & val;
+	SET_CFLG (sign != 0);
+	COPY_CARRY;
+	SET_VFLG (GET_VFLG | (sign2 != sign));
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e1e8_3_t: /* ASLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 sign2;
+	val <<= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+	sign2 = 0x8000 & val;
+	SET_CFLG (sign != 0);
+	COPY_CARRY;
+	SET_VFLG (GET_VFLG | (sign2 != sign));
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e1f0_3_t: /* ASLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 sign2;
+	val <<= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+	sign2 = 0x8000 & val;
+	SET_CFLG (sign != 0);
+	COPY_CARRY;
+	SET_VFLG (GET_VFLG | (sign2 != sign));
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e1f8_3_t: /* ASLW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 sign2;
+	val <<= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+	sign2 = 0x8000 & val;
+	SET_CFLG (sign != 0);
+	COPY_CARRY;
+	SET_VFLG (GET_VFLG | (sign2 != sign));
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e1f9_3_t: /* ASLW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 sign2;
+	val <<= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+	sign2 = 0x8000 & val;
+	SET_CFLG (sign != 0);
+	COPY_CARRY;
+	SET_VFLG (GET_VFLG | (sign2 != sign));
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_e2d0_3_t: /* LSRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e2d8_3_t: /* LSRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e2e0_3_t: /* LSRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e2e8_3_t: /* LSRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e2f0_3_t: /* LSRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e2f8_3_t: /* LSRW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e2f9_3_t: /* LSRW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_e3d0_3_t: /* LSLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e3d8_3_t: /* LSLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e3e0_3_t: /* LSLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e3e8_3_t: /* LSLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e3f0_3_t: /* LSLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e3f8_3_t: /* LSLW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e3f9_3_t: /* LSLW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_e4d0_3_t: /* ROXRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (GET_XFLG) val |= 0x8000;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e4d8_3_t: /* ROXRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (GET_XFLG) val |= 0x8000;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e4e0_3_t: /* ROXRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (GET_XFLG) val |= 0x8000;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e4e8_3_t: /* ROXRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (GET_XFLG) val |= 0x8000;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e4f0_3_t: /* ROXRW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (GET_XFLG) val |= 0x8000;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e4f8_3_t: /* ROXRW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (GET_XFLG) val |= 0x8000;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e4f9_3_t: /* ROXRW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (GET_XFLG) val |= 0x8000;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_e5d0_3_t: /* ROXLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (GET_XFLG) val |= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e5d8_3_t: /* ROXLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (GET_XFLG) val |= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e5e0_3_t: /* ROXLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (GET_XFLG) val |= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e5e8_3_t: /* ROXLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (GET_XFLG) val |= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e5f0_3_t: /* ROXLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (GET_XFLG) val |= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e5f8_3_t: /* ROXLW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (GET_XFLG) val |= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e5f9_3_t: /* ROXLW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (GET_XFLG) val |= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_e6d0_3_t: /* RORW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (carry) val |= 0x8000;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e6d8_3_t: /* RORW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (carry) val |= 0x8000;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e6e0_3_t: /* RORW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (carry) val |= 0x8000;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e6e8_3_t: /* RORW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (carry) val |= 0x8000;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e6f0_3_t: /* RORW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (carry) val |= 0x8000;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e6f8_3_t: /* RORW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (carry) val |= 0x8000;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e6f9_3_t: /* RORW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (carry) val |= 0x8000;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry);
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+op_e7d0_3_t: /* ROLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (carry)  val |= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e7d8_3_t: /* ROLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg);
+{	uae_s16 data = get_word(dataa);
+	m68k_areg(regs, srcreg) += 2;
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (carry)  val |= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e7e0_3_t: /* ROLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 data = get_word(dataa);
+	m68k_areg (regs, srcreg) = dataa;
+	if (srcreg == 7) CHECK_STACK_POINTER_DECREMENT ();
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (carry)  val |= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	put_word(dataa,val);
+}}}}m68k_incpc(2);
+THREADED_NEXT (6);
+}
+op_e7e8_3_t: /* ROLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (carry)  val |= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e7f0_3_t: /* ROLW */
+{
+	uae_u32 srcreg = (opcode & 7);
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (carry)  val |= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e7f8_3_t: /* ROLW */
+{
+{{	uaecptr dataa = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (carry)  val |= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+THREADED_NEXT (8);
+}
+op_e7f9_3_t: /* ROLW */
+{
+{{	uaecptr dataa = get_ilong(2);
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (carry)  val |= 1;
+	SET_LAZY_FLAGS (LAZY_FLAGS_LOGICAL | LAZY_FLAGS_W, 0, 0, val);
+SET_CFLG (carry >> 15);
+	put_word(dataa,val);
+}}}}m68k_incpc(6);
+THREADED_NEXT (10);
+}
+
+#else
+
+&&op_0_3_t, /* OR */
+&&op_10_3_t, /* OR */
+&&op_18_3_t, /* OR */
+&&op_20_3_t, /* OR */
+&&op_28_3_t, /* OR */
+&&op_30_3_t, /* OR */
+&&op_38_3_t, /* OR */
+&&op_39_3_t, /* OR */
+&&op_3c_3_t, /* ORSR */
+&&op_40_3_t, /* OR */
+&&op_50_3_t, /* OR */
+&&op_58_3_t, /* OR */
+&&op_60_3_t, /* OR */
+&&op_68_3_t, /* OR */
+&&op_70_3_t, /* OR */
+&&op_78_3_t, /* OR */
+&&op_79_3_t, /* OR */
+&&op_7c_3_t, /* ORSR */
+&&op_80_3_t, /* OR */
+&&op_90_3_t, /* OR */
+&&op_98_3_t, /* OR */
+&&op_a0_3_t, /* OR */
+&&op_a8_3_t, /* OR */
+&&op_b0_3_t, /* OR */
+&&op_b8_3_t, /* OR */
+&&op_b9_3_t, /* OR */
+&&op_100_3_t, /* BTST */
+&&op_108_3_t, /* MVPMR */
+&&op_110_3_t, /* BTST */
+&&op_118_3_t, /* BTST */
+&&op_120_3_t, /* BTST */
+&&op_128_3_t, /* BTST */
+&&op_130_3_t, /* BTST */
+&&op_138_3_t, /* BTST */
+&&op_139_3_t, /* BTST */
+&&op_13a_3_t, /* BTST */
+&&op_13b_3_t, /* BTST */
+&&op_13c_3_t, /* BTST */
+&&op_140_3_t, /* BCHG */
+&&op_148_3_t, /* MVPMR */
+&&op_150_3_t, /* BCHG */
+&&op_158_3_t, /* BCHG */
+&&op_160_3_t, /* BCHG */
+&&op_168_3_t, /* BCHG */
+&&op_170_3_t, /* BCHG */
+&&op_178_3_t, /* BCHG */
+&&op_179_3_t, /* BCHG */
+&&op_17a_3_t, /* BCHG */
+&&op_17b_3_t, /* BCHG */
+&&op_180_3_t, /* BCLR */
+&&op_188_3_t, /* MVPRM */
+&&op_190_3_t, /* BCLR */
+&&op_198_3_t, /* BCLR */
+&&op_1a0_3_t, /* BCLR */
+&&op_1a8_3_t, /* BCLR */
+&&op_1b0_3_t, /* BCLR */
+&&op_1b8_3_t, /* BCLR */
+&&op_1b9_3_t, /* BCLR */
+&&op_1ba_3_t, /* BCLR */
+&&op_1bb_3_t, /* BCLR */
+&&op_1c0_3_t, /* BSET */
+&&op_1c8_3_t, /* MVPRM */
+&&op_1d0_3_t, /* BSET */
+&&op_1d8_3_t, /* BSET */
+&&op_1e0_3_t, /* BSET */
+&&op_1e8_3_t, /* BSET */
+&&op_1f0_3_t, /* BSET */
+&&op_1f8_3_t, /* BSET */
+&&op_1f9_3_t, /* BSET */
+&&op_1fa_3_t, /* BSET */
+&&op_1fb_3_t, /* BSET */
+&&op_200_3_t, /* AND */
+&&op_210_3_t, /* AND */
+&&op_218_3_t, /* AND */
+&&op_220_3_t, /* AND */
+&&op_228_3_t, /* AND */
+&&op_230_3_t, /* AND */
+&&op_238_3_t, /* AND */
+&&op_239_3_t, /* AND */
+&&op_23c_3_t, /* ANDSR */
+&&op_240_3_t, /* AND */
+&&op_250_3_t, /* AND */
+&&op_258_3_t, /* AND */
+&&op_260_3_t, /* AND */
+&&op_268_3_t, /* AND */
+&&op_270_3_t, /* AND */
+&&op_278_3_t, /* AND */
+&&op_279_3_t, /* AND */
+&&op_27c_3_t, /* ANDSR */
+&&op_280_3_t, /* AND */
+&&op_290_3_t, /* AND */
+&&op_298_3_t, /* AND */
+&&op_2a0_3_t, /* AND */
+&&op_2a8_3_t, /* AND */
+&&op_2b0_3_t, /* AND */
+&&op_2b8_3_t, /* AND */
+&&op_2b9_3_t, /* AND */
+&&op_400_3_t, /* SUB */
+&&op_410_3_t, /* SUB */
+&&op_418_3_t, /* SUB */
+&&op_420_3_t, /* SUB */
+&&op_428_3_t, /* SUB */
+&&op_430_3_t, /* SUB */
+&&op_438_3_t, /* SUB */
+&&op_439_3_t, /* SUB */
+&&op_440_3_t, /* SUB */
+&&op_450_3_t, /* SUB */
+&&op_458_3_t, /* SUB */
+&&op_460_3_t, /* SUB */
+&&op_468_3_t, /* SUB */
+&&op_470_3_t, /* SUB */
+&&op_478_3_t, /* SUB */
+&&op_479_3_t, /* SUB */
+&&op_480_3_t, /* SUB */
+&&op_490_3_t, /* SUB */
+&&op_498_3_t, /* SUB */
+&&op_4a0_3_t, /* SUB */
+&&op_4a8_3_t, /* SUB */
+&&op_4b0_3_t, /* SUB */
+&&op_4b8_3_t, /* SUB */
+&&op_4b9_3_t, /* SUB */
+&&op_600_3_t, /* ADD */
+&&op_610_3_t, /* ADD */
+&&op_618_3_t, /* ADD */
+&&op_620_3_t, /* ADD */
+&&op_628_3_t, /* ADD */
+&&op_630_3_t, /* ADD */
+&&op_638_3_t, /* ADD */
+&&op_639_3_t, /* ADD */
+&&op_640_3_t, /* ADD */
+&&op_650_3_t, /* ADD */
+&&op_658_3_t, /* ADD */
+&&op_660_3_t, /* ADD */
+&&op_668_3_t, /* ADD */
+&&op_670_3_t, /* ADD */
+&&op_678_3_t, /* ADD */
+&&op_679_3_t, /* ADD */
+&&op_680_3_t, /* ADD */
+&&op_690_3_t, /* ADD */
+&&op_698_3_t, /* ADD */
+&&op_6a0_3_t, /* ADD */
+&&op_6a8_3_t, /* ADD */
+&&op_6b0_3_t, /* ADD */
+&&op_6b8_3_t, /* ADD */
+&&op_6b9_3_t, /* ADD */
+&&op_800_3_t, /* BTST */
+&&op_810_3_t, /* BTST */
+&&op_818_3_t, /* BTST */
+&&op_820_3_t, /* BTST */
+&&op_828_3_t, /* BTST */
+&&op_830_3_t, /* BTST */
+&&op_838_3_t, /* BTST */
+&&op_839_3_t, /* BTST */
+&&op_83a_3_t, /* BTST */
+&&op_83b_3_t, /* BTST */
+&&op_83c_3_t, /* BTST */
+&&op_840_3_t, /* BCHG */
+&&op_850_3_t, /* BCHG */
+&&op_858_3_t, /* BCHG */
+&&op_860_3_t, /* BCHG */
+&&op_868_3_t, /* BCHG */
+&&op_870_3_t, /* BCHG */
+&&op_878_3_t, /* BCHG */
+&&op_879_3_t, /* BCHG */
+&&op_87a_3_t, /* BCHG */
+&&op_87b_3_t, /* BCHG */
+&&op_880_3_t, /* BCLR */
+&&op_890_3_t, /* BCLR */
+&&op_898_3_t, /* BCLR */
+&&op_8a0_3_t, /* BCLR */
+&&op_8a8_3_t, /* BCLR */
+&&op_8b0_3_t, /* BCLR */
+&&op_8b8_3_t, /* BCLR */
+&&op_8b9_3_t, /* BCLR */
+&&op_8ba_3_t, /* BCLR */
+&&op_8bb_3_t, /* BCLR */
+&&op_8c0_3_t, /* BSET */
+&&op_8d0_3_t, /* BSET */
+&&op_8d8_3_t, /* BSET */
+&&op_8e0_3_t, /* BSET */
+&&op_8e8_3_t, /* BSET */
+&&op_8f0_3_t, /* BSET */
+&&op_8f8_3_t, /* BSET */
+&&op_8f9_3_t, /* BSET */
+&&op_8fa_3_t, /* BSET */
+&&op_8fb_3_t, /* BSET */
+&&op_a00_3_t, /* EOR */
+&&op_a10_3_t, /* EOR */
+&&op_a18_3_t, /* EOR */
+&&op_a20_3_t, /* EOR */
+&&op_a28_3_t, /* EOR */
+&&op_a30_3_t, /* EOR */
+&&op_a38_3_t, /* EOR */
+&&op_a39_3_t, /* EOR */
+&&op_a3c_3_t, /* EORSR */
+&&op_a40_3_t, /* EOR */
+&&op_a50_3_t, /* EOR */
+&&op_a58_3_t, /* EOR */
+&&op_a60_3_t, /* EOR */
+&&op_a68_3_t, /* EOR */
+&&op_a70_3_t, /* EOR */
+&&op_a78_3_t, /* EOR */
+&&op_a79_3_t, /* EOR */
+&&op_a7c_3_t, /* EORSR */
+&&op_a80_3_t, /* EOR */
+&&op_a90_3_t, /* EOR */
+&&op_a98_3_t, /* EOR */
+&&op_aa0_3_t, /* EOR */
+&&op_aa8_3_t, /* EOR */
+&&op_ab0_3_t, /* EOR */
+&&op_ab8_3_t, /* EOR */
+&&op_ab9_3_t, /* EOR */
+&&op_c00_3_t, /* CMP */
+&&op_c10_3_t, /* CMP */
+&&op_c18_3_t, /* CMP */
+&&op_c20_3_t, /* CMP */
+&&op_c28_3_t, /* CMP */
+&&op_c30_3_t, /* CMP */
+&&op_c38_3_t, /* CMP */
+&&op_c39_3_t, /* CMP */
+&&op_c3a_3_t, /* CMP */
+&&op_c3b_3_t, /* CMP */
+&&op_c40_3_t, /* CMP */
+&&op_c50_3_t, /* CMP */
+&&op_c58_3_t, /* CMP */
+&&op_c60_3_t, /* CMP */
+&&op_c68_3_t, /* CMP */
+&&op_c70_3_t, /* CMP */
+&&op_c78_3_t, /* CMP */
+&&op_c79_3_t, /* CMP */
+&&op_c7a_3_t, /* CMP */
+&&op_c7b_3_t, /* CMP */
+&&op_c80_3_t, /* CMP */
+&&op_c90_3_t, /* CMP */
+&&op_c98_3_t, /* CMP */
+&&op_ca0_3_t, /* CMP */
+&&op_ca8_3_t, /* CMP */
+&&op_cb0_3_t, /* CMP */
+&&op_cb8_3_t, /* CMP */
+&&op_cb9_3_t, /* CMP */
+&&op_cba_3_t, /* CMP */
+&&op_cbb_3_t, /* CMP */
+&&op_1000_3_t, /* MOVE */
+&&op_1010_3_t, /* MOVE */
+&&op_1018_3_t, /* MOVE */
+&&op_1020_3_t, /* MOVE */
+&&op_1028_3_t, /* MOVE */
+&&op_1030_3_t, /* MOVE */
+&&op_1038_3_t, /* MOVE */
+&&op_1039_3_t, /* MOVE */
+&&op_103a_3_t, /* MOVE */
+&&op_103b_3_t, /* MOVE */
+&&op_103c_3_t, /* MOVE */
+&&op_1080_3_t, /* MOVE */
+&&op_1090_3_t, /* MOVE */
+&&op_1098_3_t, /* MOVE */
+&&op_10a0_3_t, /* MOVE */
+&&op_10a8_3_t, /* MOVE */
+&&op_10b0_3_t, /* MOVE */
+&&op_10b8_3_t, /* MOVE */
+&&op_10b9_3_t, /* MOVE */
+&&op_10ba_3_t, /* MOVE */
+&&op_10bb_3_t, /* MOVE */
+&&op_10bc_3_t, /* MOVE */
+&&op_10c0_3_t, /* MOVE */
+&&op_10d0_3_t, /* MOVE */
+&&op_10d8_3_t, /* MOVE */
+&&op_10e0_3_t, /* MOVE */
+&&op_10e8_3_t, /* MOVE */
+&&op_10f0_3_t, /* MOVE */
+&&op_10f8_3_t, /* MOVE */
+&&op_10f9_3_t, /* MOVE */
+&&op_10fa_3_t, /* MOVE */
+&&op_10fb_3_t, /* MOVE */
+&&op_10fc_3_t, /* MOVE */
+&&op_1100_3_t, /* MOVE */
+&&op_1110_3_t, /* MOVE */
+&&op_1118_3_t, /* MOVE */
+&&op_1120_3_t, /* MOVE */
+&&op_1128_3_t, /* MOVE */
+&&op_1130_3_t, /* MOVE */
+&&op_1138_3_t, /* MOVE */
+&&op_1139_3_t, /* MOVE */
+&&op_113a_3_t, /* MOVE */
+&&op_113b_3_t, /* MOVE */
+&&op_113c_3_t, /* MOVE */
+&&op_1140_3_t, /* MOVE */
+&&op_1150_3_t, /* MOVE */
+&&op_1158_3_t, /* MOVE */
+&&op_1160_3_t, /* MOVE */
+&&op_1168_3_t, /* MOVE */
+&&op_1170_3_t, /* MOVE */
+&&op_1178_3_t, /* MOVE */
+&&op_1179_3_t, /* MOVE */
+&&op_117a_3_t, /* MOVE */
+&&op_117b_3_t, /* MOVE */
+&&op_117c_3_t, /* MOVE */
+&&op_1180_3_t, /* MOVE */
+&&op_1190_3_t, /* MOVE */
+&&op_1198_3_t, /* MOVE */
+&&op_11a0_3_t, /* MOVE */
+&&op_11a8_3_t, /* MOVE */
+&&op_11b0_3_t, /* MOVE */
+&&op_11b8_3_t, /* MOVE */
+&&op_11b9_3_t, /* MOVE */
+&&op_11ba_3_t, /* MOVE */
+&&op_11bb_3_t, /* MOVE */
+&&op_11bc_3_t, /* MOVE */
+&&op_11c0_3_t, /* MOVE */
+&&op_11d0_3_t, /* MOVE */
+&&op_11d8_3_t, /* MOVE */
+&&op_11e0_3_t, /* MOVE */
+&&op_11e8_3_t, /* MOVE */
+&&op_11f0_3_t, /* MOVE */
+&&op_11f8_3_t, /* MOVE */
+&&op_11f9_3_t, /* MOVE */
+&&op_11fa_3_t, /* MOVE */
+&&op_11fb_3_t, /* MOVE */
+&&op_11fc_3_t, /* MOVE */
+&&op_13c0_3_t, /* MOVE */
+&&op_13d0_3_t, /* MOVE */
+&&op_13d8_3_t, /* MOVE */
+&&op_13e0_3_t, /* MOVE */
+&&op_13e8_3_t, /* MOVE */
+&&op_13f0_3_t, /* MOVE */
+&&op_13f8_3_t, /* MOVE */
+&&op_13f9_3_t, /* MOVE */
+&&op_13fa_3_t, /* MOVE */
+&&op_13fb_3_t, /* MOVE */
+&&op_13fc_3_t, /* MOVE */
+&&op_2000_3_t, /* MOVE */
+&&op_2008_3_t, /* MOVE */
+&&op_2010_3_t, /* MOVE */
+&&op_2018_3_t, /* MOVE */
+&&op_2020_3_t, /* MOVE */
+&&op_2028_3_t, /* MOVE */
+&&op_2030_3_t, /* MOVE */
+&&op_2038_3_t, /* MOVE */
+&&op_2039_3_t, /* MOVE */
+&&op_203a_3_t, /* MOVE */
+&&op_203b_3_t, /* MOVE */
+&&op_203c_3_t, /* MOVE */
+&&op_2040_3_t, /* MOVEA */
+&&op_2048_3_t, /* MOVEA */
+&&op_2050_3_t, /* MOVEA */
+&&op_2058_3_t, /* MOVEA */
+&&op_2060_3_t, /* MOVEA */
+&&op_2068_3_t, /* MOVEA */
+&&op_2070_3_t, /* MOVEA */
+&&op_2078_3_t, /* MOVEA */
+&&op_2079_3_t, /* MOVEA */
+&&op_207a_3_t, /* MOVEA */
+&&op_207b_3_t, /* MOVEA */
+&&op_207c_3_t, /* MOVEA */
+&&op_2080_3_t, /* MOVE */
+&&op_2088_3_t, /* MOVE */
+&&op_2090_3_t, /* MOVE */
+&&op_2098_3_t, /* MOVE */
+&&op_20a0_3_t, /* MOVE */
+&&op_20a8_3_t, /* MOVE */
+&&op_20b0_3_t, /* MOVE */
+&&op_20b8_3_t, /* MOVE */
+&&op_20b9_3_t, /* MOVE */
+&&op_20ba_3_t, /* MOVE */
+&&op_20bb_3_t, /* MOVE */
+&&op_20bc_3_t, /* MOVE */
+&&op_20c0_3_t, /* MOVE */
+&&op_20c8_3_t, /* MOVE */
+&&op_20d0_3_t, /* MOVE */
+&&op_20d8_3_t, /* MOVE */
+&&op_20e0_3_t, /* MOVE */
+&&op_20e8_3_t, /* MOVE */
+&&op_20f0_3_t, /* MOVE */
+&&op_20f8_3_t, /* MOVE */
+&&op_20f9_3_t, /* MOVE */
+&&op_20fa_3_t, /* MOVE */
+&&op_20fb_3_t, /* MOVE */
+&&op_20fc_3_t, /* MOVE */
+&&op_2100_3_t, /* MOVE */
+&&op_2108_3_t, /* MOVE */
+&&op_2110_3_t, /* MOVE */
+&&op_2118_3_t, /* MOVE */
+&&op_2120_3_t, /* MOVE */
+&&op_2128_3_t, /* MOVE */
+&&op_2130_3_t, /* MOVE */
+&&op_2138_3_t, /* MOVE */
+&&op_2139_3_t, /* MOVE */
+&&op_213a_3_t, /* MOVE */
+&&op_213b_3_t, /* MOVE */
+&&op_213c_3_t, /* MOVE */
+&&op_2140_3_t, /* MOVE */
+&&op_2148_3_t, /* MOVE */
+&&op_2150_3_t, /* MOVE */
+&&op_2158_3_t, /* MOVE */
+&&op_2160_3_t, /* MOVE */
+&&op_2168_3_t, /* MOVE */
+&&op_2170_3_t, /* MOVE */
+&&op_2178_3_t, /* MOVE */
+&&op_2179_3_t, /* MOVE */
+&&op_217a_3_t, /* MOVE */
+&&op_217b_3_t, /* MOVE */
+&&op_217c_3_t, /* MOVE */
+&&op_2180_3_t, /* MOVE */
+&&op_2188_3_t, /* MOVE */
+&&op_2190_3_t, /* MOVE */
+&&op_2198_3_t, /* MOVE */
+&&op_21a0_3_t, /* MOVE */
+&&op_21a8_3_t, /* MOVE */
+&&op_21b0_3_t, /* MOVE */
+&&op_21b8_3_t, /* MOVE */
+&&op_21b9_3_t, /* MOVE */
+&&op_21ba_3_t, /* MOVE */
+&&op_21bb_3_t, /* MOVE */
+&&op_21bc_3_t, /* MOVE */
+&&op_21c0_3_t, /* MOVE */
+&&op_21c8_3_t, /* MOVE */
+&&op_21d0_3_t, /* MOVE */
+&&op_21d8_3_t, /* MOVE */
+&&op_21e0_3_t, /* MOVE */
+&&op_21e8_3_t, /* MOVE */
+&&op_21f0_3_t, /* MOVE */
+&&op_21f8_3_t, /* MOVE */
+&&op_21f9_3_t, /* MOVE */
+&&op_21fa_3_t, /* MOVE */
+&&op_21fb_3_t, /* MOVE */
+&&op_21fc_3_t, /* MOVE */
+&&op_23c0_3_t, /* MOVE */
+&&op_23c8_3_t, /* MOVE */
+&&op_23d0_3_t, /* MOVE */
+&&op_23d8_3_t, /* MOVE */
+&&op_23e0_3_t, /* MOVE */
+&&op_23e8_3_t, /* MOVE */
+&&op_23f0_3_t, /* MOVE */
+&&op_23f8_3_t, /* MOVE */
+&&op_23f9_3_t, /* MOVE */
+&&op_23fa_3_t, /* MOVE */
+&&op_23fb_3_t, /* MOVE */
+&&op_23fc_3_t, /* MOVE */
+&&op_3000_3_t, /* MOVE */
+&&op_3008_3_t, /* MOVE */
+&&op_3010_3_t, /* MOVE */
+&&op_3018_3_t, /* MOVE */
+&&op_3020_3_t, /* MOVE */
+&&op_3028_3_t, /* MOVE */
+&&op_3030_3_t, /* MOVE */
+&&op_3038_3_t, /* MOVE */
+&&op_3039_3_t, /* MOVE */
+&&op_303a_3_t, /* MOVE */
+&&op_303b_3_t, /* MOVE */
+&&op_303c_3_t, /* MOVE */
+&&op_3040_3_t, /* MOVEA */
+&&op_3048_3_t, /* MOVEA */
+&&op_3050_3_t, /* MOVEA */
+&&op_3058_3_t, /* MOVEA */
+&&op_3060_3_t, /* MOVEA */
+&&op_3068_3_t, /* MOVEA */
+&&op_3070_3_t, /* MOVEA */
+&&op_3078_3_t, /* MOVEA */
+&&op_3079_3_t, /* MOVEA */
+&&op_307a_3_t, /* MOVEA */
+&&op_307b_3_t, /* MOVEA */
+&&op_307c_3_t, /* MOVEA */
+&&op_3080_3_t, /* MOVE */
+&&op_3088_3_t, /* MOVE */
+&&op_3090_3_t, /* MOVE */
+&&op_3098_3_t, /* MOVE */
+&&op_30a0_3_t, /* MOVE */
+&&op_30a8_3_t, /* MOVE */
+&&op_30b0_3_t, /* MOVE */
+&&op_30b8_3_t, /* MOVE */
+&&op_30b9_3_t, /* MOVE */
+&&op_30ba_3_t, /* MOVE */
+&&op_30bb_3_t, /* MOVE */
+&&op_30bc_3_t, /* MOVE */
+&&op_30c0_3_t, /* MOVE */
+&&op_30c8_3_t, /* MOVE */
+&&op_30d0_3_t, /* MOVE */
+&&op_30d8_3_t, /* MOVE */
+&&op_30e0_3_t, /* MOVE */
+&&op_30e8_3_t, /* MOVE */
+&&op_30f0_3_t, /* MOVE */
+&&op_30f8_3_t, /* MOVE */
+&&op_30f9_3_t, /* MOVE */
+&&op_30fa_3_t, /* MOVE */
+&&op_30fb_3_t, /* MOVE */
+&&op_30fc_3_t, /* MOVE */
+&&op_3100_3_t, /* MOVE */
+&&op_3108_3_t, /* MOVE */
+&&op_3110_3_t, /* MOVE */
+&&op_3118_3_t, /* MOVE */
+&&op_3120_3_t, /* MOVE */
+&&op_3128_3_t, /* MOVE */
+&&op_3130_3_t, /* MOVE */
+&&op_3138_3_t, /* MOVE */
+&&op_3139_3_t, /* MOVE */
+&&op_313a_3_t, /* MOVE */
+&&op_313b_3_t, /* MOVE */
+&&op_313c_3_t, /* MOVE */
+&&op_3140_3_t, /* MOVE */
+&&op_3148_3_t, /* MOVE */
+&&op_3150_3_t, /* MOVE */
+&&op_3158_3_t, /* MOVE */
+&&op_3160_3_t, /* MOVE */
+&&op_3168_3_t, /* MOVE */
+&&op_3170_3_t, /* MOVE */
+&&op_3178_3_t, /* MOVE */
+&&op_3179_3_t, /* MOVE */
+&&op_317a_3_t, /* MOVE */
+&&op_317b_3_t, /* MOVE */
+&&op_317c_3_t, /* MOVE */
+&&op_3180_3_t, /* MOVE */
+&&op_3188_3_t, /* MOVE */
+&&op_3190_3_t, /* MOVE */
+&&op_3198_3_t, /* MOVE */
+&&op_31a0_3_t, /* MOVE */
+&&op_31a8_3_t, /* MOVE */
+&&op_31b0_3_t, /* MOVE */
+&&op_31b8_3_t, /* MOVE */
+&&op_31b9_3_t, /* MOVE */
+&&op_31ba_3_t, /* MOVE */
+&&op_31bb_3_t, /* MOVE */
+&&op_31bc_3_t, /* MOVE */
+&&op_31c0_3_t, /* MOVE */
+&&op_31c8_3_t, /* MOVE */
+&&op_31d0_3_t, /* MOVE */
+&&op_31d8_3_t, /* MOVE */
+&&op_31e0_3_t, /* MOVE */
+&&op_31e8_3_t, /* MOVE */
+&&op_31f0_3_t, /* MOVE */
+&&op_31f8_3_t, /* MOVE */
+&&op_31f9_3_t, /* MOVE */
+&&op_31fa_3_t, /* MOVE */
+&&op_31fb_3_t, /* MOVE */
+&&op_31fc_3_t, /* MOVE */
+&&op_33c0_3_t, /* MOVE */
+&&op_33c8_3_t, /* MOVE */
+&&op_33d0_3_t, /* MOVE */
+&&op_33d8_3_t, /* MOVE */
+&&op_33e0_3_t, /* MOVE */
+&&op_33e8_3_t, /* MOVE */
+&&op_33f0_3_t, /* MOVE */
+&&op_33f8_3_t, /* MOVE */
+&&op_33f9_3_t, /* MOVE */
+&&op_33fa_3_t, /* MOVE */
+&&op_33fb_3_t, /* MOVE */
+&&op_33fc_3_t, /* MOVE */
+&&op_4000_3_t, /* NEGX */
+&&op_4010_3_t, /* NEGX */
+&&op_4018_3_t, /* NEGX */
+&&op_4020_3_t, /* NEGX */
+&&op_4028_3_t, /* NEGX */
+&&op_4030_3_t, /* NEGX */
+&&op_4038_3_t, /* NEGX */
+&&op_4039_3_t, /* NEGX */
+&&op_4040_3_t, /* NEGX */
+&&op_4050_3_t, /* NEGX */
+&&op_4058_3_t, /* NEGX */
+&&op_4060_3_t, /* NEGX */
+&&op_4068_3_t, /* NEGX */
+&&op_4070_3_t, /* NEGX */
+&&op_4078_3_t, /* NEGX */
+&&op_4079_3_t, /* NEGX */
+&&op_4080_3_t, /* NEGX */
+&&op_4090_3_t, /* NEGX */
+&&op_4098_3_t, /* NEGX */
+&&op_40a0_3_t, /* NEGX */
+&&op_40a8_3_t, /* NEGX */
+&&op_40b0_3_t, /* NEGX */
+&&op_40b8_3_t, /* NEGX */
+&&op_40b9_3_t, /* NEGX */
+&&op_40c0_3_t, /* MVSR2 */
+&&op_40d0_3_t, /* MVSR2 */
+&&op_40d8_3_t, /* MVSR2 */
+&&op_40e0_3_t, /* MVSR2 */
+&&op_40e8_3_t, /* MVSR2 */
+&&op_40f0_3_t, /* MVSR2 */
+&&op_40f8_3_t, /* MVSR2 */
+&&op_40f9_3_t, /* MVSR2 */
+&&op_4100_3_t, /* CHK */
+&&op_4110_3_t, /* CHK */
+&&op_4118_3_t, /* CHK */
+&&op_4120_3_t, /* CHK */
+&&op_4128_3_t, /* CHK */
+&&op_4130_3_t, /* CHK */
+&&op_4138_3_t, /* CHK */
+&&op_4139_3_t, /* CHK */
+&&op_413a_3_t, /* CHK */
+&&op_413b_3_t, /* CHK */
+&&op_413c_3_t, /* CHK */
+&&op_4180_3_t, /* CHK */
+&&op_4190_3_t, /* CHK */
+&&op_4198_3_t, /* CHK */
+&&op_41a0_3_t, /* CHK */
+&&op_41a8_3_t, /* CHK */
+&&op_41b0_3_t, /* CHK */
+&&op_41b8_3_t, /* CHK */
+&&op_41b9_3_t, /* CHK */
+&&op_41ba_3_t, /* CHK */
+&&op_41bb_3_t, /* CHK */
+&&op_41bc_3_t, /* CHK */
+&&op_41d0_3_t, /* LEA */
+&&op_41e8_3_t, /* LEA */
+&&op_41f0_3_t, /* LEA */
+&&op_41f8_3_t, /* LEA */
+&&op_41f9_3_t, /* LEA */
+&&op_41fa_3_t, /* LEA */
+&&op_41fb_3_t, /* LEA */
+&&op_4200_3_t, /* CLR */
+&&op_4210_3_t, /* CLR */
+&&op_4218_3_t, /* CLR */
+&&op_4220_3_t, /* CLR */
+&&op_4228_3_t, /* CLR */
+&&op_4230_3_t, /* CLR */
+&&op_4238_3_t, /* CLR */
+&&op_4239_3_t, /* CLR */
+&&op_4240_3_t, /* CLR */
+&&op_4250_3_t, /* CLR */
+&&op_4258_3_t, /* CLR */
+&&op_4260_3_t, /* CLR */
+&&op_4268_3_t, /* CLR */
+&&op_4270_3_t, /* CLR */
+&&op_4278_3_t, /* CLR */
+&&op_4279_3_t, /* CLR */
+&&op_4280_3_t, /* CLR */
+&&op_4290_3_t, /* CLR */
+&&op_4298_3_t, /* CLR */
+&&op_42a0_3_t, /* CLR */
+&&op_42a8_3_t, /* CLR */
+&&op_42b0_3_t, /* CLR */
+&&op_42b8_3_t, /* CLR */
+&&op_42b9_3_t, /* CLR */
+&&op_4400_3_t, /* NEG */
+&&op_4410_3_t, /* NEG */
+&&op_4418_3_t, /* NEG */
+&&op_4420_3_t, /* NEG */
+&&op_4428_3_t, /* NEG */
+&&op_4430_3_t, /* NEG */
+&&op_4438_3_t, /* NEG */
+&&op_4439_3_t, /* NEG */
+&&op_4440_3_t, /* NEG */
+&&op_4450_3_t, /* NEG */
+&&op_4458_3_t, /* NEG */
+&&op_4460_3_t, /* NEG */
+&&op_4468_3_t, /* NEG */
+&&op_4470_3_t, /* NEG */
+&&op_4478_3_t, /* NEG */
+&&op_4479_3_t, /* NEG */
+&&op_4480_3_t, /* NEG */
+&&op_4490_3_t, /* NEG */
+&&op_4498_3_t, /* NEG */
+&&op_44a0_3_t, /* NEG */
+&&op_44a8_3_t, /* NEG */
+&&op_44b0_3_t, /* NEG */
+&&op_44b8_3_t, /* NEG */
+&&op_44b9_3_t, /* NEG */
+&&op_44c0_3_t, /* MV2SR */
+&&op_44d0_3_t, /* MV2SR */
+&&op_44d8_3_t, /* MV2SR */
+&&op_44e0_3_t, /* MV2SR */
+&&op_44e8_3_t, /* MV2SR */
+&&op_44f0_3_t, /* MV2SR */
+&&op_44f8_3_t, /* MV2SR */
+&&op_44f9_3_t, /* MV2SR */
+&&op_44fa_3_t, /* MV2SR */
+&&op_44fb_3_t, /* MV2SR */
+&&op_44fc_3_t, /* MV2SR */
+&&op_4600_3_t, /* NOT */
+&&op_4610_3_t, /* NOT */
+&&op_4618_3_t, /* NOT */
+&&op_4620_3_t, /* NOT */
+&&op_4628_3_t, /* NOT */
+&&op_4630_3_t, /* NOT */
+&&op_4638_3_t, /* NOT */
+&&op_4639_3_t, /* NOT */
+&&op_4640_3_t, /* NOT */
+&&op_4650_3_t, /* NOT */
+&&op_4658_3_t, /* NOT */
+&&op_4660_3_t, /* NOT */
+&&op_4668_3_t, /* NOT */
+&&op_4670_3_t, /* NOT */
+&&op_4678_3_t, /* NOT */
+&&op_4679_3_t, /* NOT */
+&&op_4680_3_t, /* NOT */
+&&op_4690_3_t, /* NOT */
+&&op_4698_3_t, /* NOT */
+&&op_46a0_3_t, /* NOT */
+&&op_46a8_3_t, /* NOT */
+&&op_46b0_3_t, /* NOT */
+&&op_46b8_3_t, /* NOT */
+&&op_46b9_3_t, /* NOT */
+&&op_46c0_3_t, /* MV2SR */
+&&op_46d0_3_t, /* MV2SR */
+&&op_46d8_3_t, /* MV2SR */
+&&op_46e0_3_t, /* MV2SR */
+&&op_46e8_3_t, /* MV2SR */
+&&op_46f0_3_t, /* MV2SR */
+&&op_46f8_3_t, /* MV2SR */
+&&op_46f9_3_t, /* MV2SR */
+&&op_46fa_3_t, /* MV2SR */
+&&op_46fb_3_t, /* MV2SR */
+&&op_46fc_3_t, /* MV2SR */
+&&op_4800_3_t, /* NBCD */
+&&op_4810_3_t, /* NBCD */
+&&op_4818_3_t, /* NBCD */
+&&op_4820_3_t, /* NBCD */
+&&op_4828_3_t, /* NBCD */
+&&op_4830_3_t, /* NBCD */
+&&op_4838_3_t, /* NBCD */
+&&op_4839_3_t, /* NBCD */
+&&op_4840_3_t, /* SWAP */
+&&op_4850_3_t, /* PEA */
+&&op_4868_3_t, /* PEA */
+&&op_4870_3_t, /* PEA */
+&&op_4878_3_t, /* PEA */
+&&op_4879_3_t, /* PEA */
+&&op_487a_3_t, /* PEA */
+&&op_487b_3_t, /* PEA */
+&&op_4880_3_t, /* EXT */
+&&op_4890_3_t, /* MVMLE */
+&&op_48a0_3_t, /* MVMLE */
+&&op_48a8_3_t, /* MVMLE */
+&&op_48b0_3_t, /* MVMLE */
+&&op_48b8_3_t, /* MVMLE */
+&&op_48b9_3_t, /* MVMLE */
+&&op_48c0_3_t, /* EXT */
+&&op_48d0_3_t, /* MVMLE */
+&&op_48e0_3_t, /* MVMLE */
+&&op_48e8_3_t, /* MVMLE */
+&&op_48f0_3_t, /* MVMLE */
+&&op_48f8_3_t, /* MVMLE */
+&&op_48f9_3_t, /* MVMLE */
+&&op_49c0_3_t, /* EXT */
+&&op_4a00_3_t, /* TST */
+&&op_4a10_3_t, /* TST */
+&&op_4a18_3_t, /* TST */
+&&op_4a20_3_t, /* TST */
+&&op_4a28_3_t, /* TST */
+&&op_4a30_3_t, /* TST */
+&&op_4a38_3_t, /* TST */
+&&op_4a39_3_t, /* TST */
+&&op_4a3a_3_t, /* TST */
+&&op_4a3b_3_t, /* TST */
+&&op_4a3c_3_t, /* TST */
+&&op_4a40_3_t, /* TST */
+&&op_4a48_3_t, /* TST */
+&&op_4a50_3_t, /* TST */
+&&op_4a58_3_t, /* TST */
+&&op_4a60_3_t, /* TST */
+&&op_4a68_3_t, /* TST */
+&&op_4a70_3_t, /* TST */
+&&op_4a78_3_t, /* TST */
+&&op_4a79_3_t, /* TST */
+&&op_4a7a_3_t, /* TST */
+&&op_4a7b_3_t, /* TST */
+&&op_4a7c_3_t, /* TST */
+&&op_4a80_3_t, /* TST */
+&&op_4a88_3_t, /* TST */
+&&op_4a90_3_t, /* TST */
+&&op_4a98_3_t, /* TST */
+&&op_4aa0_3_t, /* TST */
+&&op_4aa8_3_t, /* TST */
+&&op_4ab0_3_t, /* TST */
+&&op_4ab8_3_t, /* TST */
+&&op_4ab9_3_t, /* TST */
+&&op_4aba_3_t, /* TST */
+&&op_4abb_3_t, /* TST */
+&&op_4abc_3_t, /* TST */
+&&op_4ac0_3_t, /* TAS */
+&&op_4ad0_3_t, /* TAS */
+&&op_4ad8_3_t, /* TAS */
+&&op_4ae0_3_t, /* TAS */
+&&op_4ae8_3_t, /* TAS */
+&&op_4af0_3_t, /* TAS */
+&&op_4af8_3_t, /* TAS */
+&&op_4af9_3_t, /* TAS */
+&&op_4c90_3_t, /* MVMEL */
+&&op_4c98_3_t, /* MVMEL */
+&&op_4ca8_3_t, /* MVMEL */
+&&op_4cb0_3_t, /* MVMEL */
+&&op_4cb8_3_t, /* MVMEL */
+&&op_4cb9_3_t, /* MVMEL */
+&&op_4cba_3_t, /* MVMEL */
+&&op_4cbb_3_t, /* MVMEL */
+&&op_4cd0_3_t, /* MVMEL */
+&&op_4cd8_3_t, /* MVMEL */
+&&op_4ce8_3_t, /* MVMEL */
+&&op_4cf0_3_t, /* MVMEL */
+&&op_4cf8_3_t, /* MVMEL */
+&&op_4cf9_3_t, /* MVMEL */
+&&op_4cfa_3_t, /* MVMEL */
+&&op_4cfb_3_t, /* MVMEL */
+&&op_4e40_3_t, /* TRAP */
+&&op_4e50_3_t, /* LINK */
+&&op_4e58_3_t, /* UNLK */
+&&op_4e60_3_t, /* MVR2USP */
+&&op_4e68_3_t, /* MVUSP2R */
+&&op_4e70_3_t, /* RESET */
+&&op_4e71_3_t, /* NOP */
+&&op_4e72_3_t, /* STOP */
+&&op_4e73_3_t, /* RTE */
+&&op_4e74_3_t, /* RTD */
+&&op_4e75_3_t, /* RTS */
+&&op_4e76_3_t, /* TRAPV */
+&&op_4e77_3_t, /* RTR */
+&&op_4e90_3_t, /* JSR */
+&&op_4ea8_3_t, /* JSR */
+&&op_4eb0_3_t, /* JSR */
+&&op_4eb8_3_t, /* JSR */
+&&op_4eb9_3_t, /* JSR */
+&&op_4eba_3_t, /* JSR */
+&&op_4ebb_3_t, /* JSR */
+&&op_4ed0_3_t, /* JMP */
+&&op_4ee8_3_t, /* JMP */
+&&op_4ef0_3_t, /* JMP */
+&&op_4ef8_3_t, /* JMP */
+&&op_4ef9_3_t, /* JMP */
+&&op_4efa_3_t, /* JMP */
+&&op_4efb_3_t, /* JMP */
+&&op_5000_3_t, /* ADD */
+&&op_5010_3_t, /* ADD */
+&&op_5018_3_t, /* ADD */
+&&op_5020_3_t, /* ADD */
+&&op_5028_3_t, /* ADD */
+&&op_5030_3_t, /* ADD */
+&&op_5038_3_t, /* ADD */
+&&op_5039_3_t, /* ADD */
+&&op_5040_3_t, /* ADD */
+&&op_5048_3_t, /* ADDA */
+&&op_5050_3_t, /* ADD */
+&&op_5058_3_t, /* ADD */
+&&op_5060_3_t, /* ADD */
+&&op_5068_3_t, /* ADD */
+&&op_5070_3_t, /* ADD */
+&&op_5078_3_t, /* ADD */
+&&op_5079_3_t, /* ADD */
+&&op_5080_3_t, /* ADD */
+&&op_5088_3_t, /* ADDA */
+&&op_5090_3_t, /* ADD */
+&&op_5098_3_t, /* ADD */
+&&op_50a0_3_t, /* ADD */
+&&op_50a8_3_t, /* ADD */
+&&op_50b0_3_t, /* ADD */
+&&op_50b8_3_t, /* ADD */
+&&op_50b9_3_t, /* ADD */
+&&op_50c0_3_t, /* Scc */
+&&op_50c8_3_t, /* DBcc */
+&&op_50d0_3_t, /* Scc */
+&&op_50d8_3_t, /* Scc */
+&&op_50e0_3_t, /* Scc */
+&&op_50e8_3_t, /* Scc */
+&&op_50f0_3_t, /* Scc */
+&&op_50f8_3_t, /* Scc */
+&&op_50f9_3_t, /* Scc */
+&&op_5100_3_t, /* SUB */
+&&op_5110_3_t, /* SUB */
+&&op_5118_3_t, /* SUB */
+&&op_5120_3_t, /* SUB */
+&&op_5128_3_t, /* SUB */
+&&op_5130_3_t, /* SUB */
+&&op_5138_3_t, /* SUB */
+&&op_5139_3_t, /* SUB */
+&&op_5140_3_t, /* SUB */
+&&op_5148_3_t, /* SUBA */
+&&op_5150_3_t, /* SUB */
+&&op_5158_3_t, /* SUB */
+&&op_5160_3_t, /* SUB */
+&&op_5168_3_t, /* SUB */
+&&op_5170_3_t, /* SUB */
+&&op_5178_3_t, /* SUB */
+&&op_5179_3_t, /* SUB */
+&&op_5180_3_t, /* SUB */
+&&op_5188_3_t, /* SUBA */
+&&op_5190_3_t, /* SUB */
+&&op_5198_3_t, /* SUB */
+&&op_51a0_3_t, /* SUB */
+&&op_51a8_3_t, /* SUB */
+&&op_51b0_3_t, /* SUB */
+&&op_51b8_3_t, /* SUB */
+&&op_51b9_3_t, /* SUB */
+&&op_51c0_3_t, /* Scc */
+&&op_51c8_3_t, /* DBcc */
+&&op_51d0_3_t, /* Scc */
+&&op_51d8_3_t, /* Scc */
+&&op_51e0_3_t, /* Scc */
+&&op_51e8_3_t, /* Scc */
+&&op_51f0_3_t, /* Scc */
+&&op_51f8_3_t, /* Scc */
+&&op_51f9_3_t, /* Scc */
+&&op_52c0_3_t, /* Scc */
+&&op_52c8_3_t, /* DBcc */
+&&op_52d0_3_t, /* Scc */
+&&op_52d8_3_t, /* Scc */
+&&op_52e0_3_t, /* Scc */
+&&op_52e8_3_t, /* Scc */
+&&op_52f0_3_t, /* Scc */
+&&op_52f8_3_t, /* Scc */
+&&op_52f9_3_t, /* Scc */
+&&op_53c0_3_t, /* Scc */
+&&op_53c8_3_t, /* DBcc */
+&&op_53d0_3_t, /* Scc */
+&&op_53d8_3_t, /* Scc */
+&&op_53e0_3_t, /* Scc */
+&&op_53e8_3_t, /* Scc */
+&&op_53f0_3_t, /* Scc */
+&&op_53f8_3_t, /* Scc */
+&&op_53f9_3_t, /* Scc */
+&&op_54c0_3_t, /* Scc */
+&&op_54c8_3_t, /* DBcc */
+&&op_54d0_3_t, /* Scc */
+&&op_54d8_3_t, /* Scc */
+&&op_54e0_3_t, /* Scc */
+&&op_54e8_3_t, /* Scc */
+&&op_54f0_3_t, /* Scc */
+&&op_54f8_3_t, /* Scc */
+&&op_54f9_3_t, /* Scc */
+&&op_55c0_3_t, /* Scc */
+&&op_55c8_3_t, /* DBcc */
+&&op_55d0_3_t, /* Scc */
+&&op_55d8_3_t, /* Scc */
+&&op_55e0_3_t, /* Scc */
+&&op_55e8_3_t, /* Scc */
+&&op_55f0_3_t, /* Scc */
+&&op_55f8_3_t, /* Scc */
+&&op_55f9_3_t, /* Scc */
+&&op_56c0_3_t, /* Scc */
+&&op_56c8_3_t, /* DBcc */
+&&op_56d0_3_t, /* Scc */
+&&op_56d8_3_t, /* Scc */
+&&op_56e0_3_t, /* Scc */
+&&op_56e8_3_t, /* Scc */
+&&op_56f0_3_t, /* Scc */
+&&op_56f8_3_t, /* Scc */
+&&op_56f9_3_t, /* Scc */
+&&op_57c0_3_t, /* Scc */
+&&op_57c8_3_t, /* DBcc */
+&&op_57d0_3_t, /* Scc */
+&&op_57d8_3_t, /* Scc */
+&&op_57e0_3_t, /* Scc */
+&&op_57e8_3_t, /* Scc */
+&&op_57f0_3_t, /* Scc */
+&&op_57f8_3_t, /* Scc */
+&&op_57f9_3_t, /* Scc */
+&&op_58c0_3_t, /* Scc */
+&&op_58c8_3_t, /* DBcc */
+&&op_58d0_3_t, /* Scc */
+&&op_58d8_3_t, /* Scc */
+&&op_58e0_3_t, /* Scc */
+&&op_58e8_3_t, /* Scc */
+&&op_58f0_3_t, /* Scc */
+&&op_58f8_3_t, /* Scc */
+&&op_58f9_3_t, /* Scc */
+&&op_59c0_3_t, /* Scc */
+&&op_59c8_3_t, /* DBcc */
+&&op_59d0_3_t, /* Scc */
+&&op_59d8_3_t, /* Scc */
+&&op_59e0_3_t, /* Scc */
+&&op_59e8_3_t, /* Scc */
+&&op_59f0_3_t, /* Scc */
+&&op_59f8_3_t, /* Scc */
+&&op_59f9_3_t, /* Scc */
+&&op_5ac0_3_t, /* Scc */
+&&op_5ac8_3_t, /* DBcc */
+&&op_5ad0_3_t, /* Scc */
+&&op_5ad8_3_t, /* Scc */
+&&op_5ae0_3_t, /* Scc */
+&&op_5ae8_3_t, /* Scc */
+&&op_5af0_3_t, /* Scc */
+&&op_5af8_3_t, /* Scc */
+&&op_5af9_3_t, /* Scc */
+&&op_5bc0_3_t, /* Scc */
+&&op_5bc8_3_t, /* DBcc */
+&&op_5bd0_3_t, /* Scc */
+&&op_5bd8_3_t, /* Scc */
+&&op_5be0_3_t, /* Scc */
+&&op_5be8_3_t, /* Scc */
+&&op_5bf0_3_t, /* Scc */
+&&op_5bf8_3_t, /* Scc */
+&&op_5bf9_3_t, /* Scc */
+&&op_5cc0_3_t, /* Scc */
+&&op_5cc8_3_t, /* DBcc */
+&&op_5cd0_3_t, /* Scc */
+&&op_5cd8_3_t, /* Scc */
+&&op_5ce0_3_t, /* Scc */
+&&op_5ce8_3_t, /* Scc */
+&&op_5cf0_3_t, /* Scc */
+&&op_5cf8_3_t, /* Scc */
+&&op_5cf9_3_t, /* Scc */
+&&op_5dc0_3_t, /* Scc */
+&&op_5dc8_3_t, /* DBcc */
+&&op_5dd0_3_t, /* Scc */
+&&op_5dd8_3_t, /* Scc */
+&&op_5de0_3_t, /* Scc */
+&&op_5de8_3_t, /* Scc */
+&&op_5df0_3_t, /* Scc */
+&&op_5df8_3_t, /* Scc */
+&&op_5df9_3_t, /* Scc */
+&&op_5ec0_3_t, /* Scc */
+&&op_5ec8_3_t, /* DBcc */
+&&op_5ed0_3_t, /* Scc */
+&&op_5ed8_3_t, /* Scc */
+&&op_5ee0_3_t, /* Scc */
+&&op_5ee8_3_t, /* Scc */
+&&op_5ef0_3_t, /* Scc */
+&&op_5ef8_3_t, /* Scc */
+&&op_5ef9_3_t, /* Scc */
+&&op_5fc0_3_t, /* Scc */
+&&op_5fc8_3_t, /* DBcc */
+&&op_5fd0_3_t, /* Scc */
+&&op_5fd8_3_t, /* Scc */
+&&op_5fe0_3_t, /* Scc */
+&&op_5fe8_3_t, /* Scc */
+&&op_5ff0_3_t, /* Scc */
+&&op_5ff8_3_t, /* Scc */
+&&op_5ff9_3_t, /* Scc */
+&&op_6000_3_t, /* Bcc */
+&&op_6001_3_t, /* Bcc */
+&&op_60ff_3_t, /* Bcc */
+&&op_6100_3_t, /* BSR */
+&&op_6101_3_t, /* BSR */
+&&op_61ff_3_t, /* BSR */
+&&op_6200_3_t, /* Bcc */
+&&op_6201_3_t, /* Bcc */
+&&op_62ff_3_t, /* Bcc */
+&&op_6300_3_t, /* Bcc */
+&&op_6301_3_t, /* Bcc */
+&&op_63ff_3_t, /* Bcc */
+&&op_6400_3_t, /* Bcc */
+&&op_6401_3_t, /* Bcc */
+&&op_64ff_3_t, /* Bcc */
+&&op_6500_3_t, /* Bcc */
+&&op_6501_3_t, /* Bcc */
+&&op_65ff_3_t, /* Bcc */
+&&op_6600_3_t, /* Bcc */
+&&op_6601_3_t, /* Bcc */
+&&op_66ff_3_t, /* Bcc */
+&&op_6700_3_t, /* Bcc */
+&&op_6701_3_t, /* Bcc */
+&&op_67ff_3_t, /* Bcc */
+&&op_6800_3_t, /* Bcc */
+&&op_6801_3_t, /* Bcc */
+&&op_68ff_3_t, /* Bcc */
+&&op_6900_3_t, /* Bcc */
+&&op_6901_3_t, /* Bcc */
+&&op_69ff_3_t, /* Bcc */
+&&op_6a00_3_t, /* Bcc */
+&&op_6a01_3_t, /* Bcc */
+&&op_6aff_3_t, /* Bcc */
+&&op_6b00_3_t, /* Bcc */
+&&op_6b01_3_t, /* Bcc */
+&&op_6bff_3_t, /* Bcc */
+&&op_6c00_3_t, /* Bcc */
+&&op_6c01_3_t, /* Bcc */
+&&op_6cff_3_t, /* Bcc */
+&&op_6d00_3_t, /* Bcc */
+&&op_6d01_3_t, /* Bcc */
+&&op_6dff_3_t, /* Bcc */
+&&op_6e00_3_t, /* Bcc */
+&&op_6e01_3_t, /* Bcc */
+&&op_6eff_3_t, /* Bcc */
+&&op_6f00_3_t, /* Bcc */
+&&op_6f01_3_t, /* Bcc */
+&&op_6fff_3_t, /* Bcc */
+&&op_7000_3_t, /* MOVE */
+&&op_8000_3_t, /* OR */
+&&op_8010_3_t, /* OR */
+&&op_8018_3_t, /* OR */
+&&op_8020_3_t, /* OR */
+&&op_8028_3_t, /* OR */
+&&op_8030_3_t, /* OR */
+&&op_8038_3_t, /* OR */
+&&op_8039_3_t, /* OR */
+&&op_803a_3_t, /* OR */
+&&op_803b_3_t, /* OR */
+&&op_803c_3_t, /* OR */
+&&op_8040_3_t, /* OR */
+&&op_8050_3_t, /* OR */
+&&op_8058_3_t, /* OR */
+&&op_8060_3_t, /* OR */
+&&op_8068_3_t, /* OR */
+&&op_8070_3_t, /* OR */
+&&op_8078_3_t, /* OR */
+&&op_8079_3_t, /* OR */
+&&op_807a_3_t, /* OR */
+&&op_807b_3_t, /* OR */
+&&op_807c_3_t, /* OR */
+&&op_8080_3_t, /* OR */
+&&op_8090_3_t, /* OR */
+&&op_8098_3_t, /* OR */
+&&op_80a0_3_t, /* OR */
+&&op_80a8_3_t, /* OR */
+&&op_80b0_3_t, /* OR */
+&&op_80b8_3_t, /* OR */
+&&op_80b9_3_t, /* OR */
+&&op_80ba_3_t, /* OR */
+&&op_80bb_3_t, /* OR */
+&&op_80bc_3_t, /* OR */
+&&op_80c0_3_t, /* DIVU */
+&&op_80d0_3_t, /* DIVU */
+&&op_80d8_3_t, /* DIVU */
+&&op_80e0_3_t, /* DIVU */
+&&op_80e8_3_t, /* DIVU */
+&&op_80f0_3_t, /* DIVU */
+&&op_80f8_3_t, /* DIVU */
+&&op_80f9_3_t, /* DIVU */
+&&op_80fa_3_t, /* DIVU */
+&&op_80fb_3_t, /* DIVU */
+&&op_80fc_3_t, /* DIVU */
+&&op_8100_3_t, /* SBCD */
+&&op_8108_3_t, /* SBCD */
+&&op_8110_3_t, /* OR */
+&&op_8118_3_t, /* OR */
+&&op_8120_3_t, /* OR */
+&&op_8128_3_t, /* OR */
+&&op_8130_3_t, /* OR */
+&&op_8138_3_t, /* OR */
+&&op_8139_3_t, /* OR */
+&&op_8150_3_t, /* OR */
+&&op_8158_3_t, /* OR */
+&&op_8160_3_t, /* OR */
+&&op_8168_3_t, /* OR */
+&&op_8170_3_t, /* OR */
+&&op_8178_3_t, /* OR */
+&&op_8179_3_t, /* OR */
+&&op_8190_3_t, /* OR */
+&&op_8198_3_t, /* OR */
+&&op_81a0_3_t, /* OR */
+&&op_81a8_3_t, /* OR */
+&&op_81b0_3_t, /* OR */
+&&op_81b8_3_t, /* OR */
+&&op_81b9_3_t, /* OR */
+&&op_81c0_3_t, /* DIVS */
+&&op_81d0_3_t, /* DIVS */
+&&op_81d8_3_t, /* DIVS */
+&&op_81e0_3_t, /* DIVS */
+&&op_81e8_3_t, /* DIVS */
+&&op_81f0_3_t, /* DIVS */
+&&op_81f8_3_t, /* DIVS */
+&&op_81f9_3_t, /* DIVS */
+&&op_81fa_3_t, /* DIVS */
+&&op_81fb_3_t, /* DIVS */
+&&op_81fc_3_t, /* DIVS */
+&&op_9000_3_t, /* SUB */
+&&op_9010_3_t, /* SUB */
+&&op_9018_3_t, /* SUB */
+&&op_9020_3_t, /* SUB */
+&&op_9028_3_t, /* SUB */
+&&op_9030_3_t, /* SUB */
+&&op_9038_3_t, /* SUB */
+&&op_9039_3_t, /* SUB */
+&&op_903a_3_t, /* SUB */
+&&op_903b_3_t, /* SUB */
+&&op_903c_3_t, /* SUB */
+&&op_9040_3_t, /* SUB */
+&&op_9048_3_t, /* SUB */
+&&op_9050_3_t, /* SUB */
+&&op_9058_3_t, /* SUB */
+&&op_9060_3_t, /* SUB */
+&&op_9068_3_t, /* SUB */
+&&op_9070_3_t, /* SUB */
+&&op_9078_3_t, /* SUB */
+&&op_9079_3_t, /* SUB */
+&&op_907a_3_t, /* SUB */
+&&op_907b_3_t, /* SUB */
+&&op_907c_3_t, /* SUB */
+&&op_9080_3_t, /* SUB */
+&&op_9088_3_t, /* SUB */
+&&op_9090_3_t, /* SUB */
+&&op_9098_3_t, /* SUB */
+&&op_90a0_3_t, /* SUB */
+&&op_90a8_3_t, /* SUB */
+&&op_90b0_3_t, /* SUB */
+&&op_90b8_3_t, /* SUB */
+&&op_90b9_3_t, /* SUB */
+&&op_90ba_3_t, /* SUB */
+&&op_90bb_3_t, /* SUB */
+&&op_90bc_3_t, /* SUB */
+&&op_90c0_3_t, /* SUBA */
+&&op_90c8_3_t, /* SUBA */
+&&op_90d0_3_t, /* SUBA */
+&&op_90d8_3_t, /* SUBA */
+&&op_90e0_3_t, /* SUBA */
+&&op_90e8_3_t, /* SUBA */
+&&op_90f0_3_t, /* SUBA */
+&&op_90f8_3_t, /* SUBA */
+&&op_90f9_3_t, /* SUBA */
+&&op_90fa_3_t, /* SUBA */
+&&op_90fb_3_t, /* SUBA */
+&&op_90fc_3_t, /* SUBA */
+&&op_9100_3_t, /* SUBX */
+&&op_9108_3_t, /* SUBX */
+&&op_9110_3_t, /* SUB */
+&&op_9118_3_t, /* SUB */
+&&op_9120_3_t, /* SUB */
+&&op_9128_3_t, /* SUB */
+&&op_9130_3_t, /* SUB */
+&&op_9138_3_t, /* SUB */
+&&op_9139_3_t, /* SUB */
+&&op_9140_3_t, /* SUBX */
+&&op_9148_3_t, /* SUBX */
+&&op_9150_3_t, /* SUB */
+&&op_9158_3_t, /* SUB */
+&&op_9160_3_t, /* SUB */
+&&op_9168_3_t, /* SUB */
+&&op_9170_3_t, /* SUB */
+&&op_9178_3_t, /* SUB */
+&&op_9179_3_t, /* SUB */
+&&op_9180_3_t, /* SUBX */
+&&op_9188_3_t, /* SUBX */
+&&op_9190_3_t, /* SUB */
+&&op_9198_3_t, /* SUB */
+&&op_91a0_3_t, /* SUB */
+&&op_91a8_3_t, /* SUB */
+&&op_91b0_3_t, /* SUB */
+&&op_91b8_3_t, /* SUB */
+&&op_91b9_3_t, /* SUB */
+&&op_91c0_3_t, /* SUBA */
+&&op_91c8_3_t, /* SUBA */
+&&op_91d0_3_t, /* SUBA */
+&&op_91d8_3_t, /* SUBA */
+&&op_91e0_3_t, /* SUBA */
+&&op_91e8_3_t, /* SUBA */
+&&op_91f0_3_t, /* SUBA */
+&&op_91f8_3_t, /* SUBA */
+&&op_91f9_3_t, /* SUBA */
+&&op_91fa_3_t, /* SUBA */
+&&op_91fb_3_t, /* SUBA */
+&&op_91fc_3_t, /* SUBA */
+&&op_b000_3_t, /* CMP */
+&&op_b010_3_t, /* CMP */
+&&op_b018_3_t, /* CMP */
+&&op_b020_3_t, /* CMP */
+&&op_b028_3_t, /* CMP */
+&&op_b030_3_t, /* CMP */
+&&op_b038_3_t, /* CMP */
+&&op_b039_3_t, /* CMP */
+&&op_b03a_3_t, /* CMP */
+&&op_b03b_3_t, /* CMP */
+&&op_b03c_3_t, /* CMP */
+&&op_b040_3_t, /* CMP */
+&&op_b048_3_t, /* CMP */
+&&op_b050_3_t, /* CMP */
+&&op_b058_3_t, /* CMP */
+&&op_b060_3_t, /* CMP */
+&&op_b068_3_t, /* CMP */
+&&op_b070_3_t, /* CMP */
+&&op_b078_3_t, /* CMP */
+&&op_b079_3_t, /* CMP */
+&&op_b07a_3_t, /* CMP */
+&&op_b07b_3_t, /* CMP */
+&&op_b07c_3_t, /* CMP */
+&&op_b080_3_t, /* CMP */
+&&op_b088_3_t, /* CMP */
+&&op_b090_3_t, /* CMP */
+&&op_b098_3_t, /* CMP */
+&&op_b0a0_3_t, /* CMP */
+&&op_b0a8_3_t, /* CMP */
+&&op_b0b0_3_t, /* CMP */
+&&op_b0b8_3_t, /* CMP */
+&&op_b0b9_3_t, /* CMP */
+&&op_b0ba_3_t, /* CMP */
+&&op_b0bb_3_t, /* CMP */
+&&op_b0bc_3_t, /* CMP */
+&&op_b0c0_3_t, /* CMPA */
+&&op_b0c8_3_t, /* CMPA */
+&&op_b0d0_3_t, /* CMPA */
+&&op_b0d8_3_t, /* CMPA */
+&&op_b0e0_3_t, /* CMPA */
+&&op_b0e8_3_t, /* CMPA */
+&&op_b0f0_3_t, /* CMPA */
+&&op_b0f8_3_t, /* CMPA */
+&&op_b0f9_3_t, /* CMPA */
+&&op_b0fa_3_t, /* CMPA */
+&&op_b0fb_3_t, /* CMPA */
+&&op_b0fc_3_t, /* CMPA */
+&&op_b100_3_t, /* EOR */
+&&op_b108_3_t, /* CMPM */
+&&op_b110_3_t, /* EOR */
+&&op_b118_3_t, /* EOR */
+&&op_b120_3_t, /* EOR */
+&&op_b128_3_t, /* EOR */
+&&op_b130_3_t, /* EOR */
+&&op_b138_3_t, /* EOR */
+&&op_b139_3_t, /* EOR */
+&&op_b140_3_t, /* EOR */
+&&op_b148_3_t, /* CMPM */
+&&op_b150_3_t, /* EOR */
+&&op_b158_3_t, /* EOR */
+&&op_b160_3_t, /* EOR */
+&&op_b168_3_t, /* EOR */
+&&op_b170_3_t, /* EOR */
+&&op_b178_3_t, /* EOR */
+&&op_b179_3_t, /* EOR */
+&&op_b180_3_t, /* EOR */
+&&op_b188_3_t, /* CMPM */
+&&op_b190_3_t, /* EOR */
+&&op_b198_3_t, /* EOR */
+&&op_b1a0_3_t, /* EOR */
+&&op_b1a8_3_t, /* EOR */
+&&op_b1b0_3_t, /* EOR */
+&&op_b1b8_3_t, /* EOR */
+&&op_b1b9_3_t, /* EOR */
+&&op_b1c0_3_t, /* CMPA */
+&&op_b1c8_3_t, /* CMPA */
+&&op_b1d0_3_t, /* CMPA */
+&&op_b1d8_3_t, /* CMPA */
+&&op_b1e0_3_t, /* CMPA */
+&&op_b1e8_3_t, /* CMPA */
+&&op_b1f0_3_t, /* CMPA */
+&&op_b1f8_3_t, /* CMPA */
+&&op_b1f9_3_t, /* CMPA */
+&&op_b1fa_3_t, /* CMPA */
+&&op_b1fb_3_t, /* CMPA */
+&&op_b1fc_3_t, /* CMPA */
+&&op_c000_3_t, /* AND */
+&&op_c010_3_t, /* AND */
+&&op_c018_3_t, /* AND */
+&&op_c020_3_t, /* AND */
+&&op_c028_3_t, /* AND */
+&&op_c030_3_t, /* AND */
+&&op_c038_3_t, /* AND */
+&&op_c039_3_t, /* AND */
+&&op_c03a_3_t, /* AND */
+&&op_c03b_3_t, /* AND */
+&&op_c03c_3_t, /* AND */
+&&op_c040_3_t, /* AND */
+&&op_c050_3_t, /* AND */
+&&op_c058_3_t, /* AND */
+&&op_c060_3_t, /* AND */
+&&op_c068_3_t, /* AND */
+&&op_c070_3_t, /* AND */
+&&op_c078_3_t, /* AND */
+&&op_c079_3_t, /* AND */
+&&op_c07a_3_t, /* AND */
+&&op_c07b_3_t, /* AND */
+&&op_c07c_3_t, /* AND */
+&&op_c080_3_t, /* AND */
+&&op_c090_3_t, /* AND */
+&&op_c098_3_t, /* AND */
+&&op_c0a0_3_t, /* AND */
+&&op_c0a8_3_t, /* AND */
+&&op_c0b0_3_t, /* AND */
+&&op_c0b8_3_t, /* AND */
+&&op_c0b9_3_t, /* AND */
+&&op_c0ba_3_t, /* AND */
+&&op_c0bb_3_t, /* AND */
+&&op_c0bc_3_t, /* AND */
+&&op_c0c0_3_t, /* MULU */
+&&op_c0d0_3_t, /* MULU */
+&&op_c0d8_3_t, /* MULU */
+&&op_c0e0_3_t, /* MULU */
+&&op_c0e8_3_t, /* MULU */
+&&op_c0f0_3_t, /* MULU */
+&&op_c0f8_3_t, /* MULU */
+&&op_c0f9_3_t, /* MULU */
+&&op_c0fa_3_t, /* MULU */
+&&op_c0fb_3_t, /* MULU */
+&&op_c0fc_3_t, /* MULU */
+&&op_c100_3_t, /* ABCD */
+&&op_c108_3_t, /* ABCD */
+&&op_c110_3_t, /* AND */
+&&op_c118_3_t, /* AND */
+&&op_c120_3_t, /* AND */
+&&op_c128_3_t, /* AND */
+&&op_c130_3_t, /* AND */
+&&op_c138_3_t, /* AND */
+&&op_c139_3_t, /* AND */
+&&op_c140_3_t, /* EXG */
+&&op_c148_3_t, /* EXG */
+&&op_c150_3_t, /* AND */
+&&op_c158_3_t, /* AND */
+&&op_c160_3_t, /* AND */
+&&op_c168_3_t, /* AND */
+&&op_c170_3_t, /* AND */
+&&op_c178_3_t, /* AND */
+&&op_c179_3_t, /* AND */
+&&op_c188_3_t, /* EXG */
+&&op_c190_3_t, /* AND */
+&&op_c198_3_t, /* AND */
+&&op_c1a0_3_t, /* AND */
+&&op_c1a8_3_t, /* AND */
+&&op_c1b0_3_t, /* AND */
+&&op_c1b8_3_t, /* AND */
+&&op_c1b9_3_t, /* AND */
+&&op_c1c0_3_t, /* MULS */
+&&op_c1d0_3_t, /* MULS */
+&&op_c1d8_3_t, /* MULS */
+&&op_c1e0_3_t, /* MULS */
+&&op_c1e8_3_t, /* MULS */
+&&op_c1f0_3_t, /* MULS */
+&&op_c1f8_3_t, /* MULS */
+&&op_c1f9_3_t, /* MULS */
+&&op_c1fa_3_t, /* MULS */
+&&op_c1fb_3_t, /* MULS */
+&&op_c1fc_3_t, /* MULS */
+&&op_d000_3_t, /* ADD */
+&&op_d010_3_t, /* ADD */
+&&op_d018_3_t, /* ADD */
+&&op_d020_3_t, /* ADD */
+&&op_d028_3_t, /* ADD */
+&&op_d030_3_t, /* ADD */
+&&op_d038_3_t, /* ADD */
+&&op_d039_3_t, /* ADD */
+&&op_d03a_3_t, /* ADD */
+&&op_d03b_3_t, /* ADD */
+&&op_d03c_3_t, /* ADD */
+&&op_d040_3_t, /* ADD */
+&&op_d048_3_t, /* ADD */
+&&op_d050_3_t, /* ADD */
+&&op_d058_3_t, /* ADD */
+&&op_d060_3_t, /* ADD */
+&&op_d068_3_t, /* ADD */
+&&op_d070_3_t, /* ADD */
+&&op_d078_3_t, /* ADD */
+&&op_d079_3_t, /* ADD */
+&&op_d07a_3_t, /* ADD */
+&&op_d07b_3_t, /* ADD */
+&&op_d07c_3_t, /* ADD */
+&&op_d080_3_t, /* ADD */
+&&op_d088_3_t, /* ADD */
+&&op_d090_3_t, /* ADD */
+&&op_d098_3_t, /* ADD */
+&&op_d0a0_3_t, /* ADD */
+&&op_d0a8_3_t, /* ADD */
+&&op_d0b0_3_t, /* ADD */
+&&op_d0b8_3_t, /* ADD */
+&&op_d0b9_3_t, /* ADD */
+&&op_d0ba_3_t, /* ADD */
+&&op_d0bb_3_t, /* ADD */
+&&op_d0bc_3_t, /* ADD */
+&&op_d0c0_3_t, /* ADDA */
+&&op_d0c8_3_t, /* ADDA */
+&&op_d0d0_3_t, /* ADDA */
+&&op_d0d8_3_t, /* ADDA */
+&&op_d0e0_3_t, /* ADDA */
+&&op_d0e8_3_t, /* ADDA */
+&&op_d0f0_3_t, /* ADDA */
+&&op_d0f8_3_t, /* ADDA */
+&&op_d0f9_3_t, /* ADDA */
+&&op_d0fa_3_t, /* ADDA */
+&&op_d0fb_3_t, /* ADDA */
+&&op_d0fc_3_t, /* ADDA */
+&&op_d100_3_t, /* ADDX */
+&&op_d108_3_t, /* ADDX */
+&&op_d110_3_t, /* ADD */
+&&op_d118_3_t, /* ADD */
+&&op_d120_3_t, /* ADD */
+&&op_d128_3_t, /* ADD */
+&&op_d130_3_t, /* ADD */
+&&op_d138_3_t, /* ADD */
+&&op_d139_3_t, /* ADD */
+&&op_d140_3_t, /* ADDX */
+&&op_d148_3_t, /* ADDX */
+&&op_d150_3_t, /* ADD */
+&&op_d158_3_t, /* ADD */
+&&op_d160_3_t, /* ADD */
+&&op_d168_3_t, /* ADD */
+&&op_d170_3_t, /* ADD */
+&&op_d178_3_t, /* ADD */
+&&op_d179_3_t, /* ADD */
+&&op_d180_3_t, /* ADDX */
+&&op_d188_3_t, /* ADDX */
+&&op_d190_3_t, /* ADD */
+&&op_d198_3_t, /* ADD */
+&&op_d1a0_3_t, /* ADD */
+&&op_d1a8_3_t, /* ADD */
+&&op_d1b0_3_t, /* ADD */
+&&op_d1b8_3_t, /* ADD */
+&&op_d1b9_3_t, /* ADD */
+&&op_d1c0_3_t, /* ADDA */
+&&op_d1c8_3_t, /* ADDA */
+&&op_d1d0_3_t, /* ADDA */
+&&op_d1d8_3_t, /* ADDA */
+&&op_d1e0_3_t, /* ADDA */
+&&op_d1e8_3_t, /* ADDA */
+&&op_d1f0_3_t, /* ADDA */
+&&op_d1f8_3_t, /* ADDA */
+&&op_d1f9_3_t, /* ADDA */
+&&op_d1fa_3_t, /* ADDA */
+&&op_d1fb_3_t, /* ADDA */
+&&op_d1fc_3_t, /* ADDA */
+&&op_e000_3_t, /* ASR */
+&&op_e008_3_t, /* LSR */
+&&op_e010_3_t, /* ROXR */
+&&op_e018_3_t, /* ROR */
+&&op_e020_3_t, /* ASR */
+&&op_e028_3_t, /* LSR */
+&&op_e030_3_t, /* ROXR */
+&&op_e038_3_t, /* ROR */
+&&op_e040_3_t, /* ASR */
+&&op_e048_3_t, /* LSR */
+&&op_e050_3_t, /* ROXR */
+&&op_e058_3_t, /* ROR */
+&&op_e060_3_t, /* ASR */
+&&op_e068_3_t, /* LSR */
+&&op_e070_3_t, /* ROXR */
+&&op_e078_3_t, /* ROR */
+&&op_e080_3_t, /* ASR */
+&&op_e088_3_t, /* LSR */
+&&op_e090_3_t, /* ROXR */
+&&op_e098_3_t, /* ROR */
+&&op_e0a0_3_t, /* ASR */
+&&op_e0a8_3_t, /* LSR */
+&&op_e0b0_3_t, /* ROXR */
+&&op_e0b8_3_t, /* ROR */
+&&op_e0d0_3_t, /* ASRW */
+&&op_e0d8_3_t, /* ASRW */
+&&op_e0e0_3_t, /* ASRW */
+&&op_e0e8_3_t, /* ASRW */
+&&op_e0f0_3_t, /* ASRW */
+&&op_e0f8_3_t, /* ASRW */
+&&op_e0f9_3_t, /* ASRW */
+&&op_e100_3_t, /* ASL */
+&&op_e108_3_t, /* LSL */
+&&op_e110_3_t, /* ROXL */
+&&op_e118_3_t, /* ROL */
+&&op_e120_3_t, /* ASL */
+&&op_e128_3_t, /* LSL */
+&&op_e130_3_t, /* ROXL */
+&&op_e138_3_t, /* ROL */
+&&op_e140_3_t, /* ASL */
+&&op_e148_3_t, /* LSL */
+&&op_e150_3_t, /* ROXL */
+&&op_e158_3_t, /* ROL */
+&&op_e160_3_t, /* ASL */
+&&op_e168_3_t, /* LSL */
+&&op_e170_3_t, /* ROXL */
+&&op_e178_3_t, /* ROL */
+&&op_e180_3_t, /* ASL */
+&&op_e188_3_t, /* LSL */
+&&op_e190_3_t, /* ROXL */
+&&op_e198_3_t, /* ROL */
+&&op_e1a0_3_t, /* ASL */
+&&op_e1a8_3_t, /* LSL */
+&&op_e1b0_3_t, /* ROXL */
+&&op_e1b8_3_t, /* ROL */
+&&op_e1d0_3_t, /* ASLW */
+&&op_e1d8_3_t, /* ASLW */
+&&op_e1e0_3_t, /* ASLW */
+&&op_e1e8_3_t, /* ASLW */
+&&op_e1f0_3_t, /* ASLW */
+&&op_e1f8_3_t, /* ASLW */
+&&op_e1f9_3_t, /* ASLW */
+&&op_e2d0_3_t, /* LSRW */
+&&op_e2d8_3_t, /* LSRW */
+&&op_e2e0_3_t, /* LSRW */
+&&op_e2e8_3_t, /* LSRW */
+&&op_e2f0_3_t, /* LSRW */
+&&op_e2f8_3_t, /* LSRW */
+&&op_e2f9_3_t, /* LSRW */
+&&op_e3d0_3_t, /* LSLW */
+&&op_e3d8_3_t, /* LSLW */
+&&op_e3e0_3_t, /* LSLW */
+&&op_e3e8_3_t, /* LSLW */
+&&op_e3f0_3_t, /* LSLW */
+&&op_e3f8_3_t, /* LSLW */
+&&op_e3f9_3_t, /* LSLW */
+&&op_e4d0_3_t, /* ROXRW */
+&&op_e4d8_3_t, /* ROXRW */
+&&op_e4e0_3_t, /* ROXRW */
+&&op_e4e8_3_t, /* ROXRW */
+&&op_e4f0_3_t, /* ROXRW */
+&&op_e4f8_3_t, /* ROXRW */
+&&op_e4f9_3_t, /* ROXRW */
+&&op_e5d0_3_t, /* ROXLW */
+&&op_e5d8_3_t, /* ROXLW */
+&&op_e5e0_3_t, /* ROXLW */
+&&op_e5e8_3_t, /* ROXLW */
+&&op_e5f0_3_t, /* ROXLW */
+&&op_e5f8_3_t, /* ROXLW */
+&&op_e5f9_3_t, /* ROXLW */
+&&op_e6d0_3_t, /* RORW */
+&&op_e6d8_3_t, /* RORW */
+&&op_e6e0_3_t, /* RORW */
+&&op_e6e8_3_t, /* RORW */
+&&op_e6f0_3_t, /* RORW */
+&&op_e6f8_3_t, /* RORW */
+&&op_e6f9_3_t, /* RORW */
+&&op_e7d0_3_t, /* ROLW */
+&&op_e7d8_3_t, /* ROLW */
+&&op_e7e0_3_t, /* ROLW */
+&&op_e7e8_3_t, /* ROLW */
+&&op_e7f0_3_t, /* ROLW */
+&&op_e7f8_3_t, /* ROLW */
+&&op_e7f9_3_t, /* ROLW */
+
+#endif
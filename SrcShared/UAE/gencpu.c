@@ -40,6 +40,9 @@ static int cpu_level;
 #define PALM_HEADERS		1	// Changes made to accounts for Poser's header structures
 #define PALM_BUG_FIX		1	// Changes made to fix UAE bugs.
 #define PALM_SYSTEM_CALL	1	// Changes made to track system calls
+#define PALM_THREADED		1	// Changes made to emit a threaded (computed goto) core
+#define PALM_LAZY_FLAGS		1	// Changes made to compute condition codes lazily
+#define PALM_LEAN			1	// Changes made to emit a second table without checking hooks
 
 #if PALM_STACK
 int adda_hack = 0;
@@ -47,6 +50,42 @@ int suba_hack = 0;
 int lea_hack = 0;
 #endif	// PALM_STACK
 
+#if PALM_LAZY_FLAGS
+#define CCTRUE "lazy_cctrue"
+#else	// PALM_LAZY_FLAGS
+#define CCTRUE "cctrue"
+#endif	// PALM_LAZY_FLAGS
+
+#if PALM_THREADED
+/*
+ * When "threaded" is set, generate_one_opcode emits each handler as a
+ * labelled block instead of a function.  The blocks are meant to be
+ * #included inside the CPU loop, which defines THREADED_NEXT to fetch the
+ * next opcode and jump straight to its label.  The table of label
+ * addresses (in the same order as op_smalltbl) goes to stblfile.
+ */
+static int threaded;
+#endif	// PALM_THREADED
+
+#if PALM_LEAN
+/*
+ * When "lean" is set, the handlers are generated without the work that's
+ * only needed for profiling and for the "stack almost full" warning: the
+ * JSR/BSR/RTS/RTE hooks are skipped, and pushes compare A7 against the
+ * overflow limit rather than the warning limit.  The stack overflow and
+ * invalid PC checks are still made.  EmCPU68K switches to this table when
+ * nothing needs the rest.  "hook_suffix" is appended to the names of the
+ * inline helpers that call the JSR/BSR/RTS/RTE hooks, selecting the
+ * variants that don't.
+ */
+static int lean;
+static const char *hook_suffix = "";
+#define STACK_DECREMENT_CHECK	(lean ? "CHECK_STACK_POINTER_OVERFLOW" : "CHECK_STACK_POINTER_DECREMENT")
+#else	// PALM_LEAN
+static const char *hook_suffix = "";
+#define STACK_DECREMENT_CHECK	"CHECK_STACK_POINTER_DECREMENT"
+#endif	// PALM_LEAN
+
 #if PALM_PERF
 static int extraCycles;			// number of clock cycles to do reads+writes+op
 static int readCycles;			// number of read cycles to do something
@@ -522,8 +561,8 @@ static void genamode (amodes mode, char *reg, wordsizes size, char *name, int ge
 	 case Apdi:
 	    printf ("\tm68k_areg (regs, %s) = %sa;\n", reg, name);
 #if PALM_STACK
-		printf ("\tif (%s == 7) CHECK_STACK_POINTER_DECREMENT ();\n",
-			reg, name, name);
+		printf ("\tif (%s == 7) %s ();\n",
+			reg, STACK_DECREMENT_CHECK);
 #endif	// PALM_STACK
 	    break;
 	 default:
@@ -572,14 +611,14 @@ static void genastore (char *from, amodes mode, char *reg, wordsizes size, char
 			printf ("\tif (%s == 7) CHECK_STACK_POINTER_INCREMENT ();\n",
 				reg, reg, from);
 		else if (suba_hack)
-			printf ("\tif (%s == 7) CHECK_STACK_POINTER_DECREMENT ();\n",
-				reg, reg, from);
+			printf ("\tif (%s == 7) %s ();\n",
+				reg, STACK_DECREMENT_CHECK);
 		else if (lea_hack)
 		{
 			printf ("\tif (dstreg == 7) {\n");
 			printf ("\t\tif (srcreg == 7) {\n");
 			printf ("\t\t\tif (prev_dstreg < (%s)) CHECK_STACK_POINTER_INCREMENT ();\n", from);
-			printf ("\t\t\tif (prev_dstreg > (%s)) CHECK_STACK_POINTER_DECREMENT ();\n", from);
+			printf ("\t\t\tif (prev_dstreg > (%s)) %s ();\n", from, STACK_DECREMENT_CHECK);
 			printf ("\t\t} else {\n");
 			printf ("\t\t\tCHECK_STACK_POINTER_ASSIGNMENT ();\n", from);
 			printf ("\t\t}\n");
@@ -717,7 +756,7 @@ static void genmovemle (uae_u16 opcode)
 		size, putcode);
 	printf ("\tm68k_areg(regs, dstreg) = srca;\n");
 #if PALM_STACK
-	printf ("\tCHECK_STACK_POINTER_DECREMENT ();\n");
+	printf ("\t%s ();\n", STACK_DECREMENT_CHECK);
 #endif	// PALM_STACK
     } else {
 	printf ("\tuae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;\n");
@@ -809,6 +848,33 @@ static void genflags_normal (flagtypes type, wordsizes size, char *value, char *
 	break;
     }
 
+#if PALM_LAZY_FLAGS
+    /* These set all of N, Z, V, and C (and X for ADD and SUB), so rather
+       than computing them here, just record the operation.  See the
+       SET_LAZY_FLAGS comments in newcpu.h. */
+    {
+	const char *kind = NULL;
+	const char *lsize = size == sz_byte ? "LAZY_FLAGS_B"
+			  : size == sz_word ? "LAZY_FLAGS_W" : "LAZY_FLAGS_L";
+
+	switch (type) {
+	 case flag_logical: kind = "LAZY_FLAGS_LOGICAL"; break;
+	 case flag_add: kind = "LAZY_FLAGS_ADD"; break;
+	 case flag_sub: kind = "LAZY_FLAGS_SUB"; break;
+	 case flag_cmp: kind = "LAZY_FLAGS_CMP"; break;
+	 default: break;
+	}
+
+	if (kind) {
+	    if (type == flag_logical)
+		printf ("\tSET_LAZY_FLAGS (%s | %s, 0, 0, %s);\n", kind, lsize, value);
+	    else
+		printf ("\tSET_LAZY_FLAGS (%s | %s, %s, %s, %s);\n", kind, lsize, src, dst, value);
+	    return;
+	}
+    }
+#endif	// PALM_LAZY_FLAGS
+
     switch (type) {
      case flag_logical_noclobber:
      case flag_logical:
@@ -1830,9 +1896,9 @@ static void gen_opcode (unsigned long int opcode)
 	    genamode (Aipi, "7", sz_word, "sr", 1, 0);
 	    genamode (Aipi, "7", sz_long, "pc", 1, 0);
 #if PALM_PERF
-		printf ("\tregs.sr = sr; m68k_do_rte(pc);\n");
+		printf ("\tregs.sr = sr; m68k_do_rte%s(pc);\n", hook_suffix);
 #else	// PALM_PERF
-	    printf ("\tregs.sr = sr; m68k_setpc_rte(pc);\n");
+	    printf ("\tregs.sr = sr; m68k_setpc_rte%s(pc);\n", hook_suffix);
 #endif	// PALM_PERF
 	    fill_prefetch_0 ();
 	    printf ("\tMakeFromSR();\n");
@@ -1856,7 +1922,7 @@ static void gen_opcode (unsigned long int opcode)
 	    printf ("\tregs.sr = newsr; MakeFromSR();\n}\n");
 	    pop_braces (old_brace_level);
 	    printf ("\tregs.sr = newsr; MakeFromSR();\n");
-	    printf ("\tm68k_setpc_rte(newpc);\n");
+	    printf ("\tm68k_setpc_rte%s(newpc);\n", hook_suffix);
 	    fill_prefetch_0 ();
 	    need_endlabel = 1;
 	}
@@ -1874,7 +1940,7 @@ static void gen_opcode (unsigned long int opcode)
 #if PALM_STACK
 	printf ("\tCHECK_STACK_POINTER_INCREMENT ();\n");
 #endif	// PALM_STACK
-	printf ("\tm68k_setpc_rte(pc);\n");
+	printf ("\tm68k_setpc_rte%s(pc);\n", hook_suffix);
 	fill_prefetch_0 ();
 	/* PC is set and prefetch filled. */
 	m68k_pc_offset = 0;
@@ -1890,7 +1956,7 @@ static void gen_opcode (unsigned long int opcode)
 	genamode (curi->dmode, "dstreg", curi->size, "offs", 1, 0);
 	printf ("\tm68k_areg(regs, 7) += offs;\n");
 #if PALM_STACK
-	printf ("\tCHECK_STACK_POINTER_DECREMENT ();\n");
+	printf ("\t%s ();\n", STACK_DECREMENT_CHECK);
 #endif	// PALM_STACK
 #if PALM_PERF
 	{extraCycles += 0; readCycles += 1; writeCycles += 0; PERF_COMMENT("LINK 16(2/2)\n");}
@@ -1909,7 +1975,7 @@ static void gen_opcode (unsigned long int opcode)
 #endif	// PALM_PERF
 	break;
      case i_RTS:
-	printf ("\tm68k_do_rts();\n");
+	printf ("\tm68k_do_rts%s();\n", hook_suffix);
 	fill_prefetch_0 ();
 	m68k_pc_offset = 0;
 #if PALM_PERF
@@ -1930,7 +1996,7 @@ static void gen_opcode (unsigned long int opcode)
 	genamode (Aipi, "7", sz_word, "sr", 1, 0);
 	genamode (Aipi, "7", sz_long, "pc", 1, 0);
 	printf ("\tregs.sr &= 0xFF00; sr &= 0xFF;\n");
-	printf ("\tregs.sr |= sr; m68k_setpc(pc);\n");
+	printf ("\tregs.sr |= sr; m68k_setpc%s(pc);\n", hook_suffix);
 	fill_prefetch_0 ();
 	printf ("\tMakeFromSR();\n");
 	m68k_pc_offset = 0;
@@ -1944,7 +2010,7 @@ static void gen_opcode (unsigned long int opcode)
 	if (curi->smode == Aind)
 		printf ("if (!Software_ProcessJSR_Ind (m68k_getpc(), srca))\n");
 #endif	// PALM_SYSTEM_CALL
-	printf ("\tm68k_do_jsr(m68k_getpc() + %d, srca);\n", m68k_pc_offset);
+	printf ("\tm68k_do_jsr%s(m68k_getpc() + %d, srca);\n", hook_suffix, m68k_pc_offset);
 	fill_prefetch_0 ();
 	m68k_pc_offset = 0;
 #if PALM_PERF
@@ -1969,7 +2035,7 @@ static void gen_opcode (unsigned long int opcode)
 	break;
      case i_JMP:
 	genamode (curi->smode, "srcreg", curi->size, "src", 0, 0);
-	printf ("\tm68k_setpc(srca);\n");
+	printf ("\tm68k_setpc%s(srca);\n", hook_suffix);
 	fill_prefetch_0 ();
 	m68k_pc_offset = 0;
 #if PALM_PERF
@@ -1992,7 +2058,7 @@ static void gen_opcode (unsigned long int opcode)
 	    printf ("\t}\n");
 	    need_endlabel = 1;
 	}
-	printf ("\tm68k_do_bsr(m68k_getpc() + %d, s);\n", m68k_pc_offset);
+	printf ("\tm68k_do_bsr%s(m68k_getpc() + %d, s);\n", hook_suffix, m68k_pc_offset);
 	fill_prefetch_0 ();
 	m68k_pc_offset = 0;
 #if PALM_PERF
@@ -2003,7 +2069,7 @@ static void gen_opcode (unsigned long int opcode)
 	if (curi->size == sz_long) {
 	    if (cpu_level < 2) {
 		printf ("\tm68k_incpc(2);\n");
-		printf ("\tif (!cctrue(%d)) goto %s;\n", curi->cc, endlabelstr);
+		printf ("\tif (!" CCTRUE "(%d)) goto %s;\n", curi->cc, endlabelstr);
 		printf ("\t\tlast_addr_for_exception_3 = m68k_getpc() + 2;\n");
 		printf ("\t\tlast_fault_for_exception_3 = m68k_getpc() + 1;\n");
 		printf ("\t\tlast_op_for_exception_3 = opcode; Exception(3,0); goto %s;\n", endlabelstr);
@@ -2014,7 +2080,13 @@ static void gen_opcode (unsigned long int opcode)
 	    }
 	}
 	genamode (curi->smode, "srcreg", curi->size, "src", 1, 0);
-	printf ("\tif (!cctrue(%d)) goto didnt_jump;\n", curi->cc);
+#if PALM_THREADED
+	/* Labels must be unique across all of the threaded handlers. */
+	if (threaded)
+	    printf ("\tif (!" CCTRUE "(%d)) goto didnt_jump%d;\n", curi->cc, endlabelno);
+	else
+#endif	// PALM_THREADED
+	printf ("\tif (!" CCTRUE "(%d)) goto didnt_jump;\n", curi->cc);
 	if (using_exception_3) {
 	    printf ("\tif (src & 1) {\n");
 	    printf ("\t\tlast_addr_for_exception_3 = m68k_getpc() + 2;\n");
@@ -2036,6 +2108,11 @@ static void gen_opcode (unsigned long int opcode)
 	printf ("#endif\n");
 #endif	// PALM_PERF
 	printf ("\tgoto %s;\n", endlabelstr);
+#if PALM_THREADED
+	if (threaded)
+	    printf ("didnt_jump%d:;\n", endlabelno);
+	else
+#endif	// PALM_THREADED
 	printf ("didnt_jump:;\n");
 	need_endlabel = 1;
 #if PALM_PERF
@@ -2085,7 +2162,7 @@ static void gen_opcode (unsigned long int opcode)
 	genamode (curi->smode, "srcreg", curi->size, "src", 1, 0);
 	genamode (curi->dmode, "dstreg", curi->size, "offs", 1, 0);
 
-	printf ("\tif (!cctrue(%d)) {\n", curi->cc);
+	printf ("\tif (!" CCTRUE "(%d)) {\n", curi->cc);
 	genastore ("(src-1)", curi->smode, "srcreg", curi->size, "src");
 
 	printf ("\t\tif (src) {\n");
@@ -2121,7 +2198,7 @@ static void gen_opcode (unsigned long int opcode)
      case i_Scc:
 	genamode (curi->smode, "srcreg", curi->size, "src", 2, 0);
 	start_brace ();
-	printf ("\tint val = cctrue(%d) ? 0xff : 0;\n", curi->cc);
+	printf ("\tint val = " CCTRUE "(%d) ? 0xff : 0;\n", curi->cc);
 #if PALM_PERF
 	if (curi->smode <= Areg)
 	{
@@ -2499,7 +2576,7 @@ static void gen_opcode (unsigned long int opcode)
 	 default: abort ();
 	}
 	printf ("\tcnt &= 63;\n");
-	printf ("\tif (!cnt) { CFLG = 0; } else {");
+	printf ("\tif (!cnt) { SET_CFLG (0); } else {");
 	printf ("\tuae_u32 carry;\n");
 	printf ("\tfor(;cnt;--cnt){\n");
 	printf ("\tcarry=val&1; val = val >> 1;\n");
@@ -2914,7 +2991,7 @@ static void gen_opcode (unsigned long int opcode)
      case i_TRAPcc:
 	if (curi->smode != am_unknown && curi->smode != am_illg)
 	    genamode (curi->smode, "srcreg", curi->size, "dummy", 1, 0);
-	printf ("\tif (cctrue(%d)) { Exception(7,m68k_getpc()); goto %s; }\n", curi->cc, endlabelstr);
+	printf ("\tif (" CCTRUE "(%d)) { Exception(7,m68k_getpc()); goto %s; }\n", curi->cc, endlabelstr);
 	need_endlabel = 1;
 	break;
      case i_DIVL:
@@ -3128,6 +3205,54 @@ static void generate_includes (FILE * f)
 #endif	// PALM_HEADERS
 }
 
+#if PALM_LAZY_FLAGS
+/*
+ * Emit the function that brings regflags up to date from the operation
+ * recorded by SET_LAZY_FLAGS.  This mirrors what genflags_normal emits
+ * for the eager case.
+ */
+static void generate_lazy_flags (void)
+{
+    printf ("#ifdef PART_1\n");
+    printf ("struct lazy_flag_struct regflags_lazy;\n\n");
+    printf ("void flush_lazy_flags (void)\n{\n");
+    printf ("\tuae_u32 kind = regflags_lazy.kind;\n");
+    printf ("\tuae_u32 mask = LAZY_FLAGS_MASK (kind);\n");
+    printf ("\tuae_u32 sign = LAZY_FLAGS_SIGN (kind);\n");
+    printf ("\tuae_u32 src = regflags_lazy.src & mask;\n");
+    printf ("\tuae_u32 dst = regflags_lazy.dst & mask;\n");
+    printf ("\tuae_u32 res = regflags_lazy.res & mask;\n");
+    printf ("\t" BOOL_TYPE " flgs = (src & sign) != 0;\n");
+    printf ("\t" BOOL_TYPE " flgo = (dst & sign) != 0;\n");
+    printf ("\t" BOOL_TYPE " flgn = (res & sign) != 0;\n");
+    printf ("\tregflags_lazy.kind = LAZY_FLAGS_NONE;\n");
+    printf ("\tswitch (kind & LAZY_FLAGS_OP) {\n");
+    printf ("\t case LAZY_FLAGS_LOGICAL:\n");
+    printf ("\t\tCFLG = 0;\n");
+    printf ("\t\tVFLG = 0;\n");
+    printf ("\t\tbreak;\n");
+    printf ("\t case LAZY_FLAGS_ADD:\n");
+    printf ("\t\tVFLG = (flgs ^ flgn) & (flgo ^ flgn);\n");
+    printf ("\t\tCFLG = XFLG = (~dst & mask) < src;\n");
+    printf ("\t\tbreak;\n");
+    printf ("\t case LAZY_FLAGS_SUB:\n");
+    printf ("\t\tVFLG = (flgs ^ flgo) & (flgn ^ flgo);\n");
+    printf ("\t\tCFLG = XFLG = src > dst;\n");
+    printf ("\t\tbreak;\n");
+    printf ("\t case LAZY_FLAGS_CMP:\n");
+    printf ("\t\tVFLG = (flgs != flgo) && (flgn != flgo);\n");
+    printf ("\t\tCFLG = src > dst;\n");
+    printf ("\t\tbreak;\n");
+    printf ("\t default:\n");
+    printf ("\t\treturn;\n");
+    printf ("\t}\n");
+    printf ("\tZFLG = res == 0;\n");
+    printf ("\tNFLG = flgn;\n");
+    printf ("}\n");
+    printf ("#endif\n\n");
+}
+#endif	// PALM_LAZY_FLAGS
+
 static int postfix;
 
 static void generate_one_opcode (int rp)
@@ -3148,6 +3273,12 @@ static void generate_one_opcode (int rp)
     if (table68k[opcode].handler != -1)
 	return;
 
+#if PALM_THREADED
+    if (threaded) {
+	fprintf (stblfile, "&&op_%lx_%d_t, /* %s */\n", opcode, postfix, lookuptab[i].name);
+	printf ("op_%lx_%d_t: /* %s */\n{\n", opcode, postfix, lookuptab[i].name);
+    } else {
+#endif	// PALM_THREADED
 #if PALM_PERF
     if (opcode_next_clev[rp] != cpu_level) {
 	fprintf (stblfile, "{ op_%lx_%d, 0, %ld, %d, %d, %d }, /* %s */\n", opcode, opcode_last_postfix[rp],
@@ -3164,6 +3295,9 @@ static void generate_one_opcode (int rp)
 #endif	// PALM_PERF
     fprintf (headerfile, "extern cpuop_func op_%lx_%d;\n", opcode, postfix);
     printf ("unsigned long REGPARAM2 op_%lx_%d(uae_u32 opcode) /* %s */\n{\n", opcode, postfix, lookuptab[i].name);
+#if PALM_THREADED
+    }
+#endif	// PALM_THREADED
 
     switch (table68k[opcode].stype) {
      case 0: smsk = 7; break;
@@ -3241,6 +3375,13 @@ static void generate_one_opcode (int rp)
     gen_opcode (opcode);
     if (need_endlabel)
 	printf ("%s: ;\n", endlabelstr);
+#if PALM_THREADED
+    if (threaded) {
+	printf ("THREADED_NEXT (%d);\n", insn_n_cycles);
+	printf ("}\n");
+	return;
+    }
+#endif	// PALM_THREADED
     printf ("return %d;\n", insn_n_cycles);
     printf ("}\n");
     opcode_next_clev[rp] = next_cpu_level;
@@ -3264,6 +3405,10 @@ static void generate_func (void)
 #if PALM_MIN
     {
 	i = 3;
+#if PALM_LEAN
+	if (lean)
+	    i = 4;	/* The lean handlers and table use postfix 4. */
+#endif	// PALM_LEAN
 	cpu_level = 0;
     for (rp = 0; rp < nr_cpuop_funcs; rp++)
 	opcode_next_clev[rp] = 0;
@@ -3279,6 +3424,13 @@ static void generate_func (void)
 	}
 #endif	// PALM_MIN
 	postfix = i;
+#if PALM_THREADED
+	if (threaded) {
+	    for (rp = 0; rp < nr_cpuop_funcs; rp++)
+		generate_one_opcode (rp);
+	    return;	/* Only the PALM_MIN level is threaded. */
+	}
+#endif	// PALM_THREADED
 	fprintf (stblfile, "struct cputbl op_smalltbl_%d[] = {\n", postfix);
 
 	/* sam: this is for people with low memory (eg. me :)) */
@@ -3297,6 +3449,13 @@ static void generate_func (void)
 	        "#define PART_7 1\n"
 	        "#define PART_8 1\n"
 	        "#endif\n\n");
+
+#if PALM_LAZY_FLAGS
+#if PALM_LEAN
+	if (!lean)	/* Only one copy; it's shared by both tables. */
+#endif	// PALM_LEAN
+	generate_lazy_flags ();
+#endif	// PALM_LAZY_FLAGS
 	
 	rp = 0;
 	for(j=1;j<=8;++j) {
@@ -3341,6 +3500,55 @@ int main (int argc, char **argv)
 
     generate_func ();
 
+#if PALM_LEAN
+    /*
+     * Generate the handlers again without the checking hooks.  They go
+     * into cpuemulean.c; their table, op_smalltbl_4, is appended to
+     * cpustbl.c and their declarations to cputbl.h.
+     */
+    freopen ("cpuemulean.c", "wb", stdout);
+    generate_includes (stdout);
+
+    lean = 1;
+    hook_suffix = "_lean";
+
+    generate_func ();
+
+    lean = 0;
+    hook_suffix = "";
+#endif	// PALM_LEAN
+
+#if PALM_THREADED
+    /*
+     * Now generate the same handlers again, this time as a fragment for
+     * the threaded CPU loop in EmCPU68K::ExecuteThreaded.  The handler
+     * bodies go first; the label table is collected in a temporary file
+     * and appended in the CPUTHREADED_LABELS section.
+     */
+    {
+	FILE *labelfile = tmpfile ();
+	int c;
+
+	freopen ("cputhreaded.c", "wb", stdout);
+	stblfile = labelfile;
+	threaded = 1;
+
+	printf ("/* Generated by gencpu: threaded form of cpuemu.c.  Do not compile\n"
+		" * on its own; it is #included twice by EmCPU68K::ExecuteThreaded. */\n\n");
+	printf ("#if !defined(CPUTHREADED_LABELS)\n\n");
+
+	generate_func ();
+
+	printf ("\n#else\n\n");
+	rewind (labelfile);
+	while ((c = getc (labelfile)) != EOF)
+	    putchar (c);
+	printf ("\n#endif\n");
+
+	fclose (labelfile);
+    }
+#endif	// PALM_THREADED
+
     free (table68k);
     return 0;
 }
@@ -18,26 +18,155 @@ extern "C" {
 
 #ifndef SET_CFLG
 
-#define SET_CFLG(x) (CFLG = (x))
-#define SET_NFLG(x) (NFLG = (x))
-#define SET_VFLG(x) (VFLG = (x))
-#define SET_ZFLG(x) (ZFLG = (x))
-#define SET_XFLG(x) (XFLG = (x))
-
-#define GET_CFLG CFLG
-#define GET_NFLG NFLG
-#define GET_VFLG VFLG
-#define GET_ZFLG ZFLG
-#define GET_XFLG XFLG
+/*
+ * Lazy condition codes.  Instead of computing N, Z, V, C (and X) after
+ * every MOVE, TST, AND, OR, EOR, ADD, SUB and CMP, the generated handlers
+ * just record the kind and size of the operation along with its operands
+ * and result (see SET_LAZY_FLAGS).  The flags in regflags are brought up
+ * to date by flush_lazy_flags (generated into cpuemu.c) the first time
+ * anything reads or writes one of them through the accessors below.
+ * lazy_cctrue evaluates the common branch conditions straight from the
+ * recorded operation without flushing.
+ *
+ * The ADD and SUB kinds also set X.  Recording an operation that doesn't
+ * set X while one of those is pending first flushes the pending one so
+ * that its X isn't lost.
+ */
+
+#define LAZY_FLAGS_NONE		0x00
+#define LAZY_FLAGS_B		0x01
+#define LAZY_FLAGS_W		0x02
+#define LAZY_FLAGS_L		0x03
+#define LAZY_FLAGS_SIZE		0x03
+
+#define LAZY_FLAGS_LOGICAL	0x04
+#define LAZY_FLAGS_CMP		0x08
+#define LAZY_FLAGS_ADD		(0x0C | LAZY_FLAGS_X)
+#define LAZY_FLAGS_SUB		(0x10 | LAZY_FLAGS_X)
+#define LAZY_FLAGS_OP		0x9C
+#define LAZY_FLAGS_X		0x80
+
+struct lazy_flag_struct {
+    uae_u32 kind;
+    uae_u32 src;
+    uae_u32 dst;
+    uae_u32 res;
+};
+
+extern struct lazy_flag_struct regflags_lazy;
+extern void flush_lazy_flags (void);
+
+#define LAZY_FLAGS_MASK(kind) \
+ (((kind) & LAZY_FLAGS_SIZE) == LAZY_FLAGS_B ? 0xFFUL : \
+  ((kind) & LAZY_FLAGS_SIZE) == LAZY_FLAGS_W ? 0xFFFFUL : 0xFFFFFFFFUL)
+
+#define LAZY_FLAGS_SIGN(kind) \
+ (((kind) & LAZY_FLAGS_SIZE) == LAZY_FLAGS_B ? 0x80UL : \
+  ((kind) & LAZY_FLAGS_SIZE) == LAZY_FLAGS_W ? 0x8000UL : 0x80000000UL)
+
+#define FLUSH_LAZY_FLAGS \
+ (regflags_lazy.kind != LAZY_FLAGS_NONE ? flush_lazy_flags () : (void) 0)
+
+#define SET_LAZY_FLAGS(k, s, d, r) do { \
+ if (((k) & LAZY_FLAGS_X) == 0 && (regflags_lazy.kind & LAZY_FLAGS_X) != 0) \
+  flush_lazy_flags (); \
+ regflags_lazy.kind = (k); \
+ regflags_lazy.src = (uae_u32) (s); \
+ regflags_lazy.dst = (uae_u32) (d); \
+ regflags_lazy.res = (uae_u32) (r); \
+} while (0)
+
+#define SET_CFLG(x) (FLUSH_LAZY_FLAGS, CFLG = (x))
+#define SET_NFLG(x) (FLUSH_LAZY_FLAGS, NFLG = (x))
+#define SET_VFLG(x) (FLUSH_LAZY_FLAGS, VFLG = (x))
+#define SET_ZFLG(x) (FLUSH_LAZY_FLAGS, ZFLG = (x))
+#define SET_XFLG(x) (FLUSH_LAZY_FLAGS, XFLG = (x))
+
+#define GET_CFLG (FLUSH_LAZY_FLAGS, CFLG)
+#define GET_NFLG (FLUSH_LAZY_FLAGS, NFLG)
+#define GET_VFLG (FLUSH_LAZY_FLAGS, VFLG)
+#define GET_ZFLG (FLUSH_LAZY_FLAGS, ZFLG)
+#define GET_XFLG (FLUSH_LAZY_FLAGS, XFLG)
 
 #define CLEAR_CZNV do { \
- SET_CFLG (0); \
- SET_ZFLG (0); \
- SET_NFLG (0); \
- SET_VFLG (0); \
+ FLUSH_LAZY_FLAGS; \
+ CFLG = 0; \
+ ZFLG = 0; \
+ NFLG = 0; \
+ VFLG = 0; \
 } while (0)
 
 #define COPY_CARRY (SET_XFLG (GET_CFLG))
+
+STATIC_INLINE uae_s32 lazy_flags_sext (uae_u32 kind, uae_u32 v)
+{
+    switch (kind & LAZY_FLAGS_SIZE) {
+     case LAZY_FLAGS_B: return (uae_s32) (uae_s8) v;
+     case LAZY_FLAGS_W: return (uae_s32) (uae_s16) v;
+    }
+    return (uae_s32) v;
+}
+
+/* cctrue, but without flushing the flags for the usual conditions. */
+STATIC_INLINE int lazy_cctrue (const int cc)
+{
+    uae_u32 kind = regflags_lazy.kind;
+
+    if (kind != LAZY_FLAGS_NONE) {
+	uae_u32 mask = LAZY_FLAGS_MASK (kind);
+	uae_u32 res = regflags_lazy.res & mask;
+	int zero = res == 0;
+	int neg = (res & LAZY_FLAGS_SIGN (kind)) != 0;
+
+	switch (cc) {
+	 case 0: return 1;                   /* T */
+	 case 1: return 0;                   /* F */
+	 case 6: return !zero;               /* NE */
+	 case 7: return zero;                /* EQ */
+	 case 10: return !neg;               /* PL */
+	 case 11: return neg;                /* MI */
+	}
+
+	switch (kind & LAZY_FLAGS_OP) {
+	 case LAZY_FLAGS_LOGICAL:            /* V and C are clear */
+	    switch (cc) {
+	     case 2: return !zero;           /* HI */
+	     case 3: return zero;            /* LS */
+	     case 4: return 1;               /* CC */
+	     case 5: return 0;               /* CS */
+	     case 8: return 1;               /* VC */
+	     case 9: return 0;               /* VS */
+	     case 12: return !neg;           /* GE */
+	     case 13: return neg;            /* LT */
+	     case 14: return !zero && !neg;  /* GT */
+	     case 15: return zero || neg;    /* LE */
+	    }
+	    break;
+
+	 case LAZY_FLAGS_CMP:                /* res = dst - src */
+	 case LAZY_FLAGS_SUB: {
+	    uae_u32 s = regflags_lazy.src & mask;
+	    uae_u32 d = regflags_lazy.dst & mask;
+	    switch (cc) {
+	     case 2: return d > s;           /* HI */
+	     case 3: return d <= s;          /* LS */
+	     case 4: return d >= s;          /* CC */
+	     case 5: return d < s;           /* CS */
+	     case 12: return lazy_flags_sext (kind, d) >= lazy_flags_sext (kind, s); /* GE */
+	     case 13: return lazy_flags_sext (kind, d) < lazy_flags_sext (kind, s);  /* LT */
+	     case 14: return lazy_flags_sext (kind, d) > lazy_flags_sext (kind, s);  /* GT */
+	     case 15: return lazy_flags_sext (kind, d) <= lazy_flags_sext (kind, s); /* LE */
+	    }
+	    break;
+	 }
+	}
+
+	flush_lazy_flags ();
+    }
+
+    return cctrue (cc);
+}
+
 #endif
 
 extern int areg_byteinc[];
@@ -186,6 +315,12 @@ STATIC_INLINE uaecptr m68k_getpc_p (uae_u8 *p)
 #define m68k_setpc_bcc  m68k_setpc
 #define m68k_setpc_rte  m68k_setpc
 
+/* Used by the lean handlers (op_smalltbl_4).  Setting the PC still runs
+ * the new-PC hooks, which check for an invalid PC. */
+
+#define m68k_setpc_lean      m68k_setpc
+#define m68k_setpc_rte_lean  m68k_setpc
+
 STATIC_INLINE void m68k_setstopped (int stop)
 {
     regs.stopped = stop;
@@ -219,7 +354,7 @@ extern struct cputbl op_smalltbl_1[];
 extern struct cputbl op_smalltbl_2[];
 /* 68000 */
 extern struct cputbl op_smalltbl_3[];
-/* 68000 slow but compatible.  */
+/* 68000 without Poser's checking hooks (see EmCPU68K::UpdateFunctable).  */
 extern struct cputbl op_smalltbl_4[];
 
 extern cpuop_func *cpufunctbl[65536] ASM_SYM_FOR_FUNC ("cpufunctbl");
@@ -23,6 +23,7 @@
 
 #include <errno.h>				// EPERM, ENOENT, etc.
 #include <unistd.h>
+#include <sys/mman.h>			// mmap, munmap, madvise
 #include <sys/time.h>
 #include <sys/stat.h>			// mkdir
 #include <time.h>
@@ -658,6 +659,93 @@ void Platform::RealDisposeMemory (void* p)
 }
 
 
+#if !defined (MAP_ANONYMOUS) && defined (MAP_ANON)
+	#define MAP_ANONYMOUS	MAP_ANON
+#endif
+
+// Huge pages are 2 MB on x86 and most other hosts.  A request for them
+// that isn't a multiple of that is sure to fail, so don't bother.
+
+const size_t	kHugePageSize	= 2 * 1024L * 1024L;
+
+
+// ---------------------------------------------------------------------------
+//		 Platform::AllocateLargeMemory
+// ---------------------------------------------------------------------------
+// Anonymous mappings start out as references to the kernel's zero page, so
+// the parts of the block that are never written to (most of a large RAM
+// image) cost nothing, and we don't have to clear the block ourselves.
+
+void* Platform::AllocateLargeMemory (size_t size, Bool hugePages)
+{
+#if defined (MAP_ANONYMOUS)
+
+	void*	result = MAP_FAILED;
+
+#if defined (MAP_HUGETLB)
+	// Explicit huge pages have to be reserved by the administrator.  If
+	// there aren't enough, fall back to normal pages.
+
+	if (hugePages && (size % kHugePageSize) == 0)
+	{
+		result = mmap (NULL, size, PROT_READ | PROT_WRITE,
+					   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+	}
+#endif
+
+	if (result == MAP_FAILED)
+	{
+		result = mmap (NULL, size, PROT_READ | PROT_WRITE,
+					   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+		if (result == MAP_FAILED)
+		{
+			result = NULL;
+		}
+
+#if defined (MADV_HUGEPAGE)
+		// Ask for transparent huge pages instead.  This is only advice;
+		// ignore any error.
+
+		else if (hugePages && size >= kHugePageSize)
+		{
+			(void) madvise (result, size, MADV_HUGEPAGE);
+		}
+#endif
+	}
+
+	Errors::ThrowIfNULL (result);
+
+	return result;
+
+#else
+
+	UNUSED_PARAM (hugePages);
+
+	return Platform::AllocateMemoryClear (size);
+
+#endif
+}
+
+
+// ---------------------------------------------------------------------------
+//		 Platform::RealDisposeLargeMemory
+// ---------------------------------------------------------------------------
+
+void Platform::RealDisposeLargeMemory (void* p, size_t size)
+{
+	if (p)
+	{
+#if defined (MAP_ANONYMOUS)
+		munmap (p, size);
+#else
+		UNUSED_PARAM (size);
+		Platform::RealDisposeMemory (p);
+#endif
+	}
+}
+
+
 /***********************************************************************
  *
  * FUNCTION:	Platform::ForceStartupScreen